@@ -0,0 +1,446 @@
+/*! \file SpliceArchive.cpp
+*	\brief Splice indexed cue archive class definition.
+*	\details CPP file for definition of class CSpliceArchive whose declaration is in SpliceArchive.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceArchive.hpp"
+#include "SpliceVisitor.hpp"
+#include <algorithm>	//for std::sort, std::lower_bound, std::find
+#include <cstring>		//for std::strcmp
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const int64_t CSpliceArchive::iNoPts;
+
+/*! \brief Function to find a value in an ascending list from a position, moving the position to the first value not below it.
+*
+*	The value is searched from where the previous one was found, doubling the step until it is passed, then bisecting that step
+*	(galloping), so a short list costs about log(long / short) comparisons per value instead of a walk over the long list.
+*	\returns true if the value is at the new position.
+*/
+static bool Gallop(const std::vector<uint64_t>& vLong, std::size_t& iLow, const uint64_t& uValue) {
+	std::size_t iStep = 1;
+	std::size_t iHigh = iLow;
+	while (iHigh < vLong.size() && vLong[iHigh] < uValue) {
+		iLow = iHigh + 1;
+		iHigh += iStep;
+		iStep <<= 1;
+	}
+	iHigh = std::min(iHigh, vLong.size());
+	iLow = (std::size_t)(std::lower_bound(vLong.begin() + iLow, vLong.begin() + iHigh, uValue) - vLong.begin());
+	return iLow < vLong.size() && vLong[iLow] == uValue;
+}
+
+/*! \brief Function to keep the values of vValues also present in a longer ascending list.
+*/
+static void Intersect(std::vector<uint64_t>& vValues, const std::vector<uint64_t>& vLong) {
+	std::size_t iKept = 0;
+	std::size_t iLow = 0;
+	for (std::size_t i = 0;i < vValues.size() && iLow < vLong.size();i++) {
+		if (Gallop(vLong, iLow, vValues[i])) {
+			vValues[iKept++] = vValues[i];
+			iLow++;
+		}
+	}
+	vValues.resize(iKept);
+}
+
+/*! \brief Function to mark the values of vValues present in an ascending list, the marks of earlier lists being kept (a union of conditions).
+*/
+static void MarkPresent(const std::vector<uint64_t>& vValues, const std::vector<uint64_t>& vList, std::vector<uint8_t>& vHits) {
+	std::size_t iLow = 0;
+	for (std::size_t i = 0;i < vValues.size() && iLow < vList.size();i++) {
+		if (Gallop(vList, iLow, vValues[i])) {
+			vHits[i] = 1;
+			iLow++;
+		}
+	}
+}
+
+/*!	\class CSpliceArchive::CRecordVisitor
+*	\brief #CRecordVisitor class posting the splice_event_id values and the segmentation_descriptor values of a walked section.
+*
+*	Only splice_insert, splice_schedule and "CUEI" segmentation_descriptor fields are walked, the other commands and descriptors are skipped.
+*	A cancelled segmentation event posts its segmentation_event_id only, like CSpliceArchive::Add.
+*/
+class CSpliceArchive::CRecordVisitor : public CSpliceVisitor {
+public:
+	/*! \brief #CRecordVisitor class constructor.
+	*	\param objArchive archive receiving the postings.
+	*/
+	explicit CRecordVisitor(CSpliceArchive& objArchive) :
+	 m_objArchive(objArchive),
+	 m_uSequence(0),
+	 m_bSegmentation(false),
+	 m_bCancelled(false)
+	{
+	}
+
+	/*! \brief Function to set the sequence number of the record walked next.
+	*/
+	void SetSequence(const uint64_t& uSequence) {
+		m_uSequence = uSequence;
+		m_bSegmentation = false;
+		m_bCancelled = false;
+	}
+
+	scte35Visit::type OnCommand(const uint32_t& uType, const std::size_t& iOffset, const std::size_t& iLength) override {
+		(void)iOffset;
+		(void)iLength;
+		return uType == scte35Cmd::splice_insert || uType == scte35Cmd::splice_schedule ? scte35Visit::next : scte35Visit::skip;
+	}
+
+	scte35Visit::type OnDescriptor(const uint32_t& uTag, const uint32_t& uIdentifier, const std::size_t& iOffset, const std::size_t& iLength) override {
+		(void)iOffset;
+		(void)iLength;
+		m_bSegmentation = uTag == scte35Desc::segmentation_descriptor && CSpliceClass::IsBuiltInDescriptor(uTag, uIdentifier);
+		m_bCancelled = false;
+		return m_bSegmentation ? scte35Visit::next : scte35Visit::skip;
+	}
+
+	scte35Visit::type OnDescriptorEnd(const uint32_t& uTag) override {
+		(void)uTag;
+		m_bSegmentation = false;
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnField(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) override {
+		(void)iBitOffset;
+		(void)iBits;
+		bool bInserted = false;
+		if (!m_bSegmentation) {
+			//Command fields: the splice_insert event or one splice_schedule event
+			if (std::strcmp(sName, "splice_event_id") == 0) {
+				m_objArchive.Post(m_objArchive.m_mSpliceEvents.Insert((uint32_t)uValue, bInserted), m_uSequence);
+			}
+		}
+		else if (std::strcmp(sName, "segmentation_event_id") == 0) {
+			m_objArchive.Post(m_objArchive.m_mSegmentationEvents.Insert((uint32_t)uValue, bInserted), m_uSequence);
+		}
+		else if (std::strcmp(sName, "segmentation_event_cancel_indicator") == 0) {
+			m_bCancelled = uValue == 1;
+		}
+		else if (std::strcmp(sName, "segmentation_type_id") == 0 && !m_bCancelled) {
+			m_objArchive.Post(m_objArchive.m_vTypes[uValue & 0xFF], m_uSequence);
+		}
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnBytes(const char* sName, const uint8_t* pData, const std::size_t& iLength, const std::size_t& iOffset) override {
+		(void)iOffset;
+		if (m_bSegmentation && !m_bCancelled && iLength > 0 && std::strcmp(sName, "segmentation_upid") == 0) {
+			m_objArchive.m_sUpidKey.assign(reinterpret_cast<const char*>(pData), iLength);
+			m_objArchive.Post(m_objArchive.m_mUpids[m_objArchive.m_sUpidKey], m_uSequence);
+		}
+		return scte35Visit::next;
+	}
+
+private:
+	CSpliceArchive& m_objArchive;		/*!<Archive receiving the postings.*/
+	uint64_t m_uSequence;				/*!<Sequence number of the walked record.*/
+	bool m_bSegmentation;				/*!<Whether the walk is inside a "CUEI" segmentation_descriptor.*/
+	bool m_bCancelled;					/*!<Whether the segmentation_descriptor walked cancels its event.*/
+};
+
+CSpliceArchive::CSpliceArchive() :
+m_mSegmentationEvents(),
+m_mSpliceEvents(),
+m_mUpids(),
+m_mChannels(),
+m_uFirstSequence(0),
+m_uNextSequence(0),
+m_vReceiveTimes(),
+m_vPts(),
+m_bReceiveOrdered(true),
+m_iPostings(0),
+m_sUpidKey()
+{
+
+}
+
+void CSpliceArchive::Post(std::vector<uint64_t>& vList, const uint64_t& uSequence) {
+	//A cue with two descriptors of the same value is listed once
+	if (vList.empty() || vList.back() != uSequence) {
+		vList.push_back(uSequence);
+		m_iPostings++;
+	}
+}
+
+bool CSpliceArchive::AddRecord(const uint64_t& uSequence, const uint64_t& uChannel, const uint64_t& uReceiveTime, const bool& bPts, const uint64_t& uPts) {
+	if (m_vReceiveTimes.empty()) {
+		m_uFirstSequence = uSequence;
+	}
+	else if (uSequence != m_uNextSequence) {
+		return false;
+	}
+	m_uNextSequence = uSequence + 1;
+
+	if (!m_vReceiveTimes.empty() && uReceiveTime < m_vReceiveTimes.back()) {
+		m_bReceiveOrdered = false;
+	}
+	m_vReceiveTimes.push_back(uReceiveTime);
+	bool bInserted = false;
+	SArchiveChannel& objChannel = m_mChannels.Insert(uChannel, bInserted);
+	Post(objChannel.vRecords, uSequence);
+	m_vPts.push_back(bPts ? objChannel.objUnwrapper.Unwrap(uPts) : iNoPts);
+	return true;
+}
+
+bool CSpliceArchive::Add(const uint64_t& uSequence, const uint64_t& uChannel, const uint64_t& uReceiveTime, const CSpliceClass* pCue) {
+	const bool bParsed = pCue != nullptr && pCue->GetLastError() == scte35Error::none;
+	uint64_t uPts = 0;
+	const bool bPts = bParsed && CSpliceTimeline::GetCuePts(*pCue, uPts);
+	if (!AddRecord(uSequence, uChannel, uReceiveTime, bPts, uPts)) {
+		return false;
+	}
+	if (!bParsed) {
+		return true;
+	}
+
+	bool bInserted = false;
+	const uint32_t uCommand = pCue->GetSInfoData().splice_command_type;
+	if (uCommand == scte35Cmd::splice_insert) {
+		Post(m_mSpliceEvents.Insert(pCue->GetSpliceInsert().splice_event_id, bInserted), uSequence);
+	}
+	else if (uCommand == scte35Cmd::splice_schedule) {
+		const std::vector<SpliceScheduleChild>& vEvents = pCue->GetSpliceSchedule().v_childs;
+		for (std::size_t i = 0;i < vEvents.size();i++) {
+			Post(m_mSpliceEvents.Insert(vEvents[i].splice_event_id, bInserted), uSequence);
+		}
+	}
+
+	const std::vector<SDBase*>& vDescriptors = pCue->GetDescriptors();
+	for (std::size_t i = 0;i < vDescriptors.size();i++) {
+		if (vDescriptors[i]->splice_descriptor_tag != scte35Desc::segmentation_descriptor || !CSpliceClass::IsBuiltInDescriptor(*vDescriptors[i])) {
+			continue;
+		}
+		const SegmentationDescriptor& objSegmentation = *static_cast<const SegmentationDescriptor*>(vDescriptors[i]);
+		Post(m_mSegmentationEvents.Insert(objSegmentation.segmentation_event_id, bInserted), uSequence);
+		if (objSegmentation.segmentation_event_cancel_indicator == 0) {
+			Post(m_vTypes[objSegmentation.segmentation_type_id & 0xFF], uSequence);
+			if (!objSegmentation.v_upid_list.empty()) {
+				m_sUpidKey.assign(objSegmentation.v_upid_list.begin(), objSegmentation.v_upid_list.end());
+				Post(m_mUpids[m_sUpidKey], uSequence);
+			}
+		}
+	}
+	return true;
+}
+
+bool CSpliceArchive::IndexJournal(const CSpliceJournalReader& objReader, std::size_t& iIndexed) {
+	iIndexed = 0;
+	std::size_t iStart = 0;
+	if (!m_vReceiveTimes.empty()) {
+		//Records indexed by an earlier call are skipped, so a growing journal can be indexed again after reopening it; a journal numbering
+		//its records again (a rotation not continuing the sequence) or leaving a gap would mix up or lose records, so it is refused
+		const uint64_t uFirst = objReader.GetFirstSequence();
+		if (uFirst > m_uNextSequence) {
+			return false;
+		}
+		if (uFirst < m_uNextSequence) {
+			//The last record shared with the archive must be the indexed one
+			const uint64_t uEnd = uFirst + objReader.GetCount();
+			const uint64_t uShared = std::min(uEnd, m_uNextSequence) - 1;
+			SJournalRecord objShared;
+			if (uEnd == uFirst || uShared < m_uFirstSequence || !objReader.FindRecord(uShared, objShared) || objShared.uReceiveTime != m_vReceiveTimes[(std::size_t)(uShared - m_uFirstSequence)]) {
+				return false;
+			}
+		}
+		iStart = (std::size_t)(m_uNextSequence - uFirst);
+	}
+
+	//The summary gives the splice time and the walk the posted values, straight from the mapped section bytes
+	CRecordVisitor objVisitor(*this);
+	SJournalRecord objRecord;
+	for (std::size_t i = iStart;objReader.GetRecord(i, objRecord);i++) {
+		const SJournalSummary& objSummary = objRecord.objSummary;
+		const bool bParsed = (objSummary.uFlags & SJournalSummary::uParsed) != 0;
+		AddRecord(objRecord.uSequence, objRecord.uChannel, objRecord.uReceiveTime, bParsed && (objSummary.uFlags & SJournalSummary::uHasPts) != 0, objSummary.uPts);
+		if (bParsed) {
+			objVisitor.SetSequence(objRecord.uSequence);
+			CSpliceWalker::Walk(objRecord.pSection, objRecord.iLength, objVisitor);
+		}
+		iIndexed++;
+	}
+	return true;
+}
+
+bool CSpliceArchive::IsInRanges(const SArchiveQuery& objQuery, const uint64_t& uSequence) const {
+	const std::size_t iIndex = (std::size_t)(uSequence - m_uFirstSequence);
+	if (objQuery.bReceiveTime && (m_vReceiveTimes[iIndex] < objQuery.uReceiveBegin || m_vReceiveTimes[iIndex] >= objQuery.uReceiveEnd)) {
+		return false;
+	}
+	if (objQuery.bPts && (m_vPts[iIndex] == iNoPts || m_vPts[iIndex] < objQuery.iPtsBegin || m_vPts[iIndex] >= objQuery.iPtsEnd)) {
+		return false;
+	}
+	return true;
+}
+
+std::size_t CSpliceArchive::Query(const SArchiveQuery& objQuery, std::vector<uint64_t>& vSequences) const {
+	vSequences.clear();
+	if (m_vReceiveTimes.empty() || (objQuery.bPts && !objQuery.bChannel)) {
+		return 0;
+	}
+
+	//Posting lists of the conditions, a condition without a list has no match
+	std::vector<const std::vector<uint64_t>*> vLists;
+	if (objQuery.bChannel) {
+		const SArchiveChannel* pChannel = m_mChannels.Find(objQuery.uChannel);
+		if (pChannel == nullptr) {
+			return 0;
+		}
+		vLists.push_back(&pChannel->vRecords);
+	}
+	if (objQuery.bSegmentationEventId) {
+		vLists.push_back(m_mSegmentationEvents.Find(objQuery.uSegmentationEventId));
+	}
+	if (objQuery.bSpliceEventId) {
+		vLists.push_back(m_mSpliceEvents.Find(objQuery.uSpliceEventId));
+	}
+	if (objQuery.bUpid) {
+		auto itUpid = m_mUpids.find(std::string(objQuery.vUpid.begin(), objQuery.vUpid.end()));
+		vLists.push_back(itUpid == m_mUpids.end() ? nullptr : &itUpid->second);
+	}
+	for (std::size_t i = 0;i < vLists.size();i++) {
+		if (vLists[i] == nullptr) {
+			return 0;
+		}
+	}
+
+	//Several segmentation types are one condition met by any of their lists, none of which is merged
+	std::vector<const std::vector<uint64_t>*> vTypes;
+	for (std::size_t i = 0;i < objQuery.vSegmentationTypes.size();i++) {
+		const std::vector<uint64_t>* pType = &m_vTypes[objQuery.vSegmentationTypes[i] & 0xFF];
+		if (!pType->empty() && std::find(vTypes.begin(), vTypes.end(), pType) == vTypes.end()) {
+			vTypes.push_back(pType);
+		}
+	}
+	if (!objQuery.vSegmentationTypes.empty() && vTypes.empty()) {
+		return 0;
+	}
+	if (vTypes.size() == 1) {
+		vLists.push_back(vTypes[0]);
+		vTypes.clear();
+	}
+
+	//Ordered receive times turn the receive range into a sequence range, which bounds the candidates before any intersection
+	uint64_t uLow = m_uFirstSequence;
+	uint64_t uHigh = m_uNextSequence;
+	bool bReceiveChecked = false;
+	if (objQuery.bReceiveTime && m_bReceiveOrdered) {
+		uLow = m_uFirstSequence + (uint64_t)(std::lower_bound(m_vReceiveTimes.begin(), m_vReceiveTimes.end(), objQuery.uReceiveBegin) - m_vReceiveTimes.begin());
+		uHigh = m_uFirstSequence + (uint64_t)(std::lower_bound(m_vReceiveTimes.begin(), m_vReceiveTimes.end(), objQuery.uReceiveEnd) - m_vReceiveTimes.begin());
+		bReceiveChecked = true;
+	}
+	SArchiveQuery objRanges = objQuery;
+	objRanges.bReceiveTime = objQuery.bReceiveTime && !bReceiveChecked;
+	const bool bRanges = objRanges.bReceiveTime || objRanges.bPts;
+
+	if (vLists.empty() && !vTypes.empty()) {
+		//Only segmentation types: walk their lists side by side, taking the smallest sequence number of them each time
+		std::vector<std::size_t> vPositions(vTypes.size());
+		for (std::size_t i = 0;i < vTypes.size();i++) {
+			vPositions[i] = (std::size_t)(std::lower_bound(vTypes[i]->begin(), vTypes[i]->end(), uLow) - vTypes[i]->begin());
+		}
+		for (;;) {
+			uint64_t uSequence = uHigh;
+			for (std::size_t i = 0;i < vTypes.size();i++) {
+				if (vPositions[i] < vTypes[i]->size()) {
+					uSequence = std::min(uSequence, (*vTypes[i])[vPositions[i]]);
+				}
+			}
+			if (uSequence >= uHigh) {
+				break;
+			}
+			for (std::size_t i = 0;i < vTypes.size();i++) {
+				if (vPositions[i] < vTypes[i]->size() && (*vTypes[i])[vPositions[i]] == uSequence) {
+					vPositions[i]++;
+				}
+			}
+			if (!bRanges || IsInRanges(objRanges, uSequence)) {
+				vSequences.push_back(uSequence);
+				if (vSequences.size() == objQuery.iLimit) {
+					break;
+				}
+			}
+		}
+		return vSequences.size();
+	}
+	if (vLists.empty()) {
+		for (uint64_t uSequence = uLow;uSequence < uHigh;uSequence++) {
+			if (!bRanges || IsInRanges(objRanges, uSequence)) {
+				vSequences.push_back(uSequence);
+				if (vSequences.size() == objQuery.iLimit) {
+					break;
+				}
+			}
+		}
+		return vSequences.size();
+	}
+
+	//Shortest list first: the candidates only shrink, and every other list is galloped through
+	std::sort(vLists.begin(), vLists.end(), [](const std::vector<uint64_t>* pA, const std::vector<uint64_t>* pB) {
+		return pA->size() < pB->size();
+	});
+	const std::vector<uint64_t>& vShortest = *vLists[0];
+	vSequences.assign(std::lower_bound(vShortest.begin(), vShortest.end(), uLow), std::lower_bound(vShortest.begin(), vShortest.end(), uHigh));
+	for (std::size_t i = 1;i < vLists.size() && !vSequences.empty();i++) {
+		Intersect(vSequences, *vLists[i]);
+	}
+
+	//The survivors are galloped through each segmentation type list, a survivor found in any of them is kept
+	if (!vTypes.empty() && !vSequences.empty()) {
+		std::vector<uint8_t> vHits(vSequences.size(), 0);
+		for (std::size_t i = 0;i < vTypes.size();i++) {
+			MarkPresent(vSequences, *vTypes[i], vHits);
+		}
+		std::size_t iHit = 0;
+		for (std::size_t i = 0;i < vSequences.size();i++) {
+			if (vHits[i] != 0) {
+				vSequences[iHit++] = vSequences[i];
+			}
+		}
+		vSequences.resize(iHit);
+	}
+
+	std::size_t iKept = 0;
+	for (std::size_t i = 0;i < vSequences.size() && (objQuery.iLimit == 0 || iKept < objQuery.iLimit);i++) {
+		if (!bRanges || IsInRanges(objRanges, vSequences[i])) {
+			vSequences[iKept++] = vSequences[i];
+		}
+	}
+	vSequences.resize(iKept);
+	return iKept;
+}
+
+bool CSpliceArchive::GetChannelTime(const uint64_t& uChannel, const uint64_t& uPts, int64_t& iTime) const {
+	const SArchiveChannel* pChannel = m_mChannels.Find(uChannel);
+	if (pChannel == nullptr || !pChannel->objUnwrapper.HasValue()) {
+		return false;
+	}
+	iTime = pChannel->objUnwrapper.GetNearest(uPts);
+	return true;
+}
+
+void CSpliceArchive::Clear() {
+	for (std::size_t i = 0;i < 256;i++) {
+		m_vTypes[i].clear();
+	}
+	m_mSegmentationEvents.Clear();
+	m_mSpliceEvents.Clear();
+	m_mUpids.clear();
+	m_mChannels.Clear();
+	m_uFirstSequence = 0;
+	m_uNextSequence = 0;
+	m_vReceiveTimes.clear();
+	m_vPts.clear();
+	m_bReceiveOrdered = true;
+	m_iPostings = 0;
+}
+
+};
@@ -0,0 +1,197 @@
+/*! \file SpliceArchive.hpp
+*	\brief Splice indexed cue archive classes declaration.
+*	\details Header file for declaration of classes SArchiveQuery and CSpliceArchive whose definition is in SpliceArchive.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEARCHIVE_HPP_
+/*! \brief SpliceArchive.hpp header guard define.
+*/
+#define _SPLICEARCHIVE_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include "SpliceJournal.hpp"
+#include "SpliceTimeline.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class SArchiveQuery
+*	\brief #SArchiveQuery class holding the conditions of a #CSpliceArchive query, all of which a record must meet.
+*
+*	Conditions are evaluated per record: a cue carrying two segmentation_descriptors may meet the type condition with one and the
+*	event condition with the other.
+*/
+class SArchiveQuery {
+public:
+	std::vector<uint32_t> vSegmentationTypes;	/*!<segmentation_type_id values of which the record must carry one, empty for any.*/
+	bool bSegmentationEventId;					/*!<Whether uSegmentationEventId is a condition.*/
+	uint32_t uSegmentationEventId;				/*!<segmentation_event_id the record must carry.*/
+	bool bSpliceEventId;						/*!<Whether uSpliceEventId is a condition.*/
+	uint32_t uSpliceEventId;					/*!<splice_event_id (splice_insert or splice_schedule) the record must carry.*/
+	bool bUpid;									/*!<Whether vUpid is a condition.*/
+	std::vector<uint8_t> vUpid;					/*!<segmentation_upid bytes the record must carry.*/
+	bool bChannel;								/*!<Whether uChannel is a condition.*/
+	uint64_t uChannel;							/*!<Channel of the record.*/
+	bool bReceiveTime;							/*!<Whether the receive time range is a condition.*/
+	uint64_t uReceiveBegin;						/*!<First receive time of the range.*/
+	uint64_t uReceiveEnd;						/*!<Receive time after the range.*/
+	bool bPts;									/*!<Whether the splice time range is a condition, needs bChannel.*/
+	int64_t iPtsBegin;							/*!<First splice time of the range, unwrapped on the channel (see CSpliceArchive::GetChannelTime).*/
+	int64_t iPtsEnd;							/*!<Splice time after the range.*/
+	std::size_t iLimit;							/*!<Largest number of results, 0 for all.*/
+
+	/*! \brief #SArchiveQuery class default constructor with intializer list (no condition).
+	*/
+	SArchiveQuery() :
+	 vSegmentationTypes(),
+	 bSegmentationEventId(false),
+	 uSegmentationEventId(PARAMETER_DEF_VAL),
+	 bSpliceEventId(false),
+	 uSpliceEventId(PARAMETER_DEF_VAL),
+	 bUpid(false),
+	 vUpid(),
+	 bChannel(false),
+	 uChannel(PARAMETER_DEF_VAL),
+	 bReceiveTime(false),
+	 uReceiveBegin(PARAMETER_DEF_VAL),
+	 uReceiveEnd(PARAMETER_DEF_VAL),
+	 bPts(false),
+	 iPtsBegin(PARAMETER_DEF_VAL),
+	 iPtsEnd(PARAMETER_DEF_VAL),
+	 iLimit(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSpliceArchive
+*	\brief #CSpliceArchive class indexes stored cues by segmentation type, segmentation and splice event, UPID, channel and time, and answers
+*	queries combining them.
+*
+*	Every index is a set of posting lists: ascending sequence numbers (see SJournalRecord::uSequence) of the records carrying a value.
+*	A query takes the lists of its conditions and intersects them from the shortest, galloping through the longer ones, so its cost
+*	follows the shortest list and not the archive size; the segmentation types of a query are galloped one by one against the survivors.
+*	Receive time and splice time are kept per record and checked on the survivors. Records are indexed once, by #IndexJournal or #Add
+*	in sequence order, then only their sequence numbers are handled: the records of the results are read from the journal
+*	(CSpliceJournalReader::FindRecord). Sequence numbers are the key, so the journals of a rotation must continue each other's numbers
+*	(see CSpliceJournalWriter::Open); a journal that does not is refused.
+*/
+class CSpliceArchive {
+public:
+	/*! \brief #CSpliceArchive class default constructor.
+	*/
+	CSpliceArchive();
+
+	/*!	\brief Deleted copy constructor so #CSpliceArchive class object cannot be copied.
+	*/
+	CSpliceArchive(const CSpliceArchive&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceArchive class object cannot be assigned.
+	*/
+	void operator=(const CSpliceArchive&) = delete;
+
+	/*! \brief Function to index a record.
+	*	\param uSequence sequence number, following the one of the previous record (the sequence numbers of a journal are consecutive).
+	*	\param uChannel channel identifier.
+	*	\param uReceiveTime receive time.
+	*	\param pCue parser after the parse of the record, nullptr (or a failed parse) indexes channel and receive time only.
+	*	\returns true if indexed and false if uSequence does not follow the previous one.
+	*/
+	bool Add(const uint64_t& uSequence, const uint64_t& uChannel, const uint64_t& uReceiveTime, const CSpliceClass* pCue);
+
+	/*! \brief Function to index the records of a journal not indexed yet, walking the section bytes of each of them once.
+	*
+	*	The journal continues the archive when its first record follows the last indexed one, or when the last record it shares with the
+	*	archive has the indexed receive time (a journal indexed before, or a growing one opened again); a journal starting after a gap, or
+	*	numbering its records again, is refused.
+	*	\param objReader open journal.
+	*	\param iIndexed receives the number of records indexed.
+	*	\returns true if the journal continues the archive and false, indexing nothing, if it does not.
+	*/
+	bool IndexJournal(const CSpliceJournalReader& objReader, std::size_t& iIndexed);
+
+	/*! \brief Function to run a query.
+	*	\param objQuery conditions.
+	*	\param vSequences receives the ascending sequence numbers of the matching records.
+	*	\returns number of matching records (at most SArchiveQuery::iLimit).
+	*/
+	std::size_t Query(const SArchiveQuery& objQuery, std::vector<uint64_t>& vSequences) const;
+
+	/*! \brief Function to place a 33-bit splice time on the unwrapped time line of a channel, for SArchiveQuery::iPtsBegin and iPtsEnd.
+	*	\param uChannel channel identifier.
+	*	\param uPts 33-bit 90 kHz value.
+	*	\param iTime receives the unwrapped time nearest to the last splice time of the channel.
+	*	\returns true if the channel has splice times.
+	*/
+	bool GetChannelTime(const uint64_t& uChannel, const uint64_t& uPts, int64_t& iTime) const;
+
+	/*! \brief Function to get the number of indexed records.
+	*/
+	std::size_t GetRecordCount() const { return m_vReceiveTimes.size(); }
+
+	/*! \brief Function to get the number of entries of all the posting lists.
+	*/
+	std::size_t GetPostingCount() const { return m_iPostings; }
+
+	/*! \brief Function to remove every record.
+	*/
+	void Clear();
+
+private:
+	/*!	\class SArchiveChannel
+	*	\brief #SArchiveChannel class holding the records and the splice time line of one channel.
+	*/
+	class SArchiveChannel {
+	public:
+		std::vector<uint64_t> vRecords;		/*!<Posting list of the channel.*/
+		CPtsUnwrapper objUnwrapper;			/*!<Unwrapper of the splice times of the channel.*/
+	};
+
+	/*!	\class CRecordVisitor
+	*	\brief #CRecordVisitor class posting the events and segmentation values of a walked section, defined in SpliceArchive.cpp.
+	*/
+	class CRecordVisitor;
+
+	/*! \brief Function to append a record to a posting list once.
+	*/
+	void Post(std::vector<uint64_t>& vList, const uint64_t& uSequence);
+
+	/*! \brief Function to check the sequence number of a record and index its channel, receive time and splice time.
+	*	\returns true if indexed and false if uSequence does not follow the previous one.
+	*/
+	bool AddRecord(const uint64_t& uSequence, const uint64_t& uChannel, const uint64_t& uReceiveTime, const bool& bPts, const uint64_t& uPts);
+
+	/*! \brief Function to check the per-record conditions (receive time, splice time) of a record.
+	*/
+	bool IsInRanges(const SArchiveQuery& objQuery, const uint64_t& uSequence) const;
+
+	/*! \brief Splice time of the records without one.
+	*/
+	static const int64_t iNoPts = INT64_MIN;
+
+	std::vector<uint64_t> m_vTypes[256];									/*!<Posting lists by segmentation_type_id.*/
+	CSpliceHashMap<std::vector<uint64_t>> m_mSegmentationEvents;			/*!<Posting lists by segmentation_event_id.*/
+	CSpliceHashMap<std::vector<uint64_t>> m_mSpliceEvents;					/*!<Posting lists by splice_event_id.*/
+	std::unordered_map<std::string, std::vector<uint64_t>> m_mUpids;		/*!<Posting lists by segmentation_upid bytes.*/
+	CSpliceHashMap<SArchiveChannel> m_mChannels;							/*!<Posting lists and time lines by channel.*/
+	uint64_t m_uFirstSequence;												/*!<Sequence number of the first record.*/
+	uint64_t m_uNextSequence;												/*!<Sequence number accepted by the next #Add.*/
+	std::vector<uint64_t> m_vReceiveTimes;									/*!<Receive time of every sequence number from m_uFirstSequence.*/
+	std::vector<int64_t> m_vPts;											/*!<Unwrapped splice time of every sequence number, iNoPts if none.*/
+	bool m_bReceiveOrdered;													/*!<Whether receive times never decrease with the sequence numbers.*/
+	std::size_t m_iPostings;												/*!<Entries of all the posting lists.*/
+	std::string m_sUpidKey;													/*!<Key buffer of the UPID index.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,445 @@
+/*! \file SpliceBitKernel.cpp
+*	\brief Splice multi-field extraction kernels class definition.
+*	\details CPP file for definition of class CSpliceBitKernel whose declaration is in SpliceBitKernel.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceBitKernel.hpp"
+#include "SpliceLayout.hpp"
+#include <array>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+/*! \brief Defined when the BMI2 kernel is compiled in (GCC and Clang on x86-64, selected at run time).
+*/
+#define SCTE35_BMI2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Layout of the splice_info_section header cluster.
+*/
+typedef CSpliceLayout<SInfoHeaderLayout> CInfoHeader;
+
+/*! \brief Characters '0' and '1' differ in the lowest bit only.
+*/
+static const uint64_t uBitCharMask = 0x0101010101010101ULL;
+/*! \brief Eight '0' characters.
+*/
+static const uint64_t uZeroChars = 0x3030303030303030ULL;
+
+/*! \brief Header windows : the 112 header bits are read as three big-endian 64-bit words starting at these bytes.
+*/
+static constexpr int iWindowStart[3] = { 0, 4, 6 };
+
+/*! \brief Function to reverse the byte order of a 64-bit word.
+*/
+static inline uint64_t ByteSwap64(const uint64_t& uWord) {
+#if defined(__GNUC__)
+	return __builtin_bswap64(uWord);
+#else
+	uint64_t uOut = 0;
+	for (int i = 0;i < 8;i++) {
+		uOut = (uOut << 8) | ((uWord >> (i * 8)) & 0xFF);
+	}
+	return uOut;
+#endif
+}
+
+/*! \brief Function to load 8 bytes as a little-endian word (the first byte lowest) with a single load.
+*/
+static inline uint64_t LoadLE64(const void* p) {
+	uint64_t uWord = 0;
+	std::memcpy(&uWord, p, sizeof(uWord));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	uWord = ByteSwap64(uWord);
+#endif
+	return uWord;
+}
+
+/*! \brief Function to load a big-endian 64-bit word.
+*/
+static inline uint64_t LoadBE64(const uint8_t* p) {
+	return ByteSwap64(LoadLE64(p));
+}
+
+/*! \brief Function to load the three header windows.
+*/
+static inline void LoadWindows(const uint8_t* pData, uint64_t* uWindows) {
+	for (int i = 0;i < 3;i++) {
+		uWindows[i] = LoadBE64(pData + iWindowStart[i]);
+	}
+}
+
+/*! \brief Function to get the header window holding a field.
+*/
+template <std::size_t I>
+constexpr int GetWindow() {
+	constexpr int iEnd = CInfoHeader::GetOffset<I>() + CInfoHeader::GetBits<I>();
+	return iEnd <= 64 ? 0 : ((CInfoHeader::GetOffset<I>() >= iWindowStart[1] * 8 && iEnd <= iWindowStart[1] * 8 + 64) ? 1 : 2);
+}
+
+/*! \brief Function to get the right shift bringing a field to the lowest bits of its header window.
+*/
+template <std::size_t I>
+constexpr int GetWindowShift() {
+	constexpr int iStart = iWindowStart[GetWindow<I>()] * 8;
+	static_assert(CInfoHeader::GetOffset<I>() >= iStart && CInfoHeader::GetOffset<I>() + CInfoHeader::GetBits<I>() <= iStart + 64, "header field outside its window");
+	return iStart + 64 - CInfoHeader::GetOffset<I>() - CInfoHeader::GetBits<I>();
+}
+
+/*! \brief Function to store a header field value to its member.
+*/
+template <std::size_t I>
+static inline void StoreHeaderField(SInfoData& objInfo, const uint64_t& uValue) {
+	auto& objMember = objInfo.*(std::get<I>(SInfoHeaderLayout::fields).pMember);
+	objMember = (typename std::remove_reference<decltype(objMember)>::type)uValue;
+}
+
+/*! \brief Width and presence condition of a flag cluster field.
+*/
+struct SClusterField {
+	int iBits;				/*!<Number of bits.*/
+	int iCondField;			/*!<Index of the field the presence depends on, -1 if always present.*/
+	uint32_t uCondValue;	/*!<Value of field iCondField for this field to be present.*/
+};
+
+/*! \brief Function to copy the widths and conditions of a layout table.
+*/
+template <typename TLayout, std::size_t... Is>
+constexpr std::array<SClusterField, sizeof...(Is)> GetClusterFields(std::index_sequence<Is...>) {
+	return {{ SClusterField{ std::get<Is>(TLayout::fields).iBits, std::get<Is>(TLayout::fields).iCondField, std::get<Is>(TLayout::fields).uCondValue }... }};
+}
+
+/*! \brief Widths and conditions of the fields of a flag cluster table.
+*/
+template <typename TLayout>
+constexpr auto aClusterFields = GetClusterFields<TLayout>(std::make_index_sequence<CSpliceLayout<TLayout>::iFieldCount>());
+
+/*! \brief Function to check if field iField is present whenever field iTarget is : it is unconditional, or shares the condition of iTarget or
+*	of one of the fields iTarget depends on (reserved_2 of the segmentation_descriptor() takes the place of the delivery flags, not their bits).
+*/
+template <std::size_t N>
+constexpr bool IsOnClusterPath(const std::array<SClusterField, N>& aFields, const std::size_t& iField, const std::size_t& iTarget) {
+	if (aFields[iField].iCondField < 0) {
+		return true;
+	}
+	for (int c = (int)iTarget;aFields[c].iCondField >= 0;c = aFields[c].iCondField) {
+		if (aFields[c].iCondField == aFields[iField].iCondField && aFields[c].uCondValue == aFields[iField].uCondValue) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*! \brief Function to get the bit offset of a field in its cluster, counting the earlier fields present along with it.
+*/
+template <std::size_t N>
+constexpr int GetClusterOffset(const std::array<SClusterField, N>& aFields, const std::size_t& iTarget) {
+	int iOffset = 0;
+	for (std::size_t i = 0;i < iTarget;i++) {
+		iOffset += IsOnClusterPath(aFields, i, iTarget) ? aFields[i].iBits : 0;
+	}
+	return iOffset;
+}
+
+/*! \brief Function to get the number of bytes of a cluster when every flag is present.
+*/
+template <typename TLayout>
+constexpr std::size_t GetClusterBytes() {
+	int iEnd = 0;
+	for (std::size_t i = 0;i < aClusterFields<TLayout>.size();i++) {
+		int iFieldEnd = GetClusterOffset(aClusterFields<TLayout>, i) + aClusterFields<TLayout>[i].iBits;
+		iEnd = iFieldEnd > iEnd ? iFieldEnd : iEnd;
+	}
+	return (std::size_t)(iEnd + 7) / 8;
+}
+
+/*! \brief Cluster windows : up to 128 bits are read as two big-endian 64-bit words, the first starting at byte 0 and the second ending with the cluster.
+*/
+template <typename TLayout>
+constexpr int iClusterWindowStart[2] = { 0, GetClusterBytes<TLayout>() > 8 ? (int)GetClusterBytes<TLayout>() - 8 : 0 };
+
+/*! \brief Function to get the cluster window holding a field.
+*/
+template <typename TLayout, std::size_t I>
+constexpr int GetClusterWindow() {
+	constexpr int iOffset = GetClusterOffset(aClusterFields<TLayout>, I);
+	return iOffset + aClusterFields<TLayout>[I].iBits <= 64 ? 0 : 1;
+}
+
+/*! \brief Function to get the right shift bringing a field to the lowest bits of its cluster window.
+*/
+template <typename TLayout, std::size_t I>
+constexpr int GetClusterShift() {
+	constexpr int iOffset = GetClusterOffset(aClusterFields<TLayout>, I);
+	constexpr int iBits = aClusterFields<TLayout>[I].iBits;
+	constexpr int iStart = iClusterWindowStart<TLayout>[GetClusterWindow<TLayout, I>()] * 8;
+	static_assert(iOffset >= iStart && iOffset + iBits <= iStart + 64, "cluster field outside its window");
+	return iStart + 64 - iOffset - iBits;
+}
+
+/*! \brief Function to load the cluster windows, a cluster shorter than a word is zero padded.
+*/
+template <typename TLayout>
+static inline void LoadClusterWindows(const uint8_t* pData, uint64_t* uWindows) {
+	constexpr std::size_t iBytes = GetClusterBytes<TLayout>();
+	if constexpr (iBytes < 8) {
+		uint8_t uPadded[8] = {};
+		std::memcpy(uPadded, pData, iBytes);
+		uWindows[0] = LoadBE64(uPadded);
+		uWindows[1] = uWindows[0];
+	}
+	else {
+		uWindows[0] = LoadBE64(pData + iClusterWindowStart<TLayout>[0]);
+		uWindows[1] = LoadBE64(pData + iClusterWindowStart<TLayout>[1]);
+	}
+}
+
+/*! \brief Function to store a cluster field to its member when its condition holds.
+*/
+template <typename TLayout, std::size_t I>
+static inline void StoreClusterField(typename TLayout::value_type& objValue, const uint64_t* uValues, bool* bPresent, std::size_t& iBits) {
+	constexpr SClusterField objField = aClusterFields<TLayout>[I];
+	if constexpr (objField.iCondField < 0) {
+		bPresent[I] = true;
+	}
+	else {
+		bPresent[I] = bPresent[objField.iCondField] && uValues[objField.iCondField] == objField.uCondValue;
+	}
+	if (bPresent[I]) {
+		auto& objMember = objValue.*(std::get<I>(TLayout::fields).pMember);
+		objMember = (typename std::remove_reference<decltype(objMember)>::type)uValues[I];
+		iBits += objField.iBits;
+	}
+}
+
+/*! \brief Function to store the present cluster fields to their members.
+*	\returns number of bits of the present fields.
+*/
+template <typename TLayout, std::size_t... Is>
+static inline std::size_t StoreClusterFields(typename TLayout::value_type& objValue, const uint64_t* uValues, std::index_sequence<Is...>) {
+	bool bPresent[sizeof...(Is)];
+	std::size_t iBits = 0;
+	(StoreClusterField<TLayout, Is>(objValue, uValues, bPresent, iBits), ...);
+	return iBits;
+}
+
+static_assert(GetClusterBytes<SpliceInsertLayout>() == CSpliceBitKernel::iInsertFlagsBytes, "splice_insert() flag cluster size");
+static_assert(GetClusterBytes<SegmentationDescriptorLayout>() == CSpliceBitKernel::iSegmentationFlagsBytes, "segmentation_descriptor() flag cluster size");
+
+//---------------------------------------- Portable kernel ----------------------------------------//
+
+/*! \brief Function to pack characters with a multiply : the 8 low bits land in the top byte, first character first.
+*/
+static bool PackBitsPortable(const char* pBits, const std::size_t& iCount, uint8_t* pOut) {
+	std::size_t iEnd = iCount;
+	for (std::size_t i = 0;i < iEnd;i += 8) {
+		uint64_t uWord = LoadLE64(pBits + i);
+		if ((uWord & ~uBitCharMask) != uZeroChars) {
+			return false;
+		}
+		pOut[i / 8] = (uint8_t)(((uWord & uBitCharMask) * 0x8040201008040201ULL) >> 56);
+	}
+	return true;
+}
+
+/*! \brief Function to extract the header fields with shift/mask.
+*/
+template <std::size_t... Is>
+static inline void ScatterPortable(const uint64_t* uWindows, SInfoData& objInfo, std::index_sequence<Is...>) {
+	(StoreHeaderField<Is>(objInfo, (uWindows[GetWindow<Is>()] >> GetWindowShift<Is>()) & ((1ULL << CInfoHeader::GetBits<Is>()) - 1)), ...);
+}
+
+/*! \brief Function to extract the header fields, portable kernel.
+*/
+static void ExtractInfoHeaderPortable(const uint8_t* pData, SInfoData& objInfo) {
+	uint64_t uWindows[3];
+	LoadWindows(pData, uWindows);
+	ScatterPortable(uWindows, objInfo, std::make_index_sequence<CInfoHeader::iFieldCount>());
+}
+
+/*! \brief Function to extract every field of a flag cluster with shift/mask, present or not.
+*/
+template <typename TLayout, std::size_t... Is>
+static inline void ClusterPortable(const uint64_t* uWindows, uint64_t* uValues, std::index_sequence<Is...>) {
+	((uValues[Is] = (uWindows[GetClusterWindow<TLayout, Is>()] >> GetClusterShift<TLayout, Is>()) & ((1ULL << aClusterFields<TLayout>[Is].iBits) - 1)), ...);
+}
+
+/*! \brief Function to extract the present fields of a flag cluster, portable kernel.
+*/
+template <typename TLayout>
+static std::size_t ExtractClusterPortable(const uint8_t* pData, typename TLayout::value_type& objValue) {
+	constexpr std::size_t iCount = CSpliceLayout<TLayout>::iFieldCount;
+	uint64_t uWindows[2];
+	uint64_t uValues[iCount];
+	LoadClusterWindows<TLayout>(pData, uWindows);
+	ClusterPortable<TLayout>(uWindows, uValues, std::make_index_sequence<iCount>());
+	return StoreClusterFields<TLayout>(objValue, uValues, std::make_index_sequence<iCount>());
+}
+
+//---------------------------------------- BMI2 kernel ----------------------------------------//
+
+#ifdef SCTE35_BMI2_KERNEL
+
+/*! \brief Function to pack characters with PEXT.
+*/
+__attribute__((target("bmi2"))) static bool PackBitsBMI2(const char* pBits, const std::size_t& iCount, uint8_t* pOut) {
+	std::size_t iEnd = iCount;
+	for (std::size_t i = 0;i < iEnd;i += 8) {
+		uint64_t uWord = LoadLE64(pBits + i);
+		if ((uWord & ~uBitCharMask) != uZeroChars) {
+			return false;
+		}
+		//Byte swap so the first character gives the most significant bit
+		pOut[i / 8] = (uint8_t)_pext_u64(ByteSwap64(uWord), uBitCharMask);
+	}
+	return true;
+}
+
+/*! \brief Function to extract the header fields with BZHI.
+*/
+template <std::size_t... Is>
+__attribute__((target("bmi2"))) static inline void ScatterBMI2(const uint64_t* uWindows, SInfoData& objInfo, std::index_sequence<Is...>) {
+	(StoreHeaderField<Is>(objInfo, _bzhi_u64(uWindows[GetWindow<Is>()] >> GetWindowShift<Is>(), CInfoHeader::GetBits<Is>())), ...);
+}
+
+/*! \brief Function to extract the header fields, BMI2 kernel.
+*/
+__attribute__((target("bmi2"))) static void ExtractInfoHeaderBMI2(const uint8_t* pData, SInfoData& objInfo) {
+	uint64_t uWindows[3];
+	LoadWindows(pData, uWindows);
+	ScatterBMI2(uWindows, objInfo, std::make_index_sequence<CInfoHeader::iFieldCount>());
+}
+
+/*! \brief Function to extract every field of a flag cluster with BZHI, present or not.
+*/
+template <typename TLayout, std::size_t... Is>
+__attribute__((target("bmi2"))) static inline void ClusterBMI2(const uint64_t* uWindows, uint64_t* uValues, std::index_sequence<Is...>) {
+	((uValues[Is] = _bzhi_u64(uWindows[GetClusterWindow<TLayout, Is>()] >> GetClusterShift<TLayout, Is>(), aClusterFields<TLayout>[Is].iBits)), ...);
+}
+
+/*! \brief Function to extract the present fields of a flag cluster, BMI2 kernel.
+*/
+template <typename TLayout>
+__attribute__((target("bmi2"))) static std::size_t ExtractClusterBMI2(const uint8_t* pData, typename TLayout::value_type& objValue) {
+	constexpr std::size_t iCount = CSpliceLayout<TLayout>::iFieldCount;
+	uint64_t uWindows[2];
+	uint64_t uValues[iCount];
+	LoadClusterWindows<TLayout>(pData, uWindows);
+	ClusterBMI2<TLayout>(uWindows, uValues, std::make_index_sequence<iCount>());
+	return StoreClusterFields<TLayout>(objValue, uValues, std::make_index_sequence<iCount>());
+}
+
+#endif
+
+//---------------------------------------- Dispatch ----------------------------------------//
+
+/*! \brief Function pointer type of the packing kernels.
+*/
+typedef bool (*PackBitsFn)(const char*, const std::size_t&, uint8_t*);
+/*! \brief Function pointer type of the header kernels.
+*/
+typedef void (*ExtractInfoHeaderFn)(const uint8_t*, SInfoData&);
+/*! \brief Function pointer type of the splice_insert() flag kernels.
+*/
+typedef std::size_t (*ExtractInsertFlagsFn)(const uint8_t*, SpliceInsertData&);
+/*! \brief Function pointer type of the segmentation_descriptor() flag kernels.
+*/
+typedef std::size_t (*ExtractSegmentationFlagsFn)(const uint8_t*, SegmentationDescriptor&);
+
+/*! \brief Function to get the fastest kernel this CPU runs.
+*/
+static scte35Kernel::type DetectKernel() {
+#ifdef SCTE35_BMI2_KERNEL
+	//Run from a static initializer, possibly before the compiler runtime initialized its CPU data
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("bmi2")) {
+		return scte35Kernel::bmi2;
+	}
+#endif
+	return scte35Kernel::portable;
+}
+
+/*! \brief Kernel in use, portable until the start-up selection ran.
+*/
+static scte35Kernel::type g_eKernel = scte35Kernel::portable;
+/*! \brief Packing function of the kernel in use.
+*/
+static PackBitsFn g_pfnPackBits = PackBitsPortable;
+/*! \brief Header function of the kernel in use.
+*/
+static ExtractInfoHeaderFn g_pfnExtractInfoHeader = ExtractInfoHeaderPortable;
+/*! \brief splice_insert() flag function of the kernel in use.
+*/
+static ExtractInsertFlagsFn g_pfnExtractInsertFlags = ExtractClusterPortable<SpliceInsertLayout>;
+/*! \brief segmentation_descriptor() flag function of the kernel in use.
+*/
+static ExtractSegmentationFlagsFn g_pfnExtractSegmentationFlags = ExtractClusterPortable<SegmentationDescriptorLayout>;
+
+/*!	\class CKernelSelector
+*	\brief #CKernelSelector class selecting the detected kernel at start-up.
+*/
+class CKernelSelector {
+public:
+	CKernelSelector() { CSpliceBitKernel::SetKernel(DetectKernel()); }
+};
+/*! \brief Start-up kernel selection.
+*/
+static CKernelSelector g_objKernelSelector;
+
+bool CSpliceBitKernel::IsSupported(const scte35Kernel::type& eKernel) {
+	switch (eKernel) {
+		case scte35Kernel::portable: return true;
+		case scte35Kernel::bmi2: return DetectKernel() == scte35Kernel::bmi2;
+		default: return false;
+	}
+}
+
+scte35Kernel::type CSpliceBitKernel::GetKernel() {
+	return g_eKernel;
+}
+
+bool CSpliceBitKernel::SetKernel(const scte35Kernel::type& eKernel) {
+	if (!IsSupported(eKernel)) {
+		return false;
+	}
+
+	g_eKernel = eKernel;
+	g_pfnPackBits = PackBitsPortable;
+	g_pfnExtractInfoHeader = ExtractInfoHeaderPortable;
+	g_pfnExtractInsertFlags = ExtractClusterPortable<SpliceInsertLayout>;
+	g_pfnExtractSegmentationFlags = ExtractClusterPortable<SegmentationDescriptorLayout>;
+#ifdef SCTE35_BMI2_KERNEL
+	if (eKernel == scte35Kernel::bmi2) {
+		g_pfnPackBits = PackBitsBMI2;
+		g_pfnExtractInfoHeader = ExtractInfoHeaderBMI2;
+		g_pfnExtractInsertFlags = ExtractClusterBMI2<SpliceInsertLayout>;
+		g_pfnExtractSegmentationFlags = ExtractClusterBMI2<SegmentationDescriptorLayout>;
+	}
+#endif
+	return true;
+}
+
+bool CSpliceBitKernel::PackBits(const char* pBits, const std::size_t& iCount, uint8_t* pOut) {
+	return g_pfnPackBits(pBits, iCount, pOut);
+}
+
+void CSpliceBitKernel::ExtractInfoHeader(const uint8_t* pData, SInfoData& objInfo) {
+	g_pfnExtractInfoHeader(pData, objInfo);
+}
+
+std::size_t CSpliceBitKernel::ExtractInsertFlags(const uint8_t* pData, SpliceInsertData& objInsert) {
+	return g_pfnExtractInsertFlags(pData, objInsert);
+}
+
+std::size_t CSpliceBitKernel::ExtractSegmentationFlags(const uint8_t* pData, SegmentationDescriptor& objSegmentation) {
+	return g_pfnExtractSegmentationFlags(pData, objSegmentation);
+}
+
+};
@@ -0,0 +1,100 @@
+/*! \file SpliceBitKernel.hpp
+*	\brief Splice multi-field extraction kernels class declaration.
+*	\details Header file for declaration of class CSpliceBitKernel whose definition is in SpliceBitKernel.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEBITKERNEL_HPP_
+/*! \brief SpliceBitKernel.hpp header guard define.
+*/
+#define _SPLICEBITKERNEL_HPP_
+
+#include "SpliceClass.hpp"
+#include <cstdint>
+#include <cstddef>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Kernel
+*	\brief scte35Kernel structure to hold the implementations of #CSpliceBitKernel.
+*/
+struct scte35Kernel {
+	/*!
+	*	\brief A type definition for type (Kernel implementations)
+	*/
+	typedef enum {
+		portable = 0,	/*!<Multiply packing and shift/mask tables, any CPU*/
+		bmi2 = 1		/*!<PEXT packing and BZHI extraction, x86-64 CPUs with BMI2*/
+	}type;
+};
+
+/*!	\class CSpliceBitKernel
+*	\brief #CSpliceBitKernel class loading clusters of small adjacent fields once and scattering them to their members.
+*
+*	The general path reads sections as a '0' and '1' bit string, one field at a time. The kernels pack a cluster of characters to bytes in one
+*	pass (8 characters per PEXT, or per multiply on the portable kernel) and extract every field of the cluster from a few 64-bit words, the
+*	field offsets coming from the SpliceLayout.hpp tables. The kernel is chosen once at start-up from the CPU features and may be changed with
+*	#SetKernel before parsing starts (not while other threads parse).
+*/
+class CSpliceBitKernel {
+public:
+	/*! \brief Number of bytes from table_id up to and including splice_command_type.
+	*/
+	static const std::size_t iInfoHeaderBytes = 14;
+	/*! \brief Number of bytes of a splice_insert() from splice_event_id up to and including the flag byte.
+	*/
+	static const std::size_t iInsertFlagsBytes = 6;
+	/*! \brief Number of bytes of a segmentation_descriptor() from splice_descriptor_tag up to and including the flag byte.
+	*/
+	static const std::size_t iSegmentationFlagsBytes = 12;
+
+	/*! \brief Function to check if a kernel can run on this CPU.
+	*/
+	static bool IsSupported(const scte35Kernel::type& eKernel);
+
+	/*! \brief Function to get the kernel in use.
+	*/
+	static scte35Kernel::type GetKernel();
+
+	/*! \brief Function to select the kernel.
+	*	\returns true if selected and false if the kernel cannot run on this CPU (the kernel in use is kept).
+	*/
+	static bool SetKernel(const scte35Kernel::type& eKernel);
+
+	/*! \brief Function to pack '0' and '1' characters to bytes, first character in the most significant bit.
+	*	\param pBits first character.
+	*	\param iCount number of characters, a multiple of 8.
+	*	\param pOut receives iCount / 8 bytes.
+	*	\returns true if packed and false if a character is not '0' or '1' (pOut content is then undefined).
+	*/
+	static bool PackBits(const char* pBits, const std::size_t& iCount, uint8_t* pOut);
+
+	/*! \brief Function to extract the splice_info_section fields from table_id up to and including splice_command_type.
+	*	\param pData iInfoHeaderBytes bytes starting with table_id.
+	*	\param objInfo receives the 13 fields.
+	*/
+	static void ExtractInfoHeader(const uint8_t* pData, SInfoData& objInfo);
+
+	/*! \brief Function to extract the splice_insert() fields from splice_event_id up to and including the flag byte.
+	*	\param pData iInsertFlagsBytes bytes starting with splice_event_id.
+	*	\param objInsert receives the present fields, the flags only when splice_event_cancel_indicator is 0 (the others keep their value).
+	*	\returns number of bits of the present fields (40 when cancelled, 48 otherwise).
+	*/
+	static std::size_t ExtractInsertFlags(const uint8_t* pData, SpliceInsertData& objInsert);
+
+	/*! \brief Function to extract the segmentation_descriptor() fields from splice_descriptor_tag up to and including the flag byte.
+	*	\param pData iSegmentationFlagsBytes bytes starting with splice_descriptor_tag.
+	*	\param objSegmentation receives the present fields, the flags only when segmentation_event_cancel_indicator is 0 (the others keep their value).
+	*	\returns number of bits of the present fields (88 when cancelled, 96 otherwise).
+	*/
+	static std::size_t ExtractSegmentationFlags(const uint8_t* pData, SegmentationDescriptor& objSegmentation);
+};
+
+};
+
+#endif
@@ -0,0 +1,569 @@
+/*! \file SpliceCApi.cpp
+*	\brief Splice parser C interface definition.
+*	\details CPP file for definition of the scte35_ functions whose declaration is in SpliceCApi.h.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceCApi.h"
+#include "SpliceVisitor.hpp"
+#include "SpliceCRC.hpp"
+#include <cstring>
+#include <new>
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+static_assert(SCTE35_E_EMPTY_INPUT == (int)scte35Error::empty_input && SCTE35_E_TRUNCATED == (int)scte35Error::truncated, "scte35_status must follow scte35Error");
+static_assert(SCTE35_E_UNKNOWN_COMMAND == (int)scte35Error::unknown_command && SCTE35_E_DESCRIPTOR_OVERRUN == (int)scte35Error::descriptor_overrun, "scte35_status must follow scte35Error");
+
+/*! \brief identifier of the SCTE-35 descriptors, "CUEI".
+*/
+static const uint32_t uCueIdentifier = 0x43554549;
+
+/*! \brief Function to hash a field name (FNV-1a), usable in case labels.
+*/
+static constexpr uint64_t NameHash(const char* sName) {
+	uint64_t uHash = 0xcbf29ce484222325ULL;
+	for (;*sName != 0;sName++) {
+		uHash = (uHash ^ (uint8_t)*sName) * 0x100000001b3ULL;
+	}
+	return uHash;
+}
+
+/*!	\class CResultVisitor
+*	\brief #CResultVisitor class filling a scte35_result from the #CSpliceWalker events.
+*/
+class CResultVisitor : public CSpliceVisitor {
+public:
+	/*! \brief #CResultVisitor class constructor.
+	*	\param objResult result to fill, cleared by the caller.
+	*/
+	explicit CResultVisitor(scte35_result& objResult) :
+	m_objResult(objResult),
+	m_pSegmentation(nullptr),
+	m_bInCommand(false),
+	m_bInLoop(false)
+	{
+	}
+
+	scte35Visit::type OnCommand(const uint32_t& uType, const std::size_t& iOffset, const std::size_t& iLength) override {
+		(void)uType; (void)iOffset; (void)iLength;
+		m_bInCommand = true;
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnCommandEnd(const uint32_t& uType) override {
+		(void)uType;
+		m_bInCommand = false;
+		m_bInLoop = false;
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnLoop(const char* sName, const uint32_t& uIndex, const std::size_t& iOffset) override {
+		(void)sName; (void)uIndex; (void)iOffset;
+		m_bInLoop = true;
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnDescriptor(const uint32_t& uTag, const uint32_t& uIdentifier, const std::size_t& iOffset, const std::size_t& iLength) override {
+		uint32_t uIndex = m_objResult.descriptor_count++;
+		if (uIndex < SCTE35_MAX_DESCRIPTORS) {
+			scte35_descriptor& objDescriptor = m_objResult.descriptors[uIndex];
+			objDescriptor.splice_descriptor_tag = uTag;
+			objDescriptor.identifier = uIdentifier;
+			objDescriptor.offset = (uint32_t)iOffset;
+			objDescriptor.length = (uint32_t)iLength;
+		}
+
+		//Only segmentation_descriptor fields are kept, the others are located for the caller
+		if (uTag != scte35Desc::segmentation_descriptor || uIdentifier != uCueIdentifier) {
+			return scte35Visit::skip;
+		}
+		uint32_t uSegmentation = m_objResult.segmentation_count++;
+		if (uSegmentation < SCTE35_MAX_SEGMENTATIONS) {
+			m_pSegmentation = &m_objResult.segmentations[uSegmentation];
+			m_pSegmentation->descriptor_index = uIndex;
+			return scte35Visit::next;
+		}
+		return scte35Visit::skip;
+	}
+
+	scte35Visit::type OnDescriptorEnd(const uint32_t& uTag) override {
+		(void)uTag;
+		m_pSegmentation = nullptr;
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnBytes(const char* sName, const uint8_t* pData, const std::size_t& iLength, const std::size_t& iOffset) override {
+		(void)pData; (void)iLength;
+		if (m_pSegmentation != nullptr && NameHash(sName) == NameHash("segmentation_upid")) {
+			m_pSegmentation->segmentation_upid_offset = (uint32_t)iOffset;
+		}
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnField(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) override {
+		(void)iBitOffset; (void)iBits;
+		uint32_t uValue32 = (uint32_t)uValue;
+		bool bInsert = m_bInCommand && m_objResult.splice_command_type == scte35Cmd::splice_insert;
+		scte35_segmentation* pSeg = m_pSegmentation;
+
+		switch (NameHash(sName))
+		{
+			case NameHash("table_id"): m_objResult.table_id = uValue32; break;
+			case NameHash("section_syntax_indicator"): m_objResult.section_syntax_indicator = uValue32; break;
+			case NameHash("private_indicator"): m_objResult.private_indicator = uValue32; break;
+			case NameHash("section_length"): m_objResult.section_length = uValue32; break;
+			case NameHash("protocol_version"): m_objResult.protocol_version = uValue32; break;
+			case NameHash("encrypted_packet"): m_objResult.encrypted_packet = uValue32; break;
+			case NameHash("encryption_algorithm"): m_objResult.encryption_algorithm = uValue32; break;
+			case NameHash("pts_adjustment"): m_objResult.pts_adjustment = uValue; break;
+			case NameHash("cw_index"): m_objResult.cw_index = uValue32; break;
+			case NameHash("tier"): m_objResult.tier = uValue32; break;
+			case NameHash("splice_command_length"): m_objResult.splice_command_length = uValue32; break;
+			case NameHash("splice_command_type"): m_objResult.splice_command_type = uValue32; break;
+			case NameHash("descriptor_loop_length"): m_objResult.descriptor_loop_length = uValue32; break;
+			case NameHash("E_CRC_32"): m_objResult.E_CRC_32 = uValue32; break;
+			case NameHash("CRC_32"): m_objResult.CRC_32 = uValue32; break;
+
+			case NameHash("splice_count"): m_objResult.splice_count = uValue32; break;
+			case NameHash("splice_event_id"): if (bInsert) { m_objResult.splice_event_id = uValue32; } break;
+			case NameHash("splice_event_cancel_indicator"): if (bInsert) { m_objResult.splice_event_cancel_indicator = uValue32; } break;
+			case NameHash("out_of_network_indicator"): if (bInsert) { m_objResult.out_of_network_indicator = uValue32; } break;
+			case NameHash("program_splice_flag"): if (bInsert) { m_objResult.program_splice_flag = uValue32; } break;
+			case NameHash("duration_flag"): if (bInsert) { m_objResult.duration_flag = uValue32; } break;
+			case NameHash("splice_immediate_flag"): if (bInsert) { m_objResult.splice_immediate_flag = uValue32; } break;
+			//Component splice times come after OnLoop
+			case NameHash("time_specified_flag"): if (m_bInCommand && !m_bInLoop) { m_objResult.time_specified_flag = uValue32; } break;
+			case NameHash("pts_time"): if (m_bInCommand && !m_bInLoop) { m_objResult.pts_time = uValue; } break;
+			case NameHash("auto_return"): if (bInsert) { m_objResult.auto_return = uValue32; } break;
+			case NameHash("duration"): if (bInsert) { m_objResult.duration = uValue; } break;
+			case NameHash("unique_program_id"): if (bInsert) { m_objResult.unique_program_id = uValue32; } break;
+			case NameHash("avail_num"): if (bInsert) { m_objResult.avail_num = uValue32; } break;
+			case NameHash("avails_expected"): if (bInsert) { m_objResult.avails_expected = uValue32; } break;
+			case NameHash("identifier"): if (m_bInCommand) { m_objResult.private_identifier = uValue32; } break;
+
+			case NameHash("segmentation_event_id"): if (pSeg != nullptr) { pSeg->segmentation_event_id = uValue32; } break;
+			case NameHash("segmentation_event_cancel_indicator"): if (pSeg != nullptr) { pSeg->segmentation_event_cancel_indicator = uValue32; } break;
+			case NameHash("program_segmentation_flag"): if (pSeg != nullptr) { pSeg->program_segmentation_flag = uValue32; } break;
+			case NameHash("segmentation_duration_flag"): if (pSeg != nullptr) { pSeg->segmentation_duration_flag = uValue32; } break;
+			case NameHash("delivery_not_restricted_flag"): if (pSeg != nullptr) { pSeg->delivery_not_restricted_flag = uValue32; } break;
+			case NameHash("web_delivery_allowed_flag"): if (pSeg != nullptr) { pSeg->web_delivery_allowed_flag = uValue32; } break;
+			case NameHash("no_regional_blackout_flag"): if (pSeg != nullptr) { pSeg->no_regional_blackout_flag = uValue32; } break;
+			case NameHash("archive_allowed_flag"): if (pSeg != nullptr) { pSeg->archive_allowed_flag = uValue32; } break;
+			case NameHash("device_restrictions"): if (pSeg != nullptr) { pSeg->device_restrictions = uValue32; } break;
+			case NameHash("component_count"): if (pSeg != nullptr) { pSeg->component_count = uValue32; } break;
+			case NameHash("segmentation_duration"): if (pSeg != nullptr) { pSeg->segmentation_duration = uValue; } break;
+			case NameHash("segmentation_upid_type"): if (pSeg != nullptr) { pSeg->segmentation_upid_type = uValue32; } break;
+			case NameHash("segmentation_upid_length"): if (pSeg != nullptr) { pSeg->segmentation_upid_length = uValue32; } break;
+			case NameHash("segmentation_type_id"): if (pSeg != nullptr) { pSeg->segmentation_type_id = uValue32; } break;
+			case NameHash("segment_num"): if (pSeg != nullptr) { pSeg->segment_num = uValue32; } break;
+			case NameHash("segments_expected"): if (pSeg != nullptr) { pSeg->segments_expected = uValue32; } break;
+			case NameHash("sub_segment_num"): if (pSeg != nullptr) { pSeg->sub_segment_num = uValue32; } break;
+			case NameHash("sub_segments_expected"): if (pSeg != nullptr) { pSeg->sub_segments_expected = uValue32; } break;
+			default: break;
+		}
+		return scte35Visit::next;
+	}
+
+private:
+	scte35_result& m_objResult;				/*!<Result being filled.*/
+	scte35_segmentation* m_pSegmentation;	/*!<Segmentation descriptor being walked, nullptr outside one.*/
+	bool m_bInCommand;						/*!<Whether the splice command is being walked.*/
+	bool m_bInLoop;							/*!<Whether a loop of the splice command started.*/
+};
+
+/*!	\struct SResultField
+*	\brief #SResultField structure to describe one serialized field of the C structures.
+*/
+struct SResultField {
+	const char* sName;		/*!<Field name.*/
+	std::size_t iOffset;	/*!<Offset of the field in its structure.*/
+	std::size_t iSize;		/*!<Size of the field, 4 or 8.*/
+};
+
+/*! \def SCTE35_RESULT_FIELD
+*	\brief Macro to describe a member of a C structure (offsetof needs the member name).
+*/
+#define SCTE35_RESULT_FIELD(TStruct, sMember) { #sMember, offsetof(TStruct, sMember), sizeof(((TStruct*)nullptr)->sMember) }
+
+/*! \brief Serialized scte35_result fields, in declaration order up to crc_valid.
+*/
+static const SResultField g_ResultFields[] = {
+	SCTE35_RESULT_FIELD(scte35_result, table_id),
+	SCTE35_RESULT_FIELD(scte35_result, section_syntax_indicator),
+	SCTE35_RESULT_FIELD(scte35_result, private_indicator),
+	SCTE35_RESULT_FIELD(scte35_result, section_length),
+	SCTE35_RESULT_FIELD(scte35_result, protocol_version),
+	SCTE35_RESULT_FIELD(scte35_result, encrypted_packet),
+	SCTE35_RESULT_FIELD(scte35_result, encryption_algorithm),
+	SCTE35_RESULT_FIELD(scte35_result, pts_adjustment),
+	SCTE35_RESULT_FIELD(scte35_result, cw_index),
+	SCTE35_RESULT_FIELD(scte35_result, tier),
+	SCTE35_RESULT_FIELD(scte35_result, splice_command_length),
+	SCTE35_RESULT_FIELD(scte35_result, splice_command_type),
+	SCTE35_RESULT_FIELD(scte35_result, splice_count),
+	SCTE35_RESULT_FIELD(scte35_result, splice_event_id),
+	SCTE35_RESULT_FIELD(scte35_result, splice_event_cancel_indicator),
+	SCTE35_RESULT_FIELD(scte35_result, out_of_network_indicator),
+	SCTE35_RESULT_FIELD(scte35_result, program_splice_flag),
+	SCTE35_RESULT_FIELD(scte35_result, duration_flag),
+	SCTE35_RESULT_FIELD(scte35_result, splice_immediate_flag),
+	SCTE35_RESULT_FIELD(scte35_result, time_specified_flag),
+	SCTE35_RESULT_FIELD(scte35_result, pts_time),
+	SCTE35_RESULT_FIELD(scte35_result, auto_return),
+	SCTE35_RESULT_FIELD(scte35_result, duration),
+	SCTE35_RESULT_FIELD(scte35_result, unique_program_id),
+	SCTE35_RESULT_FIELD(scte35_result, avail_num),
+	SCTE35_RESULT_FIELD(scte35_result, avails_expected),
+	SCTE35_RESULT_FIELD(scte35_result, private_identifier),
+	SCTE35_RESULT_FIELD(scte35_result, descriptor_loop_length),
+	SCTE35_RESULT_FIELD(scte35_result, E_CRC_32),
+	SCTE35_RESULT_FIELD(scte35_result, CRC_32),
+	SCTE35_RESULT_FIELD(scte35_result, crc_valid)
+};
+
+/*! \brief Serialized scte35_descriptor fields.
+*/
+static const SResultField g_DescriptorFields[] = {
+	SCTE35_RESULT_FIELD(scte35_descriptor, splice_descriptor_tag),
+	SCTE35_RESULT_FIELD(scte35_descriptor, identifier),
+	SCTE35_RESULT_FIELD(scte35_descriptor, offset),
+	SCTE35_RESULT_FIELD(scte35_descriptor, length)
+};
+
+/*! \brief Serialized scte35_segmentation fields.
+*/
+static const SResultField g_SegmentationFields[] = {
+	SCTE35_RESULT_FIELD(scte35_segmentation, descriptor_index),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_event_id),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_event_cancel_indicator),
+	SCTE35_RESULT_FIELD(scte35_segmentation, program_segmentation_flag),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_duration_flag),
+	SCTE35_RESULT_FIELD(scte35_segmentation, delivery_not_restricted_flag),
+	SCTE35_RESULT_FIELD(scte35_segmentation, web_delivery_allowed_flag),
+	SCTE35_RESULT_FIELD(scte35_segmentation, no_regional_blackout_flag),
+	SCTE35_RESULT_FIELD(scte35_segmentation, archive_allowed_flag),
+	SCTE35_RESULT_FIELD(scte35_segmentation, device_restrictions),
+	SCTE35_RESULT_FIELD(scte35_segmentation, component_count),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_duration),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_upid_type),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_upid_length),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_upid_offset),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segmentation_type_id),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segment_num),
+	SCTE35_RESULT_FIELD(scte35_segmentation, segments_expected),
+	SCTE35_RESULT_FIELD(scte35_segmentation, sub_segment_num),
+	SCTE35_RESULT_FIELD(scte35_segmentation, sub_segments_expected)
+};
+
+#undef SCTE35_RESULT_FIELD
+
+/*! \brief Function to read a serialized field.
+*/
+static uint64_t GetFieldValue(const void* pStruct, const SResultField& objField) {
+	const uint8_t* pField = (const uint8_t*)pStruct + objField.iOffset;
+	if (objField.iSize == sizeof(uint64_t)) {
+		uint64_t uValue = 0;
+		std::memcpy(&uValue, pField, sizeof(uValue));
+		return uValue;
+	}
+	uint32_t uValue = 0;
+	std::memcpy(&uValue, pField, sizeof(uValue));
+	return uValue;
+}
+
+/*!	\class CBufferWriter
+*	\brief #CBufferWriter class writing to a caller buffer. Writes past the capacity are counted, not done, so the required size is known.
+*/
+class CBufferWriter {
+public:
+	/*! \brief #CBufferWriter class constructor.
+	*/
+	CBufferWriter(uint8_t* pBuffer, const std::size_t& iCapacity) :
+	m_pBuffer(pBuffer),
+	m_iCapacity(pBuffer == nullptr ? 0 : iCapacity),
+	m_iSize(0)
+	{
+	}
+
+	/*! \brief Function to write bytes.
+	*/
+	void Put(const void* pData, const std::size_t& iLength) {
+		if (m_iSize + iLength <= m_iCapacity) {
+			std::memcpy(m_pBuffer + m_iSize, pData, iLength);
+		}
+		m_iSize += iLength;
+	}
+
+	/*! \brief Function to write a string without its NUL.
+	*/
+	void Put(const char* sText) {
+		Put(sText, std::strlen(sText));
+	}
+
+	/*! \brief Function to write an unsigned integer as decimal text.
+	*/
+	void PutDecimal(uint64_t uValue) {
+		char sDigits[20];
+		int iCount = 0;
+		do {
+			sDigits[sizeof(sDigits) - 1 - iCount++] = (char)('0' + uValue % 10);
+			uValue /= 10;
+		} while (uValue != 0);
+		Put(sDigits + sizeof(sDigits) - iCount, (std::size_t)iCount);
+	}
+
+	/*! \brief Function to write bytes as a quoted hexa-decimal string.
+	*/
+	void PutHexa(const uint8_t* pData, const std::size_t& iLength) {
+		static const char sDigits[] = "0123456789ABCDEF";
+		Put("\"");
+		for (std::size_t i = 0;i < iLength;i++) {
+			char sByte[2] = { sDigits[pData[i] >> 4], sDigits[pData[i] & 0x0F] };
+			Put(sByte, sizeof(sByte));
+		}
+		Put("\"");
+	}
+
+	/*! \brief Function to write an unsigned integer little-endian.
+	*/
+	void PutLE(const uint64_t& uValue, const std::size_t& iBytes) {
+		uint8_t uBytes[8];
+		for (std::size_t i = 0;i < iBytes;i++) {
+			uBytes[i] = (uint8_t)(uValue >> (i * 8));
+		}
+		Put(uBytes, iBytes);
+	}
+
+	/*! \brief Function to get the number of bytes written or required.
+	*/
+	std::size_t GetSize() const { return m_iSize; }
+
+	/*! \brief Function to check whether everything written fits.
+	*/
+	bool IsComplete() const { return m_iSize <= m_iCapacity; }
+
+private:
+	uint8_t* m_pBuffer;			/*!<Caller buffer.*/
+	std::size_t m_iCapacity;	/*!<Size of the caller buffer.*/
+	std::size_t m_iSize;		/*!<Bytes written or required.*/
+};
+
+/*! \brief Function to write the fields of a structure as JSON members.
+*/
+template <std::size_t N>
+static void PutJsonFields(CBufferWriter& objWriter, const void* pStruct, const SResultField (&objFields)[N]) {
+	for (std::size_t i = 0;i < N;i++) {
+		if (i > 0) {
+			objWriter.Put(",");
+		}
+		objWriter.Put("\"");
+		objWriter.Put(objFields[i].sName);
+		objWriter.Put("\":");
+		objWriter.PutDecimal(GetFieldValue(pStruct, objFields[i]));
+	}
+}
+
+/*! \brief Function to write the fields of a structure packed.
+*/
+template <std::size_t N>
+static void PutPackedFields(CBufferWriter& objWriter, const void* pStruct, const SResultField (&objFields)[N]) {
+	for (std::size_t i = 0;i < N;i++) {
+		objWriter.PutLE(GetFieldValue(pStruct, objFields[i]), objFields[i].iSize);
+	}
+}
+
+/*! \brief Function to get the number of descriptors held by a result.
+*/
+static uint32_t GetHeldDescriptors(const scte35_result& objResult) {
+	return objResult.descriptor_count < SCTE35_MAX_DESCRIPTORS ? objResult.descriptor_count : SCTE35_MAX_DESCRIPTORS;
+}
+
+/*! \brief Function to get the number of segmentation descriptors held by a result.
+*/
+static uint32_t GetHeldSegmentations(const scte35_result& objResult) {
+	return objResult.segmentation_count < SCTE35_MAX_SEGMENTATIONS ? objResult.segmentation_count : SCTE35_MAX_SEGMENTATIONS;
+}
+
+/*! \brief Function to write a result as a JSON object, followed by a NUL.
+*/
+static void WriteJson(CBufferWriter& objWriter, const scte35_result& objResult, const uint8_t* pData) {
+	objWriter.Put("{\"abi_version\":");
+	objWriter.PutDecimal(SCTE35_ABI_VERSION);
+	objWriter.Put(",");
+	PutJsonFields(objWriter, &objResult, g_ResultFields);
+
+	objWriter.Put(",\"descriptor_count\":");
+	objWriter.PutDecimal(objResult.descriptor_count);
+	objWriter.Put(",\"descriptors\":[");
+	for (uint32_t i = 0;i < GetHeldDescriptors(objResult);i++) {
+		const scte35_descriptor& objDescriptor = objResult.descriptors[i];
+		objWriter.Put(i > 0 ? ",{" : "{");
+		PutJsonFields(objWriter, &objDescriptor, g_DescriptorFields);
+		objWriter.Put(",\"data\":");
+		objWriter.PutHexa(pData + objDescriptor.offset, objDescriptor.length);
+		objWriter.Put("}");
+	}
+
+	objWriter.Put("],\"segmentation_count\":");
+	objWriter.PutDecimal(objResult.segmentation_count);
+	objWriter.Put(",\"segmentations\":[");
+	for (uint32_t i = 0;i < GetHeldSegmentations(objResult);i++) {
+		const scte35_segmentation& objSegmentation = objResult.segmentations[i];
+		objWriter.Put(i > 0 ? ",{" : "{");
+		PutJsonFields(objWriter, &objSegmentation, g_SegmentationFields);
+		objWriter.Put(",\"segmentation_upid\":");
+		objWriter.PutHexa(pData + objSegmentation.segmentation_upid_offset, objSegmentation.segmentation_upid_length);
+		objWriter.Put("}");
+	}
+	objWriter.Put("]}");
+	objWriter.Put("", 1);
+}
+
+/*! \brief Function to write a result in the packed format.
+*/
+static void WritePacked(CBufferWriter& objWriter, const scte35_result& objResult, const uint8_t* pData) {
+	objWriter.Put("S35R");
+	objWriter.PutLE(SCTE35_ABI_VERSION, 2);
+	PutPackedFields(objWriter, &objResult, g_ResultFields);
+
+	objWriter.PutLE(GetHeldDescriptors(objResult), 2);
+	for (uint32_t i = 0;i < GetHeldDescriptors(objResult);i++) {
+		PutPackedFields(objWriter, &objResult.descriptors[i], g_DescriptorFields);
+	}
+
+	objWriter.PutLE(GetHeldSegmentations(objResult), 2);
+	for (uint32_t i = 0;i < GetHeldSegmentations(objResult);i++) {
+		const scte35_segmentation& objSegmentation = objResult.segmentations[i];
+		PutPackedFields(objWriter, &objSegmentation, g_SegmentationFields);
+		objWriter.Put(pData + objSegmentation.segmentation_upid_offset, objSegmentation.segmentation_upid_length);
+	}
+}
+
+};
+
+/*! \struct scte35_parser
+*	\brief scte35_parser structure behind the opaque C handle.
+*/
+struct scte35_parser {
+	bool bRequireCRC;				/*!<Whether a CRC_32 mismatch fails the parse.*/
+	scte35_result objResult;		/*!<Result of the serializing entry points.*/
+};
+
+/*! \brief Function to parse into a result, the common part of the entry points.
+*/
+static int ParseInto(const scte35_parser* pParser, const uint8_t* pData, const std::size_t& iLength, scte35_result& objResult) {
+	std::memset(&objResult, 0, sizeof(objResult));
+
+	scte35::CResultVisitor objVisitor(objResult);
+	scte35::scte35Error::type eError = scte35::CSpliceWalker::Walk(pData, iLength, objVisitor);
+	if (eError != scte35::scte35Error::none) {
+		return (int)eError;
+	}
+
+	//The walk checked that the whole section is in the input
+	objResult.crc_valid = scte35::CSpliceCRC::Compute(pData, (std::size_t)objResult.section_length + 3 - 4) == objResult.CRC_32 ? 1 : 0;
+	if (pParser->bRequireCRC && objResult.crc_valid == 0) {
+		return SCTE35_E_CRC_MISMATCH;
+	}
+	return SCTE35_OK;
+}
+
+int scte35_abi_version(void) {
+	return SCTE35_ABI_VERSION;
+}
+
+const char* scte35_status_name(int status) {
+	switch (status)
+	{
+		case SCTE35_OK: return "ok";
+		case SCTE35_E_EMPTY_INPUT: return "empty_input";
+		case SCTE35_E_TRUNCATED: return "truncated";
+		case SCTE35_E_UNKNOWN_COMMAND: return "unknown_command";
+		case SCTE35_E_DESCRIPTOR_OVERRUN: return "descriptor_overrun";
+		case SCTE35_E_INVALID_ARGUMENT: return "invalid_argument";
+		case SCTE35_E_BUFFER_TOO_SMALL: return "buffer_too_small";
+		case SCTE35_E_CRC_MISMATCH: return "crc_mismatch";
+		case SCTE35_E_INTERNAL: return "internal";
+		default: return "unknown";
+	}
+}
+
+scte35_parser* scte35_parser_create(void) {
+	scte35_parser* pParser = new (std::nothrow) scte35_parser();
+	if (pParser != nullptr) {
+		pParser->bRequireCRC = false;
+	}
+	return pParser;
+}
+
+void scte35_parser_destroy(scte35_parser* parser) {
+	delete parser;
+}
+
+int scte35_parser_set_option(scte35_parser* parser, int option, int value) {
+	if (parser == nullptr) {
+		return SCTE35_E_INVALID_ARGUMENT;
+	}
+	switch (option)
+	{
+		case SCTE35_OPTION_REQUIRE_CRC: parser->bRequireCRC = value != 0; return SCTE35_OK;
+		default: return SCTE35_E_INVALID_ARGUMENT;
+	}
+}
+
+int scte35_parse(scte35_parser* parser, const uint8_t* data, size_t length, scte35_result* result, size_t result_size) {
+	if (parser == nullptr || result == nullptr || result_size < sizeof(scte35_result)) {
+		return SCTE35_E_INVALID_ARGUMENT;
+	}
+	try {
+		return ParseInto(parser, data, length, *result);
+	}
+	catch (...) {
+		return SCTE35_E_INTERNAL;
+	}
+}
+
+int scte35_parse_json(scte35_parser* parser, const uint8_t* data, size_t length, char* buffer, size_t capacity, size_t* written) {
+	if (parser == nullptr || written == nullptr) {
+		return SCTE35_E_INVALID_ARGUMENT;
+	}
+	*written = 0;
+	try {
+		int iStatus = ParseInto(parser, data, length, parser->objResult);
+		if (iStatus != SCTE35_OK) {
+			return iStatus;
+		}
+		scte35::CBufferWriter objWriter((uint8_t*)buffer, capacity);
+		scte35::WriteJson(objWriter, parser->objResult, data);
+		*written = objWriter.GetSize();
+		return objWriter.IsComplete() ? SCTE35_OK : SCTE35_E_BUFFER_TOO_SMALL;
+	}
+	catch (...) {
+		return SCTE35_E_INTERNAL;
+	}
+}
+
+int scte35_parse_packed(scte35_parser* parser, const uint8_t* data, size_t length, uint8_t* buffer, size_t capacity, size_t* written) {
+	if (parser == nullptr || written == nullptr) {
+		return SCTE35_E_INVALID_ARGUMENT;
+	}
+	*written = 0;
+	try {
+		int iStatus = ParseInto(parser, data, length, parser->objResult);
+		if (iStatus != SCTE35_OK) {
+			return iStatus;
+		}
+		scte35::CBufferWriter objWriter(buffer, capacity);
+		scte35::WritePacked(objWriter, parser->objResult, data);
+		*written = objWriter.GetSize();
+		return objWriter.IsComplete() ? SCTE35_OK : SCTE35_E_BUFFER_TOO_SMALL;
+	}
+	catch (...) {
+		return SCTE35_E_INTERNAL;
+	}
+}
@@ -0,0 +1,228 @@
+/*! \file SpliceCApi.h
+*	\brief Splice parser C interface declaration.
+*	\details C header file for declaration of the scte35_ functions whose definition is in SpliceCApi.cpp. It can be included from C and C++,
+*	and is the interface of the SCTE35C shared library for the runtimes embedding the parser through a foreign function interface.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICECAPI_H_
+/*! \brief SpliceCApi.h header guard define.
+*/
+#define _SPLICECAPI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*! \def SCTE35_API
+*	\brief Export attribute of the C interface functions.
+*/
+#if defined(_WIN32) && defined(SCTE35_C_EXPORTS)
+#define SCTE35_API __declspec(dllexport)
+#elif defined(__GNUC__)
+#define SCTE35_API __attribute__((visibility("default")))
+#else
+#define SCTE35_API
+#endif
+
+/*! \def SCTE35_ABI_VERSION
+*	\brief Version of the structures and of the packed format below, raised on any incompatible change.
+*/
+#define SCTE35_ABI_VERSION 1
+
+/*! \def SCTE35_MAX_DESCRIPTORS
+*	\brief Number of descriptors a #scte35_result holds, the following ones are only counted.
+*/
+#define SCTE35_MAX_DESCRIPTORS 32
+
+/*! \def SCTE35_MAX_SEGMENTATIONS
+*	\brief Number of segmentation_descriptor a #scte35_result holds, the following ones are only counted.
+*/
+#define SCTE35_MAX_SEGMENTATIONS 8
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \enum scte35_status
+*	\brief Return values of the scte35_ functions. Positive values are the scte35Error parse failure reasons, negative values are failures of
+*	the call itself.
+*/
+typedef enum scte35_status {
+	SCTE35_OK = 0,						/*!<Parsed*/
+	SCTE35_E_EMPTY_INPUT = 1,			/*!<Input is empty*/
+	SCTE35_E_TRUNCATED = 5,				/*!<Input ends before a field of the section*/
+	SCTE35_E_UNKNOWN_COMMAND = 6,		/*!<splice_command_type value is reserved*/
+	SCTE35_E_DESCRIPTOR_OVERRUN = 7,	/*!<A descriptor goes beyond descriptor_loop_length or the loop beyond the section*/
+	SCTE35_E_INVALID_ARGUMENT = -1,		/*!<Null handle or output, or result_size smaller than sizeof(scte35_result)*/
+	SCTE35_E_BUFFER_TOO_SMALL = -2,		/*!<Output buffer too small, the required size is returned in *written*/
+	SCTE35_E_CRC_MISMATCH = -3,			/*!<CRC_32 does not match and #SCTE35_OPTION_REQUIRE_CRC is set*/
+	SCTE35_E_INTERNAL = -4				/*!<Unexpected internal failure, no exception ever crosses the interface*/
+} scte35_status;
+
+/*! \enum scte35_option
+*	\brief Options of a parser handle, see #scte35_parser_set_option.
+*/
+typedef enum scte35_option {
+	SCTE35_OPTION_REQUIRE_CRC = 1		/*!<Fail with #SCTE35_E_CRC_MISMATCH when CRC_32 does not match (off by default, crc_valid is always set)*/
+} scte35_option;
+
+/*! \struct scte35_descriptor
+*	\brief One splice_descriptor, located in the input so it can be decoded by the caller without copy.
+*/
+typedef struct scte35_descriptor {
+	uint32_t splice_descriptor_tag;		/*!<splice_descriptor_tag*/
+	uint32_t identifier;				/*!<identifier, 0 if the descriptor is shorter than 4 bytes*/
+	uint32_t offset;					/*!<Byte offset of splice_descriptor_tag in the input*/
+	uint32_t length;					/*!<Descriptor size in bytes (descriptor_length + 2)*/
+} scte35_descriptor;
+
+/*! \struct scte35_segmentation
+*	\brief One "CUEI" segmentation_descriptor (component offsets are not kept, see the descriptor bytes).
+*/
+typedef struct scte35_segmentation {
+	uint32_t descriptor_index;						/*!<Index of the descriptor in descriptors*/
+	uint32_t segmentation_event_id;					/*!<segmentation_event_id*/
+	uint32_t segmentation_event_cancel_indicator;	/*!<segmentation_event_cancel_indicator*/
+	uint32_t program_segmentation_flag;				/*!<program_segmentation_flag*/
+	uint32_t segmentation_duration_flag;			/*!<segmentation_duration_flag*/
+	uint32_t delivery_not_restricted_flag;			/*!<delivery_not_restricted_flag*/
+	uint32_t web_delivery_allowed_flag;				/*!<web_delivery_allowed_flag*/
+	uint32_t no_regional_blackout_flag;				/*!<no_regional_blackout_flag*/
+	uint32_t archive_allowed_flag;					/*!<archive_allowed_flag*/
+	uint32_t device_restrictions;					/*!<device_restrictions*/
+	uint32_t component_count;						/*!<component_count*/
+	uint64_t segmentation_duration;					/*!<segmentation_duration (90 kHz)*/
+	uint32_t segmentation_upid_type;				/*!<segmentation_upid_type*/
+	uint32_t segmentation_upid_length;				/*!<segmentation_upid_length*/
+	uint32_t segmentation_upid_offset;				/*!<Byte offset of segmentation_upid() in the input*/
+	uint32_t segmentation_type_id;					/*!<segmentation_type_id*/
+	uint32_t segment_num;							/*!<segment_num*/
+	uint32_t segments_expected;						/*!<segments_expected*/
+	uint32_t sub_segment_num;						/*!<sub_segment_num (0 if absent)*/
+	uint32_t sub_segments_expected;					/*!<sub_segments_expected (0 if absent)*/
+} scte35_segmentation;
+
+/*! \struct scte35_result
+*	\brief Flat result of a parse, filled by #scte35_parse. Fields absent from the cue are 0.
+*
+*	Command fields are the ones of time_signal, of a program splice_insert (splice_time, break_duration and the unique_program_id group,
+*	component splice times are not kept) and of private_command (identifier). Of splice_schedule only splice_count is kept.
+*/
+typedef struct scte35_result {
+	uint32_t table_id;					/*!<table_id*/
+	uint32_t section_syntax_indicator;	/*!<section_syntax_indicator*/
+	uint32_t private_indicator;			/*!<private_indicator*/
+	uint32_t section_length;			/*!<section_length*/
+	uint32_t protocol_version;			/*!<protocol_version*/
+	uint32_t encrypted_packet;			/*!<encrypted_packet*/
+	uint32_t encryption_algorithm;		/*!<encryption_algorithm*/
+	uint64_t pts_adjustment;			/*!<pts_adjustment*/
+	uint32_t cw_index;					/*!<cw_index*/
+	uint32_t tier;						/*!<tier*/
+	uint32_t splice_command_length;		/*!<splice_command_length*/
+	uint32_t splice_command_type;		/*!<splice_command_type*/
+
+	uint32_t splice_count;						/*!<splice_schedule splice_count*/
+	uint32_t splice_event_id;					/*!<splice_insert splice_event_id*/
+	uint32_t splice_event_cancel_indicator;		/*!<splice_insert splice_event_cancel_indicator*/
+	uint32_t out_of_network_indicator;			/*!<splice_insert out_of_network_indicator*/
+	uint32_t program_splice_flag;				/*!<splice_insert program_splice_flag*/
+	uint32_t duration_flag;						/*!<splice_insert duration_flag*/
+	uint32_t splice_immediate_flag;				/*!<splice_insert splice_immediate_flag*/
+	uint32_t time_specified_flag;				/*!<time_signal or program splice_insert time_specified_flag*/
+	uint64_t pts_time;							/*!<time_signal or program splice_insert pts_time*/
+	uint32_t auto_return;						/*!<break_duration auto_return*/
+	uint64_t duration;							/*!<break_duration duration*/
+	uint32_t unique_program_id;					/*!<splice_insert unique_program_id*/
+	uint32_t avail_num;							/*!<splice_insert avail_num*/
+	uint32_t avails_expected;					/*!<splice_insert avails_expected*/
+	uint32_t private_identifier;				/*!<private_command identifier*/
+
+	uint32_t descriptor_loop_length;	/*!<descriptor_loop_length*/
+	uint32_t E_CRC_32;					/*!<E_CRC_32 (encrypted sections)*/
+	uint32_t CRC_32;					/*!<CRC_32*/
+	uint32_t crc_valid;					/*!<1 if CRC_32 matches the section, 0 otherwise*/
+
+	uint32_t descriptor_count;										/*!<Number of descriptors in the section (may exceed #SCTE35_MAX_DESCRIPTORS)*/
+	scte35_descriptor descriptors[SCTE35_MAX_DESCRIPTORS];			/*!<First descriptors*/
+	uint32_t segmentation_count;									/*!<Number of segmentation_descriptor (may exceed #SCTE35_MAX_SEGMENTATIONS)*/
+	scte35_segmentation segmentations[SCTE35_MAX_SEGMENTATIONS];	/*!<First segmentation_descriptor*/
+} scte35_result;
+
+/*! \struct scte35_parser
+*	\brief Opaque parser handle. A handle is used by one thread at a time, use one handle per thread.
+*/
+typedef struct scte35_parser scte35_parser;
+
+/*! \brief Function to get the #SCTE35_ABI_VERSION the library was built with, to check it against the header at load time.
+*/
+SCTE35_API int scte35_abi_version(void);
+
+/*! \brief Function to get the name of a #scte35_status value.
+*	\returns static string, never NULL.
+*/
+SCTE35_API const char* scte35_status_name(int status);
+
+/*! \brief Function to create a parser handle, the only allocation of the interface.
+*	\returns handle or NULL if out of memory.
+*/
+SCTE35_API scte35_parser* scte35_parser_create(void);
+
+/*! \brief Function to destroy a parser handle (NULL is ignored).
+*/
+SCTE35_API void scte35_parser_destroy(scte35_parser* parser);
+
+/*! \brief Function to set an option of a parser handle.
+*	\param parser handle.
+*	\param option #scte35_option value.
+*	\param value 0 to disable, any other value to enable.
+*	\returns #SCTE35_OK or #SCTE35_E_INVALID_ARGUMENT for a NULL handle or an unknown option.
+*/
+SCTE35_API int scte35_parser_set_option(scte35_parser* parser, int option, int value);
+
+/*! \brief Function to parse a binary splice_info_section into a flat result. Nothing is allocated and the input is not copied.
+*	\param parser handle.
+*	\param data section bytes starting with table_id.
+*	\param length number of bytes in data.
+*	\param result receives the result, also on failure (fields up to the failure).
+*	\param result_size sizeof(scte35_result) as seen by the caller.
+*	\returns #SCTE35_OK or the failure.
+*/
+SCTE35_API int scte35_parse(scte35_parser* parser, const uint8_t* data, size_t length, scte35_result* result, size_t result_size);
+
+/*! \brief Function to parse a binary splice_info_section into a JSON object written to a caller buffer.
+*
+*	The object holds the #scte35_result fields under the same names, descriptors with their bytes as a hexa-decimal string and segmentation
+*	descriptors with segmentation_upid as a hexa-decimal string.
+*	\param parser handle.
+*	\param data section bytes starting with table_id.
+*	\param length number of bytes in data.
+*	\param buffer receives the NUL terminated JSON text (may be NULL if capacity is 0).
+*	\param capacity size of buffer in bytes.
+*	\param written receives the text size including the NUL, or the size required when #SCTE35_E_BUFFER_TOO_SMALL is returned.
+*	\returns #SCTE35_OK, #SCTE35_E_BUFFER_TOO_SMALL or the parse failure (nothing is written then).
+*/
+SCTE35_API int scte35_parse_json(scte35_parser* parser, const uint8_t* data, size_t length, char* buffer, size_t capacity, size_t* written);
+
+/*! \brief Function to parse a binary splice_info_section into the packed binary format written to a caller buffer.
+*
+*	Packed format, all integers little-endian : "S35R", uint16 #SCTE35_ABI_VERSION, then the #scte35_result fields in declaration order
+*	up to crc_valid with their C size, uint16 number of descriptors written, for each descriptor its 4 uint32 fields, uint16 number of
+*	segmentation descriptors written, for each one its fields in declaration order followed by the segmentation_upid_length UPID bytes.
+*	\param parser handle.
+*	\param data section bytes starting with table_id.
+*	\param length number of bytes in data.
+*	\param buffer receives the packed result (may be NULL if capacity is 0).
+*	\param capacity size of buffer in bytes.
+*	\param written receives the packed size, or the size required when #SCTE35_E_BUFFER_TOO_SMALL is returned.
+*	\returns #SCTE35_OK, #SCTE35_E_BUFFER_TOO_SMALL or the parse failure (nothing is written then).
+*/
+SCTE35_API int scte35_parse_packed(scte35_parser* parser, const uint8_t* data, size_t length, uint8_t* buffer, size_t capacity, size_t* written);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+/*! \file SpliceCRC.cpp
+*	\brief Splice CRC utility class definition.
+*	\details CPP file for definition of class CSpliceCRC whose declaration is in SpliceCRC.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceCRC.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const uint32_t CSpliceCRC::uPolynomial;
+const uint32_t CSpliceCRC::uInitial;
+
+/*! \brief Byte-wise lookup table for the MPEG-2 CRC-32.
+*/
+struct SCrcTable {
+	uint32_t values[256];	/*!<CRC register value for every possible leading byte.*/
+
+	SCrcTable() {
+		for (uint32_t i = 0;i < 256;i++) {
+			uint32_t uLocal = i << 24;
+			for (int j = 0;j < 8;j++) {
+				uLocal = (uLocal & 0x80000000) ? ((uLocal << 1) ^ CSpliceCRC::uPolynomial) : (uLocal << 1);
+			}
+			values[i] = uLocal;
+		}
+	}
+};
+
+static const SCrcTable& CrcTable() {
+	static const SCrcTable objTable;
+	return objTable;
+}
+
+uint32_t CSpliceCRC::Compute(const uint8_t* pData, const std::size_t& iLength) {
+	return Update(uInitial, pData, iLength);
+}
+
+uint32_t CSpliceCRC::Update(const uint32_t& uCrc, const uint8_t* pData, const std::size_t& iLength) {
+	const SCrcTable& objTable = CrcTable();
+	uint32_t uLocal = uCrc;
+	for (std::size_t i = 0;i < iLength;i++) {
+		uLocal = (uLocal << 8) ^ objTable.values[((uLocal >> 24) ^ pData[i]) & 0xff];
+	}
+	return uLocal;
+}
+
+uint32_t CSpliceCRC::MultiplyMod(const uint32_t& uA, const uint32_t& uB) {
+	uint32_t uProduct = 0;
+	for (int i = 31;i >= 0;i--) {
+		uProduct = (uProduct & 0x80000000) ? ((uProduct << 1) ^ uPolynomial) : (uProduct << 1);
+		if ((uB >> i) & 1) {
+			uProduct ^= uA;
+		}
+	}
+	return uProduct;
+}
+
+uint32_t CSpliceCRC::ShiftZeros(const uint32_t& uCrc, std::size_t iZeroBytes) {
+	//x^8 mod polynomial is the effect of a single zero byte; square it for every further power of two
+	static const struct SZeroPowers {
+		uint32_t values[64];
+		SZeroPowers() {
+			values[0] = 0x100;
+			for (int i = 1;i < 64;i++) {
+				values[i] = MultiplyMod(values[i - 1], values[i - 1]);
+			}
+		}
+	} objPowers;
+
+	uint32_t uLocal = uCrc;
+	for (int i = 0;iZeroBytes != 0 && i < 64;i++, iZeroBytes >>= 1) {
+		if (iZeroBytes & 1) {
+			uLocal = MultiplyMod(uLocal, objPowers.values[i]);
+		}
+	}
+	return uLocal;
+}
+
+};
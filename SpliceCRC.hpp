@@ -0,0 +1,72 @@
+/*! \file SpliceCRC.hpp
+*	\brief Splice CRC utility class declaration.
+*	\details Header file for declaration of class CSpliceCRC whose definition is in SpliceCRC.cpp. Implements the CRC_32 (MPEG-2) used by the splice_info_section.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICECRC_HPP_
+/*! \brief SpliceCRC.hpp header guard define.
+*/
+#define _SPLICECRC_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CSpliceCRC
+*	\brief #CSpliceCRC class is the utility for computing the CRC_32 of a splice_info_section.
+*
+*	The CRC is the ISO/IEC 13818-1 Annex A CRC-32 (polynomial 0x04C11DB7, initial value 0xFFFFFFFF, not reflected, no final XOR).
+*	Since this CRC is linear, a change to a few bytes of a section can be folded into an existing CRC_32 without re-reading the section (see #CSpliceCRC::ShiftZeros).
+*/
+class CSpliceCRC {
+public:
+	/*! \brief Generator polynomial of the MPEG-2 CRC-32.
+	*/
+	static const uint32_t uPolynomial = 0x04C11DB7;
+	/*! \brief Initial register value of the MPEG-2 CRC-32.
+	*/
+	static const uint32_t uInitial = 0xFFFFFFFF;
+
+	/*! \brief Function to compute the CRC_32 of a byte range.
+	*	\param pData an input byte data.
+	*	\param iLength number of bytes in pData.
+	*	\returns CRC_32 value of the input bytes.
+	*/
+	static uint32_t Compute(const uint8_t* pData, const std::size_t& iLength);
+
+	/*! \brief Function to continue a CRC computation over more bytes.
+	*	\param uCrc the current CRC register value (use #uInitial to start, 0 for a pure difference CRC).
+	*	\param pData an input byte data.
+	*	\param iLength number of bytes in pData.
+	*	\returns updated CRC register value.
+	*/
+	static uint32_t Update(const uint32_t& uCrc, const uint8_t* pData, const std::size_t& iLength);
+
+	/*! \brief Function to advance a CRC register over a run of zero bytes.
+	*
+	*	Equivalent to calling #Update with iZeroBytes zero bytes, but costs at most one GF(2) multiplication per set bit of iZeroBytes instead of one table step per byte.
+	*	\param uCrc the current CRC register value.
+	*	\param iZeroBytes number of zero bytes to advance.
+	*	\returns CRC register value after the zero bytes.
+	*/
+	static uint32_t ShiftZeros(const uint32_t& uCrc, std::size_t iZeroBytes);
+
+private:
+	/*! \brief Function to multiply two polynomials modulo the CRC generator polynomial.
+	*	\param uA first polynomial.
+	*	\param uB second polynomial.
+	*	\returns product of uA and uB modulo #uPolynomial.
+	*/
+	static uint32_t MultiplyMod(const uint32_t& uA, const uint32_t& uB);
+};
+
+};
+
+#endif
@@ -0,0 +1,179 @@
+/*! \file SpliceCache.cpp
+*	\brief Splice parsed-cue cache class definition.
+*	\details CPP file for definition of class CSpliceCache whose declaration is in SpliceCache.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceCache.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Number of trailing input characters hashed into the key, enough to cover CRC_32 in every encoding.
+*/
+static const std::size_t iKeyTailLength = 64;
+
+/*! \brief Smallest number of entries per shard, small caches use fewer shards.
+*/
+static const std::size_t iMinShardCapacity = 8;
+
+CSpliceCache::CSpliceCache(const std::size_t& iCapacity, const std::size_t& iShardCount) :
+m_iCapacity(iCapacity),
+m_iShardCount(iShardCount),
+m_iShardCapacity(0),
+m_pShards(nullptr),
+m_pMetrics(nullptr)
+{
+	if (m_iShardCount == 0) {
+		m_iShardCount = 1;
+	}
+	//Keep at least iMinShardCapacity entries per shard so an uneven key spread does not evict small caches early
+	if (m_iShardCount > m_iCapacity / iMinShardCapacity) {
+		m_iShardCount = m_iCapacity / iMinShardCapacity;
+	}
+	if (m_iShardCount == 0) {
+		m_iShardCount = 1;
+	}
+	m_iShardCapacity = (m_iCapacity + m_iShardCount - 1) / m_iShardCount;
+
+	m_pShards.reset(new SCacheShard[m_iShardCount]);
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		m_pShards[i].mIndex.reserve(m_iShardCapacity);
+		m_pShards[i].uHits = 0;
+		m_pShards[i].uMisses = 0;
+	}
+}
+
+uint64_t CSpliceCache::GetKey(const scte35Input::type& eInput, const std::string& sInput) {
+	//FNV-1a over encoding, length and the input tail (CRC_32 is at the end of the section)
+	uint64_t uHash = 0xcbf29ce484222325ULL;
+	const uint64_t uPrime = 0x100000001b3ULL;
+
+	uint64_t uHeader = ((uint64_t)eInput << 56) ^ (uint64_t)sInput.length();
+	for (int i = 0;i < 8;i++) {
+		uHash = (uHash ^ ((uHeader >> (i * 8)) & 0xff)) * uPrime;
+	}
+
+	std::size_t iStart = sInput.length() > iKeyTailLength ? sInput.length() - iKeyTailLength : 0;
+	for (std::size_t i = iStart;i < sInput.length();i++) {
+		uHash = (uHash ^ (unsigned char)sInput[i]) * uPrime;
+	}
+	return uHash;
+}
+
+CSpliceCache::ResultPtr CSpliceCache::ParseNew(const scte35Input::type& eInput, const std::string& sInput) const {
+	std::shared_ptr<CSpliceClass> pParser = std::make_shared<CSpliceClass>();
+	pParser->SetMetrics(m_pMetrics);
+
+	bool bSuccess = false;
+	switch (eInput)
+	{
+		case scte35Input::binary: bSuccess = pParser->ParseBinary(sInput); break;
+		case scte35Input::hexa: bSuccess = pParser->ParseHexa(sInput); break;
+		case scte35Input::base64: bSuccess = pParser->ParseBase64(sInput); break;
+		default: break;
+	}
+
+	if (!bSuccess) {
+		return nullptr;
+	}
+	return pParser;
+}
+
+CSpliceCache::ResultPtr CSpliceCache::Parse(const scte35Input::type& eInput, const std::string& sInput) {
+	if (m_iCapacity == 0) {
+		return ParseNew(eInput, sInput);
+	}
+
+	uint64_t uKey = GetKey(eInput, sInput);
+	SCacheShard& objShard = m_pShards[(uKey >> 32) % m_iShardCount];
+
+	{
+		std::lock_guard<std::mutex> objLock(objShard.objMutex);
+		auto itIndex = objShard.mIndex.find(uKey);
+		if (itIndex != objShard.mIndex.end() && itIndex->second->eInput == eInput && itIndex->second->sInput == sInput) {
+			objShard.lEntries.splice(objShard.lEntries.begin(), objShard.lEntries, itIndex->second);
+			objShard.uHits++;
+			return itIndex->second->pResult;
+		}
+		objShard.uMisses++;
+	}
+
+	//Parse outside the lock so other cues of this shard are not blocked
+	ResultPtr pResult = ParseNew(eInput, sInput);
+	if (pResult == nullptr) {
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> objLock(objShard.objMutex);
+	auto itIndex = objShard.mIndex.find(uKey);
+	if (itIndex != objShard.mIndex.end()) {
+		//Same key inserted meanwhile by another thread or a colliding input, keep the newest
+		objShard.lEntries.erase(itIndex->second);
+		objShard.mIndex.erase(itIndex);
+	}
+
+	objShard.lEntries.push_front(SCacheEntry{ uKey, eInput, sInput, pResult });
+	objShard.mIndex[uKey] = objShard.lEntries.begin();
+
+	while (objShard.lEntries.size() > m_iShardCapacity) {
+		objShard.mIndex.erase(objShard.lEntries.back().uKey);
+		objShard.lEntries.pop_back();
+	}
+
+	return pResult;
+}
+
+CSpliceCache::ResultPtr CSpliceCache::ParseBinary(const std::string& sInput) {
+	return Parse(scte35Input::binary, sInput);
+}
+
+CSpliceCache::ResultPtr CSpliceCache::ParseHexa(const std::string& sInput) {
+	return Parse(scte35Input::hexa, sInput);
+}
+
+CSpliceCache::ResultPtr CSpliceCache::ParseBase64(const std::string& sInput) {
+	return Parse(scte35Input::base64, sInput);
+}
+
+uint64_t CSpliceCache::GetHits() const {
+	uint64_t uTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		std::lock_guard<std::mutex> objLock(m_pShards[i].objMutex);
+		uTotal += m_pShards[i].uHits;
+	}
+	return uTotal;
+}
+
+uint64_t CSpliceCache::GetMisses() const {
+	uint64_t uTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		std::lock_guard<std::mutex> objLock(m_pShards[i].objMutex);
+		uTotal += m_pShards[i].uMisses;
+	}
+	return uTotal;
+}
+
+std::size_t CSpliceCache::GetSize() const {
+	std::size_t iTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		std::lock_guard<std::mutex> objLock(m_pShards[i].objMutex);
+		iTotal += m_pShards[i].lEntries.size();
+	}
+	return iTotal;
+}
+
+void CSpliceCache::ResetValue() {
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		std::lock_guard<std::mutex> objLock(m_pShards[i].objMutex);
+		m_pShards[i].mIndex.clear();
+		m_pShards[i].lEntries.clear();
+		m_pShards[i].uHits = 0;
+		m_pShards[i].uMisses = 0;
+	}
+}
+
+};
@@ -0,0 +1,157 @@
+/*! \file SpliceCache.hpp
+*	\brief Splice parsed-cue cache class declaration.
+*	\details Header file for declaration of class CSpliceCache whose definition is in SpliceCache.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICECACHE_HPP_
+/*! \brief SpliceCache.hpp header guard define.
+*/
+#define _SPLICECACHE_HPP_
+
+#include "SpliceClass.hpp"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Input
+*	\brief scte35Input structure to hold the textual input encodings accepted by the parse entry points.
+*/
+struct scte35Input {
+	/*!
+	*	\brief A type definition for type (Input encodings)
+	*/
+	typedef enum {
+		binary = 0,		/*!<Binary textual data (CSpliceClass::ParseBinary)*/
+		hexa = 1,		/*!<Hexa-decimal textual data (CSpliceClass::ParseHexa)*/
+		base64 = 2		/*!<Base64 textual data (CSpliceClass::ParseBase64)*/
+	}type;
+};
+
+/*!	\class CSpliceCache
+*	\brief #CSpliceCache class is a bounded, thread-safe LRU cache of parsed cues placed in front of the #CSpliceClass parse entry points.
+*
+*	Repeated cues (the same section sent again for robustness or listed again on every playlist refresh) are parsed once and then shared.
+*	The key is a hash of the input encoding, the input length and the input tail, which carries CRC_32 of the section, and a hit is confirmed
+*	by comparing the full input text. A hit only locks one shard, moves the entry to the front and copies a shared pointer: nothing is decoded
+*	or allocated. Failed parses are not cached. Entries are spread over shards, each with its own mutex and LRU list, so the capacity is
+*	shared evenly between the shards.
+*/
+class CSpliceCache {
+public:
+	/*! \brief Shared immutable parsed cue returned by the cache, nullptr if the input does not parse.
+	*/
+	typedef std::shared_ptr<const CSpliceClass> ResultPtr;
+
+	/*! \brief #CSpliceCache class constructor.
+	*	\param iCapacity maximum number of cached cues, 0 to disable caching (every call parses).
+	*	\param iShardCount number of independently locked shards, reduced so every shard holds at least 8 cues (0 is taken as 1).
+	*/
+	explicit CSpliceCache(const std::size_t& iCapacity, const std::size_t& iShardCount = 16);
+
+	/*!	\brief Deleted copy constructor so #CSpliceCache class object cannot be copied.
+	*/
+	CSpliceCache(const CSpliceCache&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceCache class object cannot be assigned.
+	*/
+	void operator=(const CSpliceCache&) = delete;
+
+	/*!	\brief Function to get the parsed cue of binary textual data (without spaces).
+	*	\param sInput an input binary string data.
+	*	\returns shared parsed cue or nullptr if parsing failed.
+	*/
+	ResultPtr ParseBinary(const std::string& sInput);
+
+	/*!	\brief Function to get the parsed cue of hexa-decimal textual data (without spaces).
+	*	\param sInput an input hexa-decimal string data (upper and lower case inputs are cached separately).
+	*	\returns shared parsed cue or nullptr if parsing failed.
+	*/
+	ResultPtr ParseHexa(const std::string& sInput);
+
+	/*!	\brief Function to get the parsed cue of Base64 textual data (without spaces).
+	*	\param sInput an input Base64 string data.
+	*	\returns shared parsed cue or nullptr if parsing failed.
+	*/
+	ResultPtr ParseBase64(const std::string& sInput);
+
+	/*!	\brief Function to get the parsed cue of textual data in any supported encoding.
+	*	\param eInput encoding of sInput.
+	*	\param sInput an input string data.
+	*	\returns shared parsed cue or nullptr if parsing failed.
+	*/
+	ResultPtr Parse(const scte35Input::type& eInput, const std::string& sInput);
+
+	/*!	\brief Function to attach metrics to the parsers created on cache misses (hits are not parsed so they are not counted there).
+	*	\param pMetrics metrics object (not owned, must outlive this object and the returned cues, or be detached with nullptr).
+	*/
+	void SetMetrics(CSpliceMetrics* pMetrics) { m_pMetrics = pMetrics; }
+
+	/*! \brief Function to get the number of calls answered from the cache.
+	*/
+	uint64_t GetHits() const;
+	/*! \brief Function to get the number of calls which had to parse.
+	*/
+	uint64_t GetMisses() const;
+	/*! \brief Function to get the number of cached cues.
+	*/
+	std::size_t GetSize() const;
+
+	/*!	\brief Function to drop all the cached cues and reset the hit and miss counters. Cues already returned stay valid.
+	*/
+	void ResetValue();
+
+private:
+	/*!	\struct SCacheEntry
+	*	\brief #SCacheEntry structure holding one cached cue.
+	*/
+	struct SCacheEntry {
+		uint64_t uKey;					/*!<Hash key of the input.*/
+		scte35Input::type eInput;		/*!<Input encoding.*/
+		std::string sInput;				/*!<Full input text, compared on every hit.*/
+		ResultPtr pResult;				/*!<Parsed cue.*/
+	};
+
+	/*!	\struct SCacheShard
+	*	\brief #SCacheShard structure holding one independently locked part of the cache.
+	*/
+	struct SCacheShard {
+		mutable std::mutex objMutex;													/*!<Lock of this shard.*/
+		std::list<SCacheEntry> lEntries;												/*!<Entries, most recently used first.*/
+		std::unordered_map<uint64_t, std::list<SCacheEntry>::iterator> mIndex;		/*!<Entries by hash key.*/
+		uint64_t uHits;																	/*!<Calls answered from this shard.*/
+		uint64_t uMisses;																/*!<Calls which had to parse.*/
+	};
+
+	/*! \brief Function to compute the hash key of an input.
+	*	\param eInput encoding of sInput.
+	*	\param sInput an input string data.
+	*	\returns 64-bit hash key.
+	*/
+	static uint64_t GetKey(const scte35Input::type& eInput, const std::string& sInput);
+
+	/*! \brief Function to parse an input with a new #CSpliceClass object.
+	*	\param eInput encoding of sInput.
+	*	\param sInput an input string data.
+	*	\returns parsed cue or nullptr if parsing failed.
+	*/
+	ResultPtr ParseNew(const scte35Input::type& eInput, const std::string& sInput) const;
+
+	std::size_t m_iCapacity;						/*!<Maximum number of cached cues.*/
+	std::size_t m_iShardCount;						/*!<Number of shards.*/
+	std::size_t m_iShardCapacity;					/*!<Maximum number of cached cues per shard.*/
+	std::unique_ptr<SCacheShard[]> m_pShards;		/*!<Shards.*/
+	CSpliceMetrics* m_pMetrics;					/*!<Metrics given to the parsers created on misses, not owned.*/
+};
+
+};
+
+#endif
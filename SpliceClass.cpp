@@ -7,6 +7,14 @@
 */
 
 #include "SpliceClass.hpp"
+#include "SpliceMetrics.hpp"
+#include "SpliceCRC.hpp"
+#include "SpliceFilter.hpp"
+#include "SpliceProjection.hpp"
+#include "SpliceLayout.hpp"
+#include "SpliceBitKernel.hpp"
+#include "SpliceDescriptorRegistry.hpp"
+#include "SpliceUpid.hpp"
 #include <stdexcept>      //for std::invalid_argument
 #include <bitset>		// for bit string conversion
 #include <sstream>		//for std::stringstream
@@ -29,6 +37,8 @@ void CSpliceClass::RemoveSpaces(std::string& sParam) {
 
 std::string CSpliceClass::Base64ToHexa(const std::string& str)
 {
+	SCTE35_PROFILE_STAGE(scte35Stage::input_decode);
+
 	std::string finalStr = "";
 	std::string refData = "0123456789abcdef";
 
@@ -129,6 +139,8 @@ const char* CSpliceClass::hexa2binary(char ch)
 
 std::string CSpliceClass::HexaStr2BinaryStr(const std::string& hex)
 {
+	SCTE35_PROFILE_STAGE(scte35Stage::input_decode);
+
 	std::string binary;
 	for (unsigned i = 0; i != hex.length(); ++i) {
 		binary += hexa2binary(hex[i]);
@@ -291,7 +303,16 @@ void SInfoData::ClearValues() {
 	CRC_32 = PARAMETER_DEF_VAL;
 }
 
-CSpliceClass::CSpliceClass()
+CSpliceClass::CSpliceClass() :
+m_pDescriptorRegistry(nullptr),
+m_eLastError(scte35Error::none),
+m_eLastErrorField(scte35Field::input),
+m_pMetrics(nullptr),
+m_bPreFilter(false),
+m_bPreFilterCRC(false),
+m_bFastPath(true),
+m_uFastPathHits(0),
+m_uFastPathFallbacks(0)
 {
 	ResetValue();
 }
@@ -313,136 +334,68 @@ void CSpliceClass::ResetValue() {
 	m_SInfoData.ClearValues();
 }
 
-bool CSpliceClass::ParseSInfoDataFirst() {
-
-	bool bSuccess = false;
-
-	m_SInfoData.table_id = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::table_id, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::table_id;
-
-	m_SInfoData.section_syntax_indicator = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::section_syntax_indicator, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::section_syntax_indicator;
-
-	m_SInfoData.private_indicator = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::private_indicator, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::private_indicator;
-
-	m_SInfoData.reserved = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::reserved, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::reserved;
-
-	m_SInfoData.section_length = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::section_length, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::section_length;
-
-	m_SInfoData.protocol_version = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::protocol_version, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::protocol_version;
-
-	m_SInfoData.encrypted_packet = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::encrypted_packet, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::encrypted_packet;
-
-
-	m_SInfoData.encryption_algorithm = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::encryption_algorithm, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::encryption_algorithm;
-
-
-	m_SInfoData.pts_adjustment = GetValue_info_64bit(sBinData, iCurrentBitPoint, false, SInfoLength::pts_adjustment, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::pts_adjustment;
-
-	m_SInfoData.cw_index = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::cw_index, bSuccess);
-	if (!bSuccess) {
+/*! \brief Function to read a loop of 8-bit values (DTMF characters, UPID bytes) at a bit string position.
+*	\returns true and moves iPos past the loop if all of it is there, false otherwise (iPos unchanged). A value holding another character
+*	than '0' or '1' is read as 0.
+*/
+static bool ReadByteLoop(const std::string& sBits, int& iPos, const std::size_t& iCount, std::vector<uint32_t>& vValues) {
+	if (iPos < 0 || sBits.length() < (std::size_t)iPos + iCount * 8) {
 		return false;
 	}
-	iCurrentBitPoint += SInfoLength::cw_index;
-
 
-	m_SInfoData.tier = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::tier, bSuccess);
-	if (!bSuccess) {
-		return false;
+	vValues.reserve(vValues.size() + iCount);
+	for (std::size_t i = 0;i < iCount;i++) {
+		uint8_t uValue = 0;
+		if (!CSpliceBitKernel::PackBits(sBits.data() + iPos, 8, &uValue)) {
+			uValue = 0;
+		}
+		vValues.emplace_back(uValue);
+		iPos += 8;
 	}
-	iCurrentBitPoint += SInfoLength::tier;
+	return true;
+}
 
-	m_SInfoData.splice_command_length = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::splice_command_length, bSuccess);
-	if (!bSuccess) {
-		return false;
-	}
-	iCurrentBitPoint += SInfoLength::splice_command_length;
+bool CSpliceClass::ParseSInfoDataFirst() {
 
+	SCTE35_PROFILE_STAGE(scte35Stage::sinfo_first);
 
-	m_SInfoData.splice_command_type = GetValue_info_32bit(sBinData, iCurrentBitPoint, false, SInfoLength::splice_command_type, bSuccess);
-	if (!bSuccess) {
-		return false;
+	//Whole header at once when it is all there, field by field otherwise (same result, partial fields on truncation)
+	uint8_t uHeader[CSpliceBitKernel::iInfoHeaderBytes];
+	if (iCurrentBitPoint >= 0 && sBinData.length() >= (std::size_t)iCurrentBitPoint + sizeof(uHeader) * 8 && CSpliceBitKernel::PackBits(sBinData.data() + iCurrentBitPoint, sizeof(uHeader) * 8, uHeader)) {
+		CSpliceBitKernel::ExtractInfoHeader(uHeader, m_SInfoData);
+		iCurrentBitPoint += (int)sizeof(uHeader) * 8;
+		return true;
 	}
-	iCurrentBitPoint += SInfoLength::splice_command_type;
 
-	return true;
+	return CSpliceLayout<SInfoHeaderLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_SInfoData);
 }
-std::stringstream CSpliceClass::GetTextSInfoDataFirst(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetTextSInfoDataFirst(const bool& bIfSingleLine) const {
 	std::stringstream sLocalStr;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
 		sSepLocal = sCommaOnly;
 	}
 
-	sLocalStr << "table_id=" << m_SInfoData.table_id << sSepLocal;
-	sLocalStr << "section_syntax_indicator=" << m_SInfoData.section_syntax_indicator << sSepLocal;
-	sLocalStr << "private_indicator=" << m_SInfoData.private_indicator << sSepLocal;
-	sLocalStr << "reserved=" << m_SInfoData.reserved << sSepLocal;
-	sLocalStr << "section_length=" << m_SInfoData.section_length << sSepLocal;
-	sLocalStr << "protocol_version=" << m_SInfoData.protocol_version << sSepLocal;
-	sLocalStr << "encrypted_packet=" << m_SInfoData.encrypted_packet << sSepLocal;
-	sLocalStr << "encryption_algorithm=" << m_SInfoData.encryption_algorithm << sSepLocal;
-	sLocalStr << "pts_adjustment=" << m_SInfoData.pts_adjustment << sSepLocal;
-	sLocalStr << "cw_index=" << m_SInfoData.cw_index << sSepLocal;
-	sLocalStr << "tier=" << m_SInfoData.tier << sSepLocal;
-	sLocalStr << "splice_command_length=" << m_SInfoData.splice_command_length << sSepLocal;
-	sLocalStr << "splice_command_type=" << m_SInfoData.splice_command_type << sSepLocal;
+	CSpliceLayout<SInfoHeaderLayout>::AppendText(m_SInfoData, sLocalStr, sSepLocal);
 
 	return sLocalStr;
 }
 
 bool CSpliceClass::ParseSInfoDataSecond() {
 
-	bool bSuccess = false;
-
-	m_SInfoData.descriptor_loop_length = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 16, bSuccess);
-	if (!bSuccess) { return false; }
+	SCTE35_PROFILE_STAGE(scte35Stage::sinfo_second);
 
-	return true;
+	return CSpliceLayout<SInfoLoopLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_SInfoData);
 }
 
-std::stringstream CSpliceClass::GetTextSInfoDataSecond(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetTextSInfoDataSecond(const bool& bIfSingleLine) const {
 	std::stringstream sLocalStr;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
 		sSepLocal = sCommaOnly;
 	}
 
-	sLocalStr << "descriptor_loop_length=" << m_SInfoData.descriptor_loop_length << sSepLocal;
+	CSpliceLayout<SInfoLoopLayout>::AppendText(m_SInfoData, sLocalStr, sSepLocal);
 
 	return sLocalStr;
 }
@@ -476,7 +429,8 @@ void CSpliceClass::Clear_Command_Type() {
 }
 
 bool CSpliceClass::Parse_Command_Type() {
-	
+	SCTE35_PROFILE_STAGE(scte35Stage::command_type);
+
 	switch (m_SInfoData.splice_command_type)
 	{
 		case scte35Cmd::splice_null: {
@@ -510,14 +464,14 @@ bool CSpliceClass::Parse_Command_Type() {
 			}
 		}break;
 		default: {
-			return false;//Unknown data
+			return SetParseError(scte35Error::unknown_command, scte35Field::splice_command);//Unknown data
 		}
 		break;
 	}
 	return true;
 }
 
-std::stringstream CSpliceClass::GetText_Command_Type(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Command_Type(const bool& bIfSingleLine) const {
 	std::stringstream sLocalStr;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -555,18 +509,36 @@ std::stringstream CSpliceClass::GetText_Command_Type(const bool& bIfSingleLine)
 }
 
 bool CSpliceClass::ParseHexa(const std::string& sInput) {
+
+	m_eLastError = scte35Error::none;
 	
 	if (sInput.empty()) {
-		return false;
+		return SetParseError(scte35Error::empty_input, scte35Field::input);
 	}
 
 	int nBinLength = sInput.length();
 	if (nBinLength % 2 != 0) {//should be of even length
-		return false;
+		return SetParseError(scte35Error::odd_length, scte35Field::input);
 	}
 
 	if (!SpacesNotPresent(sInput)) {
-		return false;
+		return SetParseError(scte35Error::white_space, scte35Field::input);
+	}
+
+	if (m_bPreFilter) {
+		scte35Verdict::type eVerdict = CSpliceFilter::CheckHexa(sInput, m_bPreFilterCRC);
+		if (eVerdict != scte35Verdict::accept) {
+			ResetValue();
+			return SetParseError(scte35Error::rejected, eVerdict == scte35Verdict::crc ? scte35Field::crc : (eVerdict == scte35Verdict::bad_character || eVerdict == scte35Verdict::short_input ? scte35Field::input : scte35Field::splice_info_section));
+		}
+	}
+
+	if (m_bFastPath) {
+		if (ParseTimeSignalFast(sInput)) {
+			m_uFastPathHits++;
+			return true;
+		}
+		m_uFastPathFallbacks++;
 	}
 
 	std::string sLocalBinary;
@@ -579,17 +551,20 @@ bool CSpliceClass::ParseHexa(const std::string& sInput) {
 }
 
 bool CSpliceClass::ParseBinary(const std::string& sInput) {
+
+	m_eLastError = scte35Error::none;
+
 	if (sInput.empty()) {
-		return false;
+		return SetParseError(scte35Error::empty_input, scte35Field::input);
 	}
 
 	int nBinLength = sInput.length();
 	if (nBinLength % 2 != 0) {//should be of even length
-		return false;
+		return SetParseError(scte35Error::odd_length, scte35Field::input);
 	}
 
 	if (!SpacesNotPresent(sInput)) {
-		return false;
+		return SetParseError(scte35Error::white_space, scte35Field::input);
 	}
 
 	ResetValue();
@@ -597,22 +572,19 @@ bool CSpliceClass::ParseBinary(const std::string& sInput) {
 	sBinData = sInput;
 
 	if (!ParseSInfoDataFirst()) {
-		return false;
+		return SetParseError(scte35Error::truncated, scte35Field::splice_info_section);
 	}
 
-	int iOldPoint = iCurrentBitPoint;
-
 	if (!Parse_Command_Type()) {
-		return false;
+		return SetParseError(scte35Error::truncated, GetCommandField(m_SInfoData.splice_command_type));
 	}
 
-	if (m_SInfoData.section_length == (iCurrentBitPoint - iOldPoint)) {
-		//Successfully parsed command section
-	}
+	//Lengths are not compared with the bytes the structures use here : CSpliceValidator checks section_length, splice_command_length and
+	//descriptor_loop_length with the other rules a parse does not enforce
 
 	//For parsing descriptor section
 	if (!ParseSInfoDataSecond()) {
-		return false;
+		return SetParseError(scte35Error::truncated, scte35Field::splice_info_section);
 	}
 
 	//================================== Descriptors =========================================//
@@ -620,7 +592,7 @@ bool CSpliceClass::ParseBinary(const std::string& sInput) {
 	int iDescLocal = (int)m_SInfoData.descriptor_loop_length * 8;
 
 	if (nBinLength<(iCurrentBitPoint + iDescLocal)) {
-		return false;
+		return SetParseError(scte35Error::descriptor_overrun, scte35Field::descriptor_loop);
 	}
 
 	sDescriptorData = sInput.substr(iCurrentBitPoint, iDescLocal);
@@ -629,7 +601,7 @@ bool CSpliceClass::ParseBinary(const std::string& sInput) {
 	}
 	else {
 		if (!Parse_Splice_Descriptor(m_SInfoData.descriptor_loop_length)) {
-			return false;
+			return SetParseError(scte35Error::truncated, scte35Field::descriptor_loop);
 		}
 	}
 
@@ -637,27 +609,28 @@ bool CSpliceClass::ParseBinary(const std::string& sInput) {
 
 	iCurrentBitPoint += iDescLocal;
 
-	bool bSuccess = false;
-
 	if (m_SInfoData.encrypted_packet==1) {
-		m_SInfoData.E_CRC_32 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 32, bSuccess);
-		if (!bSuccess) { return false; }
+		if (!CSpliceLayout<SInfoECRCLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_SInfoData)) { return SetParseError(scte35Error::truncated, scte35Field::crc); }
 	}
 
-	m_SInfoData.CRC_32 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 32, bSuccess);
-	if (!bSuccess) { return false; }
+	if (!CSpliceLayout<SInfoCRCLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_SInfoData)) { return SetParseError(scte35Error::truncated, scte35Field::crc); }
+
+	RecordParseSuccess(nullptr);
 
 	return true;
 }
 
 bool CSpliceClass::ParseBase64(const std::string& sInput) {
+
+	m_eLastError = scte35Error::none;
+
 	if (sInput.empty()) {
-		return false;
+		return SetParseError(scte35Error::empty_input, scte35Field::input);
 	}
 
 	std::string sRetLocal = Base64ToHexa(sInput);
 	if (sRetLocal.empty()) {
-		return false;
+		return SetParseError(scte35Error::base64_decode, scte35Field::input);
 	}
 	
 	if (ParseHexa(sRetLocal)) {
@@ -667,7 +640,234 @@ bool CSpliceClass::ParseBase64(const std::string& sInput) {
 	return false;
 }
 
-std::string CSpliceClass::GetText(const bool& bIfSingleLine) {
+void CSpliceClass::SetMetrics(CSpliceMetrics* pMetrics) {
+	m_pMetrics = pMetrics;
+}
+
+void CSpliceClass::SetDescriptorRegistry(const CSpliceDescriptorRegistry* pRegistry) {
+	m_pDescriptorRegistry = pRegistry;
+}
+
+void CSpliceClass::SetPreFilter(const bool& bEnable, const bool& bCheckCRC) {
+	m_bPreFilter = bEnable;
+	m_bPreFilterCRC = bCheckCRC;
+}
+
+void CSpliceClass::SetFastPath(const bool& bEnable) {
+	m_bFastPath = bEnable;
+}
+
+/*! \brief Largest section decoded by the time_signal fast path, longer cues take the general path.
+*/
+static const std::size_t iFastPathMaxBytes = 256;
+/*! \brief Most segmentation_descriptor handled by the time_signal fast path.
+*/
+static const std::size_t iFastPathMaxDescriptors = 4;
+
+/*! \brief Function to read a big-endian 32-bit value.
+*/
+static inline uint32_t FastRead32(const uint8_t* p) {
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+bool CSpliceClass::ParseTimeSignalFast(const std::string& sInput) {
+
+	SCTE35_PROFILE_STAGE(scte35Stage::fast_path);
+
+	std::size_t iBytes = sInput.length() / 2;
+	if (sInput.length() % 2 != 0 || iBytes < 20 || iBytes > iFastPathMaxBytes) {
+		return false;
+	}
+
+	uint8_t uData[iFastPathMaxBytes];
+	if (!CSpliceProjection::HexaToBytes(sInput.data(), iBytes, uData)) {
+		return false;
+	}
+
+	//Shape check before touching any member : clear time_signal, segmentation_descriptor only, section filling the input exactly
+	std::size_t iSectionEnd = 3 + (((std::size_t)(uData[1] & 0x0F) << 8) | uData[2]);
+	if (iSectionEnd != iBytes || (uData[4] & 0x80) != 0 || uData[13] != scte35Cmd::time_signal) {
+		return false;
+	}
+
+	uint32_t uCommandLength = ((uint32_t)(uData[11] & 0x0F) << 8) | uData[12];
+	bool bTimeSpecified = (uData[14] & 0x80) != 0;
+	if (uCommandLength != (bTimeSpecified ? 5u : 1u)) {
+		return false;
+	}
+
+	std::size_t iLoopStart = 14 + uCommandLength;
+	std::size_t iLoopLength = ((std::size_t)uData[iLoopStart] << 8) | uData[iLoopStart + 1];
+	std::size_t iLoopEnd = iLoopStart + 2 + iLoopLength;
+	if (iLoopEnd + 4 != iSectionEnd) {
+		return false;
+	}
+
+	std::size_t iDescriptorStart[iFastPathMaxDescriptors];
+	std::size_t iDescriptorCount = 0;
+	std::size_t iPos = iLoopStart + 2;
+	while (iPos < iLoopEnd) {
+		if (iDescriptorCount == iFastPathMaxDescriptors || iPos + 2 > iLoopEnd) {
+			return false;
+		}
+
+		std::size_t iBodyEnd = iPos + 2 + uData[iPos + 1];
+		if (uData[iPos] != scte35Desc::segmentation_descriptor || iBodyEnd > iLoopEnd || iPos + 11 > iBodyEnd || FastRead32(uData + iPos + 2) != 0x43554549) {
+			return false;
+		}
+
+		//Walk the fields the general path reads to check they fit the descriptor
+		if ((uData[iPos + 10] & 0x80) == 0) {
+			std::size_t iField = iPos + 11;
+			if (iField + 1 > iBodyEnd || (uData[iField] & 0x80) == 0) {
+				return false;/*Component segmentation takes the general path*/
+			}
+			iField += 1 + (((uData[iField] & 0x40) != 0) ? 5 : 0);
+			if (iField + 2 > iBodyEnd) {
+				return false;
+			}
+			iField += 2 + uData[iField + 1];
+			if (iField + 3 > iBodyEnd) {
+				return false;
+			}
+		}
+
+		iDescriptorStart[iDescriptorCount++] = iPos;
+		iPos = iBodyEnd;
+	}
+
+	ResetValue();
+	//The views of the descriptors point into the parser buffer, as on the general path
+	m_vDescriptorBytes.assign(uData + iLoopStart + 2, uData + iLoopEnd);
+	const uint8_t* pLoop = m_vDescriptorBytes.data();
+
+	//Sizes were all checked above, the decoders cannot fail from here
+	std::size_t iBits = 0;
+	CSpliceBitKernel::ExtractInfoHeader(uData, m_SInfoData);
+	CSpliceLayout<SpliceTimeLayout>::Decode(uData + 14, uCommandLength, m_objTimeSignal, iBits);
+	CSpliceLayout<SInfoLoopLayout>::Decode(uData + iLoopStart, 2, m_SInfoData, iBits);
+
+	for (std::size_t k = 0;k < iDescriptorCount;k++) {
+		const uint8_t* pDesc = uData + iDescriptorStart[k];
+		std::size_t iDescBytes = 2 + (std::size_t)pDesc[1];
+		SegmentationDescriptor* pobjLocal = new SegmentationDescriptor();
+
+		CSpliceLayout<SegmentationDescriptorLayout>::Decode(pDesc, iDescBytes, *pobjLocal, iBits);
+		std::size_t iDescPos = iBits / 8;
+
+		if (pobjLocal->segmentation_event_cancel_indicator == 0) {
+			if (pobjLocal->segmentation_duration_flag == 1) {
+				CSpliceLayout<SegmentationDurationLayout>::Decode(pDesc + iDescPos, iDescBytes - iDescPos, *pobjLocal, iBits);
+				iDescPos += iBits / 8;
+			}
+
+			CSpliceLayout<SegmentationUpidLayout>::Decode(pDesc + iDescPos, iDescBytes - iDescPos, *pobjLocal, iBits);
+			iDescPos += iBits / 8;
+			if (pobjLocal->segmentation_upid_length > 0) {
+				pobjLocal->pUpid = pLoop + (iDescriptorStart[k] - iLoopStart - 2) + iDescPos;
+			}
+			pobjLocal->v_upid_list.reserve(pobjLocal->segmentation_upid_length);
+			for (uint32_t g = 0;g < pobjLocal->segmentation_upid_length;g++) {
+				pobjLocal->v_upid_list.emplace_back(pDesc[iDescPos + g]);
+			}
+			iDescPos += pobjLocal->segmentation_upid_length;
+
+			CSpliceLayout<SegmentationTypeLayout>::Decode(pDesc + iDescPos, iDescBytes - iDescPos, *pobjLocal, iBits);
+			iDescPos += iBits / 8;
+
+			if (pobjLocal->segmentation_type_id == 0x34 || pobjLocal->segmentation_type_id == 0x36 || pobjLocal->segmentation_type_id == 0x38 || pobjLocal->segmentation_type_id == 0x3A) {
+				//Optional, as in the general path missing bytes leave the default value
+				if (!CSpliceLayout<SubSegmentLayout>::Decode(pDesc + iDescPos, iDescBytes - iDescPos, *pobjLocal, iBits) && iDescPos < iDescBytes) {
+					pobjLocal->sub_segment_num = pDesc[iDescPos];
+				}
+			}
+		}
+
+		m_objSpliceDescriptor.v_SDChilds.emplace_back(pobjLocal);
+	}
+
+	CSpliceLayout<SInfoCRCLayout>::Decode(uData + iLoopEnd, 4, m_SInfoData, iBits);
+	iCurrentBitPoint = (int)(iLoopEnd + 4) * 8;
+
+	RecordParseSuccess(uData);
+	return true;
+}
+
+bool CSpliceClass::SetParseError(const scte35Error::type& eError, const scte35Field::type& eField) {
+	if (m_eLastError == scte35Error::none) {
+		m_eLastError = eError;
+		m_eLastErrorField = eField;
+		if (m_pMetrics != nullptr) {
+			m_pMetrics->AddFailure(eError, eField);
+		}
+	}
+	return false;
+}
+
+void CSpliceClass::RecordParseSuccess(const uint8_t* pSection) {
+	if (m_pMetrics == nullptr) {
+		return;
+	}
+
+	m_pMetrics->AddParsed(m_SInfoData.splice_command_type);
+	for (std::size_t k = 0;k < m_objSpliceDescriptor.v_SDChilds.size();k++) {
+		const SDBase* pDescriptor = m_objSpliceDescriptor.v_SDChilds[k];
+		//Counted here only, a section failing after its loop was read counts no descriptor
+		if (IsBuiltInDescriptor(*pDescriptor) || static_cast<const PrivateDescriptor*>(pDescriptor)->pDecoder != nullptr) {
+			m_pMetrics->AddDescriptor(pDescriptor->splice_descriptor_tag);
+		}
+		else {
+			m_pMetrics->AddUnsupportedDescriptor(pDescriptor->splice_descriptor_tag);
+		}
+	}
+
+	bool bCRCValid = false;
+	if (pSection != nullptr) {
+		bCRCValid = CSpliceCRC::Compute(pSection, (std::size_t)m_SInfoData.section_length + 3 - 4) == m_SInfoData.CRC_32;
+	}
+	else {
+		bCRCValid = IsCRCValid();
+	}
+	if (!bCRCValid) {
+		m_pMetrics->AddCRCMismatch();
+	}
+}
+
+bool CSpliceClass::IsCRCValid() {
+	//CRC_32 covers table_id up to (not including) CRC_32 itself
+	std::size_t iCrcBits = ((std::size_t)m_SInfoData.section_length + 3 - 4) * 8;
+	if (m_SInfoData.section_length < 4 || sBinData.length() < iCrcBits) {
+		return false;
+	}
+
+	uint32_t uCrc = CSpliceCRC::uInitial;
+	for (std::size_t i = 0;i < iCrcBits;i += 8) {
+		uint8_t uByte = 0;
+		for (std::size_t j = 0;j < 8;j++) {
+			uByte = (uint8_t)((uByte << 1) | (sBinData[i + j] == '1' ? 1 : 0));
+		}
+		uCrc = CSpliceCRC::Update(uCrc, &uByte, 1);
+	}
+
+	return uCrc == m_SInfoData.CRC_32;
+}
+
+scte35Field::type CSpliceClass::GetCommandField(const uint32_t& uCommandType) {
+	switch (uCommandType)
+	{
+		case scte35Cmd::splice_null: return scte35Field::splice_null;
+		case scte35Cmd::splice_schedule: return scte35Field::splice_schedule;
+		case scte35Cmd::splice_insert: return scte35Field::splice_insert;
+		case scte35Cmd::time_signal: return scte35Field::time_signal;
+		case scte35Cmd::bandwidth_reservation: return scte35Field::bandwidth_reservation;
+		case scte35Cmd::private_command: return scte35Field::private_command;
+		default: return scte35Field::splice_command;
+	}
+}
+
+std::string CSpliceClass::GetText(const bool& bIfSingleLine) const {
+	SCTE35_PROFILE_STAGE(scte35Stage::text_generation);
+
 	std::stringstream sMainString;
 	std::string sSepLocal= sNextLine;
 	if (bIfSingleLine) {
@@ -708,7 +908,7 @@ bool CSpliceClass::Parse_Splice_Null() {
 	return true;
 
 }
-std::stringstream CSpliceClass::GetText_Splice_Null(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Splice_Null(const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_1;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -732,7 +932,7 @@ void SpliceScheduleChild::ClearValues() {
 	 duration_flag = PARAMETER_DEF_VAL;
 	 reserved_2 = PARAMETER_DEF_VAL;
 	 utc_splice_time = PARAMETER_DEF_VAL; 
-	 for (uint32_t i = 0;i < (int)component_count;i++) {
+	 for (std::size_t i = 0;i < v_Component_childs.size();i++) {
 		 v_Component_childs[i].ClearValues();
 	 }
 	 component_count = PARAMETER_DEF_VAL;
@@ -743,103 +943,54 @@ void SpliceScheduleChild::ClearValues() {
 	 avails_expected = PARAMETER_DEF_VAL;
 }
 void SpliceScheduleData::ClearValues() {
-	for (uint32_t i = 0;i < splice_count;i++) {
+	for (std::size_t i = 0;i < v_childs.size();i++) {
 		v_childs[i].ClearValues();
 	}
 	splice_count = PARAMETER_DEF_VAL;
 	v_childs.clear();
 }
 bool CSpliceClass::Parse_Splice_Schedule() {
-	bool bSuccess = false;
-
-	m_objSpliceSchedule.splice_count= GetValue_info_32bit(sBinData, iCurrentBitPoint,true, 8, bSuccess);
-	if (!bSuccess) { return false; }
+	if (!CSpliceLayout<SpliceScheduleLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objSpliceSchedule)) { return false; }
 
 	m_objSpliceSchedule.v_childs.clear();
 
-	if (m_objSpliceSchedule.splice_count>0) {
-		for (uint32_t i = 0;i < m_objSpliceSchedule.splice_count;i++) {
-			SpliceScheduleChild objLocalSchChild;
-
-			objLocalSchChild.splice_event_id= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 32, bSuccess);
-			if (!bSuccess) { return false; }
-			
-			objLocalSchChild.splice_event_cancel_indicator = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-			if (!bSuccess) { return false; }
-
-			objLocalSchChild.reserved_1 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 7, bSuccess);
-			if (!bSuccess) { return false; }
-
-			if (objLocalSchChild.splice_event_cancel_indicator == 0) {
-
-				objLocalSchChild.out_of_network_indicator = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-				if (!bSuccess) { return false; }
-
-				objLocalSchChild.program_splice_flag = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-				if (!bSuccess) { return false; }
-
-				objLocalSchChild.duration_flag = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-				if (!bSuccess) { return false; }
-
-				objLocalSchChild.reserved_2 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 5, bSuccess);
-				if (!bSuccess) { return false; }
-
-				if (objLocalSchChild.program_splice_flag == 1) {
-					objLocalSchChild.utc_splice_time = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 32, bSuccess);
-					if (!bSuccess) { return false; }
-				}
-				else {
-				
-					objLocalSchChild.component_count = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
-					if (!bSuccess) { return false; }
-
-					if (objLocalSchChild.component_count>0) {
-						for (uint32_t j = 0;j < objLocalSchChild.component_count;j++) {
-							SSchComponent objLocal;
+	for (uint32_t i = 0;i < m_objSpliceSchedule.splice_count;i++) {
+		SpliceScheduleChild objLocalSchChild;
 
-							objLocal.component_tag= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
-							if (!bSuccess) { return false; }
+		if (!CSpliceLayout<SpliceScheduleChildLayout>::DecodeBits(sBinData, iCurrentBitPoint, objLocalSchChild)) { return false; }
 
-							objLocal.utc_splice_time = GetValue_info_32bit(sBinData, iCurrentBitPoint, true,32, bSuccess);
-							if (!bSuccess) { return false; }
-
-							objLocalSchChild.v_Component_childs.emplace_back(objLocal);
-						}
-					}
-					
+		if (objLocalSchChild.splice_event_cancel_indicator == 0) {
+			if (objLocalSchChild.program_splice_flag == 0) {
+				for (uint32_t j = 0;j < objLocalSchChild.component_count;j++) {
+					SSchComponent objLocal;
+					if (!CSpliceLayout<SSchComponentLayout>::DecodeBits(sBinData, iCurrentBitPoint, objLocal)) { return false; }
+					objLocalSchChild.v_Component_childs.emplace_back(objLocal);
 				}
+			}
 
-				if (objLocalSchChild.duration_flag) {
-
-					objLocalSchChild.m_breakD.auto_return = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-					if (!bSuccess) { return false; }
-
-					objLocalSchChild.m_breakD.reserved = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 6, bSuccess);
-					if (!bSuccess) { return false; }
-
-					objLocalSchChild.m_breakD.duration = GetValue_info_64bit(sBinData, iCurrentBitPoint, true, 32, bSuccess);
-					if (!bSuccess) { return false; }
-
-				}
+			if (objLocalSchChild.duration_flag) {
+				//Kept by hand : the break_duration of a splice_schedule has always been read with a 32-bit duration, not the 33 of BreakDurationLayout
+				bool bSuccess = false;
 
-				objLocalSchChild.unique_program_id = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 16, bSuccess);
+				objLocalSchChild.m_breakD.auto_return = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
 				if (!bSuccess) { return false; }
 
-				objLocalSchChild.avail_num = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
+				objLocalSchChild.m_breakD.reserved = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 6, bSuccess);
 				if (!bSuccess) { return false; }
 
-				objLocalSchChild.avails_expected = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
+				objLocalSchChild.m_breakD.duration = GetValue_info_64bit(sBinData, iCurrentBitPoint, true, 32, bSuccess);
 				if (!bSuccess) { return false; }
-
 			}
 
-			m_objSpliceSchedule.v_childs.emplace_back(objLocalSchChild);
+			if (!CSpliceLayout<SpliceScheduleTailLayout>::DecodeBits(sBinData, iCurrentBitPoint, objLocalSchChild)) { return false; }
 		}
+
+		m_objSpliceSchedule.v_childs.emplace_back(objLocalSchChild);
 	}
 
 	return true;
 }
-std::stringstream CSpliceClass::GetText_Splice_Schedule(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Splice_Schedule(const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_1;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -911,7 +1062,7 @@ void SpliceInsertData::ClearValues() {
 
 	 m_spliceT.ClearValues();
 
-	 for (uint32_t j = 0;j < component_count;j++) {
+	 for (std::size_t j = 0;j < v_ChildComps.size();j++) {
 		 v_ChildComps[j].ClearValues();
 	 }
 	 component_count = PARAMETER_DEF_VAL;
@@ -924,111 +1075,45 @@ void SpliceInsertData::ClearValues() {
 	 avails_expected = PARAMETER_DEF_VAL;
 }
 bool CSpliceClass::Parse_Splice_Insert() {
-	
-	bool bSuccess = false;
-
-	m_objSpliceInsert.splice_event_id= GetValue_info_32bit(sBinData, iCurrentBitPoint, true,32, bSuccess);
-	if (!bSuccess) { return false; }
-
-	m_objSpliceInsert.splice_event_cancel_indicator = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-	if (!bSuccess) { return false; }
-
-	m_objSpliceInsert.reserved_1 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 7, bSuccess);
-	if (!bSuccess) { return false; }
+	//Event id and flag byte at once when they are all there, field by field otherwise (same result, partial fields on truncation)
+	uint8_t uHead[CSpliceBitKernel::iInsertFlagsBytes];
+	if (iCurrentBitPoint >= 0 && sBinData.length() >= (std::size_t)iCurrentBitPoint + sizeof(uHead) * 8 && CSpliceBitKernel::PackBits(sBinData.data() + iCurrentBitPoint, sizeof(uHead) * 8, uHead)) {
+		iCurrentBitPoint += (int)CSpliceBitKernel::ExtractInsertFlags(uHead, m_objSpliceInsert);
+	}
+	else if (!CSpliceLayout<SpliceInsertLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objSpliceInsert)) { return false; }
 
 	m_objSpliceInsert.v_ChildComps.clear();
 
 	if (m_objSpliceInsert.splice_event_cancel_indicator==0) {
-		m_objSpliceInsert.out_of_network_indicator = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-		if (!bSuccess) { return false; }
-		m_objSpliceInsert.program_splice_flag = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-		if (!bSuccess) { return false; }
-
-		m_objSpliceInsert.duration_flag = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-		if (!bSuccess) { return false; }
-
-		m_objSpliceInsert.splice_immediate_flag = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-		if (!bSuccess) { return false; }
-
-		m_objSpliceInsert.reserved_2 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 4, bSuccess);
-		if (!bSuccess) { return false; }
-
 		if (m_objSpliceInsert.program_splice_flag==1 && m_objSpliceInsert.splice_immediate_flag==0) {
-			
-			m_objSpliceInsert.m_spliceT.time_specified_flag= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-			if (!bSuccess) { return false; }
-
-			if (m_objSpliceInsert.m_spliceT.time_specified_flag==1) {
-				m_objSpliceInsert.m_spliceT.reserved_1= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 6, bSuccess);
-				if (!bSuccess) { return false; }
-
-				m_objSpliceInsert.m_spliceT.pts_time = GetValue_info_64bit(sBinData, iCurrentBitPoint, true, 33, bSuccess);
-				if (!bSuccess) { return false; }
-			}
-			else {
-				m_objSpliceInsert.m_spliceT.reserved_2 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 7, bSuccess);
-				if (!bSuccess) { return false; }
-			}
-
+			if (!CSpliceLayout<SpliceTimeLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objSpliceInsert.m_spliceT)) { return false; }
 		}
 
 		if (m_objSpliceInsert.program_splice_flag==0) {
-			m_objSpliceInsert.component_count= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
-			if (!bSuccess) { return false; }
-
-			if (m_objSpliceInsert.component_count>0) {
-				for (uint32_t i = 0;i < m_objSpliceInsert.component_count;i++) {
-					SInComponent objLocal;
-					objLocal.component_tag= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
-					if (!bSuccess) { return false; }
-
-					if (m_objSpliceInsert.splice_immediate_flag==0) {			
-						objLocal.m_spliceT.time_specified_flag = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-						if (!bSuccess) { return false; }
+			if (!CSpliceLayout<SpliceInsertCountLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objSpliceInsert)) { return false; }
 
-						if (objLocal.m_spliceT.time_specified_flag == 1) {
-							objLocal.m_spliceT.reserved_1 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 6, bSuccess);
-							if (!bSuccess) { return false; }
+			for (uint32_t i = 0;i < m_objSpliceInsert.component_count;i++) {
+				SInComponent objLocal;
+				if (!CSpliceLayout<SInComponentLayout>::DecodeBits(sBinData, iCurrentBitPoint, objLocal)) { return false; }
 
-							objLocal.m_spliceT.pts_time = GetValue_info_64bit(sBinData, iCurrentBitPoint, true, 33, bSuccess);
-							if (!bSuccess) { return false; }
-						}
-						else {
-							objLocal.m_spliceT.reserved_2 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 7, bSuccess);
-							if (!bSuccess) { return false; }
-						}
-					}
-
-					m_objSpliceInsert.v_ChildComps.emplace_back(objLocal);
+				if (m_objSpliceInsert.splice_immediate_flag==0) {
+					if (!CSpliceLayout<SpliceTimeLayout>::DecodeBits(sBinData, iCurrentBitPoint, objLocal.m_spliceT)) { return false; }
 				}
+
+				m_objSpliceInsert.v_ChildComps.emplace_back(objLocal);
 			}
 		}
 
-		if(m_objSpliceInsert.duration_flag==1) {
-			m_objSpliceInsert.m_breakD.auto_return= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-			if (!bSuccess) { return false; }
-
-			m_objSpliceInsert.m_breakD.reserved= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 6, bSuccess);
-			if (!bSuccess) { return false; }
-
-			m_objSpliceInsert.m_breakD.duration = GetValue_info_64bit(sBinData, iCurrentBitPoint, true, 33, bSuccess);
-			if (!bSuccess) { return false; }
+		if (m_objSpliceInsert.duration_flag==1) {
+			if (!CSpliceLayout<BreakDurationLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objSpliceInsert.m_breakD)) { return false; }
 		}
 
-		m_objSpliceInsert.unique_program_id= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 16, bSuccess);
-		if (!bSuccess) { return false; }
-
-		m_objSpliceInsert.avail_num = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
-		if (!bSuccess) { return false; }
-
-		m_objSpliceInsert.avails_expected = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
-		if (!bSuccess) { return false; }
-
+		if (!CSpliceLayout<SpliceInsertTailLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objSpliceInsert)) { return false; }
 	}
 
 	return true;
 }
-std::stringstream CSpliceClass::GetText_Splice_Insert(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Splice_Insert(const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_1;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1098,26 +1183,9 @@ void splice_time::ClearValues() {
 	 reserved_2= PARAMETER_DEF_VAL;
 }
 bool CSpliceClass::Parse_Time_Signal() {
-	bool bSuccess = false;
-
-	m_objTimeSignal.time_specified_flag = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 1, bSuccess);
-	if (!bSuccess) { return false; }
-
-	if (m_objTimeSignal.time_specified_flag == 1) {
-		m_objTimeSignal.reserved_1 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 6, bSuccess);
-		if (!bSuccess) { return false; }
-
-		m_objTimeSignal.pts_time = GetValue_info_64bit(sBinData, iCurrentBitPoint, true, 33, bSuccess);
-		if (!bSuccess) { return false; }
-	}
-	else {
-		m_objTimeSignal.reserved_2 = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 7, bSuccess);
-		if (!bSuccess) { return false; }
-	}
-
-	return true;
+	return CSpliceLayout<SpliceTimeLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objTimeSignal);
 }
-std::stringstream CSpliceClass::GetText_Time_Signal(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Time_Signal(const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_1;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1126,15 +1194,7 @@ std::stringstream CSpliceClass::GetText_Time_Signal(const bool& bIfSingleLine) {
 
 	slocalStr_1 << "time_signal()" << sSepLocal;
 
-	slocalStr_1 << "time_specified_flag=" << m_objTimeSignal.time_specified_flag << sSepLocal;
-
-	if (m_objTimeSignal.time_specified_flag==1) {
-		slocalStr_1 << "reserved_1=" << m_objTimeSignal.reserved_1 << sSepLocal;
-		slocalStr_1 << "pts_time=" << m_objTimeSignal.pts_time << sSepLocal;
-	}
-	else {
-		slocalStr_1 << "reserved_2=" << m_objTimeSignal.reserved_2 << sSepLocal;
-	}
+	CSpliceLayout<SpliceTimeLayout>::AppendText(m_objTimeSignal, slocalStr_1, sSepLocal);
 
 	return slocalStr_1;
 }
@@ -1146,7 +1206,7 @@ bool CSpliceClass::Parse_BW_Reservation() {
 	return true;
 
 }
-std::stringstream CSpliceClass::GetText_BW_Reservation(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_BW_Reservation(const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_1;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1163,24 +1223,15 @@ void private_command::ClearValues() {
 	private_byte.clear();
 }
 bool CSpliceClass::Parse_Private_Command(const uint32_t& splice_command_length_param) {
-	bool bSuccess = false;
-
-	m_objPrivateCommand.identifier = GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 32, bSuccess);
-	if (!bSuccess) { return false; }
+	if (!CSpliceLayout<PrivateCommandLayout>::DecodeBits(sBinData, iCurrentBitPoint, m_objPrivateCommand)) { return false; }
 
 	m_objPrivateCommand.private_length = splice_command_length_param - 4;
-	if (!bSuccess) { return false; }
 
+	//A splice_command_length below 4 leaves no private byte
 	m_objPrivateCommand.private_byte.clear();
-	for (int i = 0;i < (int)m_objPrivateCommand.private_length;i++) {
-		uint32_t uiLocal= GetValue_info_32bit(sBinData, iCurrentBitPoint, true, 8, bSuccess);
-		if (!bSuccess) { return false; }
-		m_objPrivateCommand.private_byte.emplace_back(uiLocal);
-	}
-
-	return true;
+	return ReadByteLoop(sBinData, iCurrentBitPoint, (int)m_objPrivateCommand.private_length > 0 ? m_objPrivateCommand.private_length : 0, m_objPrivateCommand.private_byte);
 }
-std::stringstream CSpliceClass::GetText_Private_Command(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Private_Command(const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_1;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1206,23 +1257,11 @@ void AvailDescriptor::ClearValues() {
 	 provider_avail_id = PARAMETER_DEF_VAL;
 }
 bool CSpliceClass::Parse_Avail_Descriptor(const std::string& sInData) {
-	bool bSuccess = false;
-
 	AvailDescriptor* pobjLocal=new AvailDescriptor();
 
 	int iLocalCur = 0;
 
-	pobjLocal->splice_descriptor_tag = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto AVAIL_D_FAILED; }
-
-	pobjLocal->descriptor_length = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto AVAIL_D_FAILED; }
-
-	pobjLocal->identifier = GetValue_Desc_32bit(sInData, iLocalCur,true, 32, bSuccess);
-	if (!bSuccess) { goto AVAIL_D_FAILED; }
-
-	pobjLocal->provider_avail_id = GetValue_Desc_32bit(sInData, iLocalCur,true, 32, bSuccess);
-	if (!bSuccess) { goto AVAIL_D_FAILED; }
+	if (!CSpliceLayout<AvailDescriptorLayout>::DecodeBits(sInData, iLocalCur, *pobjLocal)) { goto AVAIL_D_FAILED; }
 
 	m_objSpliceDescriptor.v_SDChilds.emplace_back(pobjLocal);
 
@@ -1235,7 +1274,7 @@ AVAIL_D_FAILED:
 	return false;
 
 }
-std::stringstream CSpliceClass::GetText_Avail_Descriptor(SDBase* paramData, const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Avail_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_2;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1245,10 +1284,7 @@ std::stringstream CSpliceClass::GetText_Avail_Descriptor(SDBase* paramData, cons
 	AvailDescriptor* pReadLocal = static_cast<AvailDescriptor*>(paramData);
 
 	slocalStr_2 << "avail_descriptor()" << sSepLocal;
-	slocalStr_2 << "splice_descriptor_tag=" << pReadLocal->splice_descriptor_tag << sSepLocal;
-	slocalStr_2 << "descriptor_length=" << pReadLocal->descriptor_length << sSepLocal;
-	slocalStr_2 << "identifier=" << pReadLocal->identifier << sSepLocal;
-	slocalStr_2 << "provider_avail_id=" << pReadLocal->provider_avail_id << sSepLocal;
+	CSpliceLayout<AvailDescriptorLayout>::AppendText(*pReadLocal, slocalStr_2, sSepLocal);
 
 
 	return slocalStr_2;
@@ -1264,35 +1300,13 @@ void DTMFDescriptor::ClearValues() {
 	v_DTMF_Char.clear();
 }
 bool CSpliceClass::Parse_DTMF_Descriptor(const std::string& sInData) {
-	bool bSuccess = false;
-
 	DTMFDescriptor* pobjDTMFLocal=new DTMFDescriptor();
 
 	int iLocalCur=0;
 
-	pobjDTMFLocal->splice_descriptor_tag = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) {goto DTMF_D_FAILED; }
+	if (!CSpliceLayout<DTMFDescriptorLayout>::DecodeBits(sInData, iLocalCur, *pobjDTMFLocal)) { goto DTMF_D_FAILED; }
 
-	pobjDTMFLocal->descriptor_length = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto DTMF_D_FAILED; }
-
-	pobjDTMFLocal->identifier = GetValue_Desc_32bit(sInData, iLocalCur,true, 32, bSuccess);
-	if (!bSuccess) { goto DTMF_D_FAILED; }
-
-	pobjDTMFLocal->preroll= GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto DTMF_D_FAILED; }
-
-	pobjDTMFLocal->dtmf_count = GetValue_Desc_32bit(sInData, iLocalCur,true, 3, bSuccess);
-	if (!bSuccess) { goto DTMF_D_FAILED; }
-
-	pobjDTMFLocal->reserved = GetValue_Desc_32bit(sInData, iLocalCur,true, 5, bSuccess);
-	if (!bSuccess) { goto DTMF_D_FAILED; }
-
-	for (int a = 0;a < (int)pobjDTMFLocal->dtmf_count;a++) {
-		uint32_t ValueLocal = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-		if (!bSuccess) { goto DTMF_D_FAILED; }
-		pobjDTMFLocal->v_DTMF_Char.emplace_back(ValueLocal);
-	}
+	if (!ReadByteLoop(sInData, iLocalCur, pobjDTMFLocal->dtmf_count, pobjDTMFLocal->v_DTMF_Char)) { goto DTMF_D_FAILED; }
 
 	m_objSpliceDescriptor.v_SDChilds.emplace_back(pobjDTMFLocal);
 
@@ -1305,7 +1319,7 @@ DTMF_D_FAILED:
 	return false;
 
 }
-std::stringstream CSpliceClass::GetText_DTMF_Descriptor(SDBase* paramData, const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_DTMF_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_2;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1350,7 +1364,7 @@ void SegmentationDescriptor::ClearValues() {
 	 device_restrictions= PARAMETER_DEF_VAL;
 	 reserved_2= PARAMETER_DEF_VAL;
 
-	 for (uint32_t i = 0;i < component_count;i++) {
+	 for (std::size_t i = 0;i < v_ChildComps.size();i++) {
 		 v_ChildComps[i].ClearValues();
 	 }
 	 v_ChildComps.clear();
@@ -1360,6 +1374,7 @@ void SegmentationDescriptor::ClearValues() {
 	 segmentation_upid_type= PARAMETER_DEF_VAL;
 	 segmentation_upid_length= PARAMETER_DEF_VAL;
 	 v_upid_list.clear();
+	 pUpid = nullptr;
 
 	 segmentation_type_id = PARAMETER_DEF_VAL;
 	 segment_num = PARAMETER_DEF_VAL;
@@ -1367,113 +1382,51 @@ void SegmentationDescriptor::ClearValues() {
 	 sub_segment_num = PARAMETER_DEF_VAL;
 	 sub_segments_expected = PARAMETER_DEF_VAL;
 }
-bool CSpliceClass::Parse_Segmentation_Descriptor(const std::string& sInData) {
+bool CSpliceClass::Parse_Segmentation_Descriptor(const std::string& sInData, const uint8_t* pData) {
 	
-	bool bSuccess = false;
-
 	SegmentationDescriptor* pobjLocal = new SegmentationDescriptor();
 
 	int iLocalCur = 0;
 
-	pobjLocal->splice_descriptor_tag= GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto SEG_D_FAILED; }
-
-	pobjLocal->descriptor_length = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-	if (!bSuccess) { goto SEG_D_FAILED; }
-
-	pobjLocal->identifier = GetValue_Desc_32bit(sInData, iLocalCur, true, 32, bSuccess);
-	if (!bSuccess) { goto SEG_D_FAILED; }
+	uint8_t uHead[CSpliceBitKernel::iSegmentationFlagsBytes];
 
-	if (pobjLocal->identifier != 0x43554549) {
-		goto SEG_D_FAILED; /*Not SCTE CUEI*/
+	//Only "CUEI" descriptors get here (or ones too short to hold an identifier, which fail as truncated), the others go to Parse_Private_Descriptor
+	//Header and flag byte at once when they are all there, field by field otherwise
+	if (sInData.length() >= sizeof(uHead) * 8 && CSpliceBitKernel::PackBits(sInData.data(), sizeof(uHead) * 8, uHead)) {
+		iLocalCur += (int)CSpliceBitKernel::ExtractSegmentationFlags(uHead, *pobjLocal);
 	}
-
-	pobjLocal->segmentation_event_id = GetValue_Desc_32bit(sInData, iLocalCur, true, 32, bSuccess);
-	if (!bSuccess) { goto SEG_D_FAILED; }
-
-	pobjLocal->segmentation_event_cancel_indicator = GetValue_Desc_32bit(sInData, iLocalCur, true, 1, bSuccess);
-	if (!bSuccess) { goto SEG_D_FAILED; }
-
-	pobjLocal->reserved_1 = GetValue_Desc_32bit(sInData, iLocalCur, true, 7, bSuccess);
-	if (!bSuccess) { goto SEG_D_FAILED; }
+	else if (!CSpliceLayout<SegmentationDescriptorLayout>::DecodeBits(sInData, iLocalCur, *pobjLocal)) { goto SEG_D_FAILED; }
 
 	if (pobjLocal->segmentation_event_cancel_indicator==0) {
-		pobjLocal->program_segmentation_flag= GetValue_Desc_32bit(sInData, iLocalCur, true, 1, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
-
-		pobjLocal->segmentation_duration_flag = GetValue_Desc_32bit(sInData, iLocalCur, true, 1, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
-
-		pobjLocal->delivery_not_restricted_flag = GetValue_Desc_32bit(sInData, iLocalCur, true, 1, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
-
-		if (pobjLocal->delivery_not_restricted_flag==0) {
-			pobjLocal->web_delivery_allowed_flag = GetValue_Desc_32bit(sInData, iLocalCur, true, 1, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
-
-			pobjLocal->no_regional_blackout_flag = GetValue_Desc_32bit(sInData, iLocalCur, true, 1, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
-
-			pobjLocal->archive_allowed_flag = GetValue_Desc_32bit(sInData, iLocalCur, true, 1, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
-
-			pobjLocal->device_restrictions = GetValue_Desc_32bit(sInData, iLocalCur, true, 2, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
-		}
-		else {
-			pobjLocal->reserved_2 = GetValue_Desc_32bit(sInData, iLocalCur, true, 5, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
-		}
-
-
 		if (pobjLocal->program_segmentation_flag==0) {
-			pobjLocal->component_count = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
+			if (!CSpliceLayout<SegmentationCountLayout>::DecodeBits(sInData, iLocalCur, *pobjLocal)) { goto SEG_D_FAILED; }
 
 			for (int h = 0;h < (int)pobjLocal->component_count;h++) {
 				SegDescComponent objSDC;
+				if (!CSpliceLayout<SegDescComponentLayout>::DecodeBits(sInData, iLocalCur, objSDC)) { goto SEG_D_FAILED; }
 
-				objSDC.component_tag = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-				if (!bSuccess) { goto SEG_D_FAILED; }
-
-				objSDC.reserved = GetValue_Desc_32bit(sInData, iLocalCur, true, 7, bSuccess);
-				if (!bSuccess) { goto SEG_D_FAILED; }
-
-				objSDC.pts_offset = GetValue_Desc_32bit(sInData, iLocalCur, true, 33, bSuccess);
-				if (!bSuccess) { goto SEG_D_FAILED; }
+				//Kept by hand : pts_offset has always held the first 32 of its 33 bits, the table would store the last 32
+				bool bSuccess = false;
+				int iPtsOffsetPos = iLocalCur - CSpliceLayout<SegDescComponentLayout>::GetBits<2>();
+				objSDC.pts_offset = GetValue_Desc_32bit(sInData, iPtsOffsetPos, false, CSpliceLayout<SegDescComponentLayout>::GetBits<2>(), bSuccess);
 
 				pobjLocal->v_ChildComps.emplace_back(objSDC);
-
 			}
-			
 		}
 
 		if (pobjLocal->segmentation_duration_flag==1) {
-			pobjLocal->segmentation_duration = GetValue_Desc_64bit(sInData, iLocalCur, true, 40, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
+			if (!CSpliceLayout<SegmentationDurationLayout>::DecodeBits(sInData, iLocalCur, *pobjLocal)) { goto SEG_D_FAILED; }
 		}
 
-		pobjLocal->segmentation_upid_type = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
-		
-		pobjLocal->segmentation_upid_length = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
-
-		for (int g = 0;g < (int)pobjLocal->segmentation_upid_length;g++) {
-			uint32_t uVal= GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-			if (!bSuccess) { goto SEG_D_FAILED; }
+		if (!CSpliceLayout<SegmentationUpidLayout>::DecodeBits(sInData, iLocalCur, *pobjLocal)) { goto SEG_D_FAILED; }
 
-			pobjLocal->v_upid_list.emplace_back(uVal);
+		if (pobjLocal->segmentation_upid_length > 0) {
+			//Every field before segmentation_upid is a whole number of bytes
+			pobjLocal->pUpid = pData + iLocalCur / 8;
 		}
+		if (!ReadByteLoop(sInData, iLocalCur, pobjLocal->segmentation_upid_length, pobjLocal->v_upid_list)) { goto SEG_D_FAILED; }
 
-		pobjLocal->segmentation_type_id = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
-
-		pobjLocal->segment_num = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
-
-		pobjLocal->segments_expected = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-		if (!bSuccess) { goto SEG_D_FAILED; }
+		if (!CSpliceLayout<SegmentationTypeLayout>::DecodeBits(sInData, iLocalCur, *pobjLocal)) { goto SEG_D_FAILED; }
 
 		if (
 			pobjLocal->segmentation_type_id==0x34 ||
@@ -1481,13 +1434,8 @@ bool CSpliceClass::Parse_Segmentation_Descriptor(const std::string& sInData) {
 			pobjLocal->segmentation_type_id==0x38 ||
 			pobjLocal->segmentation_type_id==0x3A
 			) {
-			
-			pobjLocal->sub_segment_num = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-			//if (!bSuccess) { goto SEG_D_FAILED; }
-
-			pobjLocal->sub_segments_expected = GetValue_Desc_32bit(sInData, iLocalCur, true, 8, bSuccess);
-			//if (!bSuccess) { goto SEG_D_FAILED; }
-
+			//Optional : missing bytes leave the default values
+			CSpliceLayout<SubSegmentLayout>::DecodeBits(sInData, iLocalCur, *pobjLocal);
 		}
 	}
 
@@ -1501,7 +1449,7 @@ SEG_D_FAILED:
 	return false;
 
 }
-std::stringstream CSpliceClass::GetText_Segmentation_Descriptor(SDBase* paramData, const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Segmentation_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_2;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1559,6 +1507,13 @@ std::stringstream CSpliceClass::GetText_Segmentation_Descriptor(SDBase* paramDat
 		for (int g = 0;g < (int)pReadLocal->segmentation_upid_length;g++) {
 			slocalStr_2 << "upid_val[" << g + 1 << "]=" << pReadLocal->v_upid_list[g]<< sSepLocal;
 		}
+		if (pReadLocal->pUpid != nullptr) {
+			SUpidView objUpid;
+			CSpliceUpid::Decode(*pReadLocal, objUpid);
+			std::string sUpid;
+			CSpliceUpid::GetText(objUpid, sUpid);
+			slocalStr_2 << "segmentation_upid=" << sUpid << sSepLocal;
+		}
 
 		slocalStr_2 << "segmentation_type_id=" << pReadLocal->segmentation_type_id << sSepLocal;
 		slocalStr_2 << "segment_num=" << pReadLocal->segment_num << sSepLocal;
@@ -1586,29 +1541,11 @@ void TimeDescriptor::ClearValues() {
 	 UTC_offset = PARAMETER_DEF_VAL;
 }
 bool CSpliceClass::Parse_Time_Descriptor(const std::string& sInData) {
-	bool bSuccess = false;
-
 	TimeDescriptor* pobjTimeDesc=new TimeDescriptor();
 
 	int iLocalCur = 0;
 
-	pobjTimeDesc->splice_descriptor_tag = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto TIME_D_FAILED; }
-
-	pobjTimeDesc->descriptor_length = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto TIME_D_FAILED; }
-
-	pobjTimeDesc->identifier = GetValue_Desc_32bit(sInData, iLocalCur,true, 32, bSuccess);
-	if (!bSuccess) { goto TIME_D_FAILED; }
-
-	pobjTimeDesc->TAI_seconds = GetValue_Desc_64bit(sInData, iLocalCur,true, 48, bSuccess);
-	if (!bSuccess) { goto TIME_D_FAILED; }
-
-	pobjTimeDesc->TAI_ns = GetValue_Desc_32bit(sInData, iLocalCur,true, 32, bSuccess);
-	if (!bSuccess) { goto TIME_D_FAILED; }
-
-	pobjTimeDesc->UTC_offset = GetValue_Desc_32bit(sInData, iLocalCur,true, 16, bSuccess);
-	if (!bSuccess) { goto TIME_D_FAILED; }
+	if (!CSpliceLayout<TimeDescriptorLayout>::DecodeBits(sInData, iLocalCur, *pobjTimeDesc)) { goto TIME_D_FAILED; }
 
 	m_objSpliceDescriptor.v_SDChilds.emplace_back(pobjTimeDesc);
 
@@ -1620,7 +1557,7 @@ TIME_D_FAILED:
 	return false;
 
 }
-std::stringstream CSpliceClass::GetText_Time_Descriptor(SDBase* paramData, const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Time_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_2;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1630,12 +1567,7 @@ std::stringstream CSpliceClass::GetText_Time_Descriptor(SDBase* paramData, const
 	TimeDescriptor* pReadLocal = static_cast<TimeDescriptor*>(paramData);
 
 	slocalStr_2 << "time_descriptor()" << sSepLocal;
-	slocalStr_2 << "splice_descriptor_tag=" << pReadLocal->splice_descriptor_tag << sSepLocal;
-	slocalStr_2 << "descriptor_length=" << pReadLocal->descriptor_length << sSepLocal;
-	slocalStr_2 << "identifier=" << pReadLocal->identifier << sSepLocal;
-	slocalStr_2 << "TAI_seconds=" << pReadLocal->TAI_seconds << sSepLocal;
-	slocalStr_2 << "TAI_ns=" << pReadLocal->TAI_ns << sSepLocal;
-	slocalStr_2 << "UTC_offset=" << pReadLocal->UTC_offset << sSepLocal;
+	CSpliceLayout<TimeDescriptorLayout>::AppendText(*pReadLocal, slocalStr_2, sSepLocal);
 
 	return slocalStr_2;
 }
@@ -1652,56 +1584,25 @@ void AudioDescriptor::ClearValues() {
 	descriptor_length = PARAMETER_DEF_VAL;
 	identifier = PARAMETER_DEF_VAL;
 	reserved = PARAMETER_DEF_VAL;
-	for (uint32_t i = 0;i < audio_count;i++) {
+	for (std::size_t i = 0;i < v_audio_comp_list.size();i++) {
 		v_audio_comp_list[i].ClearValues();
 	}
 	v_audio_comp_list.clear();
 }
 bool CSpliceClass::Parse_Audio_Descriptor(const std::string& sInData) {
 	
-	bool bSuccess = false;
-
 	AudioDescriptor* pobjAudioDesc=new AudioDescriptor();
 
 	int iLocalCur = 0;
 
-	pobjAudioDesc->splice_descriptor_tag = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-	pobjAudioDesc->descriptor_length = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-	if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-	pobjAudioDesc->identifier = GetValue_Desc_32bit(sInData, iLocalCur,true, 32, bSuccess);
-	if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-	pobjAudioDesc->audio_count = GetValue_Desc_32bit(sInData, iLocalCur,true, 4, bSuccess);
-	if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-	pobjAudioDesc->reserved = GetValue_Desc_32bit(sInData, iLocalCur,true, 4, bSuccess);
-	if (!bSuccess) { goto AUDIO_D_FAILED; }
+	if (!CSpliceLayout<AudioDescriptorLayout>::DecodeBits(sInData, iLocalCur, *pobjAudioDesc)) { goto AUDIO_D_FAILED; }
 
 	pobjAudioDesc->v_audio_comp_list.clear();
 
 	for (int i = 0;i < (int)pobjAudioDesc->audio_count;i++) {
 		AudioDescComponent objLocal;
-
-		objLocal.component_tag = GetValue_Desc_32bit(sInData, iLocalCur,true, 8, bSuccess);
-		if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-		objLocal.ISO_code = GetValue_Desc_32bit(sInData, iLocalCur,true, 24, bSuccess);
-		if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-		objLocal.Bit_Stream_Mode = GetValue_Desc_32bit(sInData, iLocalCur,true, 3, bSuccess);
-		if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-		objLocal.Num_Channels = GetValue_Desc_32bit(sInData, iLocalCur,true, 4, bSuccess);
-		if (!bSuccess) { goto AUDIO_D_FAILED; }
-
-		objLocal.Full_Srvc_Audio = GetValue_Desc_32bit(sInData, iLocalCur,true, 1, bSuccess);
-		if (!bSuccess) { goto AUDIO_D_FAILED; }
-
+		if (!CSpliceLayout<AudioDescComponentLayout>::DecodeBits(sInData, iLocalCur, objLocal)) { goto AUDIO_D_FAILED; }
 		pobjAudioDesc->v_audio_comp_list.emplace_back(objLocal);
-
 	}
 
 	m_objSpliceDescriptor.v_SDChilds.emplace_back(pobjAudioDesc);
@@ -1713,7 +1614,7 @@ AUDIO_D_FAILED:
 	return false;
 
 }
-std::stringstream CSpliceClass::GetText_Audio_Descriptor(SDBase* paramData, const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Audio_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_2;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1747,6 +1648,10 @@ void CSpliceClass::Clear_Splice_Descriptor() {
 	
 	std::size_t iLenLocal = m_objSpliceDescriptor.v_SDChilds.size();
 	for (std::size_t i = 0;i < iLenLocal;i++) {
+		if (!IsBuiltInDescriptor(*m_objSpliceDescriptor.v_SDChilds[i])) {
+			delete static_cast<PrivateDescriptor*>(m_objSpliceDescriptor.v_SDChilds[i]);
+			continue;
+		}
 		uint32_t iLocalType = m_objSpliceDescriptor.v_SDChilds[i]->splice_descriptor_tag;
 		switch (iLocalType)
 		{
@@ -1784,89 +1689,146 @@ void CSpliceClass::Clear_Splice_Descriptor() {
 	m_objSpliceDescriptor.v_SDChilds.clear();
 }
 bool CSpliceClass::Parse_Splice_Descriptor(const uint32_t& loopLength) {
-	bool bSuccess = false;
+	SCTE35_PROFILE_STAGE(scte35Stage::splice_descriptor);
 
 	if (sDescriptorData.empty()) {
 		return false;
 	}
 
-	int iLocalCur = 0;
-	int iLocalOneTimeStart = 0;
-
-	uint32_t local_splice_descriptor_tag;
-	uint32_t local_descriptor_length;
+	//Loop bytes are packed once, headers are read from them and private descriptors point into them
+	std::size_t iLoopBytes = sDescriptorData.length() / 8;
+	m_vDescriptorBytes.resize(iLoopBytes);
+	if (!CSpliceBitKernel::PackBits(sDescriptorData.data(), iLoopBytes * 8, m_vDescriptorBytes.data())) {
+		for (std::size_t i = 0;i < iLoopBytes;i++) {
+			uint8_t uByte = 0;
+			for (std::size_t b = 0;b < 8;b++) {
+				uByte = (uint8_t)((uByte << 1) | (sDescriptorData[i * 8 + b] == '1' ? 1 : 0));
+			}
+			m_vDescriptorBytes[i] = uByte;
+		}
+	}
+	const uint8_t* pLoop = m_vDescriptorBytes.data();
 
 	uint32_t bitsRead = 0;
 
-	std::vector<std::string> v_LocalIndi;
+	std::vector<uint32_t> v_start_list;
 	std::vector<uint32_t> v_tag_list;
 
 	while (bitsRead<loopLength){
-		
-		iLocalOneTimeStart = iLocalCur;
 
-		local_splice_descriptor_tag = GetValue_Desc_32bit(sDescriptorData, iLocalCur,false, 8, bSuccess);
-		if (!bSuccess) { return false; }
-		iLocalCur += 8;
+		if ((std::size_t)bitsRead + 2 > iLoopBytes) {
+			return SetParseError(scte35Error::truncated, scte35Field::descriptor_loop);
+		}
 
-		local_descriptor_length = GetValue_Desc_32bit(sDescriptorData, iLocalCur,false, 8, bSuccess);
-		if (!bSuccess) { return false; }
-		iLocalCur += 8;
+		v_start_list.emplace_back(bitsRead);
+		v_tag_list.emplace_back(pLoop[bitsRead]);
 
-		iLocalCur += (local_descriptor_length *8);/* Identifier + Private Bytes */
+		bitsRead += (uint32_t)pLoop[bitsRead + 1] + 2;
+	}
 
-		std::string sLocal = sDescriptorData.substr(iLocalOneTimeStart,(iLocalCur- iLocalOneTimeStart));
+	std::size_t iVectorSize = v_start_list.size();
+	for (std::size_t k = 0;k < iVectorSize; k++) {
 
-		v_tag_list.emplace_back(local_splice_descriptor_tag);
-		v_LocalIndi.emplace_back(sLocal);
+		std::size_t iStart = v_start_list[k];
+		uint32_t uLength = pLoop[iStart + 1];
+		std::size_t iAvailable = std::min<std::size_t>(uLength + 2, iLoopBytes - iStart);
 
-		bitsRead += local_descriptor_length + 2;
-	}
+		//identifier scopes the tag, a descriptor too short to hold it goes to the "CUEI" parsers which reject it
+		bool bHasIdentifier = uLength >= 4 && iAvailable >= 6;
+		uint32_t uIdentifier = PARAMETER_DEF_VAL;
+		if (bHasIdentifier) {
+			uIdentifier = ((uint32_t)pLoop[iStart + 2] << 24) | ((uint32_t)pLoop[iStart + 3] << 16) | ((uint32_t)pLoop[iStart + 4] << 8) | pLoop[iStart + 5];
+		}
 
-	std::size_t iVectorSize = v_LocalIndi.size();
-	if (iVectorSize>0) {
-		
-		for (std::size_t k = 0;k < iVectorSize; k++) {
+		if (v_tag_list[k] > scte35Desc::audio_descriptor || (bHasIdentifier && !IsBuiltInDescriptor(v_tag_list[k], uIdentifier))) {
+			Parse_Private_Descriptor(pLoop + iStart, iAvailable, v_tag_list[k], uLength, uIdentifier);
+			continue;
+		}
 
-			if (v_tag_list[k] == scte35Desc::avail_descriptor) {
-				if (!Parse_Avail_Descriptor(v_LocalIndi[k])) {
-					return false;
+		std::string sLocal = sDescriptorData.substr(iStart * 8, iAvailable * 8);
+		switch (v_tag_list[k])
+		{
+			case scte35Desc::avail_descriptor: {
+				if (!Parse_Avail_Descriptor(sLocal)) {
+					return SetParseError(scte35Error::truncated, scte35Field::avail_descriptor);
 				}
-			}
-			else if(v_tag_list[k] == scte35Desc::dtmf_descriptor) {
-				if (!Parse_DTMF_Descriptor(v_LocalIndi[k])) {
-					return false;
+			}break;
+			case scte35Desc::dtmf_descriptor: {
+				if (!Parse_DTMF_Descriptor(sLocal)) {
+					return SetParseError(scte35Error::truncated, scte35Field::dtmf_descriptor);
 				}
-			}
-			else if (v_tag_list[k] == scte35Desc::segmentation_descriptor) {
-				if (!Parse_Segmentation_Descriptor(v_LocalIndi[k])) {
-					return false;
+			}break;
+			case scte35Desc::segmentation_descriptor: {
+				if (!Parse_Segmentation_Descriptor(sLocal, pLoop + iStart)) {
+					return SetParseError(scte35Error::truncated, scte35Field::segmentation_descriptor);
 				}
-			}
-			else if (v_tag_list[k] == scte35Desc::time_descriptor) {
-				if(!Parse_Time_Descriptor(v_LocalIndi[k])) {
-					return false;
+			}break;
+			case scte35Desc::time_descriptor: {
+				if (!Parse_Time_Descriptor(sLocal)) {
+					return SetParseError(scte35Error::truncated, scte35Field::time_descriptor);
 				}
-			}
-			else if(v_tag_list[k] == scte35Desc::audio_descriptor) {
-				if (!Parse_Audio_Descriptor(v_LocalIndi[k])) {
-					return false;
+			}break;
+			default: {
+				if (!Parse_Audio_Descriptor(sLocal)) {
+					return SetParseError(scte35Error::truncated, scte35Field::audio_descriptor);
 				}
-			}
-			else {
-				//Not Supported
-			}
-
+			}break;
 		}
-
 	}
 
-	
 	return true;
+}
+void CSpliceClass::Parse_Private_Descriptor(const uint8_t* pData, const std::size_t& iLength, const uint32_t& uTag, const uint32_t& uLength, const uint32_t& uIdentifier) {
 
+	const CSpliceDescriptorDecoder* pDecoder = nullptr;
+	if (m_pDescriptorRegistry != nullptr) {
+		pDecoder = m_pDescriptorRegistry->Find(uTag, uIdentifier);
+	}
+
+	PrivateDescriptor* pobjLocal = nullptr;
+	if (pDecoder != nullptr) {
+		pobjLocal = pDecoder->Decode(pData, iLength);
+	}
 
+	if (pobjLocal == nullptr) {
+		//Kept raw
+		pDecoder = nullptr;
+		pobjLocal = new PrivateDescriptor();
+	}
+
+	pobjLocal->splice_descriptor_tag = uTag;
+	pobjLocal->descriptor_length = uLength;
+	pobjLocal->identifier = uIdentifier;
+	pobjLocal->pRaw = pData;
+	pobjLocal->iRawLength = iLength;
+	pobjLocal->pDecoder = pDecoder;
+
+	m_objSpliceDescriptor.v_SDChilds.emplace_back(pobjLocal);
 }
-std::stringstream CSpliceClass::GetText_Splice_Descriptor(const bool& bIfSingleLine) {
+std::stringstream CSpliceClass::GetText_Private_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const {
+	std::stringstream slocalStr_2;
+	std::string sSepLocal = sNextLine;
+	if (bIfSingleLine) {
+		sSepLocal = sCommaOnly;
+	}
+
+	PrivateDescriptor* pReadLocal = static_cast<PrivateDescriptor*>(paramData);
+
+	slocalStr_2 << "private_descriptor()" << sSepLocal;
+	slocalStr_2 << "splice_descriptor_tag=" << pReadLocal->splice_descriptor_tag << sSepLocal;
+	slocalStr_2 << "descriptor_length=" << pReadLocal->descriptor_length << sSepLocal;
+	slocalStr_2 << "identifier=" << pReadLocal->identifier << sSepLocal;
+
+	if (pReadLocal->pDecoder != nullptr) {
+		pReadLocal->pDecoder->AppendText(*pReadLocal, slocalStr_2, sSepLocal);
+	}
+	else {
+		CSpliceDescriptorDecoder::AppendPrivateBytes(*pReadLocal, slocalStr_2, sSepLocal);
+	}
+
+	return slocalStr_2;
+}
+std::stringstream CSpliceClass::GetText_Splice_Descriptor(const bool& bIfSingleLine) const {
 	std::stringstream slocalStr_2;
 	std::string sSepLocal = sNextLine;
 	if (bIfSingleLine) {
@@ -1879,6 +1841,11 @@ std::stringstream CSpliceClass::GetText_Splice_Descriptor(const bool& bIfSingleL
 
 		slocalStr_2 << "sd[" << k + 1 << "]" << sSepLocal;
 
+		if (!IsBuiltInDescriptor(*m_objSpliceDescriptor.v_SDChilds[k])) {
+			slocalStr_2 << GetText_Private_Descriptor(m_objSpliceDescriptor.v_SDChilds[k], bIfSingleLine).str();
+			continue;
+		}
+
 		switch (m_objSpliceDescriptor.v_SDChilds[k]->splice_descriptor_tag)
 		{
 			case scte35Desc::avail_descriptor: {
@@ -11,8 +11,11 @@
 */
 #define _SPLICECLASS_HPP_
 
+#include <cstdint>
+#include <cstddef>
 #include <string>
 #include <vector>
+#include "SpliceProfiler.hpp"
 
 /*! \namespace scte35
 *	\brief scte35 namespace to keep clean the global scope.
@@ -77,6 +80,57 @@ struct scte35Desc {
 	}type;
 };
 
+/*!	\struct scte35Error
+*	\brief scte35Error structure to hold the reason values of a parse failure.
+*/
+struct scte35Error {
+	/*! \brief A type definition for type (Parse failure reasons).
+	*/
+	typedef enum {
+		none = 0,					/*!<No failure*/
+		empty_input = 1,			/*!<Input string is empty*/
+		odd_length = 2,				/*!<Input string length is not even*/
+		white_space = 3,			/*!<Input string contains white-spaces*/
+		base64_decode = 4,			/*!<Base64 input could not be decoded*/
+		truncated = 5,				/*!<Input ends before a field of the structure*/
+		unknown_command = 6,		/*!<splice_command_type value is reserved*/
+		descriptor_overrun = 7,		/*!<descriptor_loop_length goes beyond the input*/
+		rejected = 8,				/*!<Input rejected by the pre-validation filter (see #CSpliceClass::SetPreFilter)*/
+		count = 9					/*!<Number of reasons (not a reason)*/
+	}type;
+};
+
+/*!	\struct scte35Field
+*	\brief scte35Field structure to hold the values of the structure in which a parse failure happened.
+*/
+struct scte35Field {
+	/*! \brief A type definition for type (Structures of a splice_info_section).
+	*/
+	typedef enum {
+		input = 0,						/*!<Input string checks and decoding*/
+		splice_info_section = 1,		/*!<Base parameters of splice_info_section*/
+		splice_null = 2,				/*!<splice_null command*/
+		splice_schedule = 3,			/*!<splice_schedule command*/
+		splice_insert = 4,				/*!<splice_insert command*/
+		time_signal = 5,				/*!<time_signal command*/
+		bandwidth_reservation = 6,		/*!<bandwidth_reservation command*/
+		private_command = 7,			/*!<private_command command*/
+		splice_command = 8,				/*!<Reserved splice command*/
+		descriptor_loop = 9,			/*!<Descriptor loop framing (tag and length)*/
+		avail_descriptor = 10,			/*!<Avail descriptor*/
+		dtmf_descriptor = 11,			/*!<DTMF descriptor*/
+		segmentation_descriptor = 12,	/*!<Segmentation descriptor*/
+		time_descriptor = 13,			/*!<Time descriptor*/
+		audio_descriptor = 14,			/*!<Audio descriptor*/
+		crc = 15,						/*!<E_CRC_32 and CRC_32*/
+		count = 16						/*!<Number of structures (not a structure)*/
+	}type;
+};
+
+class CSpliceMetrics;
+class CSpliceDescriptorDecoder;
+class CSpliceDescriptorRegistry;
+
 /*!	\class SInfoData
 *	\brief #SInfoData class to hold base parameters.
 *	
@@ -722,6 +776,13 @@ public:
 	*/
 	std::vector<uint32_t> v_upid_list;
 
+	/*!	\brief segmentation_upid bytes, nullptr if segmentation_upid_length is 0.
+	*
+	*	The bytes are not copied : pUpid points into the parser buffer and is valid until the next parse or #CSpliceClass::ResetValue.
+	*	#CSpliceUpid decodes them according to segmentation_upid_type.
+	*/
+	const uint8_t* pUpid;
+
 	/*!	\brief 8-bit : Contains any one value from the mentioned table.
 	*
 	*	<table><caption id="multi_row">Segmentation Type ID Table</caption><tr><th>Segment Pairing - Start</th><th>Segment Pairing - End</th><th>segmentation_type_id</th></tr><tr><td>Program Start</td><td>Program End (can be overridden by Program Early Termination)</td><td>16/17 (18)</td></tr><tr><td>Program Overlap Start</td><td>Program End</td><td>23/17</td></tr><tr><td>Program Start–In Progress</td><td>Program End (can be overridden by Program Early Termination)</td><td>25/17 (18)</td></tr><tr><td>Program Breakaway</td><td>Program Resumption</td><td>19/20</td></tr><tr><td>Chapter Start</td><td>Chapter End</td><td>32/33</td></tr><tr><td>Break Start</td><td>Break End</td><td>34/35</td></tr><tr><td>Opening Credit Start</td><td>Opening Credit End</td><td>36/37</td></tr><tr><td>Closing Credit Start</td><td>Closing Credit End</td><td>38/39</td></tr><tr><td>Provider Advertisement Start</td><td>Provider Advertisement End</td><td>48/49</td></tr><tr><td>Distributor Advertisement Start</td><td>Distributor Advertisement End</td><td>50/51</td></tr><tr><td>Provider Placement Opportunity Start</td><td>Provider Placement Opportunity End</td><td>52/53</td></tr><tr><td>Distributor Placement Opportunity Start</td><td>Distributor Placement Opportunity End</td><td>54/55</td></tr><tr><td>Provider Overlay Placement Opportunity Start</td><td>Provider Overlay Placement Opportunity Start End</td><td>56/57</td></tr><tr><td>Distributor Overlay Placement Opportunity Start</td><td>Distributor Overlay Placement Opportunity End</td><td>58/59</td></tr><tr><td>Unscheduled Event Start</td><td>Unscheduled Event End</td><td>64/65</td></tr><tr><td>Network Start</td><td>Network End</td><td>80/81</td></tr><tr><td></td><td></td><td></td></tr><tr><th>Not Paired Segments</th><th></th><th></th></tr><tr><td></td><td>Program Runover Planned</td><td>21</td></tr><tr><td></td><td>Program Runover Unplanned</td><td>22</td></tr><tr><td></td><td>Content Identification</td><td>01</td></tr><tr><td></td><td>Not Indicated</td><td>00</td></tr></table>
@@ -764,6 +825,7 @@ public:
 	 segmentation_duration(PARAMETER_DEF_VAL),
 	 segmentation_upid_type(PARAMETER_DEF_VAL),
 	 segmentation_upid_length(PARAMETER_DEF_VAL),
+	 pUpid(nullptr),
 	 segmentation_type_id(PARAMETER_DEF_VAL),
 	 segment_num(PARAMETER_DEF_VAL),
 	 segments_expected(PARAMETER_DEF_VAL),
@@ -842,6 +904,41 @@ public:
 	void ClearValues();
 };
 
+/*!	\class PrivateDescriptor
+*	\brief #PrivateDescriptor class to hold a descriptor other than the "CUEI" ones of this parser (vendor-private or reserved tags).
+*
+*	The bytes are not copied : pRaw points into the parser buffer and is valid until the next parse or #CSpliceClass::ResetValue.
+*	Decoders registered in a #CSpliceDescriptorRegistry return classes derived from #PrivateDescriptor holding their decoded fields.
+*/
+class PrivateDescriptor : public SDBase {
+public:
+	/*! \brief Descriptor bytes starting with splice_descriptor_tag.
+	*/
+	const uint8_t* pRaw;
+
+	/*! \brief Number of bytes in pRaw (descriptor_length + 2, less if the descriptor loop is truncated).
+	*/
+	std::size_t iRawLength;
+
+	/*! \brief Decoder which built this object, nullptr if the descriptor is kept raw.
+	*/
+	const CSpliceDescriptorDecoder* pDecoder;
+
+	/*! \brief #PrivateDescriptor class default constructor with intializer list.
+	*/
+	PrivateDescriptor() :
+	 pRaw(nullptr),
+	 iRawLength(0),
+	 pDecoder(nullptr)
+	{
+
+	}
+
+	/*! \brief #PrivateDescriptor class destructor, virtual so the parser deletes decoder classes through it.
+	*/
+	virtual ~PrivateDescriptor() {}
+};
+
 
 /*!	\class CSpliceClass
 *	\brief #CSpliceClass class is the utility for parsing SCTE-35 data.
@@ -945,35 +1042,6 @@ private:
 
 	//======================= Splice Info Start =============================//
 
-	/*!	\class SInfoLength
-	*	\brief #SInfoLength class holding the fixed base parameters bit length values as enums.
-	*/
-	class SInfoLength {
-	public:
-		/*! 
-		*	\brief A type definition for sil (Base parameters fixed lengths)
-		*/
-		typedef enum {
-			table_id = 8,
-			section_syntax_indicator = 1,
-			private_indicator = 1,
-			reserved = 2,
-			section_length = 12,
-			protocol_version = 8,
-			encrypted_packet = 1,
-			encryption_algorithm = 6,
-			pts_adjustment = 33,
-			cw_index = 8,
-			tier = 12,
-			splice_command_length = 12,
-			splice_command_type = 8,
-			descriptor_loop_length = 16,
-			alignment_stuffing = 8,
-			E_CRC_32 = 32,
-			CRC_32 = 32
-		}sil;
-	};
-
 	/*! \brief #SInfoData object variable for holding SCTE-35 base parameters values.
 	*/
 	SInfoData m_SInfoData;
@@ -985,7 +1053,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns first portion of base parameters textual data as string stream.
 	*/
-	std::stringstream GetTextSInfoDataFirst(const bool& bIfSingleLine);
+	std::stringstream GetTextSInfoDataFirst(const bool& bIfSingleLine) const;
 
 	/*!	\brief Function to clear the splice command type object according to splice_command_type value.
 	*/
@@ -997,7 +1065,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns splice command type object textual data as string stream according to splice_command_type value.
 	*/
-	std::stringstream GetText_Command_Type(const bool& bIfSingleLine);
+	std::stringstream GetText_Command_Type(const bool& bIfSingleLine) const;
 
 	/*! \brief Function to parse the second portion of base parameters from sBinData to m_SInfoData object.
 	*	\returns true if successfully parsed and false if any failure.
@@ -1007,7 +1075,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns second portion of base parameters textual data as string stream.
 	*/
-	std::stringstream GetTextSInfoDataSecond(const bool& bIfSingleLine);
+	std::stringstream GetTextSInfoDataSecond(const bool& bIfSingleLine) const;
 
 	//======================= Splice Info End =============================//
 
@@ -1022,7 +1090,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns splice null command parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Splice_Null(const bool& bIfSingleLine);
+	std::stringstream GetText_Splice_Null(const bool& bIfSingleLine) const;
 
 	/*!	\brief #SpliceScheduleData object variable for holding SCTE-35 Splice Schedule data.
 	*/
@@ -1035,7 +1103,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns splice schedule command parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Splice_Schedule(const bool& bIfSingleLine);
+	std::stringstream GetText_Splice_Schedule(const bool& bIfSingleLine) const;
 
 	/*!	\brief #SpliceInsertData object variable for holding SCTE-35 Splice Insert data.
 	*/
@@ -1048,7 +1116,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns splice insert command parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Splice_Insert(const bool& bIfSingleLine);
+	std::stringstream GetText_Splice_Insert(const bool& bIfSingleLine) const;
 
 	/*!	\brief #splice_time object variable for holding SCTE-35 Time Signal data.
 	*/
@@ -1061,7 +1129,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns time signal command parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Time_Signal(const bool& bIfSingleLine);
+	std::stringstream GetText_Time_Signal(const bool& bIfSingleLine) const;
 
 	//BW_Reservation not required
 	/*! \brief Function to parse the BW reservation command parameters from sBinData to null object.
@@ -1072,7 +1140,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns BW reservation command parameters textual data as string stream.
 	*/
-	std::stringstream GetText_BW_Reservation(const bool& bIfSingleLine);
+	std::stringstream GetText_BW_Reservation(const bool& bIfSingleLine) const;
 
 	/*!	\brief #private_command object variable for holding SCTE-35 Private Command data.
 	*/
@@ -1085,7 +1153,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns private command parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Private_Command(const bool& bIfSingleLine);
+	std::stringstream GetText_Private_Command(const bool& bIfSingleLine) const;
 
 	//======================= Command Type End =============================//
 
@@ -1113,7 +1181,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns avail descriptor parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Avail_Descriptor(SDBase* paramData, const bool& bIfSingleLine);
+	std::stringstream GetText_Avail_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const;
 
 	/*!	\brief Function to parse the DTMF descriptor parameters from sInData and add to a list in m_objSpliceDescriptor object.
 	*	\returns true if successfully parsed and false if any failure.
@@ -1124,18 +1192,20 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns DTMF descriptor parameters textual data as string stream.
 	*/
-	std::stringstream GetText_DTMF_Descriptor(SDBase* paramData, const bool& bIfSingleLine);
+	std::stringstream GetText_DTMF_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const;
 
 	/*!	\brief Function to parse the segmentation descriptor parameters from sInData and add to a list in m_objSpliceDescriptor object.
+	*	\param sInData descriptor bits.
+	*	\param pData descriptor bytes in m_vDescriptorBytes, SegmentationDescriptor::pUpid points into them.
 	*	\returns true if successfully parsed and false if any failure.
 	*/
-	bool Parse_Segmentation_Descriptor(const std::string& sInData);
+	bool Parse_Segmentation_Descriptor(const std::string& sInData, const uint8_t* pData);
 	/*! \brief Function to get the segmentation descriptor parameters as string textual data.
 	*	\param paramData an input of descriptor type data.
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns segmentation descriptor parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Segmentation_Descriptor(SDBase* paramData, const bool& bIfSingleLine);
+	std::stringstream GetText_Segmentation_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const;
 
 	/*!	\brief Function to parse the time descriptor parameters from sInData and add to a list in m_objSpliceDescriptor object.
 	*	\returns true if successfully parsed and false if any failure.
@@ -1146,7 +1216,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns time descriptor parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Time_Descriptor(SDBase* paramData, const bool& bIfSingleLine);
+	std::stringstream GetText_Time_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const;
 
 	/*!	\brief Function to parse the audio descriptor parameters from sInData and add to a list in m_objSpliceDescriptor object.
 	*	\returns true if successfully parsed and false if any failure.
@@ -1157,7 +1227,7 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns audio descriptor parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Audio_Descriptor(SDBase* paramData, const bool& bIfSingleLine);
+	std::stringstream GetText_Audio_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const;
 
 	/*!	\brief Function to clear each descriptor in data list in object m_objSpliceDescriptor according to splice_descriptor_tag parameter.
 	*/
@@ -1171,10 +1241,94 @@ private:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns all descriptors parameters textual data as string stream.
 	*/
-	std::stringstream GetText_Splice_Descriptor(const bool& bIfSingleLine);
+	std::stringstream GetText_Splice_Descriptor(const bool& bIfSingleLine) const;
+	/*!	\brief Function to add a descriptor other than the "CUEI" ones to the list in m_objSpliceDescriptor, decoded by the registered decoder
+	*	if there is one, kept raw otherwise.
+	*	\param pData descriptor bytes starting with splice_descriptor_tag.
+	*	\param iLength number of bytes in pData.
+	*	\param uTag splice_descriptor_tag.
+	*	\param uLength descriptor_length.
+	*	\param uIdentifier identifier (PARAMETER_DEF_VAL if the descriptor is too short to hold it).
+	*/
+	void Parse_Private_Descriptor(const uint8_t* pData, const std::size_t& iLength, const uint32_t& uTag, const uint32_t& uLength, const uint32_t& uIdentifier);
+	/*! \brief Function to get the parameters of a descriptor other than the "CUEI" ones as string textual data.
+	*	\param paramData an input of descriptor type data.
+	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
+	*	\returns private descriptor parameters textual data as string stream.
+	*/
+	std::stringstream GetText_Private_Descriptor(SDBase* paramData, const bool& bIfSingleLine) const;
+	/*! \brief Bytes of the descriptor loop the #PrivateDescriptor and SegmentationDescriptor::pUpid views point into, sized once per parse so the views stay valid.
+	*/
+	std::vector<uint8_t> m_vDescriptorBytes;
+	/*! \brief Decoders of the descriptors other than the "CUEI" ones, not owned (nullptr if not attached).
+	*/
+	const CSpliceDescriptorRegistry* m_pDescriptorRegistry;
 
 	//================================== Descriptors =========================================//
 
+	//================================== Parse Outcome =========================================//
+
+	/*! \brief Reason of the first failure of the last parse (scte35Error::none if it succeeded).
+	*/
+	scte35Error::type m_eLastError;
+	/*! \brief Structure in which the first failure of the last parse happened.
+	*/
+	scte35Field::type m_eLastErrorField;
+	/*! \brief Metrics receiving the parse outcomes, not owned (nullptr if not attached).
+	*/
+	CSpliceMetrics* m_pMetrics;
+	/*! \brief Whether hexa-decimal and Base64 inputs go through CSpliceFilter before the full parse.
+	*/
+	bool m_bPreFilter;
+	/*! \brief Whether the pre-validation filter checks CRC_32 too.
+	*/
+	bool m_bPreFilterCRC;
+	/*! \brief Whether #ParseHexa tries #ParseTimeSignalFast before the general path.
+	*/
+	bool m_bFastPath;
+	/*! \brief Number of #ParseHexa calls completed by the time_signal fast path.
+	*/
+	uint64_t m_uFastPathHits;
+	/*! \brief Number of #ParseHexa calls the time_signal fast path handed to the general path.
+	*/
+	uint64_t m_uFastPathFallbacks;
+
+	/*! \brief Function to parse a time_signal cue whose descriptors are all program segmentation_descriptor, straight from the hexa-decimal bytes.
+	*
+	*	Fills the same members as the general path (sBinData and sDescriptorData are left empty). Any other shape, an encrypted section,
+	*	a section_length not matching the input or a field not fitting its descriptor returns false before any member is touched.
+	*	\param sInput an input hexa-decimal string data, already checked for length and spaces.
+	*	\returns true if parsed and false if the general path must parse the input.
+	*/
+	bool ParseTimeSignalFast(const std::string& sInput);
+
+	/*! \brief Function to record a parse failure. Only the first failure of a parse is kept and counted.
+	*	\param eError reason of the failure.
+	*	\param eField structure in which the failure happened.
+	*	\returns always false so it can be returned directly by the failing parse function.
+	*/
+	bool SetParseError(const scte35Error::type& eError, const scte35Field::type& eField);
+	/*! \brief Function to record a successful parse (command type, descriptor tags and CRC_32 check) to the attached metrics.
+	*	\param pSection section bytes the CRC_32 is checked over, or nullptr to check it over sBinData.
+	*/
+	void RecordParseSuccess(const uint8_t* pSection);
+	/*! \brief Function to check CRC_32 of the parsed section against the CRC computed over sBinData.
+	*	\returns true if CRC_32 matches and false if not.
+	*/
+	bool IsCRCValid();
+	/*! \brief Function to get the #scte35Field value of a splice command.
+	*	\param uCommandType splice_command_type value.
+	*	\returns corresponding structure value.
+	*/
+	static scte35Field::type GetCommandField(const uint32_t& uCommandType);
+
+	//================================== Parse Outcome =========================================//
+
+#ifdef SCTE35_ENABLE_PROFILING
+	/*! \brief #CSpliceProfiler object variable holding the per-stage parse timings of this object (mutable so the const #GetText is timed too, with atomic counters so a cue shared between threads can be).
+	*/
+	mutable CSpliceProfiler m_objProfiler;
+#endif
 
 public:
 
@@ -1215,7 +1369,7 @@ public:
 	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
 	*	\returns full SCTE-35 parameters textual data as string stream.
 	*/
-	std::string GetText(const bool& bIfSingleLine);
+	std::string GetText(const bool& bIfSingleLine) const;
 
 	/*!	\brief Function to reset all the SCTE-35 data parsed previously in parameters to default value.
 	*/
@@ -1225,6 +1379,92 @@ public:
 	*	\param sParam an input string data (this variable is modified inside this function).
 	*/
 	void RemoveSpaces(std::string& sParam);
+
+	/*!	\brief Function to attach metrics which will count the outcome of every following parse.
+	*	\param pMetrics metrics object (not owned, must outlive this object or be detached with nullptr).
+	*/
+	void SetMetrics(CSpliceMetrics* pMetrics);
+
+	/*!	\brief Function to attach the decoders of vendor-private descriptors. Descriptors without a decoder are kept as raw #PrivateDescriptor.
+	*	\param pRegistry registry (not owned, must outlive this object or be detached with nullptr).
+	*/
+	void SetDescriptorRegistry(const CSpliceDescriptorRegistry* pRegistry);
+
+	/*!	\brief Function to check whether a (splice_descriptor_tag, identifier) pair is a "CUEI" descriptor parsed by this class.
+	*	\returns true for identifier 0x43554549 and tags avail_descriptor to audio_descriptor.
+	*/
+	static bool IsBuiltInDescriptor(const uint32_t& uTag, const uint32_t& uIdentifier) { return uIdentifier == 0x43554549 && uTag <= scte35Desc::audio_descriptor; }
+
+	/*!	\brief Function to check whether a descriptor of #GetDescriptors is a "CUEI" one, false means it is a #PrivateDescriptor.
+	*/
+	static bool IsBuiltInDescriptor(const SDBase& objDescriptor) { return IsBuiltInDescriptor(objDescriptor.splice_descriptor_tag, objDescriptor.identifier); }
+
+	/*!	\brief Function to run CSpliceFilter on hexa-decimal and Base64 inputs before decoding them, so garbage fails with scte35Error::rejected
+	*	before any bit string conversion. The filter is stricter than the parser on section_syntax_indicator, private_indicator and protocol_version.
+	*	\param bEnable whether the filter runs (off by default).
+	*	\param bCheckCRC whether the filter rejects a wrong CRC_32 too.
+	*/
+	void SetPreFilter(const bool& bEnable, const bool& bCheckCRC = false);
+
+	/*!	\brief Function to enable the time_signal fast path of #ParseHexa and #ParseBase64 (on by default). It decodes the common time_signal
+	*	plus program segmentation_descriptor cues from bytes with the same results as the general path, which handles every other input.
+	*	\param bEnable whether the fast path is tried.
+	*/
+	void SetFastPath(const bool& bEnable);
+
+	/*!	\brief Function to get the number of parses completed by the time_signal fast path.
+	*/
+	uint64_t GetFastPathHits() const { return m_uFastPathHits; }
+
+	/*!	\brief Function to get the number of parses the time_signal fast path handed to the general path.
+	*/
+	uint64_t GetFastPathFallbacks() const { return m_uFastPathFallbacks; }
+
+	/*!	\brief Function to get the reason of the failure of the last parse.
+	*	\returns failure reason, scte35Error::none if the last parse succeeded.
+	*/
+	scte35Error::type GetLastError() const { return m_eLastError; }
+
+	/*!	\brief Function to get the structure in which the last parse failed.
+	*	\returns failing structure, only meaningful when #GetLastError is not scte35Error::none.
+	*/
+	scte35Field::type GetLastErrorField() const { return m_eLastErrorField; }
+
+	/*!	\brief Function to get the base parameters (splice_info_section fields) of the last parse.
+	*/
+	const SInfoData& GetSInfoData() const { return m_SInfoData; }
+
+	/*!	\brief Function to get the splice_schedule command of the last parse (meaningful when splice_command_type is splice_schedule).
+	*/
+	const SpliceScheduleData& GetSpliceSchedule() const { return m_objSpliceSchedule; }
+
+	/*!	\brief Function to get the splice_insert command of the last parse (meaningful when splice_command_type is splice_insert).
+	*/
+	const SpliceInsertData& GetSpliceInsert() const { return m_objSpliceInsert; }
+
+	/*!	\brief Function to get the time_signal command of the last parse (meaningful when splice_command_type is time_signal).
+	*/
+	const splice_time& GetTimeSignal() const { return m_objTimeSignal; }
+
+	/*!	\brief Function to get the private_command of the last parse (meaningful when splice_command_type is private_command).
+	*/
+	const private_command& GetPrivateCommand() const { return m_objPrivateCommand; }
+
+	/*!	\brief Function to get the descriptors of the last parse, each one is cast to its class according to splice_descriptor_tag if
+	*	#IsBuiltInDescriptor, to #PrivateDescriptor (or the class of its decoder) otherwise.
+	*/
+	const std::vector<SDBase*>& GetDescriptors() const { return m_objSpliceDescriptor.v_SDChilds; }
+
+#ifdef SCTE35_ENABLE_PROFILING
+	/*!	\brief Function to get the per-stage timing histograms of all the parses and text generations done by this object.
+	*	\returns stage profiler (only available when built with SCTE35_ENABLE_PROFILING).
+	*/
+	const CSpliceProfiler& GetProfiler() const { return m_objProfiler; }
+
+	/*!	\brief Function to reset the per-stage timing histograms (not done by #ResetValue).
+	*/
+	void ResetProfiler() { m_objProfiler.ResetValue(); }
+#endif
 	//--------------------------------------- Usage Functions End -------------------------------------------------------//
 };
 
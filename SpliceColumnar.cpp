@@ -0,0 +1,783 @@
+/*! \file SpliceColumnar.cpp
+*	\brief Splice columnar export classes definition.
+*	\details CPP file for definition of classes CSpliceColumnar, CSpliceColumnarWriter and CSpliceColumnarReader whose declaration is in
+*	SpliceColumnar.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceColumnar.hpp"
+#include <cstring>		//for std::memcpy, std::memcmp, std::strlen
+#include <fstream>
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const std::size_t CSpliceColumnar::iFileHeaderSize;
+const std::size_t CSpliceColumnar::iDirectoryEntrySize;
+const std::size_t CSpliceColumnar::iMaxNameLength;
+const uint32_t CSpliceColumnar::uVersion;
+
+/*! \brief Magic of the columnar file header.
+*/
+static const char cColumnarMagic[8] = { 'S', 'C', 'T', 'E', '3', '5', 'C', 'L' };
+
+/*!	\class SColumnDef
+*	\brief #SColumnDef class holding the name, encoding and width of a column of the schema.
+*/
+class SColumnDef {
+public:
+	const char* sName;							/*!<Column name.*/
+	scte35ColumnEncoding::type eEncoding;		/*!<Encoding.*/
+	uint32_t iWidth;							/*!<Width in bytes.*/
+};
+
+/*! \brief Columns of the cue table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objCueColumns[] = {
+	{ "channel", scte35ColumnEncoding::plain, 8 },
+	{ "receive_time", scte35ColumnEncoding::delta, 8 },
+	{ "table_id", scte35ColumnEncoding::plain, 1 },
+	{ "section_syntax_indicator", scte35ColumnEncoding::plain, 1 },
+	{ "private_indicator", scte35ColumnEncoding::plain, 1 },
+	{ "section_length", scte35ColumnEncoding::plain, 2 },
+	{ "protocol_version", scte35ColumnEncoding::plain, 1 },
+	{ "encrypted_packet", scte35ColumnEncoding::plain, 1 },
+	{ "encryption_algorithm", scte35ColumnEncoding::plain, 1 },
+	{ "pts_adjustment", scte35ColumnEncoding::delta, 8 },
+	{ "cw_index", scte35ColumnEncoding::plain, 1 },
+	{ "tier", scte35ColumnEncoding::plain, 2 },
+	{ "splice_command_length", scte35ColumnEncoding::plain, 2 },
+	{ "splice_command_type", scte35ColumnEncoding::plain, 1 },
+	{ "descriptor_loop_length", scte35ColumnEncoding::plain, 2 },
+	{ "descriptor_count", scte35ColumnEncoding::plain, 1 },
+	{ "CRC_32", scte35ColumnEncoding::plain, 4 },
+	//splice_time of a splice_insert or a time_signal
+	{ "time_specified_flag", scte35ColumnEncoding::plain, 1 },
+	{ "pts_time", scte35ColumnEncoding::delta, 8 },
+	//splice_insert
+	{ "splice_event_id", scte35ColumnEncoding::plain, 4 },
+	{ "splice_event_cancel_indicator", scte35ColumnEncoding::plain, 1 },
+	{ "out_of_network_indicator", scte35ColumnEncoding::plain, 1 },
+	{ "program_splice_flag", scte35ColumnEncoding::plain, 1 },
+	{ "duration_flag", scte35ColumnEncoding::plain, 1 },
+	{ "splice_immediate_flag", scte35ColumnEncoding::plain, 1 },
+	{ "auto_return", scte35ColumnEncoding::plain, 1 },
+	{ "break_duration", scte35ColumnEncoding::plain, 8 },
+	{ "unique_program_id", scte35ColumnEncoding::plain, 2 },
+	{ "avail_num", scte35ColumnEncoding::plain, 1 },
+	{ "avails_expected", scte35ColumnEncoding::plain, 1 },
+	//splice_schedule and private_command
+	{ "splice_count", scte35ColumnEncoding::plain, 1 },
+	{ "private_identifier", scte35ColumnEncoding::plain, 4 }
+};
+
+/*! \brief Columns of the schedule table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objScheduleColumns[] = {
+	{ "schedule.cue_row", scte35ColumnEncoding::plain, 8 },
+	{ "schedule.splice_event_id", scte35ColumnEncoding::plain, 4 },
+	{ "schedule.splice_event_cancel_indicator", scte35ColumnEncoding::plain, 1 },
+	{ "schedule.out_of_network_indicator", scte35ColumnEncoding::plain, 1 },
+	{ "schedule.program_splice_flag", scte35ColumnEncoding::plain, 1 },
+	{ "schedule.duration_flag", scte35ColumnEncoding::plain, 1 },
+	{ "schedule.utc_splice_time", scte35ColumnEncoding::plain, 4 },
+	{ "schedule.auto_return", scte35ColumnEncoding::plain, 1 },
+	{ "schedule.break_duration", scte35ColumnEncoding::plain, 8 },
+	{ "schedule.unique_program_id", scte35ColumnEncoding::plain, 2 },
+	{ "schedule.avail_num", scte35ColumnEncoding::plain, 1 },
+	{ "schedule.avails_expected", scte35ColumnEncoding::plain, 1 }
+};
+
+/*! \brief Columns of the segmentation table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objSegmentationColumns[] = {
+	{ "segmentation.cue_row", scte35ColumnEncoding::plain, 8 },
+	{ "segmentation.segmentation_event_id", scte35ColumnEncoding::plain, 4 },
+	{ "segmentation.segmentation_event_cancel_indicator", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.program_segmentation_flag", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.segmentation_duration_flag", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.delivery_not_restricted_flag", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.web_delivery_allowed_flag", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.no_regional_blackout_flag", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.archive_allowed_flag", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.device_restrictions", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.component_count", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.segmentation_duration", scte35ColumnEncoding::plain, 8 },
+	{ "segmentation.segmentation_upid_type", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.segmentation_upid", scte35ColumnEncoding::dictionary, 4 },
+	{ "segmentation.segmentation_type_id", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.segment_num", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.segments_expected", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.sub_segment_num", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation.sub_segments_expected", scte35ColumnEncoding::plain, 1 }
+};
+
+/*! \brief Columns of the avail table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objAvailColumns[] = {
+	{ "avail.cue_row", scte35ColumnEncoding::plain, 8 },
+	{ "avail.provider_avail_id", scte35ColumnEncoding::plain, 4 }
+};
+
+/*! \brief Columns of the DTMF table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objDtmfColumns[] = {
+	{ "dtmf.cue_row", scte35ColumnEncoding::plain, 8 },
+	{ "dtmf.preroll", scte35ColumnEncoding::plain, 1 },
+	{ "dtmf.dtmf_count", scte35ColumnEncoding::plain, 1 },
+	{ "dtmf.DTMF_char", scte35ColumnEncoding::plain, 8 }		//up to 7 characters, the first one in the low byte
+};
+
+/*! \brief Columns of the time table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objTimeColumns[] = {
+	{ "time.cue_row", scte35ColumnEncoding::plain, 8 },
+	{ "time.TAI_seconds", scte35ColumnEncoding::plain, 8 },
+	{ "time.TAI_ns", scte35ColumnEncoding::plain, 4 },
+	{ "time.UTC_offset", scte35ColumnEncoding::plain, 2 }
+};
+
+/*! \brief Columns of the audio table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objAudioColumns[] = {
+	{ "audio.cue_row", scte35ColumnEncoding::plain, 8 },
+	{ "audio.audio_count", scte35ColumnEncoding::plain, 1 }
+};
+
+/*! \brief Columns of the splice_insert component table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objInsertComponentColumns[] = {
+	{ "insert_component.cue_row", scte35ColumnEncoding::plain, 8 },
+	{ "insert_component.component_tag", scte35ColumnEncoding::plain, 1 },
+	{ "insert_component.time_specified_flag", scte35ColumnEncoding::plain, 1 },
+	{ "insert_component.pts_time", scte35ColumnEncoding::plain, 8 }
+};
+
+/*! \brief Columns of the splice_schedule component table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objScheduleComponentColumns[] = {
+	{ "schedule_component.schedule_row", scte35ColumnEncoding::plain, 8 },
+	{ "schedule_component.component_tag", scte35ColumnEncoding::plain, 1 },
+	{ "schedule_component.utc_splice_time", scte35ColumnEncoding::plain, 4 }
+};
+
+/*! \brief Columns of the segmentation component table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objSegmentationComponentColumns[] = {
+	{ "segmentation_component.segmentation_row", scte35ColumnEncoding::plain, 8 },
+	{ "segmentation_component.component_tag", scte35ColumnEncoding::plain, 1 },
+	{ "segmentation_component.pts_offset", scte35ColumnEncoding::plain, 8 }
+};
+
+/*! \brief Columns of the audio component table, in the order of the values of CSpliceColumnarWriter::Add.
+*/
+static const SColumnDef objAudioComponentColumns[] = {
+	{ "audio_component.audio_row", scte35ColumnEncoding::plain, 8 },
+	{ "audio_component.component_tag", scte35ColumnEncoding::plain, 1 },
+	{ "audio_component.ISO_code", scte35ColumnEncoding::plain, 4 },
+	{ "audio_component.Bit_Stream_Mode", scte35ColumnEncoding::plain, 1 },
+	{ "audio_component.Num_Channels", scte35ColumnEncoding::plain, 1 },
+	{ "audio_component.Full_Srvc_Audio", scte35ColumnEncoding::plain, 1 }
+};
+
+/*! \brief Function to get the number of columns of a table at compile time.
+*/
+template <std::size_t N>
+static constexpr std::size_t ColumnCount(const SColumnDef (&)[N]) {
+	return N;
+}
+
+/*!	\class STableDef
+*	\brief #STableDef class holding a table of the schema: its columns and, for a child table, its parent and the offsets column of the parent.
+*/
+class STableDef {
+public:
+	scte35ColumnTable::type eTable;				/*!<Table.*/
+	scte35ColumnTable::type eParent;			/*!<Parent table, the table itself for the cue table.*/
+	const char* sOffsets;						/*!<Name of the offsets column in the parent table, nullptr for the cue table.*/
+	const SColumnDef* pColumns;					/*!<Columns, the parent row first for a child table.*/
+	std::size_t iColumns;						/*!<Number of columns.*/
+};
+
+/*! \brief Tables of the schema but the dictionary, every parent before its children.
+*/
+static const STableDef objTables[] = {
+	{ scte35ColumnTable::cue, scte35ColumnTable::cue, nullptr, objCueColumns, ColumnCount(objCueColumns) },
+	{ scte35ColumnTable::schedule, scte35ColumnTable::cue, "schedule_offsets", objScheduleColumns, ColumnCount(objScheduleColumns) },
+	{ scte35ColumnTable::segmentation, scte35ColumnTable::cue, "segmentation_offsets", objSegmentationColumns, ColumnCount(objSegmentationColumns) },
+	{ scte35ColumnTable::avail, scte35ColumnTable::cue, "avail_offsets", objAvailColumns, ColumnCount(objAvailColumns) },
+	{ scte35ColumnTable::dtmf, scte35ColumnTable::cue, "dtmf_offsets", objDtmfColumns, ColumnCount(objDtmfColumns) },
+	{ scte35ColumnTable::time, scte35ColumnTable::cue, "time_offsets", objTimeColumns, ColumnCount(objTimeColumns) },
+	{ scte35ColumnTable::audio, scte35ColumnTable::cue, "audio_offsets", objAudioColumns, ColumnCount(objAudioColumns) },
+	{ scte35ColumnTable::insert_component, scte35ColumnTable::cue, "insert_component_offsets", objInsertComponentColumns, ColumnCount(objInsertComponentColumns) },
+	{ scte35ColumnTable::schedule_component, scte35ColumnTable::schedule, "schedule.component_offsets", objScheduleComponentColumns, ColumnCount(objScheduleComponentColumns) },
+	{ scte35ColumnTable::segmentation_component, scte35ColumnTable::segmentation, "segmentation.component_offsets", objSegmentationComponentColumns, ColumnCount(objSegmentationComponentColumns) },
+	{ scte35ColumnTable::audio_component, scte35ColumnTable::audio, "audio.component_offsets", objAudioComponentColumns, ColumnCount(objAudioComponentColumns) }
+};
+
+/*! \brief Number of tables of the schema but the dictionary.
+*/
+static const std::size_t iTables = sizeof(objTables) / sizeof(objTables[0]);
+
+/*! \brief Function to store a value in little-endian order.
+*/
+static void StoreLE(uint8_t* pOutput, uint64_t uValue, const std::size_t& iBytes) {
+	for (std::size_t i = 0;i < iBytes;i++) {
+		pOutput[i] = (uint8_t)uValue;
+		uValue >>= 8;
+	}
+}
+
+/*! \brief Function to load a value stored in little-endian order.
+*/
+static uint64_t LoadLE(const uint8_t* pInput, const std::size_t& iBytes) {
+	uint64_t uValue = 0;
+	for (std::size_t i = iBytes;i > 0;i--) {
+		uValue = (uValue << 8) | pInput[i - 1];
+	}
+	return uValue;
+}
+
+/*! \brief Function to pad the file image data to an 8-byte boundary and append the directory entry of the column stored from iOffset.
+*/
+static void AppendEntry(std::vector<uint8_t>& vDirectory, std::vector<uint8_t>& vData, const uint64_t& uDataStart, const char* sName,
+	const scte35ColumnTable::type& eTable, const scte35ColumnEncoding::type& eEncoding, const uint32_t& iWidth, const std::size_t& iCount, const std::size_t& iOffset) {
+	const std::size_t iSize = vData.size() - iOffset;
+	vData.resize((vData.size() + 7) & ~(std::size_t)7, 0);
+
+	uint8_t uEntry[CSpliceColumnar::iDirectoryEntrySize] = {};
+	std::memcpy(uEntry, sName, std::strlen(sName));
+	uEntry[64] = (uint8_t)eTable;
+	uEntry[65] = (uint8_t)eEncoding;
+	uEntry[66] = (uint8_t)iWidth;
+	StoreLE(uEntry + 72, iCount, 8);
+	StoreLE(uEntry + 80, uDataStart + iOffset, 8);
+	StoreLE(uEntry + 88, iSize, 8);
+	vDirectory.insert(vDirectory.end(), uEntry, uEntry + sizeof(uEntry));
+}
+
+/*! \brief Function to append one column to the file image: its directory entry and its encoded data on an 8-byte boundary.
+*/
+static void AppendColumn(std::vector<uint8_t>& vDirectory, std::vector<uint8_t>& vData, const uint64_t& uDataStart, const char* sName,
+	const scte35ColumnTable::type& eTable, const scte35ColumnEncoding::type& eEncoding, const uint32_t& iWidth, const std::vector<uint64_t>& vValues) {
+	const std::size_t iOffset = vData.size();
+	if (eEncoding == scte35ColumnEncoding::delta) {
+		uint64_t uPrevious = 0;
+		for (std::size_t i = 0;i < vValues.size();i++) {
+			//Zigzag keeps small negative steps (an earlier cue of another channel) small
+			const int64_t iDelta = (int64_t)(vValues[i] - uPrevious);
+			uint64_t uCode = ((uint64_t)iDelta << 1) ^ (uint64_t)(iDelta >> 63);
+			uPrevious = vValues[i];
+			while (uCode >= 0x80) {
+				vData.push_back((uint8_t)(uCode | 0x80));
+				uCode >>= 7;
+			}
+			vData.push_back((uint8_t)uCode);
+		}
+	}
+	else {
+		vData.resize(iOffset + vValues.size() * iWidth);
+		for (std::size_t i = 0;i < vValues.size();i++) {
+			StoreLE(vData.data() + iOffset + i * iWidth, vValues[i], iWidth);
+		}
+	}
+	AppendEntry(vDirectory, vData, uDataStart, sName, eTable, eEncoding, iWidth, vValues.size(), iOffset);
+}
+
+/*! \brief Function to append one column of bytes to the file image, copied as they are (plain encoding of width 1).
+*/
+static void AppendColumn(std::vector<uint8_t>& vDirectory, std::vector<uint8_t>& vData, const uint64_t& uDataStart, const char* sName,
+	const scte35ColumnTable::type& eTable, const std::vector<uint8_t>& vValues) {
+	const std::size_t iOffset = vData.size();
+	vData.insert(vData.end(), vValues.begin(), vValues.end());
+	AppendEntry(vDirectory, vData, uDataStart, sName, eTable, scte35ColumnEncoding::plain, 1, vValues.size(), iOffset);
+}
+
+/*! \brief Function to check that offsets start at 0, never decrease and stay within a limit.
+*/
+static bool IsAscending(const std::vector<uint64_t>& vOffsets, const uint64_t& uLimit) {
+	if (vOffsets.empty() || vOffsets[0] != 0) {
+		return false;
+	}
+	for (std::size_t i = 1;i < vOffsets.size();i++) {
+		if (vOffsets[i] < vOffsets[i - 1] || vOffsets[i] > uLimit) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*! \brief Function to append one row to the columns of a table.
+*/
+template <std::size_t N>
+static void AppendRow(std::vector<std::vector<uint64_t>>& vColumns, const uint64_t (&uValues)[N]) {
+	for (std::size_t i = 0;i < N;i++) {
+		vColumns[i].push_back(uValues[i]);
+	}
+}
+
+//--------------------------------------- CSpliceColumnarWriter -------------------------------------------------------//
+
+CSpliceColumnarWriter::CSpliceColumnarWriter() :
+m_vTables(),
+m_vOffsets(),
+m_mUpids(),
+m_vUpidOffsets(1, 0),
+m_vUpidBytes(),
+m_sUpidKey()
+{
+	for (std::size_t i = 0;i < iTables;i++) {
+		m_vTables[objTables[i].eTable].resize(objTables[i].iColumns);
+		if (objTables[i].eParent != objTables[i].eTable) {
+			m_vOffsets[objTables[i].eTable].assign(1, 0);
+		}
+	}
+}
+
+bool CSpliceColumnarWriter::Add(const CSpliceClass& objCue, const uint64_t& uChannel, const uint64_t& uReceiveTime) {
+	const std::vector<SDBase*>& vDescriptors = objCue.GetDescriptors();
+	//segmentation_upid is a 32-bit dictionary index, a batch holding more UPIDs is refused before anything is appended
+	if (objCue.GetLastError() != scte35Error::none || GetUpidCount() + vDescriptors.size() > 0xFFFFFFFFu) {
+		return false;
+	}
+
+	const SInfoData& objInfo = objCue.GetSInfoData();
+	const SpliceInsertData& objInsert = objCue.GetSpliceInsert();
+	const uint32_t uCommand = objInfo.splice_command_type;
+	const bool bInsert = uCommand == scte35Cmd::splice_insert;
+	const uint64_t uCueRow = GetRows();
+
+	//Command columns hold 0 for cues of another command, splice_command_type tells which ones apply
+	const splice_time* pTime = nullptr;
+	if (uCommand == scte35Cmd::time_signal) {
+		pTime = &objCue.GetTimeSignal();
+	}
+	else if (bInsert && objInsert.splice_immediate_flag == 0) {
+		pTime = &objInsert.m_spliceT;
+	}
+	const uint64_t uCueValues[] = {
+		uChannel,
+		uReceiveTime,
+		objInfo.table_id,
+		objInfo.section_syntax_indicator,
+		objInfo.private_indicator,
+		objInfo.section_length,
+		objInfo.protocol_version,
+		objInfo.encrypted_packet,
+		objInfo.encryption_algorithm,
+		objInfo.pts_adjustment,
+		objInfo.cw_index,
+		objInfo.tier,
+		objInfo.splice_command_length,
+		uCommand,
+		objInfo.descriptor_loop_length,
+		vDescriptors.size(),
+		objInfo.CRC_32,
+		pTime != nullptr ? pTime->time_specified_flag : 0,
+		pTime != nullptr && pTime->time_specified_flag == 1 ? pTime->pts_time : 0,
+		bInsert ? objInsert.splice_event_id : 0,
+		bInsert ? objInsert.splice_event_cancel_indicator : 0,
+		bInsert ? objInsert.out_of_network_indicator : 0,
+		bInsert ? objInsert.program_splice_flag : 0,
+		bInsert ? objInsert.duration_flag : 0,
+		bInsert ? objInsert.splice_immediate_flag : 0,
+		bInsert && objInsert.duration_flag == 1 ? objInsert.m_breakD.auto_return : 0,
+		bInsert && objInsert.duration_flag == 1 ? objInsert.m_breakD.duration : 0,
+		bInsert ? objInsert.unique_program_id : 0,
+		bInsert ? objInsert.avail_num : 0,
+		bInsert ? objInsert.avails_expected : 0,
+		uCommand == scte35Cmd::splice_schedule ? objCue.GetSpliceSchedule().splice_count : 0,
+		uCommand == scte35Cmd::private_command ? objCue.GetPrivateCommand().identifier : 0
+	};
+	static_assert(ColumnCount(objCueColumns) == sizeof(uCueValues) / sizeof(uCueValues[0]), "cue values do not match the cue columns");
+	AppendRow(m_vTables[scte35ColumnTable::cue], uCueValues);
+
+	//Component loops of a splice_insert only exist in component splice mode, their splice_time only out of splice immediate mode
+	if (bInsert && objInsert.program_splice_flag == 0) {
+		for (std::size_t i = 0;i < objInsert.v_ChildComps.size();i++) {
+			const SInComponent& objComponent = objInsert.v_ChildComps[i];
+			const bool bTime = objInsert.splice_immediate_flag == 0;
+			const uint64_t uValues[] = {
+				uCueRow,
+				objComponent.component_tag,
+				bTime ? objComponent.m_spliceT.time_specified_flag : 0,
+				bTime && objComponent.m_spliceT.time_specified_flag == 1 ? objComponent.m_spliceT.pts_time : 0
+			};
+			static_assert(ColumnCount(objInsertComponentColumns) == sizeof(uValues) / sizeof(uValues[0]), "splice_insert component values do not match the columns");
+			AppendRow(m_vTables[scte35ColumnTable::insert_component], uValues);
+		}
+	}
+
+	if (uCommand == scte35Cmd::splice_schedule) {
+		const std::vector<SpliceScheduleChild>& vEvents = objCue.GetSpliceSchedule().v_childs;
+		for (std::size_t i = 0;i < vEvents.size();i++) {
+			const SpliceScheduleChild& objEvent = vEvents[i];
+			const uint64_t uScheduleRow = m_vTables[scte35ColumnTable::schedule][0].size();
+			const uint64_t uValues[] = {
+				uCueRow,
+				objEvent.splice_event_id,
+				objEvent.splice_event_cancel_indicator,
+				objEvent.out_of_network_indicator,
+				objEvent.program_splice_flag,
+				objEvent.duration_flag,
+				objEvent.utc_splice_time,
+				objEvent.duration_flag == 1 ? objEvent.m_breakD.auto_return : 0,
+				objEvent.duration_flag == 1 ? objEvent.m_breakD.duration : 0,
+				objEvent.unique_program_id,
+				objEvent.avail_num,
+				objEvent.avails_expected
+			};
+			static_assert(ColumnCount(objScheduleColumns) == sizeof(uValues) / sizeof(uValues[0]), "schedule values do not match the schedule columns");
+			AppendRow(m_vTables[scte35ColumnTable::schedule], uValues);
+
+			for (std::size_t j = 0;objEvent.program_splice_flag == 0 && j < objEvent.v_Component_childs.size();j++) {
+				const uint64_t uComponentValues[] = {
+					uScheduleRow,
+					objEvent.v_Component_childs[j].component_tag,
+					objEvent.v_Component_childs[j].utc_splice_time
+				};
+				static_assert(ColumnCount(objScheduleComponentColumns) == sizeof(uComponentValues) / sizeof(uComponentValues[0]), "splice_schedule component values do not match the columns");
+				AppendRow(m_vTables[scte35ColumnTable::schedule_component], uComponentValues);
+			}
+			m_vOffsets[scte35ColumnTable::schedule_component].push_back(m_vTables[scte35ColumnTable::schedule_component][0].size());
+		}
+	}
+
+	for (std::size_t i = 0;i < vDescriptors.size();i++) {
+		if (!CSpliceClass::IsBuiltInDescriptor(*vDescriptors[i])) {
+			continue;
+		}
+		switch (vDescriptors[i]->splice_descriptor_tag) {
+		case scte35Desc::avail_descriptor: {
+			const uint64_t uValues[] = {
+				uCueRow,
+				static_cast<const AvailDescriptor*>(vDescriptors[i])->provider_avail_id
+			};
+			static_assert(ColumnCount(objAvailColumns) == sizeof(uValues) / sizeof(uValues[0]), "avail values do not match the avail columns");
+			AppendRow(m_vTables[scte35ColumnTable::avail], uValues);
+			break;
+		}
+		case scte35Desc::dtmf_descriptor: {
+			const DTMFDescriptor& objDtmf = *static_cast<const DTMFDescriptor*>(vDescriptors[i]);
+			uint64_t uChars = 0;
+			for (std::size_t j = objDtmf.v_DTMF_Char.size();j > 0;j--) {
+				uChars = (uChars << 8) | (uint8_t)objDtmf.v_DTMF_Char[j - 1];
+			}
+			const uint64_t uValues[] = {
+				uCueRow,
+				objDtmf.preroll,
+				objDtmf.dtmf_count,
+				uChars
+			};
+			static_assert(ColumnCount(objDtmfColumns) == sizeof(uValues) / sizeof(uValues[0]), "DTMF values do not match the DTMF columns");
+			AppendRow(m_vTables[scte35ColumnTable::dtmf], uValues);
+			break;
+		}
+		case scte35Desc::segmentation_descriptor: {
+			const SegmentationDescriptor& objSegmentation = *static_cast<const SegmentationDescriptor*>(vDescriptors[i]);
+			const uint64_t uSegmentationRow = m_vTables[scte35ColumnTable::segmentation][0].size();
+
+			//Dictionary: a UPID repeated by every cue of a programme is stored once
+			m_sUpidKey.assign(objSegmentation.v_upid_list.begin(), objSegmentation.v_upid_list.end());
+			auto itUpid = m_mUpids.find(m_sUpidKey);
+			if (itUpid == m_mUpids.end()) {
+				itUpid = m_mUpids.emplace(m_sUpidKey, (uint32_t)GetUpidCount()).first;
+				m_vUpidBytes.insert(m_vUpidBytes.end(), objSegmentation.v_upid_list.begin(), objSegmentation.v_upid_list.end());
+				m_vUpidOffsets.push_back(m_vUpidBytes.size());
+			}
+
+			const uint64_t uValues[] = {
+				uCueRow,
+				objSegmentation.segmentation_event_id,
+				objSegmentation.segmentation_event_cancel_indicator,
+				objSegmentation.program_segmentation_flag,
+				objSegmentation.segmentation_duration_flag,
+				objSegmentation.delivery_not_restricted_flag,
+				objSegmentation.web_delivery_allowed_flag,
+				objSegmentation.no_regional_blackout_flag,
+				objSegmentation.archive_allowed_flag,
+				objSegmentation.device_restrictions,
+				objSegmentation.component_count,
+				objSegmentation.segmentation_duration,
+				objSegmentation.segmentation_upid_type,
+				itUpid->second,
+				objSegmentation.segmentation_type_id,
+				objSegmentation.segment_num,
+				objSegmentation.segments_expected,
+				objSegmentation.sub_segment_num,
+				objSegmentation.sub_segments_expected
+			};
+			static_assert(ColumnCount(objSegmentationColumns) == sizeof(uValues) / sizeof(uValues[0]), "segmentation values do not match the segmentation columns");
+			AppendRow(m_vTables[scte35ColumnTable::segmentation], uValues);
+
+			for (std::size_t j = 0;j < objSegmentation.v_ChildComps.size();j++) {
+				const uint64_t uComponentValues[] = {
+					uSegmentationRow,
+					objSegmentation.v_ChildComps[j].component_tag,
+					objSegmentation.v_ChildComps[j].pts_offset
+				};
+				static_assert(ColumnCount(objSegmentationComponentColumns) == sizeof(uComponentValues) / sizeof(uComponentValues[0]), "segmentation component values do not match the columns");
+				AppendRow(m_vTables[scte35ColumnTable::segmentation_component], uComponentValues);
+			}
+			m_vOffsets[scte35ColumnTable::segmentation_component].push_back(m_vTables[scte35ColumnTable::segmentation_component][0].size());
+			break;
+		}
+		case scte35Desc::time_descriptor: {
+			const TimeDescriptor& objTime = *static_cast<const TimeDescriptor*>(vDescriptors[i]);
+			const uint64_t uValues[] = {
+				uCueRow,
+				objTime.TAI_seconds,
+				objTime.TAI_ns,
+				objTime.UTC_offset
+			};
+			static_assert(ColumnCount(objTimeColumns) == sizeof(uValues) / sizeof(uValues[0]), "time values do not match the time columns");
+			AppendRow(m_vTables[scte35ColumnTable::time], uValues);
+			break;
+		}
+		case scte35Desc::audio_descriptor: {
+			const AudioDescriptor& objAudio = *static_cast<const AudioDescriptor*>(vDescriptors[i]);
+			const uint64_t uAudioRow = m_vTables[scte35ColumnTable::audio][0].size();
+			const uint64_t uValues[] = {
+				uCueRow,
+				objAudio.audio_count
+			};
+			static_assert(ColumnCount(objAudioColumns) == sizeof(uValues) / sizeof(uValues[0]), "audio values do not match the audio columns");
+			AppendRow(m_vTables[scte35ColumnTable::audio], uValues);
+
+			for (std::size_t j = 0;j < objAudio.v_audio_comp_list.size();j++) {
+				const AudioDescComponent& objComponent = objAudio.v_audio_comp_list[j];
+				const uint64_t uComponentValues[] = {
+					uAudioRow,
+					objComponent.component_tag,
+					objComponent.ISO_code,
+					objComponent.Bit_Stream_Mode,
+					objComponent.Num_Channels,
+					objComponent.Full_Srvc_Audio
+				};
+				static_assert(ColumnCount(objAudioComponentColumns) == sizeof(uComponentValues) / sizeof(uComponentValues[0]), "audio component values do not match the columns");
+				AppendRow(m_vTables[scte35ColumnTable::audio_component], uComponentValues);
+			}
+			m_vOffsets[scte35ColumnTable::audio_component].push_back(m_vTables[scte35ColumnTable::audio_component][0].size());
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	//Every child table of the cue table gets the end of this cue's rows, none added included
+	for (std::size_t i = 1;i < iTables;i++) {
+		if (objTables[i].eParent == scte35ColumnTable::cue) {
+			m_vOffsets[objTables[i].eTable].push_back(m_vTables[objTables[i].eTable][0].size());
+		}
+	}
+	return true;
+}
+
+bool CSpliceColumnarWriter::Write(const std::string& sPath) const {
+	//Columns of every table, an offsets column per child table, and the two dictionary columns
+	std::size_t iColumns = iTables - 1 + 2;
+	for (std::size_t i = 0;i < iTables;i++) {
+		iColumns += objTables[i].iColumns;
+	}
+	const uint64_t uDataStart = CSpliceColumnar::iFileHeaderSize + iColumns * CSpliceColumnar::iDirectoryEntrySize;
+	std::vector<uint8_t> vDirectory;
+	std::vector<uint8_t> vData;
+	vDirectory.reserve(iColumns * CSpliceColumnar::iDirectoryEntrySize);
+
+	for (std::size_t i = 0;i < iTables;i++) {
+		const STableDef& objTable = objTables[i];
+		for (std::size_t j = 0;j < objTable.iColumns;j++) {
+			const SColumnDef& objColumn = objTable.pColumns[j];
+			AppendColumn(vDirectory, vData, uDataStart, objColumn.sName, objTable.eTable, objColumn.eEncoding, objColumn.iWidth, m_vTables[objTable.eTable][j]);
+		}
+		//Offsets columns belong to the parent table, they have one value per parent row plus one
+		for (std::size_t j = 1;j < iTables;j++) {
+			if (objTables[j].eParent == objTable.eTable) {
+				AppendColumn(vDirectory, vData, uDataStart, objTables[j].sOffsets, objTable.eTable, scte35ColumnEncoding::plain, 8, m_vOffsets[objTables[j].eTable]);
+			}
+		}
+	}
+	AppendColumn(vDirectory, vData, uDataStart, "upid.offsets", scte35ColumnTable::dictionary, scte35ColumnEncoding::plain, 8, m_vUpidOffsets);
+	AppendColumn(vDirectory, vData, uDataStart, "upid.bytes", scte35ColumnTable::dictionary, m_vUpidBytes);
+
+	uint8_t uHeader[CSpliceColumnar::iFileHeaderSize] = {};
+	std::memcpy(uHeader, cColumnarMagic, sizeof(cColumnarMagic));
+	StoreLE(uHeader + 8, CSpliceColumnar::uVersion, 4);
+	StoreLE(uHeader + 12, iColumns, 4);
+	StoreLE(uHeader + 16, GetRows(), 8);
+
+	std::ofstream objFile(sPath, std::ios::binary | std::ios::trunc);
+	objFile.write(reinterpret_cast<const char*>(uHeader), sizeof(uHeader));
+	objFile.write(reinterpret_cast<const char*>(vDirectory.data()), (std::streamsize)vDirectory.size());
+	objFile.write(reinterpret_cast<const char*>(vData.data()), (std::streamsize)vData.size());
+	objFile.close();
+	return !objFile.fail();
+}
+
+void CSpliceColumnarWriter::Clear() {
+	for (std::size_t i = 0;i < iTables;i++) {
+		for (std::vector<uint64_t>& vColumn : m_vTables[objTables[i].eTable]) {
+			vColumn.clear();
+		}
+		if (objTables[i].eParent != objTables[i].eTable) {
+			m_vOffsets[objTables[i].eTable].assign(1, 0);
+		}
+	}
+	m_mUpids.clear();
+	m_vUpidOffsets.assign(1, 0);
+	m_vUpidBytes.clear();
+}
+
+//--------------------------------------- CSpliceColumnarReader -------------------------------------------------------//
+
+CSpliceColumnarReader::CSpliceColumnarReader() :
+m_objFile(),
+m_vColumns(),
+m_uRows(),
+m_vOffsets(),
+m_vUpidOffsets()
+{
+
+}
+
+bool CSpliceColumnarReader::Open(const std::string& sPath) {
+	Close();
+	if (!m_objFile.Open(sPath)) {
+		return false;
+	}
+	const uint8_t* pData = m_objFile.GetData();
+	const uint64_t uFileSize = m_objFile.GetSize();
+	if (uFileSize < CSpliceColumnar::iFileHeaderSize || std::memcmp(pData, cColumnarMagic, sizeof(cColumnarMagic)) != 0 || LoadLE(pData + 8, 4) != CSpliceColumnar::uVersion) {
+		Close();
+		return false;
+	}
+	const uint64_t uColumns = LoadLE(pData + 12, 4);
+	if (uColumns > (uFileSize - CSpliceColumnar::iFileHeaderSize) / CSpliceColumnar::iDirectoryEntrySize) {
+		Close();
+		return false;
+	}
+
+	m_vColumns.resize((std::size_t)uColumns);
+	for (std::size_t i = 0;i < m_vColumns.size();i++) {
+		const uint8_t* pEntry = pData + CSpliceColumnar::iFileHeaderSize + i * CSpliceColumnar::iDirectoryEntrySize;
+		SColumnInfo& objColumn = m_vColumns[i];
+		objColumn.sName.assign(reinterpret_cast<const char*>(pEntry), strnlen(reinterpret_cast<const char*>(pEntry), CSpliceColumnar::iMaxNameLength));
+		objColumn.eTable = (scte35ColumnTable::type)pEntry[64];
+		objColumn.eEncoding = (scte35ColumnEncoding::type)pEntry[65];
+		objColumn.iWidth = pEntry[66];
+		objColumn.uRows = LoadLE(pEntry + 72, 8);
+		objColumn.uOffset = LoadLE(pEntry + 80, 8);
+		objColumn.uSize = LoadLE(pEntry + 88, 8);
+
+		//Every later read trusts the directory, so it is checked against the file once here
+		const bool bWidth = objColumn.iWidth == 1 || objColumn.iWidth == 2 || objColumn.iWidth == 4 || objColumn.iWidth == 8;
+		const bool bBounds = objColumn.uOffset <= uFileSize && objColumn.uSize <= uFileSize - objColumn.uOffset && objColumn.uOffset % 8 == 0;
+		const bool bSize = objColumn.eEncoding == scte35ColumnEncoding::delta ? objColumn.uRows <= objColumn.uSize : objColumn.uRows <= objColumn.uSize / objColumn.iWidth && objColumn.uSize == objColumn.uRows * objColumn.iWidth;
+		if (pEntry[64] >= scte35ColumnTable::count || pEntry[65] > scte35ColumnEncoding::dictionary || !bWidth || !bBounds || !bSize) {
+			Close();
+			return false;
+		}
+	}
+
+	//Row counts come from the parent row column of each child table, the offsets make the child tables reachable from their parents
+	m_uRows[scte35ColumnTable::cue] = LoadLE(pData + 16, 8);
+	for (std::size_t i = 1;i < iTables;i++) {
+		const STableDef& objTable = objTables[i];
+		const SColumnInfo* pColumn = FindColumn(objTable.pColumns[0].sName);
+		std::vector<uint64_t>& vOffsets = m_vOffsets[objTable.eTable];
+		if (pColumn == nullptr || !Decode(objTable.sOffsets, vOffsets) || vOffsets.size() != m_uRows[objTable.eParent] + 1 || !IsAscending(vOffsets, pColumn->uRows)) {
+			Close();
+			return false;
+		}
+		m_uRows[objTable.eTable] = pColumn->uRows;
+	}
+	const SColumnInfo* pColumn = FindColumn("upid.bytes");
+	if (pColumn == nullptr || !Decode("upid.offsets", m_vUpidOffsets) || !IsAscending(m_vUpidOffsets, pColumn->uRows)) {
+		Close();
+		return false;
+	}
+	m_uRows[scte35ColumnTable::dictionary] = m_vUpidOffsets.size() - 1;
+	return true;
+}
+
+void CSpliceColumnarReader::Close() {
+	m_objFile.Close();
+	m_vColumns.clear();
+	for (std::size_t i = 0;i < scte35ColumnTable::count;i++) {
+		m_uRows[i] = 0;
+		m_vOffsets[i].clear();
+	}
+	m_vUpidOffsets.clear();
+}
+
+const SColumnInfo* CSpliceColumnarReader::FindColumn(const std::string& sName) const {
+	for (std::size_t i = 0;i < m_vColumns.size();i++) {
+		if (m_vColumns[i].sName == sName) {
+			return &m_vColumns[i];
+		}
+	}
+	return nullptr;
+}
+
+bool CSpliceColumnarReader::Decode(const std::string& sName, std::vector<uint64_t>& vValues) const {
+	const SColumnInfo* pColumn = FindColumn(sName);
+	if (pColumn == nullptr) {
+		return false;
+	}
+
+	const uint8_t* pData = m_objFile.GetData() + pColumn->uOffset;
+	vValues.resize((std::size_t)pColumn->uRows);
+	if (pColumn->eEncoding != scte35ColumnEncoding::delta) {
+		for (std::size_t i = 0;i < vValues.size();i++) {
+			vValues[i] = LoadLE(pData + i * pColumn->iWidth, pColumn->iWidth);
+		}
+		return true;
+	}
+
+	std::size_t iPosition = 0;
+	uint64_t uValue = 0;
+	for (std::size_t i = 0;i < vValues.size();i++) {
+		uint64_t uCode = 0;
+		for (unsigned int iShift = 0;;iShift += 7) {
+			if (iPosition >= pColumn->uSize || iShift > 63) {
+				vValues.clear();
+				return false;
+			}
+			const uint8_t uByte = pData[iPosition++];
+			uCode |= (uint64_t)(uByte & 0x7F) << iShift;
+			if ((uByte & 0x80) == 0) {
+				break;
+			}
+		}
+		uValue += (uCode >> 1) ^ (0 - (uCode & 1));
+		vValues[i] = uValue;
+	}
+	return true;
+}
+
+bool CSpliceColumnarReader::GetChildRows(const scte35ColumnTable::type& eTable, const uint64_t& uParentRow, uint64_t& uFirst, uint64_t& uCount) const {
+	//The cue and dictionary tables have no offsets, so every row of theirs is out of range
+	if ((std::size_t)eTable >= scte35ColumnTable::count || m_vOffsets[eTable].empty() || uParentRow >= m_vOffsets[eTable].size() - 1) {
+		return false;
+	}
+	const std::vector<uint64_t>& vOffsets = m_vOffsets[eTable];
+	uFirst = vOffsets[(std::size_t)uParentRow];
+	uCount = vOffsets[(std::size_t)uParentRow + 1] - uFirst;
+	return true;
+}
+
+bool CSpliceColumnarReader::GetUpid(const uint32_t& uIndex, const uint8_t*& pData, std::size_t& iLength) const {
+	if ((uint64_t)uIndex + 1 >= m_vUpidOffsets.size()) {
+		return false;
+	}
+	const SColumnInfo* pColumn = FindColumn("upid.bytes");
+	pData = m_objFile.GetData() + pColumn->uOffset + m_vUpidOffsets[uIndex];
+	iLength = (std::size_t)(m_vUpidOffsets[uIndex + 1] - m_vUpidOffsets[uIndex]);
+	return true;
+}
+
+};
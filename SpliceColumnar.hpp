@@ -0,0 +1,270 @@
+/*! \file SpliceColumnar.hpp
+*	\brief Splice columnar export classes declaration.
+*	\details Header file for declaration of structures scte35ColumnTable and scte35ColumnEncoding and classes SColumnInfo, CSpliceColumnar,
+*	CSpliceColumnarWriter and CSpliceColumnarReader whose definition is in SpliceColumnar.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICECOLUMNAR_HPP_
+/*! \brief SpliceColumnar.hpp header guard define.
+*/
+#define _SPLICECOLUMNAR_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceMappedFile.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35ColumnTable
+*	\brief scte35ColumnTable structure to hold the tables of a columnar file.
+*/
+struct scte35ColumnTable {
+	/*!
+	*	\brief A type definition for type (Columnar Tables)
+	*/
+	typedef enum {
+		cue = 0,					/*!<One row per cue: SInfoData, splice_insert, time_signal, splice_schedule count, private_command identifier.*/
+		schedule = 1,				/*!<One row per splice_schedule event, rows of a cue given by the cue column schedule_offsets.*/
+		segmentation = 2,			/*!<One row per segmentation_descriptor, rows of a cue given by the cue column segmentation_offsets.*/
+		dictionary = 3,				/*!<UPID dictionary: upid.offsets and upid.bytes.*/
+		avail = 4,					/*!<One row per avail_descriptor, rows of a cue given by the cue column avail_offsets.*/
+		dtmf = 5,					/*!<One row per DTMF_descriptor, rows of a cue given by the cue column dtmf_offsets.*/
+		time = 6,					/*!<One row per time_descriptor, rows of a cue given by the cue column time_offsets.*/
+		audio = 7,					/*!<One row per audio_descriptor, rows of a cue given by the cue column audio_offsets.*/
+		insert_component = 8,		/*!<One row per splice_insert component, rows of a cue given by the cue column insert_component_offsets.*/
+		schedule_component = 9,		/*!<One row per splice_schedule event component, rows of an event given by schedule.component_offsets.*/
+		segmentation_component = 10,	/*!<One row per segmentation_descriptor component, rows given by segmentation.component_offsets.*/
+		audio_component = 11,		/*!<One row per audio_descriptor component, rows of a descriptor given by audio.component_offsets.*/
+		count = 12					/*!<Number of tables (not a table)*/
+	}type;
+};
+
+/*! \struct scte35ColumnEncoding
+*	\brief scte35ColumnEncoding structure to hold the encodings of a column.
+*/
+struct scte35ColumnEncoding {
+	/*!
+	*	\brief A type definition for type (Column Encodings)
+	*/
+	typedef enum {
+		plain = 0,				/*!<Little-endian values of the column width, readable in place.*/
+		delta = 1,				/*!<Difference to the previous row (0 before the first), zigzag and LEB128 varint coded.*/
+		dictionary = 2			/*!<Plain 32-bit index into the UPID dictionary.*/
+	}type;
+};
+
+/*!	\class SColumnInfo
+*	\brief #SColumnInfo class holding the directory entry of one column of a columnar file.
+*/
+class SColumnInfo {
+public:
+	std::string sName;							/*!<Column name, the field name prefixed by the table name and a dot outside the cue table.*/
+	scte35ColumnTable::type eTable;				/*!<Table of the column.*/
+	scte35ColumnEncoding::type eEncoding;		/*!<Encoding of the values.*/
+	uint32_t iWidth;							/*!<Width of a decoded value in bytes (1, 2, 4 or 8).*/
+	uint64_t uRows;								/*!<Number of values (rows of the table, plus one for an offsets column).*/
+	uint64_t uOffset;							/*!<Offset of the data in the file.*/
+	uint64_t uSize;								/*!<Size of the data in bytes.*/
+
+	/*! \brief #SColumnInfo class default constructor with intializer list.
+	*/
+	SColumnInfo() :
+	 sName(),
+	 eTable(scte35ColumnTable::cue),
+	 eEncoding(scte35ColumnEncoding::plain),
+	 iWidth(PARAMETER_DEF_VAL),
+	 uRows(PARAMETER_DEF_VAL),
+	 uOffset(PARAMETER_DEF_VAL),
+	 uSize(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSpliceColumnar
+*	\brief #CSpliceColumnar class holding the file format shared by #CSpliceColumnarWriter and #CSpliceColumnarReader.
+*
+*	A columnar file is a 32-byte header (magic "SCTE35CL", version, column count, cue rows), a directory of 96-byte entries (64-byte
+*	name, table, encoding, width, rows, offset, size), then the data of every column starting on an 8-byte boundary. Nested
+*	structures (splice_schedule events, descriptors, component loops) are tables of their own: the parent table holds offsets with one
+*	value more than its rows, so the child rows of parent row i are [offsets[i], offsets[i + 1]), and every child row holds its parent
+*	row (cue_row, schedule_row, segmentation_row or audio_row). Offsets and parent rows are 64-bit, so a batch is not limited in rows.
+*/
+class CSpliceColumnar {
+public:
+	/*! \brief Size of the file header in bytes.
+	*/
+	static const std::size_t iFileHeaderSize = 32;
+	/*! \brief Size of a directory entry in bytes.
+	*/
+	static const std::size_t iDirectoryEntrySize = 96;
+	/*! \brief Largest column name length in bytes (the entry keeps a terminating 0).
+	*/
+	static const std::size_t iMaxNameLength = 63;
+	/*! \brief Version written in the file header.
+	*/
+	static const uint32_t uVersion = 2;
+};
+
+/*!	\class CSpliceColumnarWriter
+*	\brief #CSpliceColumnarWriter class turns parsed cues into columns (struct of arrays) and writes them as a columnar file.
+*
+*	Every #Add appends one value to each column of the cue table and rows to the child tables. UPIDs are stored once in a dictionary and
+*	referenced by index; receive times, pts_adjustment and pts_time are delta coded as consecutive cues of a channel differ little.
+*	A writer holds one batch (an hour, a file of a day...), written by #Write and cleared with #Clear.
+*/
+class CSpliceColumnarWriter {
+public:
+	/*! \brief #CSpliceColumnarWriter class default constructor.
+	*/
+	CSpliceColumnarWriter();
+
+	/*!	\brief Deleted copy constructor so #CSpliceColumnarWriter class object cannot be copied.
+	*/
+	CSpliceColumnarWriter(const CSpliceColumnarWriter&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceColumnarWriter class object cannot be assigned.
+	*/
+	void operator=(const CSpliceColumnarWriter&) = delete;
+
+	/*! \brief Function to append the last parse of a parser.
+	*	\param objCue parser after a successful parse.
+	*	\param uChannel channel identifier.
+	*	\param uReceiveTime receive time, in the unit chosen by the application.
+	*	\returns true if appended and false if the last parse failed or the UPID dictionary is full (2^32 - 1 UPIDs).
+	*/
+	bool Add(const CSpliceClass& objCue, const uint64_t& uChannel, const uint64_t& uReceiveTime);
+
+	/*! \brief Function to get the number of cues appended since the last #Clear.
+	*/
+	std::size_t GetRows() const { return m_vTables[scte35ColumnTable::cue][0].size(); }
+
+	/*! \brief Function to get the number of distinct UPIDs in the dictionary.
+	*/
+	std::size_t GetUpidCount() const { return m_vUpidOffsets.size() - 1; }
+
+	/*! \brief Function to write the cues appended since the last #Clear as a columnar file.
+	*	\param sPath file path, replaced if it exists.
+	*	\returns true if written.
+	*/
+	bool Write(const std::string& sPath) const;
+
+	/*! \brief Function to remove all the cues and the UPID dictionary, keeping the capacity of the columns.
+	*/
+	void Clear();
+
+private:
+	std::vector<std::vector<uint64_t>> m_vTables[scte35ColumnTable::count];	/*!<Columns of every table, none for the dictionary.*/
+	std::vector<uint64_t> m_vOffsets[scte35ColumnTable::count];				/*!<First child row of every parent row, plus the row count, of every child table.*/
+	std::unordered_map<std::string, uint32_t> m_mUpids;		/*!<Dictionary index of every distinct UPID byte string.*/
+	std::vector<uint64_t> m_vUpidOffsets;					/*!<Start of every dictionary UPID in m_vUpidBytes, plus the total size.*/
+	std::vector<uint8_t> m_vUpidBytes;						/*!<Dictionary UPID bytes.*/
+	std::string m_sUpidKey;									/*!<Key buffer of the UPID lookup.*/
+};
+
+/*!	\class CSpliceColumnarReader
+*	\brief #CSpliceColumnarReader class maps a columnar file and gives its columns.
+*
+*	Plain and dictionary columns are read in place through #GetValues (on little-endian hosts, nullptr elsewhere); #Decode
+*	gives any column, delta coded ones included, as 64-bit values.
+*/
+class CSpliceColumnarReader {
+public:
+	/*! \brief #CSpliceColumnarReader class default constructor.
+	*/
+	CSpliceColumnarReader();
+
+	/*!	\brief Deleted copy constructor so #CSpliceColumnarReader class object cannot be copied.
+	*/
+	CSpliceColumnarReader(const CSpliceColumnarReader&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceColumnarReader class object cannot be assigned.
+	*/
+	void operator=(const CSpliceColumnarReader&) = delete;
+
+	/*! \brief Function to map a columnar file and read its directory.
+	*	\param sPath file path.
+	*	\returns true if opened and false if the file cannot be mapped or its header or directory is wrong.
+	*/
+	bool Open(const std::string& sPath);
+
+	/*! \brief Function to unmap the file, the values read in place become invalid.
+	*/
+	void Close();
+
+	/*! \brief Function to get the number of rows of a table.
+	*/
+	uint64_t GetRows(const scte35ColumnTable::type& eTable) const { return m_uRows[eTable]; }
+
+	/*! \brief Function to get the directory.
+	*/
+	const std::vector<SColumnInfo>& GetColumns() const { return m_vColumns; }
+
+	/*! \brief Function to find a column by name.
+	*	\returns directory entry, nullptr if there is no such column.
+	*/
+	const SColumnInfo* FindColumn(const std::string& sName) const;
+
+	/*! \brief Function to read a plain or dictionary column in place.
+	*	\tparam T unsigned type of the column width.
+	*	\param sName column name.
+	*	\returns values (SColumnInfo::uRows of them), nullptr if the column does not exist, is delta coded or has another width.
+	*/
+	template <typename T>
+	const T* GetValues(const std::string& sName) const {
+		const SColumnInfo* pColumn = FindColumn(sName);
+		if (pColumn == nullptr || pColumn->eEncoding == scte35ColumnEncoding::delta || pColumn->iWidth != sizeof(T) || !IsLittleEndian()) {
+			return nullptr;
+		}
+		return reinterpret_cast<const T*>(m_objFile.GetData() + pColumn->uOffset);
+	}
+
+	/*! \brief Function to decode any column to 64-bit values.
+	*	\param sName column name.
+	*	\param vValues receives the values.
+	*	\returns true if decoded and false if the column does not exist or its data is wrong.
+	*/
+	bool Decode(const std::string& sName, std::vector<uint64_t>& vValues) const;
+
+	/*! \brief Function to get the rows of a child table belonging to a row of its parent table.
+	*	\param eTable child table, any table but scte35ColumnTable::cue and scte35ColumnTable::dictionary.
+	*	\param uParentRow row of the parent table (the cue table, or schedule, segmentation and audio for the component tables).
+	*	\param uFirst receives the first child row.
+	*	\param uCount receives the number of child rows.
+	*	\returns true if the table is a child table and the parent row exists.
+	*/
+	bool GetChildRows(const scte35ColumnTable::type& eTable, const uint64_t& uParentRow, uint64_t& uFirst, uint64_t& uCount) const;
+
+	/*! \brief Function to get a UPID of the dictionary in place.
+	*	\param uIndex value of the segmentation.segmentation_upid column.
+	*	\param pData receives the UPID bytes.
+	*	\param iLength receives the number of UPID bytes.
+	*	\returns true if the index exists.
+	*/
+	bool GetUpid(const uint32_t& uIndex, const uint8_t*& pData, std::size_t& iLength) const;
+
+private:
+	/*! \brief Function to check whether the host stores integers little-endian.
+	*/
+	static bool IsLittleEndian() {
+		const uint16_t uProbe = 1;
+		return *reinterpret_cast<const uint8_t*>(&uProbe) == 1;
+	}
+
+	CSpliceMappedFile m_objFile;			/*!<Mapped file.*/
+	std::vector<SColumnInfo> m_vColumns;	/*!<Directory.*/
+	uint64_t m_uRows[scte35ColumnTable::count];					/*!<Rows of every scte35ColumnTable.*/
+	std::vector<uint64_t> m_vOffsets[scte35ColumnTable::count];	/*!<Offsets of every child table decoded at #Open.*/
+	std::vector<uint64_t> m_vUpidOffsets;	/*!<upid.offsets decoded at #Open.*/
+};
+
+};
+
+#endif
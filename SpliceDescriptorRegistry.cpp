@@ -0,0 +1,50 @@
+/*! \file SpliceDescriptorRegistry.cpp
+*	\brief Splice descriptor registry classes definition.
+*	\details CPP file for definition of classes CSpliceDescriptorDecoder and CSpliceDescriptorRegistry whose declaration is in SpliceDescriptorRegistry.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceDescriptorRegistry.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Bytes of splice_descriptor_tag, descriptor_length and identifier.
+*/
+static const std::size_t iPrivateHeaderBytes = 6;
+
+void CSpliceDescriptorDecoder::AppendPrivateBytes(const PrivateDescriptor& objDescriptor, std::ostream& sOut, const std::string& sSep) {
+	for (std::size_t i = iPrivateHeaderBytes;i < objDescriptor.iRawLength;i++) {
+		sOut << "private_byte[" << i - iPrivateHeaderBytes + 1 << "]=" << (uint32_t)objDescriptor.pRaw[i] << sSep;
+	}
+}
+
+bool CSpliceDescriptorRegistry::Register(const uint32_t& uTag, const uint32_t& uIdentifier, const CSpliceDescriptorDecoder* pDecoder) {
+	if (pDecoder == nullptr || uTag > 0xFF || CSpliceClass::IsBuiltInDescriptor(uTag, uIdentifier)) {
+		return false;
+	}
+
+	bool bInserted = false;
+	m_mDecoders.Insert(GetKey(uTag, uIdentifier), bInserted) = pDecoder;
+	return true;
+}
+
+bool CSpliceDescriptorRegistry::Unregister(const uint32_t& uTag, const uint32_t& uIdentifier) {
+	if (uTag > 0xFF) {
+		return false;
+	}
+	return m_mDecoders.Erase(GetKey(uTag, uIdentifier));
+}
+
+const CSpliceDescriptorDecoder* CSpliceDescriptorRegistry::Find(const uint32_t& uTag, const uint32_t& uIdentifier) const {
+	if (uTag > 0xFF) {
+		return nullptr;
+	}
+	const CSpliceDescriptorDecoder* const* ppDecoder = m_mDecoders.Find(GetKey(uTag, uIdentifier));
+	return ppDecoder == nullptr ? nullptr : *ppDecoder;
+}
+
+};
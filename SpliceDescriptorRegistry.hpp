@@ -0,0 +1,112 @@
+/*! \file SpliceDescriptorRegistry.hpp
+*	\brief Splice descriptor registry classes declaration.
+*	\details Header file for declaration of classes CSpliceDescriptorDecoder and CSpliceDescriptorRegistry whose definition is in SpliceDescriptorRegistry.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEDESCRIPTORREGISTRY_HPP_
+/*! \brief SpliceDescriptorRegistry.hpp header guard define.
+*/
+#define _SPLICEDESCRIPTORREGISTRY_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CSpliceDescriptorDecoder
+*	\brief #CSpliceDescriptorDecoder class is the interface of an application decoder for one (splice_descriptor_tag, identifier) pair.
+*/
+class CSpliceDescriptorDecoder {
+public:
+	/*! \brief #CSpliceDescriptorDecoder class destructor.
+	*/
+	virtual ~CSpliceDescriptorDecoder() {}
+
+	/*! \brief Function to decode a descriptor.
+	*
+	*	The parser fills the #SDBase fields and the raw view of the returned object, the decoder only reads its own fields.
+	*	\param pData descriptor bytes starting with splice_descriptor_tag, valid until the next parse.
+	*	\param iLength number of bytes in pData (descriptor_length + 2, less if the descriptor loop is truncated).
+	*	\returns new object (deleted by the parser) or nullptr if the bytes do not decode, the descriptor is then kept raw.
+	*/
+	virtual PrivateDescriptor* Decode(const uint8_t* pData, const std::size_t& iLength) const = 0;
+
+	/*! \brief Function to append the decoded fields as text after splice_descriptor_tag, descriptor_length and identifier.
+	*	\param objDescriptor descriptor returned by #Decode.
+	*	\param sOut stream to append to.
+	*	\param sSep separator written after each field.
+	*/
+	virtual void AppendText(const PrivateDescriptor& objDescriptor, std::ostream& sOut, const std::string& sSep) const { AppendPrivateBytes(objDescriptor, sOut, sSep); }
+
+	/*! \brief Function to append the bytes following identifier as private_byte fields (the text of a descriptor kept raw).
+	*	\param objDescriptor descriptor to write.
+	*	\param sOut stream to append to.
+	*	\param sSep separator written after each field.
+	*/
+	static void AppendPrivateBytes(const PrivateDescriptor& objDescriptor, std::ostream& sOut, const std::string& sSep);
+};
+
+/*!	\class CSpliceDescriptorRegistry
+*	\brief #CSpliceDescriptorRegistry class mapping (splice_descriptor_tag, identifier) pairs to application decoders.
+*
+*	Pairs live in one #CSpliceHashMap keyed by identifier and tag, so a descriptor is dispatched with a single probe whatever the number of
+*	registered decoders. The "CUEI" descriptors of this parser (tags 0x00 to 0x04) cannot be overridden. Decoders are not owned and must
+*	outlive the registry. A registry is only read while parsing, it can be shared by parsers of several threads once filled.
+*/
+class CSpliceDescriptorRegistry {
+public:
+	/*! \brief #CSpliceDescriptorRegistry class default constructor with intializer list.
+	*/
+	CSpliceDescriptorRegistry() :
+	m_mDecoders()
+	{
+
+	}
+
+	/*! \brief Function to register the decoder of a pair, replacing the previous one.
+	*	\param uTag splice_descriptor_tag.
+	*	\param uIdentifier identifier.
+	*	\param pDecoder decoder (not owned).
+	*	\returns true if registered and false if pDecoder is nullptr, uTag is above 0xFF or the pair is a built-in "CUEI" descriptor.
+	*/
+	bool Register(const uint32_t& uTag, const uint32_t& uIdentifier, const CSpliceDescriptorDecoder* pDecoder);
+
+	/*! \brief Function to remove the decoder of a pair.
+	*	\returns true if a decoder was registered.
+	*/
+	bool Unregister(const uint32_t& uTag, const uint32_t& uIdentifier);
+
+	/*! \brief Function to find the decoder of a pair.
+	*	\returns decoder or nullptr if none is registered.
+	*/
+	const CSpliceDescriptorDecoder* Find(const uint32_t& uTag, const uint32_t& uIdentifier) const;
+
+	/*! \brief Function to get the number of registered pairs.
+	*/
+	std::size_t GetSize() const { return m_mDecoders.GetSize(); }
+
+	/*! \brief Function to remove all the decoders.
+	*/
+	void Clear() { m_mDecoders.Clear(); }
+
+private:
+	/*! \brief Function to get the map key of a pair.
+	*/
+	static uint64_t GetKey(const uint32_t& uTag, const uint32_t& uIdentifier) { return ((uint64_t)uIdentifier << 8) | (uTag & 0xFF); }
+
+	CSpliceHashMap<const CSpliceDescriptorDecoder*> m_mDecoders;		/*!<Decoders by identifier and tag.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,363 @@
+/*! \file SpliceEngine.cpp
+*	\brief Splice channel-sharded parsing engine class definition.
+*	\details CPP file for definition of class CSpliceEngine whose declaration is in SpliceEngine.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceEngine.hpp"
+#include "SplicePipeline.hpp"	//for CSplicePipeline::PinThread
+#include "SpliceProjection.hpp"
+#include <algorithm>	//for std::sort, std::upper_bound, std::min
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Parsed cues of a channel between two timeline retention passes.
+*/
+static const uint64_t uRetentionPeriod = 64;
+
+/*! \brief Function to spread a 64-bit value over all bits (splitmix64 finalizer), used for the ring points and the channel positions.
+*/
+static uint64_t MixKey(uint64_t uKey) {
+	uKey += 0x9E3779B97F4A7C15ULL;
+	uKey = (uKey ^ (uKey >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	uKey = (uKey ^ (uKey >> 27)) * 0x94D049BB133111EBULL;
+	return uKey ^ (uKey >> 31);
+}
+
+CSpliceEngine::CSpliceEngine(const SEngineConfig& objConfig) :
+m_objConfig(objConfig),
+m_vRing(),
+m_pShardData(nullptr),
+m_vShards(),
+m_iChannels(0),
+m_iSlots(0),
+m_iScheduled(0),
+m_bRunning(false),
+m_bStop(false),
+m_pHandler(nullptr)
+{
+	if (m_objConfig.iWorkers == 0) {
+		m_objConfig.iWorkers = std::thread::hardware_concurrency();
+	}
+	if (m_objConfig.iWorkers == 0) {
+		m_objConfig.iWorkers = 1;
+	}
+	if (m_objConfig.iVirtualNodes == 0) {
+		m_objConfig.iVirtualNodes = 1;
+	}
+	if (m_objConfig.iBatch == 0) {
+		m_objConfig.iBatch = 1;
+	}
+
+	m_pShardData.reset(new SEngineShard[m_objConfig.iWorkers]);
+	for (std::size_t i = 0;i < m_objConfig.iWorkers;i++) {
+		SEngineShard& objShard = m_pShardData[i];
+		objShard.pReady.reset(new CSpliceMPSCQueue<SChannelSlot*>(m_objConfig.iMaxChannels));
+		objShard.uCues.store(0, std::memory_order_relaxed);
+		objShard.uRuns.store(0, std::memory_order_relaxed);
+		objShard.uStolen.store(0, std::memory_order_relaxed);
+		m_vShards.push_back(&objShard);
+
+		for (std::size_t j = 0;j < m_objConfig.iVirtualNodes;j++) {
+			m_vRing.emplace_back(MixKey(((uint64_t)i << 32) | j), i);
+		}
+	}
+	std::sort(m_vRing.begin(), m_vRing.end());
+}
+
+CSpliceEngine::~CSpliceEngine() {
+	//Work left by a stopped engine (cues, removals) is handled first so the removed channels are deleted
+	if (!m_bRunning.load(std::memory_order_relaxed) && m_iScheduled.load(std::memory_order_acquire) > 0) {
+		Start();
+	}
+	Stop();
+
+	for (SEngineShard* pShard : m_vShards) {
+		pShard->mChannels.ForEach([](const uint64_t&, SChannelSlot*& pSlot) {
+			delete pSlot;
+		});
+		pShard->mChannels.Clear();
+	}
+}
+
+void CSpliceEngine::SetMetrics(CSpliceMetrics* pMetrics) {
+	for (SEngineShard* pShard : m_vShards) {
+		pShard->objParser.SetMetrics(pMetrics);
+	}
+}
+
+bool CSpliceEngine::Start() {
+	if (m_bRunning.load(std::memory_order_relaxed)) {
+		return false;
+	}
+
+	m_bStop.store(false, std::memory_order_relaxed);
+	m_bRunning.store(true, std::memory_order_relaxed);
+	for (std::size_t i = 0;i < m_vShards.size();i++) {
+		m_vShards[i]->objThread = std::thread(&CSpliceEngine::WorkerLoop, this, i);
+	}
+	return true;
+}
+
+void CSpliceEngine::Stop() {
+	if (!m_bRunning.load(std::memory_order_relaxed)) {
+		return;
+	}
+
+	m_bStop.store(true, std::memory_order_release);
+	for (SEngineShard* pShard : m_vShards) {
+		pShard->objThread.join();
+	}
+	m_bRunning.store(false, std::memory_order_relaxed);
+}
+
+std::size_t CSpliceEngine::GetShard(const uint64_t& uChannel) const {
+	//First ring point after the channel position, wrapping to the first point
+	const uint64_t uPoint = MixKey(uChannel ^ 0xC3A5C85C97CB3127ULL);
+	auto it = std::upper_bound(m_vRing.begin(), m_vRing.end(), std::make_pair(uPoint, (std::size_t)-1));
+	return it == m_vRing.end() ? m_vRing.front().second : it->second;
+}
+
+bool CSpliceEngine::AddChannel(const uint64_t& uChannel) {
+	//A slot is queued at most once, so bounding the live slots by the run queue capacity keeps every push succeeding
+	if (m_iSlots.fetch_add(1, std::memory_order_acq_rel) >= m_objConfig.iMaxChannels) {
+		m_iSlots.fetch_sub(1, std::memory_order_acq_rel);
+		return false;
+	}
+
+	const std::size_t iShard = GetShard(uChannel);
+	SEngineShard& objShard = *m_vShards[iShard];
+	std::lock_guard<std::mutex> objLock(objShard.objMutex);
+	bool bInserted = false;
+	SChannelSlot*& pSlot = objShard.mChannels.Insert(uChannel, bInserted);
+	if (!bInserted) {
+		m_iSlots.fetch_sub(1, std::memory_order_acq_rel);
+		return false;
+	}
+	pSlot = new SChannelSlot(uChannel, iShard, m_objConfig.iMailboxCapacity);
+	m_iChannels.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+bool CSpliceEngine::RemoveChannel(const uint64_t& uChannel) {
+	SEngineShard& objShard = *m_vShards[GetShard(uChannel)];
+	std::lock_guard<std::mutex> objLock(objShard.objMutex);
+	SChannelSlot** ppSlot = objShard.mChannels.Find(uChannel);
+	if (ppSlot == nullptr) {
+		return false;
+	}
+
+	//No submission can reach the slot any more, the removal is its last unit of work
+	SChannelSlot* pSlot = *ppSlot;
+	objShard.mChannels.Erase(uChannel);
+	m_iChannels.fetch_sub(1, std::memory_order_relaxed);
+	pSlot->bRemoved.store(true, std::memory_order_release);
+	AddPending(pSlot);
+	return true;
+}
+
+bool CSpliceEngine::Submit(const uint64_t& uChannel, const uint8_t* pData, const std::size_t& iLength) {
+	if (pData == nullptr || iLength == 0) {
+		return false;
+	}
+
+	std::vector<uint8_t> vSection(pData, pData + iLength);
+	SEngineShard& objShard = *m_vShards[GetShard(uChannel)];
+	std::lock_guard<std::mutex> objLock(objShard.objMutex);
+	SChannelSlot** ppSlot = objShard.mChannels.Find(uChannel);
+	if (ppSlot == nullptr) {
+		return false;
+	}
+
+	SChannelSlot* pSlot = *ppSlot;
+	if (!pSlot->objMailbox.TryPush(vSection)) {
+		pSlot->objState.uDropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	AddPending(pSlot);
+	return true;
+}
+
+void CSpliceEngine::AddPending(SChannelSlot* pSlot) {
+	if (pSlot->iPending.fetch_add(1, std::memory_order_acq_rel) != 0) {
+		return;
+	}
+
+	//Counted before it becomes visible so a stopping worker cannot miss it
+	m_iScheduled.fetch_add(1, std::memory_order_acq_rel);
+	CSpliceMPSCQueue<SChannelSlot*>& objReady = *m_vShards[pSlot->objState.iHomeShard]->pReady;
+	CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+	while (!objReady.TryPush(pSlot)) {
+		//A slot is queued at most once and the live slots fit the capacity, so this only spins on a pop still in progress
+		objBackoff.Wait();
+	}
+}
+
+CSpliceEngine::SChannelSlot* CSpliceEngine::TakeReady(const std::size_t& iShard) {
+	SChannelSlot* pSlot = nullptr;
+	if (m_vShards[iShard]->pReady->TryPop(pSlot) || !m_objConfig.bWorkStealing) {
+		return pSlot;
+	}
+
+	std::size_t iVictim = iShard;
+	std::size_t iDeepest = 0;
+	for (std::size_t i = 0;i < m_vShards.size();i++) {
+		const std::size_t iDepth = m_vShards[i]->pReady->GetSize();
+		if (i != iShard && iDepth > iDeepest) {
+			iDeepest = iDepth;
+			iVictim = i;
+		}
+	}
+	if (iVictim != iShard && m_vShards[iVictim]->pReady->TryPop(pSlot)) {
+		m_vShards[iShard]->uStolen.fetch_add(1, std::memory_order_relaxed);
+		return pSlot;
+	}
+	return nullptr;
+}
+
+void CSpliceEngine::RunChannel(SEngineShard& objShard, SChannelSlot* pSlot) {
+	SEngineChannel& objChannel = pSlot->objState;
+	const std::size_t iUnits = std::min(pSlot->iPending.load(std::memory_order_acquire), m_objConfig.iBatch);
+	objShard.uRuns.fetch_add(1, std::memory_order_relaxed);
+
+	for (std::size_t i = 0;i < iUnits;i++) {
+		if (!pSlot->objMailbox.TryPop(objShard.vSection)) {
+			//Every counted section is already in the mailbox, so the unit without one is the removal, which is the last
+			objShard.uCues.fetch_add(i, std::memory_order_relaxed);
+			if (m_pHandler != nullptr) {
+				m_pHandler->OnChannelRemoved(objChannel);
+			}
+			delete pSlot;
+			m_iSlots.fetch_sub(1, std::memory_order_acq_rel);
+			m_iScheduled.fetch_sub(1, std::memory_order_acq_rel);
+			return;
+		}
+		HandleCue(objShard, objChannel);
+	}
+	objShard.uCues.fetch_add(iUnits, std::memory_order_relaxed);
+
+	if (pSlot->iPending.fetch_sub(iUnits, std::memory_order_acq_rel) == iUnits) {
+		m_iScheduled.fetch_sub(1, std::memory_order_acq_rel);
+		return;
+	}
+	//More work arrived or was left by the batch limit: back to the home shard, behind the channels already waiting there
+	CSpliceMPSCQueue<SChannelSlot*>& objReady = *m_vShards[objChannel.iHomeShard]->pReady;
+	CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+	while (!objReady.TryPush(pSlot)) {
+		objBackoff.Wait();
+	}
+}
+
+void CSpliceEngine::HandleCue(SEngineShard& objShard, SEngineChannel& objChannel) {
+	const std::vector<uint8_t>& vSection = objShard.vSection;
+	objChannel.uReceived.fetch_add(1, std::memory_order_relaxed);
+
+	if (m_objConfig.bDedup && vSection.size() >= 4) {
+		//Length and CRC_32, the top bit keeps the key away from the empty value 0
+		const std::size_t iEnd = vSection.size();
+		const uint64_t uKey = (1ULL << 63) | ((uint64_t)iEnd << 32) | ((uint64_t)vSection[iEnd - 4] << 24) | ((uint64_t)vSection[iEnd - 3] << 16) | ((uint64_t)vSection[iEnd - 2] << 8) | vSection[iEnd - 1];
+		for (std::size_t i = 0;i < SEngineChannel::iDedupSlots;i++) {
+			if (objChannel.uDedupKeys[i] == uKey) {
+				objChannel.uDuplicates.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+		}
+		objChannel.uDedupKeys[objChannel.iDedupNext] = uKey;
+		objChannel.iDedupNext = (objChannel.iDedupNext + 1) % SEngineChannel::iDedupSlots;
+	}
+
+	CSpliceClass& objCue = objShard.objParser;
+	//Encoded once more for CSpliceClass::ParseHexa, the parser has no byte entry point
+	CSpliceProjection::BytesToHexa(vSection.data(), vSection.size(), objShard.sHexa);
+	if (!objCue.ParseHexa(objShard.sHexa)) {
+		objChannel.uFailed.fetch_add(1, std::memory_order_relaxed);
+		if (m_pHandler != nullptr) {
+			m_pHandler->OnFailure(objChannel, objCue, vSection.data(), vSection.size());
+		}
+		return;
+	}
+
+	const uint64_t uParsed = objChannel.uParsed.fetch_add(1, std::memory_order_relaxed) + 1;
+	objShard.vEvents.clear();
+	objChannel.objTracker.Update(objCue, objShard.vEvents);
+	uint64_t uPts = 0;
+	if (CSpliceTimeline::GetCuePts(objCue, uPts)) {
+		const int64_t iTime = objChannel.objUnwrapper.Unwrap(uPts);
+		objChannel.objTimeline.Add(iTime, nullptr);
+		objChannel.objTracker.Expire(uPts, m_objConfig.uExpireGrace, objShard.vEvents);
+		if (uParsed % uRetentionPeriod == 0) {
+			objChannel.objTimeline.EraseBefore(iTime - m_objConfig.iRetention);
+		}
+	}
+	objChannel.uEvents.fetch_add(objShard.vEvents.size(), std::memory_order_relaxed);
+
+	if (m_pHandler != nullptr) {
+		m_pHandler->OnCue(objChannel, objCue, objShard.vEvents);
+	}
+}
+
+void CSpliceEngine::WorkerLoop(const std::size_t& iShard) {
+	if (iShard < m_objConfig.vWorkerCores.size()) {
+		CSplicePipeline::PinThread(m_objConfig.vWorkerCores[iShard]);
+	}
+
+	SEngineShard& objShard = *m_vShards[iShard];
+	CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+	for (;;) {
+		SChannelSlot* pSlot = TakeReady(iShard);
+		if (pSlot != nullptr) {
+			objBackoff.Reset();
+			RunChannel(objShard, pSlot);
+			continue;
+		}
+		//Channels with work are counted before they are queued, so none can be left behind once the count is 0
+		if (m_bStop.load(std::memory_order_acquire) && m_iScheduled.load(std::memory_order_acquire) == 0) {
+			break;
+		}
+		objBackoff.Wait();
+	}
+}
+
+bool CSpliceEngine::GetChannelStats(const uint64_t& uChannel, SEngineChannelStats& objStats) const {
+	const SEngineShard& objShard = *m_vShards[GetShard(uChannel)];
+	std::lock_guard<std::mutex> objLock(objShard.objMutex);
+	SChannelSlot* const* ppSlot = objShard.mChannels.Find(uChannel);
+	if (ppSlot == nullptr) {
+		return false;
+	}
+
+	const SEngineChannel& objChannel = (*ppSlot)->objState;
+	objStats.iHomeShard = objChannel.iHomeShard;
+	objStats.iPending = (*ppSlot)->iPending.load(std::memory_order_relaxed);
+	objStats.uReceived = objChannel.uReceived.load(std::memory_order_relaxed);
+	objStats.uParsed = objChannel.uParsed.load(std::memory_order_relaxed);
+	objStats.uFailed = objChannel.uFailed.load(std::memory_order_relaxed);
+	objStats.uDuplicates = objChannel.uDuplicates.load(std::memory_order_relaxed);
+	objStats.uDropped = objChannel.uDropped.load(std::memory_order_relaxed);
+	objStats.uEvents = objChannel.uEvents.load(std::memory_order_relaxed);
+	return true;
+}
+
+SEngineShardStats CSpliceEngine::GetShardStats(const std::size_t& iShard) const {
+	SEngineShardStats objStats;
+	if (iShard >= m_vShards.size()) {
+		return objStats;
+	}
+
+	const SEngineShard& objShard = *m_vShards[iShard];
+	{
+		std::lock_guard<std::mutex> objLock(objShard.objMutex);
+		objStats.iChannels = objShard.mChannels.GetSize();
+	}
+	objStats.iReady = objShard.pReady->GetSize();
+	objStats.uCues = objShard.uCues.load(std::memory_order_relaxed);
+	objStats.uRuns = objShard.uRuns.load(std::memory_order_relaxed);
+	objStats.uStolen = objShard.uStolen.load(std::memory_order_relaxed);
+	return objStats;
+}
+
+};
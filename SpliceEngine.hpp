@@ -0,0 +1,363 @@
+/*! \file SpliceEngine.hpp
+*	\brief Splice channel-sharded parsing engine classes declaration.
+*	\details Header file for declaration of classes SEngineChannel, CSpliceEngineHandler, SEngineConfig, SEngineShardStats and CSpliceEngine
+*	whose definition is in SpliceEngine.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEENGINE_HPP_
+/*! \brief SpliceEngine.hpp header guard define.
+*/
+#define _SPLICEENGINE_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include "SpliceQueue.hpp"
+#include "SpliceSegmentation.hpp"
+#include "SpliceTimeline.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class SEngineChannel
+*	\brief #SEngineChannel class holding the state of one channel of #CSpliceEngine.
+*
+*	Only one worker runs a channel at a time, so the handler may read and change the state of the channel it is called for without locking.
+*	The counters are relaxed atomics so #CSpliceEngine::GetChannelStats can read them from any thread.
+*/
+class SEngineChannel {
+public:
+	/*! \brief Number of recent cues remembered by the duplicate filter.
+	*/
+	static const std::size_t iDedupSlots = 16;
+
+	uint64_t uChannel;								/*!<Channel identifier.*/
+	std::size_t iHomeShard;							/*!<Shard given by the consistent hash of uChannel.*/
+	CSegmentationTracker objTracker;				/*!<Segmentation event state.*/
+	CPtsUnwrapper objUnwrapper;						/*!<Unwrapper of the splice times.*/
+	CSpliceTimeIndex objTimeline;					/*!<Splice times of the parsed cues (entries without cue).*/
+	uint64_t uDedupKeys[iDedupSlots];				/*!<Length and CRC_32 of the recent cues, 0 when empty.*/
+	std::size_t iDedupNext;							/*!<Next slot of uDedupKeys to overwrite.*/
+	std::atomic<uint64_t> uReceived;				/*!<Cues taken from the mailbox.*/
+	std::atomic<uint64_t> uParsed;					/*!<Cues parsed successfully.*/
+	std::atomic<uint64_t> uFailed;					/*!<Cues which failed to parse.*/
+	std::atomic<uint64_t> uDuplicates;				/*!<Cues skipped as repetitions of a recent cue.*/
+	std::atomic<uint64_t> uDropped;					/*!<Cues dropped because the mailbox was full.*/
+	std::atomic<uint64_t> uEvents;					/*!<Segmentation lifecycle events.*/
+
+	/*! \brief #SEngineChannel class constructor with intializer list.
+	*	\param uChannelParam channel identifier.
+	*	\param iHomeShardParam shard of the channel.
+	*/
+	SEngineChannel(const uint64_t& uChannelParam, const std::size_t& iHomeShardParam) :
+	 uChannel(uChannelParam),
+	 iHomeShard(iHomeShardParam),
+	 objTracker(),
+	 objUnwrapper(),
+	 objTimeline(),
+	 uDedupKeys(),
+	 iDedupNext(0),
+	 uReceived(0),
+	 uParsed(0),
+	 uFailed(0),
+	 uDuplicates(0),
+	 uDropped(0),
+	 uEvents(0)
+	{
+	}
+};
+
+/*!	\class SEngineChannelStats
+*	\brief #SEngineChannelStats class holding a snapshot of the counters of one channel.
+*/
+class SEngineChannelStats {
+public:
+	std::size_t iHomeShard;			/*!<Shard given by the consistent hash of the channel.*/
+	std::size_t iPending;			/*!<Cues waiting in the mailbox.*/
+	uint64_t uReceived;				/*!<Cues taken from the mailbox.*/
+	uint64_t uParsed;				/*!<Cues parsed successfully.*/
+	uint64_t uFailed;				/*!<Cues which failed to parse.*/
+	uint64_t uDuplicates;			/*!<Cues skipped as repetitions of a recent cue.*/
+	uint64_t uDropped;				/*!<Cues dropped because the mailbox was full.*/
+	uint64_t uEvents;				/*!<Segmentation lifecycle events.*/
+
+	/*! \brief #SEngineChannelStats class default constructor with intializer list.
+	*/
+	SEngineChannelStats() :
+	 iHomeShard(0),
+	 iPending(0),
+	 uReceived(0),
+	 uParsed(0),
+	 uFailed(0),
+	 uDuplicates(0),
+	 uDropped(0),
+	 uEvents(0)
+	{
+	}
+};
+
+/*!	\class CSpliceEngineHandler
+*	\brief #CSpliceEngineHandler class is the interface receiving the results of #CSpliceEngine on its worker threads.
+*/
+class CSpliceEngineHandler {
+public:
+	/*! \brief #CSpliceEngineHandler class destructor.
+	*/
+	virtual ~CSpliceEngineHandler() {}
+
+	/*! \brief Function called for every parsed cue of a channel, in submission order.
+	*	\param objChannel channel state, already updated with the cue.
+	*	\param objCue parsed cue, valid until the function returns.
+	*	\param vEvents segmentation lifecycle events caused by the cue (and by the expiry it triggered).
+	*/
+	virtual void OnCue(SEngineChannel& objChannel, const CSpliceClass& objCue, const std::vector<SSegmentationEvent>& vEvents) = 0;
+
+	/*! \brief Function called for every cue of a channel which failed to parse.
+	*	\param objChannel channel state.
+	*	\param objCue parser holding the failure reason (CSpliceClass::GetLastError).
+	*	\param pData section bytes.
+	*	\param iLength number of bytes.
+	*/
+	virtual void OnFailure(SEngineChannel& objChannel, const CSpliceClass& objCue, const uint8_t* pData, const std::size_t& iLength) { (void)objChannel; (void)objCue; (void)pData; (void)iLength; }
+
+	/*! \brief Function called once a removed channel processed its last cue, just before its state is deleted.
+	*/
+	virtual void OnChannelRemoved(SEngineChannel& objChannel) { (void)objChannel; }
+};
+
+/*!	\class SEngineConfig
+*	\brief #SEngineConfig class holding the settings of #CSpliceEngine.
+*/
+class SEngineConfig {
+public:
+	std::size_t iWorkers;					/*!<Number of shards, one worker thread each (0 for one per hardware thread).*/
+	std::size_t iVirtualNodes;				/*!<Points of each shard on the consistent hash ring (0 is taken as 1).*/
+	std::size_t iMaxChannels;				/*!<Largest number of channels, sizes the run queues.*/
+	std::size_t iMailboxCapacity;			/*!<Cues a channel can hold before dropping, rounded up to a power of two.*/
+	std::size_t iBatch;						/*!<Cues a worker handles from a channel before moving to the next one (0 is taken as 1).*/
+	bool bDedup;							/*!<Skip a cue equal (length and CRC_32) to one of the last SEngineChannel::iDedupSlots of its channel.*/
+	bool bWorkStealing;						/*!<Let an idle worker run ready channels of the most loaded shard.*/
+	uint64_t uExpireGrace;					/*!<90 kHz ticks after a segmentation_duration before its event is orphaned.*/
+	int64_t iRetention;						/*!<90 kHz ticks of splice times kept on a channel timeline.*/
+	uint32_t uIdleSleepUs;					/*!<Sleep of an idle worker after spinning and yielding.*/
+	std::vector<int> vWorkerCores;			/*!<Core of each worker, missing or negative entries are not pinned.*/
+
+	/*! \brief #SEngineConfig class default constructor with intializer list.
+	*/
+	SEngineConfig() :
+	 iWorkers(0),
+	 iVirtualNodes(64),
+	 iMaxChannels(4096),
+	 iMailboxCapacity(64),
+	 iBatch(16),
+	 bDedup(true),
+	 bWorkStealing(true),
+	 uExpireGrace(10 * 90000),
+	 iRetention((int64_t)3600 * 90000),
+	 uIdleSleepUs(50),
+	 vWorkerCores()
+	{
+	}
+};
+
+/*!	\class SEngineShardStats
+*	\brief #SEngineShardStats class holding a snapshot of the counters of one shard.
+*/
+class SEngineShardStats {
+public:
+	std::size_t iChannels;			/*!<Channels homed on the shard.*/
+	std::size_t iReady;				/*!<Channels waiting in the run queue of the shard.*/
+	uint64_t uCues;					/*!<Cues handled by the worker of the shard.*/
+	uint64_t uRuns;					/*!<Channel batches run by the worker.*/
+	uint64_t uStolen;				/*!<Channel batches the worker took from the run queue of another shard.*/
+
+	/*! \brief #SEngineShardStats class default constructor with intializer list.
+	*/
+	SEngineShardStats() :
+	 iChannels(0),
+	 iReady(0),
+	 uCues(0),
+	 uRuns(0),
+	 uStolen(0)
+	{
+	}
+};
+
+/*!	\class CSpliceEngine
+*	\brief #CSpliceEngine class parsing the cues of many channels on worker threads, with the state of each channel owned by one worker at a time.
+*
+*	Channels are placed on shards by consistent hashing (#GetShard), so adding shards to a deployment moves few channels. Each channel has a
+*	mailbox (#CSpliceMPSCQueue) and is put on the run queue of its home shard when a cue arrives. A worker runs a channel by taking up to
+*	SEngineConfig::iBatch cues from its mailbox: duplicate filter, parse, segmentation tracker, timeline and handler. A channel is on at most
+*	one run queue and run by one worker at a time, so its cues are handled in order without locks. An idle worker steals ready channels from
+*	the most loaded shard, which spreads hot channels without breaking that order. The channel directory is locked per shard, so adding or
+*	removing a channel only waits for submissions to the channels of the same shard.
+*/
+class CSpliceEngine {
+public:
+	/*! \brief #CSpliceEngine class constructor.
+	*	\param objConfig settings, fixed for the life of the object.
+	*/
+	explicit CSpliceEngine(const SEngineConfig& objConfig);
+
+	/*! \brief #CSpliceEngine class destructor, stops the workers after the pending cues were handled.
+	*/
+	~CSpliceEngine();
+
+	/*!	\brief Deleted copy constructor so #CSpliceEngine class object cannot be copied.
+	*/
+	CSpliceEngine(const CSpliceEngine&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceEngine class object cannot be assigned.
+	*/
+	void operator=(const CSpliceEngine&) = delete;
+
+	/*! \brief Function to set the handler, before #Start only.
+	*	\param pHandler handler (not owned, must outlive the engine) or nullptr.
+	*/
+	void SetHandler(CSpliceEngineHandler* pHandler) { m_pHandler = pHandler; }
+
+	/*! \brief Function to attach metrics to the parsers of the workers, before #Start only.
+	*	\param pMetrics metrics object (not owned, must outlive the engine).
+	*/
+	void SetMetrics(CSpliceMetrics* pMetrics);
+
+	/*! \brief Function to start the workers.
+	*	\returns true if started and false if already running.
+	*/
+	bool Start();
+
+	/*! \brief Function to stop the workers once every submitted cue was handled.
+	*/
+	void Stop();
+
+	/*! \brief Function to add a channel, from any thread.
+	*	\returns true if added and false if it exists or SEngineConfig::iMaxChannels is reached (removed channels count until drained).
+	*/
+	bool AddChannel(const uint64_t& uChannel);
+
+	/*! \brief Function to remove a channel, from any thread. Its pending cues are still handled, then CSpliceEngineHandler::OnChannelRemoved
+	*	is called and the state deleted by the worker running it (by #Start or the destructor if the engine is stopped).
+	*	\returns true if the channel existed.
+	*/
+	bool RemoveChannel(const uint64_t& uChannel);
+
+	/*! \brief Function to submit one section of a channel, from any thread. Sections of one channel submitted from several threads are
+	*	handled in the order their submissions took the directory lock.
+	*	\param uChannel channel identifier.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength number of bytes.
+	*	\returns true if queued and false if the channel does not exist or its mailbox is full.
+	*/
+	bool Submit(const uint64_t& uChannel, const uint8_t* pData, const std::size_t& iLength);
+
+	/*! \brief Function to get the home shard of a channel on the consistent hash ring.
+	*/
+	std::size_t GetShard(const uint64_t& uChannel) const;
+
+	/*! \brief Function to get the number of shards.
+	*/
+	std::size_t GetShardCount() const { return m_vShards.size(); }
+
+	/*! \brief Function to get the number of channels.
+	*/
+	std::size_t GetChannelCount() const { return m_iChannels.load(std::memory_order_relaxed); }
+
+	/*! \brief Function to get the counters of a channel.
+	*	\returns true if the channel exists.
+	*/
+	bool GetChannelStats(const uint64_t& uChannel, SEngineChannelStats& objStats) const;
+
+	/*! \brief Function to get the counters of a shard.
+	*/
+	SEngineShardStats GetShardStats(const std::size_t& iShard) const;
+
+private:
+	/*!	\struct SChannelSlot
+	*	\brief #SChannelSlot structure holding a channel state and its scheduling.
+	*
+	*	iPending counts the mailbox cues plus one for the removal. The submission taking it from 0 puts the channel on a run queue, and the
+	*	worker gives it back by subtracting what it handled, so the channel is scheduled exactly while it has work.
+	*/
+	struct SChannelSlot {
+		SEngineChannel objState;								/*!<State given to the handler.*/
+		CSpliceMPSCQueue<std::vector<uint8_t>> objMailbox;		/*!<Submitted sections.*/
+		std::atomic<std::size_t> iPending;						/*!<Units of work not handled yet.*/
+		std::atomic<bool> bRemoved;								/*!<Whether the channel was removed.*/
+
+		/*! \brief #SChannelSlot structure constructor.
+		*/
+		SChannelSlot(const uint64_t& uChannel, const std::size_t& iHomeShard, const std::size_t& iMailboxCapacity) :
+		objState(uChannel, iHomeShard),
+		objMailbox(iMailboxCapacity),
+		iPending(0),
+		bRemoved(false)
+		{
+		}
+	};
+
+	/*!	\struct SEngineShard
+	*	\brief #SEngineShard structure holding the directory part, run queue and worker of one shard.
+	*/
+	struct alignas(iSpliceCacheLine) SEngineShard {
+		mutable std::mutex objMutex;								/*!<Lock of mChannels.*/
+		CSpliceHashMap<SChannelSlot*> mChannels;					/*!<Channels homed on the shard.*/
+		std::unique_ptr<CSpliceMPSCQueue<SChannelSlot*>> pReady;	/*!<Channels with cues to handle.*/
+		std::thread objThread;										/*!<Worker.*/
+		std::atomic<uint64_t> uCues;								/*!<Cues handled by the worker.*/
+		std::atomic<uint64_t> uRuns;								/*!<Channel batches run by the worker.*/
+		std::atomic<uint64_t> uStolen;								/*!<Batches taken from another shard.*/
+		CSpliceClass objParser;										/*!<Parser of the worker.*/
+		std::vector<uint8_t> vSection;								/*!<Section being handled.*/
+		std::string sHexa;											/*!<Hexa-decimal text given to objParser.*/
+		std::vector<SSegmentationEvent> vEvents;					/*!<Events of the current cue.*/
+	};
+
+	/*! \brief Function to add a unit of work to a channel, putting it on the run queue of its home shard if it had none.
+	*/
+	void AddPending(SChannelSlot* pSlot);
+
+	/*! \brief Function to take a ready channel, from the own run queue first then (work stealing) from the most loaded shard.
+	*	\returns channel or nullptr if none is ready.
+	*/
+	SChannelSlot* TakeReady(const std::size_t& iShard);
+
+	/*! \brief Function to run a batch of cues of a channel on a worker, then reschedule or delete it.
+	*/
+	void RunChannel(SEngineShard& objShard, SChannelSlot* pSlot);
+
+	/*! \brief Function to handle one cue of a channel on a worker.
+	*/
+	void HandleCue(SEngineShard& objShard, SEngineChannel& objChannel);
+
+	/*! \brief Function run by each worker thread.
+	*/
+	void WorkerLoop(const std::size_t& iShard);
+
+	SEngineConfig m_objConfig;								/*!<Settings.*/
+	std::vector<std::pair<uint64_t, std::size_t>> m_vRing;	/*!<Consistent hash ring: point and shard, sorted by point.*/
+	std::unique_ptr<SEngineShard[]> m_pShardData;			/*!<Shards.*/
+	std::vector<SEngineShard*> m_vShards;					/*!<Pointers to the shards.*/
+	std::atomic<std::size_t> m_iChannels;					/*!<Number of channels.*/
+	std::atomic<std::size_t> m_iSlots;						/*!<Number of channel slots including removed ones still draining, bounded by SEngineConfig::iMaxChannels.*/
+	std::atomic<std::size_t> m_iScheduled;					/*!<Channels with pending work, the workers stop when it reaches 0.*/
+	std::atomic<bool> m_bRunning;							/*!<Whether the workers run.*/
+	std::atomic<bool> m_bStop;								/*!<Stop request of the workers.*/
+	CSpliceEngineHandler* m_pHandler;						/*!<Handler, not owned.*/
+};
+
+};
+
+#endif
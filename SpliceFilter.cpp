@@ -0,0 +1,181 @@
+/*! \file SpliceFilter.cpp
+*	\brief Splice pre-validation filter class definition.
+*	\details CPP file for definition of class CSpliceFilter whose declaration is in SpliceFilter.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceFilter.hpp"
+#include "SpliceCRC.hpp"
+#include "SpliceProjection.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Bytes from table_id up to and including splice_command_type.
+*/
+static const std::size_t iHeaderBytes = 14;
+/*! \brief Smallest splice_info_section : header, descriptor_loop_length and CRC_32.
+*/
+static const std::size_t iMinSectionBytes = iHeaderBytes + 2 + 4;
+/*! \brief splice_command_length of sections which do not give it (legacy encoders).
+*/
+static const std::size_t iUnknownCommandLength = 0xFFF;
+/*! \brief Bytes decoded at once by the hexa-decimal CRC_32 check.
+*/
+static const std::size_t iCrcChunkBytes = 64;
+
+/*!	\class CBytesSource
+*	\brief #CBytesSource class giving the bytes of a binary section to #CheckSection.
+*/
+class CBytesSource {
+public:
+	CBytesSource(const uint8_t* pData, const std::size_t& iLength) : m_pData(pData), m_iLength(iLength) {}
+	std::size_t GetLength() const { return m_iLength; }
+	int Get(const std::size_t& i) const { return m_pData[i]; }
+	bool Crc(const std::size_t& iBytes, uint32_t& uCrc) const { uCrc = CSpliceCRC::Compute(m_pData, iBytes); return true; }
+
+private:
+	const uint8_t* m_pData;
+	std::size_t m_iLength;
+};
+
+/*!	\class CHexaSource
+*	\brief #CHexaSource class decoding the bytes of a hexa-decimal section on demand for #CheckSection.
+*/
+class CHexaSource {
+public:
+	explicit CHexaSource(const std::string& sInput) : m_sInput(sInput) {}
+	std::size_t GetLength() const { return m_sInput.length() / 2; }
+	int Get(const std::size_t& i) const {
+		uint8_t uByte = 0;
+		return CSpliceProjection::HexaToBytes(m_sInput.data() + i * 2, 1, &uByte) ? uByte : -1;
+	}
+	bool Crc(const std::size_t& iBytes, uint32_t& uCrc) const {
+		uint8_t uChunk[iCrcChunkBytes];
+		uCrc = CSpliceCRC::uInitial;
+		for (std::size_t i = 0;i < iBytes;i += iCrcChunkBytes) {
+			std::size_t iCount = iBytes - i < iCrcChunkBytes ? iBytes - i : iCrcChunkBytes;
+			if (!CSpliceProjection::HexaToBytes(m_sInput.data() + i * 2, iCount, uChunk)) {
+				return false;
+			}
+			uCrc = CSpliceCRC::Update(uCrc, uChunk, iCount);
+		}
+		return true;
+	}
+
+private:
+	const std::string& m_sInput;
+};
+
+/*! \brief Function running the checks over a source of bytes.
+*/
+template <typename TSource>
+static scte35Verdict::type CheckSection(const TSource& objSource, const bool& bCheckCRC) {
+	if (objSource.GetLength() < iMinSectionBytes) {
+		return scte35Verdict::short_input;
+	}
+
+	//Bytes are read in check order so garbage is rejected on its first byte
+	int iTableId = objSource.Get(0);
+	if (iTableId < 0) {
+		return scte35Verdict::bad_character;
+	}
+	if (iTableId != 0xFC) {
+		return scte35Verdict::table_id;
+	}
+
+	//pts_adjustment, cw_index and tier (bytes 5 to 10) are not checked and not decoded
+	int iHeader[iHeaderBytes] = {0};
+	for (std::size_t i = 1;i < iHeaderBytes;i++) {
+		iHeader[i] = (i >= 5 && i <= 10) ? 0 : objSource.Get(i);
+		if (iHeader[i] < 0) {
+			return scte35Verdict::bad_character;
+		}
+	}
+
+	if ((iHeader[1] & 0xC0) != 0) {
+		return scte35Verdict::section_syntax;
+	}
+
+	std::size_t iSectionEnd = 3 + ((std::size_t)(iHeader[1] & 0x0F) << 8 | (std::size_t)iHeader[2]);
+	if (iSectionEnd < iMinSectionBytes || iSectionEnd > objSource.GetLength()) {
+		return scte35Verdict::section_length;
+	}
+	if (iHeader[3] != 0) {
+		return scte35Verdict::protocol_version;
+	}
+
+	//splice_command_type to E_CRC_32 are encrypted, only the framing can be checked
+	bool bEncrypted = (iHeader[4] & 0x80) != 0;
+	if (!bEncrypted) {
+		uint32_t uCommandType = (uint32_t)iHeader[13];
+		if (uCommandType != 0x00 && (uCommandType < 0x04 || uCommandType > 0x07) && uCommandType != 0xFF) {
+			return scte35Verdict::command_type;
+		}
+
+		std::size_t iCommandLength = ((std::size_t)(iHeader[11] & 0x0F) << 8) | (std::size_t)iHeader[12];
+		if (iCommandLength != iUnknownCommandLength) {
+			std::size_t iLoopStart = iHeaderBytes + iCommandLength;
+			if (iLoopStart + 2 + 4 > iSectionEnd) {
+				return scte35Verdict::command_length;
+			}
+
+			int iHigh = objSource.Get(iLoopStart);
+			int iLow = objSource.Get(iLoopStart + 1);
+			if (iHigh < 0 || iLow < 0) {
+				return scte35Verdict::bad_character;
+			}
+			if (iLoopStart + 2 + (std::size_t)((iHigh << 8) | iLow) + 4 > iSectionEnd) {
+				return scte35Verdict::descriptor_length;
+			}
+		}
+	}
+
+	if (bCheckCRC) {
+		//The CRC_32 of a whole section including its CRC_32 field is 0
+		uint32_t uCrc = 0;
+		if (!objSource.Crc(iSectionEnd, uCrc)) {
+			return scte35Verdict::bad_character;
+		}
+		if (uCrc != 0) {
+			return scte35Verdict::crc;
+		}
+	}
+	return scte35Verdict::accept;
+}
+
+scte35Verdict::type CSpliceFilter::Check(const uint8_t* pData, const std::size_t& iLength, const bool& bCheckCRC) {
+	if (pData == nullptr) {
+		return scte35Verdict::short_input;
+	}
+	return CheckSection(CBytesSource(pData, iLength), bCheckCRC);
+}
+
+scte35Verdict::type CSpliceFilter::CheckHexa(const std::string& sInput, const bool& bCheckCRC) {
+	if (sInput.length() % 2 != 0) {
+		return scte35Verdict::bad_character;
+	}
+	return CheckSection(CHexaSource(sInput), bCheckCRC);
+}
+
+const char* CSpliceFilter::GetVerdictName(const scte35Verdict::type& eVerdict) {
+	switch (eVerdict) {
+		case scte35Verdict::accept: return "accept";
+		case scte35Verdict::short_input: return "short_input";
+		case scte35Verdict::bad_character: return "bad_character";
+		case scte35Verdict::table_id: return "table_id";
+		case scte35Verdict::section_syntax: return "section_syntax";
+		case scte35Verdict::section_length: return "section_length";
+		case scte35Verdict::protocol_version: return "protocol_version";
+		case scte35Verdict::command_length: return "command_length";
+		case scte35Verdict::command_type: return "command_type";
+		case scte35Verdict::descriptor_length: return "descriptor_length";
+		case scte35Verdict::crc: return "crc";
+		default: return "unknown";
+	}
+}
+
+};
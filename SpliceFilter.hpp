@@ -0,0 +1,79 @@
+/*! \file SpliceFilter.hpp
+*	\brief Splice pre-validation filter class declaration.
+*	\details Header file for declaration of class CSpliceFilter whose definition is in SpliceFilter.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEFILTER_HPP_
+/*! \brief SpliceFilter.hpp header guard define.
+*/
+#define _SPLICEFILTER_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Verdict
+*	\brief scte35Verdict structure to hold the verdicts of #CSpliceFilter.
+*/
+struct scte35Verdict {
+	/*!
+	*	\brief A type definition for type (Pre-validation verdicts, the first failed check is reported)
+	*/
+	typedef enum {
+		accept = 0,				/*!<Input may hold a splice_info_section, the full parse decides*/
+		short_input = 1,		/*!<Input is shorter than the smallest splice_info_section*/
+		bad_character = 2,		/*!<Hexa-decimal input holds a non hexa-decimal character or has an odd length*/
+		table_id = 3,			/*!<table_id is not 0xFC*/
+		section_syntax = 4,		/*!<section_syntax_indicator or private_indicator is not 0*/
+		section_length = 5,		/*!<section_length is too small or goes beyond the input*/
+		protocol_version = 6,	/*!<protocol_version is not 0*/
+		command_length = 7,		/*!<splice_command_length goes beyond the section*/
+		command_type = 8,		/*!<splice_command_type is reserved*/
+		descriptor_length = 9,	/*!<descriptor_loop_length goes beyond the section*/
+		crc = 10,				/*!<CRC_32 does not match*/
+		count = 11				/*!<Number of verdicts (not a verdict)*/
+	}type;
+};
+
+/*!	\class CSpliceFilter
+*	\brief #CSpliceFilter class rejecting inputs which cannot be a splice_info_section before the full parse.
+*
+*	Only the fixed header bytes and the two descriptor_loop_length bytes are read (and decoded, for hexa-decimal input), so a verdict costs a few
+*	tens of nanoseconds whatever the input size. The optional CRC_32 check reads the whole section. An accepted input may still fail the full
+*	parse (e.g. a truncated descriptor), but a rejected one always would, or would not be a valid section.
+*/
+class CSpliceFilter {
+public:
+	/*! \brief Function to check a binary splice_info_section.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength number of bytes in pData.
+	*	\param bCheckCRC whether CRC_32 is checked too.
+	*	\returns scte35Verdict::accept or the first failed check.
+	*/
+	static scte35Verdict::type Check(const uint8_t* pData, const std::size_t& iLength, const bool& bCheckCRC = false);
+
+	/*! \brief Function to check a hexa-decimal splice_info_section (without spaces), decoding only the bytes the checks need.
+	*	\param sInput an input hexa-decimal string data.
+	*	\param bCheckCRC whether CRC_32 is checked too.
+	*	\returns scte35Verdict::accept or the first failed check.
+	*/
+	static scte35Verdict::type CheckHexa(const std::string& sInput, const bool& bCheckCRC = false);
+
+	/*! \brief Function to get the name of a verdict.
+	*	\param eVerdict verdict value.
+	*	\returns verdict name, "unknown" for an out of range value.
+	*/
+	static const char* GetVerdictName(const scte35Verdict::type& eVerdict);
+};
+
+};
+
+#endif
@@ -0,0 +1,428 @@
+/*! \file SpliceFingerprint.cpp
+*	\brief Splice cue fingerprint and field diff class definition.
+*	\details CPP file for definition of class CSpliceFingerprint whose declaration is in SpliceFingerprint.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceFingerprint.hpp"
+#include "SpliceProjection.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Function to hash a field name (FNV-1a), usable in case labels.
+*/
+static constexpr uint64_t NameHash(const char* sName) {
+	uint64_t uHash = 0xcbf29ce484222325ULL;
+	while (*sName != '\0') {
+		uHash = (uHash ^ (uint8_t)*sName++) * 0x100000001b3ULL;
+	}
+	return uHash;
+}
+
+/*! \brief Function to mix the bits of a value (splitmix64 finalizer).
+*/
+static uint64_t Mix(uint64_t uValue) {
+	uValue = (uValue ^ (uValue >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	uValue = (uValue ^ (uValue >> 27)) * 0x94d049bb133111ebULL;
+	return uValue ^ (uValue >> 31);
+}
+
+/*! \brief Function to hash a run of bytes and its length (FNV-1a).
+*/
+static uint64_t BytesHash(const uint8_t* pData, const std::size_t& iLength) {
+	uint64_t uHash = 0xcbf29ce484222325ULL;
+	for (std::size_t i = 0;i < iLength;i++) {
+		uHash = (uHash ^ pData[i]) * 0x100000001b3ULL;
+	}
+	return Mix(uHash ^ (uint64_t)iLength);
+}
+
+/*! \brief Function to get the scte35Ignore group of a field.
+*	\returns scte35Ignore bit, scte35Ignore::none for a field always kept.
+*/
+static uint32_t GetIgnoreGroup(const uint64_t& uName) {
+	switch (uName) {
+		case NameHash("pts_adjustment"): return scte35Ignore::pts_adjustment;
+		case NameHash("CRC_32"):
+		case NameHash("E_CRC_32"): return scte35Ignore::crc;
+		case NameHash("section_length"):
+		case NameHash("splice_command_length"):
+		case NameHash("descriptor_loop_length"):
+		case NameHash("descriptor_length"): return scte35Ignore::lengths;
+		case NameHash("reserved"):
+		case NameHash("reserved_1"):
+		case NameHash("reserved_2"):
+		case NameHash("alignment_stuffing"): return scte35Ignore::reserved;
+		default: return scte35Ignore::none;
+	}
+}
+
+/*! \brief Function to tell whether a field can be part of a component (splice_time included), any other field ends a component loop.
+*/
+static bool IsComponentField(const uint64_t& uName) {
+	switch (uName) {
+		case NameHash("component_tag"):
+		case NameHash("time_specified_flag"):
+		case NameHash("reserved"):
+		case NameHash("reserved_1"):
+		case NameHash("reserved_2"):
+		case NameHash("pts_time"):
+		case NameHash("utc_splice_time"):
+		case NameHash("pts_offset"):
+		case NameHash("ISO_code"):
+		case NameHash("Bit_Stream_Mode"):
+		case NameHash("Num_Channels"):
+		case NameHash("Full_Srvc_Audio"): return true;
+		default: return false;
+	}
+}
+
+/*!	\class CPathVisitor
+*	\brief #CPathVisitor class tracking the #SFieldPath of the walked fields and passing the fields not ignored to #Field.
+*
+*	The walker announces loops but not their ends: a component loop ends with the first field a component cannot hold, a splice_schedule
+*	event loop with the command.
+*/
+class CPathVisitor : public CSpliceVisitor {
+public:
+	/*! \brief #CPathVisitor class constructor.
+	*/
+	CPathVisitor(const uint32_t& uIgnore, const char** pNames, uint64_t* pHashes, uint32_t* pKinds, const std::size_t& iSlots) :
+	 m_objPath(),
+	 m_uIgnore(uIgnore & (iComponentKind - 1)),
+	 m_iDescriptors(0),
+	 m_bSchedule(false),
+	 m_bComponent(false),
+	 m_pNames(pNames),
+	 m_pHashes(pHashes),
+	 m_pKinds(pKinds),
+	 m_iSlots(iSlots)
+	{
+	}
+
+	scte35Visit::type OnCommand(const uint32_t& uType, const std::size_t& iOffset, const std::size_t& iLength) override {
+		(void)iOffset; (void)iLength;
+		m_bSchedule = uType == scte35Cmd::splice_schedule;
+		EndLoops();
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnCommandEnd(const uint32_t& uType) override {
+		(void)uType;
+		m_bSchedule = false;
+		EndLoops();
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnDescriptor(const uint32_t& uTag, const uint32_t& uIdentifier, const std::size_t& iOffset, const std::size_t& iLength) override {
+		(void)uTag; (void)uIdentifier; (void)iOffset; (void)iLength;
+		m_objPath.iDescriptor = m_iDescriptors++;
+		EndLoops();
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnDescriptorEnd(const uint32_t& uTag) override {
+		(void)uTag;
+		m_objPath.iDescriptor = -1;
+		EndLoops();
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnLoop(const char* sName, const uint32_t& uIndex, const std::size_t& iOffset) override {
+		(void)iOffset;
+		if (sName[0] == 's') {
+			m_objPath.sLoop = sName;
+			m_objPath.iLoop = (int32_t)uIndex;
+			m_objPath.iInnerLoop = -1;
+			m_bComponent = false;
+		}
+		else if (m_bSchedule && m_objPath.iLoop >= 0) {
+			m_objPath.iInnerLoop = (int32_t)uIndex;
+			m_bComponent = true;
+		}
+		else {
+			m_objPath.sLoop = sName;
+			m_objPath.iLoop = (int32_t)uIndex;
+			m_bComponent = true;
+		}
+		Loop(m_pHashes[GetNameSlot(sName)], uIndex);
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnField(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) override {
+		(void)iBitOffset; (void)iBits;
+		Accept(sName, uValue, false);
+		return scte35Visit::next;
+	}
+
+	scte35Visit::type OnBytes(const char* sName, const uint8_t* pData, const std::size_t& iLength, const std::size_t& iOffset) override {
+		(void)iOffset;
+		Accept(sName, BytesHash(pData, iLength), true);
+		return scte35Visit::next;
+	}
+
+protected:
+	/*! \brief Function receiving a field not ignored, m_objPath holds its position (sName and uOccurrence excepted).
+	*/
+	virtual void Field(const char* sName, const uint64_t& uName, const uint64_t& uValue, const bool& bBytes) = 0;
+
+	/*! \brief Function receiving the start of a loop element.
+	*/
+	virtual void Loop(const uint64_t& uName, const uint32_t& uIndex) { (void)uName; (void)uIndex; }
+
+	SFieldPath m_objPath;		/*!<Position of the current field.*/
+
+private:
+	/*! \brief Function to get the cache slot of a field name, filled with its hash and kind on a miss.
+	*/
+	std::size_t GetNameSlot(const char* sName) {
+		const std::size_t iSlot = (std::size_t)((uintptr_t)sName % m_iSlots);
+		if (m_pNames[iSlot] != sName) {
+			m_pNames[iSlot] = sName;
+			m_pHashes[iSlot] = NameHash(sName);
+			m_pKinds[iSlot] = GetIgnoreGroup(m_pHashes[iSlot]) | (IsComponentField(m_pHashes[iSlot]) ? iComponentKind : 0);
+		}
+		return iSlot;
+	}
+
+	/*! \brief Function to close the loops at a command or descriptor boundary.
+	*/
+	void EndLoops() {
+		m_objPath.sLoop = "";
+		m_objPath.iLoop = -1;
+		m_objPath.iInnerLoop = -1;
+		m_bComponent = false;
+	}
+
+	/*! \brief Function to close an ended component loop and pass a field on unless ignored.
+	*/
+	void Accept(const char* sName, const uint64_t& uValue, const bool& bBytes) {
+		const std::size_t iSlot = GetNameSlot(sName);
+		if (m_bComponent && (m_pKinds[iSlot] & iComponentKind) == 0) {
+			if (m_objPath.iInnerLoop >= 0) {
+				m_objPath.iInnerLoop = -1;
+			}
+			else {
+				m_objPath.sLoop = "";
+				m_objPath.iLoop = -1;
+			}
+			m_bComponent = false;
+		}
+		if ((m_pKinds[iSlot] & m_uIgnore) == 0) {
+			Field(sName, m_pHashes[iSlot], uValue, bBytes);
+		}
+	}
+
+	uint32_t m_uIgnore;			/*!<scte35Ignore values.*/
+	int32_t m_iDescriptors;		/*!<Descriptors seen.*/
+	bool m_bSchedule;			/*!<Whether the command is a splice_schedule.*/
+	bool m_bComponent;			/*!<Whether a component loop is open.*/
+	const char** m_pNames;		/*!<Names of the hash cache, by slot.*/
+	uint64_t* m_pHashes;		/*!<Hashes of m_pNames.*/
+	uint32_t* m_pKinds;			/*!<scte35Ignore group of m_pNames, with iComponentKind for a component field.*/
+	std::size_t m_iSlots;		/*!<Slots of the hash cache.*/
+
+	static const uint32_t iComponentKind = 0x100;		/*!<Kind bit of the fields a component can hold.*/
+};
+
+const uint32_t CPathVisitor::iComponentKind;
+
+/*!	\class CFingerprintVisitor
+*	\brief #CFingerprintVisitor class folding the fields and loop positions into a fingerprint.
+*/
+class CFingerprintVisitor : public CPathVisitor {
+public:
+	/*! \brief #CFingerprintVisitor class constructor.
+	*/
+	CFingerprintVisitor(const uint32_t& uIgnore, const char** pNames, uint64_t* pHashes, uint32_t* pKinds, const std::size_t& iSlots) :
+	 CPathVisitor(uIgnore, pNames, pHashes, pKinds, iSlots),
+	 m_uHash(0x5343544533354650ULL)
+	{
+	}
+
+	/*! \brief Function to get the fingerprint of the fields walked.
+	*/
+	uint64_t GetHash() const { return m_uHash; }
+
+protected:
+	void Field(const char* sName, const uint64_t& uName, const uint64_t& uValue, const bool& bBytes) override {
+		(void)sName; (void)bBytes;
+		m_uHash = Mix(m_uHash ^ uName);
+		m_uHash = Mix(m_uHash + uValue + 0x9e3779b97f4a7c15ULL);
+	}
+
+	void Loop(const uint64_t& uName, const uint32_t& uIndex) override {
+		m_uHash = Mix(m_uHash ^ uName ^ ((uint64_t)(uIndex + 1) << 40));
+	}
+
+private:
+	uint64_t m_uHash;		/*!<Fingerprint so far.*/
+};
+
+/*!	\class CCollectVisitor
+*	\brief #CCollectVisitor class collecting the fields with their position for CSpliceFingerprint::Diff.
+*/
+class CCollectVisitor : public CPathVisitor {
+public:
+	/*! \brief #CCollectVisitor class constructor.
+	*/
+	CCollectVisitor(const uint32_t& uIgnore, const char** pNames, uint64_t* pHashes, uint32_t* pKinds, const std::size_t& iSlots, std::vector<CSpliceFingerprint::SField>& vFields, CSpliceHashMap<uint32_t>& mOccurrences) :
+	 CPathVisitor(uIgnore, pNames, pHashes, pKinds, iSlots),
+	 m_vFields(vFields),
+	 m_mOccurrences(mOccurrences)
+	{
+	}
+
+protected:
+	void Field(const char* sName, const uint64_t& uName, const uint64_t& uValue, const bool& bBytes) override {
+		uint64_t uKey = Mix((uint64_t)(uint32_t)(m_objPath.iDescriptor + 1) ^ ((uint64_t)(uint32_t)(m_objPath.iLoop + 1) << 32));
+		uKey = Mix(uKey ^ (uint64_t)(uint32_t)(m_objPath.iInnerLoop + 1) ^ uName);
+
+		bool bInserted = false;
+		uint32_t& uSeen = m_mOccurrences.Insert(uKey, bInserted);
+		if (bInserted) {
+			uSeen = 0;
+		}
+
+		CSpliceFingerprint::SField objField;
+		objField.objPath = m_objPath;
+		objField.objPath.sName = sName;
+		objField.objPath.uOccurrence = uSeen++;
+		objField.uKey = Mix(uKey + objField.objPath.uOccurrence);
+		objField.uValue = uValue;
+		objField.bBytes = bBytes;
+		m_vFields.push_back(objField);
+	}
+
+private:
+	std::vector<CSpliceFingerprint::SField>& m_vFields;		/*!<Fields collected.*/
+	CSpliceHashMap<uint32_t>& m_mOccurrences;				/*!<Fields seen by position.*/
+};
+
+const std::size_t CSpliceFingerprint::iNameSlots;
+
+CSpliceFingerprint::CSpliceFingerprint(const uint32_t& uIgnore) :
+ m_uIgnore(uIgnore),
+ m_vOldBytes(),
+ m_vNewBytes(),
+ m_vOld(),
+ m_vNew(),
+ m_mOccurrences(),
+ m_mNew(),
+ m_pNames(),
+ m_uNames(),
+ m_uKinds()
+{
+}
+
+bool CSpliceFingerprint::Compute(const uint8_t* pData, const std::size_t& iLength, uint64_t& uFingerprint) {
+	CFingerprintVisitor objVisitor(m_uIgnore, m_pNames, m_uNames, m_uKinds, iNameSlots);
+	if (CSpliceWalker::Walk(pData, iLength, objVisitor) != scte35Error::none) {
+		return false;
+	}
+	uFingerprint = objVisitor.GetHash();
+	return true;
+}
+
+bool CSpliceFingerprint::ComputeHexa(const std::string& sInput, uint64_t& uFingerprint) {
+	if (!CSpliceProjection::HexaToBytes(sInput, m_vNewBytes)) {
+		return false;
+	}
+	return Compute(m_vNewBytes.data(), m_vNewBytes.size(), uFingerprint);
+}
+
+bool CSpliceFingerprint::Collect(const uint8_t* pData, const std::size_t& iLength, std::vector<SField>& vFields) {
+	vFields.clear();
+	m_mOccurrences.Clear();
+	CCollectVisitor objVisitor(m_uIgnore, m_pNames, m_uNames, m_uKinds, iNameSlots, vFields, m_mOccurrences);
+	return CSpliceWalker::Walk(pData, iLength, objVisitor) == scte35Error::none;
+}
+
+bool CSpliceFingerprint::Diff(const uint8_t* pOld, const std::size_t& iOld, const uint8_t* pNew, const std::size_t& iNew, std::vector<SFieldChange>& vChanges) {
+	vChanges.clear();
+	if (!Collect(pOld, iOld, m_vOld) || !Collect(pNew, iNew, m_vNew)) {
+		return false;
+	}
+
+	m_mNew.Clear();
+	for (std::size_t i = 0;i < m_vNew.size();i++) {
+		bool bInserted = false;
+		m_mNew.Insert(m_vNew[i].uKey, bInserted) = (uint32_t)(i + 1);
+	}
+
+	//Matched new fields are marked with 0, the ones still marked afterwards were added
+	for (const SField& objOld : m_vOld) {
+		uint32_t* pIndex = m_mNew.Find(objOld.uKey);
+		if (pIndex == nullptr || *pIndex == 0) {
+			SFieldChange objChange;
+			objChange.objPath = objOld.objPath;
+			objChange.eChange = scte35Change::removed;
+			objChange.bBytes = objOld.bBytes;
+			objChange.uOld = objOld.uValue;
+			vChanges.push_back(objChange);
+			continue;
+		}
+		const SField& objNew = m_vNew[*pIndex - 1];
+		*pIndex = 0;
+		if (objNew.uValue != objOld.uValue || objNew.bBytes != objOld.bBytes) {
+			SFieldChange objChange;
+			objChange.objPath = objOld.objPath;
+			objChange.eChange = scte35Change::changed;
+			objChange.bBytes = objOld.bBytes;
+			objChange.uOld = objOld.uValue;
+			objChange.uNew = objNew.uValue;
+			vChanges.push_back(objChange);
+		}
+	}
+
+	for (const SField& objNew : m_vNew) {
+		const uint32_t* pIndex = m_mNew.Find(objNew.uKey);
+		if (pIndex != nullptr && *pIndex != 0) {
+			SFieldChange objChange;
+			objChange.objPath = objNew.objPath;
+			objChange.eChange = scte35Change::added;
+			objChange.bBytes = objNew.bBytes;
+			objChange.uNew = objNew.uValue;
+			vChanges.push_back(objChange);
+		}
+	}
+	return true;
+}
+
+bool CSpliceFingerprint::DiffHexa(const std::string& sOld, const std::string& sNew, std::vector<SFieldChange>& vChanges) {
+	if (!CSpliceProjection::HexaToBytes(sOld, m_vOldBytes) || !CSpliceProjection::HexaToBytes(sNew, m_vNewBytes)) {
+		vChanges.clear();
+		return false;
+	}
+	return Diff(m_vOldBytes.data(), m_vOldBytes.size(), m_vNewBytes.data(), m_vNewBytes.size(), vChanges);
+}
+
+void CSpliceFingerprint::GetPathText(const SFieldPath& objPath, std::string& sText) {
+	if (objPath.iDescriptor >= 0) {
+		sText += "descriptor[";
+		sText += std::to_string(objPath.iDescriptor);
+		sText += "].";
+	}
+	if (objPath.iLoop >= 0) {
+		sText += objPath.sLoop;
+		sText += '[';
+		sText += std::to_string(objPath.iLoop);
+		sText += "].";
+	}
+	if (objPath.iInnerLoop >= 0) {
+		sText += "component[";
+		sText += std::to_string(objPath.iInnerLoop);
+		sText += "].";
+	}
+	sText += objPath.sName;
+	if (objPath.uOccurrence > 0) {
+		sText += '#';
+		sText += std::to_string(objPath.uOccurrence);
+	}
+}
+
+};
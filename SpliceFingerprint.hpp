@@ -0,0 +1,192 @@
+/*! \file SpliceFingerprint.hpp
+*	\brief Splice cue fingerprint and field diff classes declaration.
+*	\details Header file for declaration of structures scte35Ignore and scte35Change and classes SFieldPath, SFieldChange and CSpliceFingerprint
+*	whose definition is in SpliceFingerprint.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEFINGERPRINT_HPP_
+/*! \brief SpliceFingerprint.hpp header guard define.
+*/
+#define _SPLICEFINGERPRINT_HPP_
+
+#include "SpliceHashMap.hpp"
+#include "SpliceVisitor.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Ignore
+*	\brief scte35Ignore structure to hold the field groups #CSpliceFingerprint can leave out.
+*/
+struct scte35Ignore {
+	/*!
+	*	\brief A type definition for type (Ignored field groups, combined with |)
+	*/
+	typedef enum {
+		none = 0x00,				/*!<Every field counts*/
+		pts_adjustment = 0x01,		/*!<pts_adjustment*/
+		crc = 0x02,					/*!<CRC_32 and E_CRC_32*/
+		lengths = 0x04,				/*!<section_length, splice_command_length, descriptor_loop_length and descriptor_length, given by the other fields*/
+		reserved = 0x08				/*!<reserved fields and alignment_stuffing*/
+	}type;
+};
+
+/*! \struct scte35Change
+*	\brief scte35Change structure to hold the kinds of #SFieldChange.
+*/
+struct scte35Change {
+	/*!
+	*	\brief A type definition for type (Field changes)
+	*/
+	typedef enum {
+		changed = 0,		/*!<The field is in both cues with different values*/
+		added = 1,			/*!<The field is only in the new cue*/
+		removed = 2			/*!<The field is only in the old cue*/
+	}type;
+};
+
+/*!	\class SFieldPath
+*	\brief #SFieldPath class holding the position of a field in a cue, without text.
+*/
+class SFieldPath {
+public:
+	int32_t iDescriptor;		/*!<Index of the descriptor holding the field, -1 for the header, the command and CRC_32.*/
+	const char* sLoop;			/*!<Loop of iLoop: "splice" for splice_schedule events, "component" otherwise, empty outside loops.*/
+	int32_t iLoop;				/*!<Index of the splice_schedule event or of the component holding the field, -1 outside loops.*/
+	int32_t iInnerLoop;			/*!<Index of the component of a splice_schedule event holding the field, -1 outside.*/
+	const char* sName;			/*!<Field name, one of the static names of the #CSpliceWalker events.*/
+	uint32_t uOccurrence;		/*!<Number of fields of the same name before this one at the same position (reserved fields repeat).*/
+
+	/*! \brief #SFieldPath class default constructor with intializer list.
+	*/
+	SFieldPath() :
+	 iDescriptor(-1),
+	 sLoop(""),
+	 iLoop(-1),
+	 iInnerLoop(-1),
+	 sName(""),
+	 uOccurrence(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class SFieldChange
+*	\brief #SFieldChange class holding one difference found by CSpliceFingerprint::Diff.
+*/
+class SFieldChange {
+public:
+	SFieldPath objPath;				/*!<Field position.*/
+	scte35Change::type eChange;		/*!<Kind of change.*/
+	bool bBytes;					/*!<Whether the field is a run of bytes, whose values are then hashes of the bytes.*/
+	uint64_t uOld;					/*!<Value in the old cue, 0 if added.*/
+	uint64_t uNew;					/*!<Value in the new cue, 0 if removed.*/
+
+	/*! \brief #SFieldChange class default constructor with intializer list.
+	*/
+	SFieldChange() :
+	 objPath(),
+	 eChange(scte35Change::changed),
+	 bBytes(false),
+	 uOld(PARAMETER_DEF_VAL),
+	 uNew(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSpliceFingerprint
+*	\brief #CSpliceFingerprint class computes a 64-bit fingerprint of the fields of a cue and the field differences between two cues.
+*
+*	Both walk the section with #CSpliceWalker, so no text is rendered and no parsed class is built. The fingerprint hashes field names, values
+*	and loop positions in wire order with fixed constants: it is the same on every platform and run, and two cues differing only in ignored
+*	fields (see #scte35Ignore) have the same fingerprint. #Diff lists the fields, by position, which differ between two cues.
+*/
+class CSpliceFingerprint {
+public:
+	/*! \brief #CSpliceFingerprint class constructor.
+	*	\param uIgnore scte35Ignore values of the fields left out of fingerprints and diffs.
+	*/
+	explicit CSpliceFingerprint(const uint32_t& uIgnore = scte35Ignore::lengths | scte35Ignore::reserved);
+
+	/*!	\brief Deleted copy constructor so #CSpliceFingerprint class object cannot be copied.
+	*/
+	CSpliceFingerprint(const CSpliceFingerprint&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceFingerprint class object cannot be assigned.
+	*/
+	void operator=(const CSpliceFingerprint&) = delete;
+
+	/*! \brief Function to compute the fingerprint of a binary splice_info_section.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength number of bytes in pData.
+	*	\param uFingerprint receives the fingerprint.
+	*	\returns true if computed and false if the section cannot be walked.
+	*/
+	bool Compute(const uint8_t* pData, const std::size_t& iLength, uint64_t& uFingerprint);
+
+	/*! \brief Function to compute the fingerprint of a hexa-decimal splice_info_section (without spaces).
+	*	\returns true if computed and false if the input is not hexa-decimal or cannot be walked.
+	*/
+	bool ComputeHexa(const std::string& sInput, uint64_t& uFingerprint);
+
+	/*! \brief Function to list the field differences between two binary splice_info_sections.
+	*	\param pOld old section bytes.
+	*	\param iOld number of bytes in pOld.
+	*	\param pNew new section bytes.
+	*	\param iNew number of bytes in pNew.
+	*	\param vChanges receives the differences, fields of the old cue first in wire order then the added ones (replaced).
+	*	\returns true if compared and false if a section cannot be walked.
+	*/
+	bool Diff(const uint8_t* pOld, const std::size_t& iOld, const uint8_t* pNew, const std::size_t& iNew, std::vector<SFieldChange>& vChanges);
+
+	/*! \brief Function to list the field differences between two hexa-decimal splice_info_sections (without spaces).
+	*	\returns true if compared and false if an input is not hexa-decimal or cannot be walked.
+	*/
+	bool DiffHexa(const std::string& sOld, const std::string& sNew, std::vector<SFieldChange>& vChanges);
+
+	/*! \brief Function to append the textual form of a path, such as descriptor[1].component[0].pts_offset, for logs.
+	*	\param objPath field position.
+	*	\param sText text the path is appended to.
+	*/
+	static void GetPathText(const SFieldPath& objPath, std::string& sText);
+
+	/*!	\class SField
+	*	\brief #SField class holding one field collected for #Diff.
+	*/
+	class SField {
+	public:
+		SFieldPath objPath;		/*!<Field position.*/
+		uint64_t uKey;			/*!<Hash of the position.*/
+		uint64_t uValue;		/*!<Value, hash of the bytes for a run of bytes.*/
+		bool bBytes;			/*!<Whether the field is a run of bytes.*/
+	};
+
+private:
+	/*! \brief Function to collect the fields of a section for #Diff.
+	*/
+	bool Collect(const uint8_t* pData, const std::size_t& iLength, std::vector<SField>& vFields);
+
+	uint32_t m_uIgnore;							/*!<scte35Ignore values.*/
+	std::vector<uint8_t> m_vOldBytes;			/*!<Decoded bytes of the old hexa-decimal input.*/
+	std::vector<uint8_t> m_vNewBytes;			/*!<Decoded bytes of the new (or only) hexa-decimal input.*/
+	std::vector<SField> m_vOld;					/*!<Fields of the old cue.*/
+	std::vector<SField> m_vNew;					/*!<Fields of the new cue.*/
+	CSpliceHashMap<uint32_t> m_mOccurrences;	/*!<Fields seen by position while collecting, for SFieldPath::uOccurrence.*/
+	CSpliceHashMap<uint32_t> m_mNew;			/*!<Index plus one of the new fields by key.*/
+
+	static const std::size_t iNameSlots = 127;	/*!<Slots of the field name hash cache.*/
+	const char* m_pNames[iNameSlots];			/*!<Field names cached by address, the walker names being static literals.*/
+	uint64_t m_uNames[iNameSlots];				/*!<Hashes of m_pNames.*/
+	uint32_t m_uKinds[iNameSlots];				/*!<Groups and kinds of m_pNames.*/
+};
+
+};
+
+#endif
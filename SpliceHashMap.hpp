@@ -0,0 +1,225 @@
+/*! \file SpliceHashMap.hpp
+*	\brief Splice open-addressing hash map class declaration and definition.
+*	\details Header file for declaration and definition of the class template CSpliceHashMap (header only as it is a template).
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEHASHMAP_HPP_
+/*! \brief SpliceHashMap.hpp header guard define.
+*/
+#define _SPLICEHASHMAP_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CSpliceHashMap
+*	\brief #CSpliceHashMap class template is an open-addressing hash map from 64-bit keys (event identifiers, channel identifiers) to values.
+*
+*	Slots live in one contiguous array probed linearly, so a lookup touches one or two cache lines and never allocates. The table doubles when
+*	it is more than 3/4 full. Erase uses backward shifting instead of tombstones so probe lengths do not grow with churn.
+*	Pointers and references to values are invalidated by #Insert (growth) and #Erase (shifting).
+*	\tparam T value type, must be default constructible and movable.
+*/
+template <typename T>
+class CSpliceHashMap {
+public:
+	/*! \brief #CSpliceHashMap class constructor.
+	*	\param iInitialCapacity number of values which can be inserted before the first growth.
+	*/
+	explicit CSpliceHashMap(const std::size_t& iInitialCapacity = 16) :
+	m_iSize(0),
+	m_iMask(0)
+	{
+		std::size_t iSlots = 8;
+		while (iSlots * 3 / 4 < iInitialCapacity) {
+			iSlots <<= 1;
+		}
+		m_vSlots.resize(iSlots);
+		m_iMask = iSlots - 1;
+	}
+
+	/*! \brief Function to find the value of a key.
+	*	\param uKey the key.
+	*	\returns pointer to the value or nullptr if the key is not present.
+	*/
+	T* Find(const uint64_t& uKey) {
+		std::size_t iSlot = FindSlot(uKey);
+		return iSlot == (std::size_t)-1 ? nullptr : &m_vSlots[iSlot].objValue;
+	}
+
+	/*! \brief Function to find the value of a key.
+	*	\param uKey the key.
+	*	\returns pointer to the value or nullptr if the key is not present.
+	*/
+	const T* Find(const uint64_t& uKey) const {
+		std::size_t iSlot = FindSlot(uKey);
+		return iSlot == (std::size_t)-1 ? nullptr : &m_vSlots[iSlot].objValue;
+	}
+
+	/*! \brief Function to get the value of a key, inserting a default constructed value if the key is not present.
+	*	\param uKey the key.
+	*	\param bInserted set to true if the key was inserted and false if it was already present.
+	*	\returns reference to the value.
+	*/
+	T& Insert(const uint64_t& uKey, bool& bInserted) {
+		if ((m_iSize + 1) * 4 > m_vSlots.size() * 3) {
+			Grow();
+		}
+
+		std::size_t iSlot = Mix(uKey) & m_iMask;
+		while (m_vSlots[iSlot].bUsed) {
+			if (m_vSlots[iSlot].uKey == uKey) {
+				bInserted = false;
+				return m_vSlots[iSlot].objValue;
+			}
+			iSlot = (iSlot + 1) & m_iMask;
+		}
+
+		m_vSlots[iSlot].bUsed = true;
+		m_vSlots[iSlot].uKey = uKey;
+		m_vSlots[iSlot].objValue = T();
+		m_iSize++;
+		bInserted = true;
+		return m_vSlots[iSlot].objValue;
+	}
+
+	/*! \brief Function to remove a key and its value.
+	*	\param uKey the key.
+	*	\returns true if the key was present and false if not.
+	*/
+	bool Erase(const uint64_t& uKey) {
+		std::size_t iSlot = FindSlot(uKey);
+		if (iSlot == (std::size_t)-1) {
+			return false;
+		}
+
+		//Backward shift : move every following entry of the probe run which may be placed in the hole
+		std::size_t iHole = iSlot;
+		std::size_t iNext = (iHole + 1) & m_iMask;
+		while (m_vSlots[iNext].bUsed) {
+			std::size_t iHome = Mix(m_vSlots[iNext].uKey) & m_iMask;
+			if (((iNext - iHome) & m_iMask) >= ((iNext - iHole) & m_iMask)) {
+				m_vSlots[iHole].uKey = m_vSlots[iNext].uKey;
+				m_vSlots[iHole].objValue = std::move(m_vSlots[iNext].objValue);
+				iHole = iNext;
+			}
+			iNext = (iNext + 1) & m_iMask;
+		}
+
+		m_vSlots[iHole].bUsed = false;
+		m_vSlots[iHole].objValue = T();
+		m_iSize--;
+		return true;
+	}
+
+	/*! \brief Function to get the number of keys.
+	*/
+	std::size_t GetSize() const { return m_iSize; }
+
+	/*! \brief Function to remove all the keys, the slot array is kept.
+	*/
+	void Clear() {
+		for (SSlot& objSlot : m_vSlots) {
+			objSlot.bUsed = false;
+			objSlot.objValue = T();
+		}
+		m_iSize = 0;
+	}
+
+	/*! \brief Function to call fVisit(key, value) for every key in slot order. The map must not be modified from fVisit.
+	*/
+	template <typename F>
+	void ForEach(F fVisit) {
+		for (SSlot& objSlot : m_vSlots) {
+			if (objSlot.bUsed) {
+				fVisit(objSlot.uKey, objSlot.objValue);
+			}
+		}
+	}
+
+	/*! \brief Function to call fVisit(key, value) for every key in slot order.
+	*/
+	template <typename F>
+	void ForEach(F fVisit) const {
+		for (const SSlot& objSlot : m_vSlots) {
+			if (objSlot.bUsed) {
+				fVisit(objSlot.uKey, objSlot.objValue);
+			}
+		}
+	}
+
+private:
+	/*!	\struct SSlot
+	*	\brief #SSlot structure holding one slot of the table.
+	*/
+	struct SSlot {
+		uint64_t uKey;		/*!<Key of the slot when used.*/
+		bool bUsed;			/*!<Whether the slot holds a key.*/
+		T objValue;			/*!<Value of the slot when used.*/
+
+		SSlot() : uKey(0), bUsed(false), objValue() {}
+	};
+
+	/*! \brief Function to spread the key bits (splitmix64 finalizer) so sequential identifiers do not cluster.
+	*/
+	static uint64_t Mix(uint64_t uKey) {
+		uKey ^= uKey >> 30;
+		uKey *= 0xbf58476d1ce4e5b9ULL;
+		uKey ^= uKey >> 27;
+		uKey *= 0x94d049bb133111ebULL;
+		uKey ^= uKey >> 31;
+		return uKey;
+	}
+
+	/*! \brief Function to find the slot of a key.
+	*	\returns slot index or SIZE_MAX if the key is not present.
+	*/
+	std::size_t FindSlot(const uint64_t& uKey) const {
+		std::size_t iSlot = Mix(uKey) & m_iMask;
+		while (m_vSlots[iSlot].bUsed) {
+			if (m_vSlots[iSlot].uKey == uKey) {
+				return iSlot;
+			}
+			iSlot = (iSlot + 1) & m_iMask;
+		}
+		return (std::size_t)-1;
+	}
+
+	/*! \brief Function to double the slot array and re-insert every key.
+	*/
+	void Grow() {
+		std::vector<SSlot> vOld;
+		vOld.swap(m_vSlots);
+		m_vSlots.resize(vOld.size() * 2);
+		m_iMask = m_vSlots.size() - 1;
+
+		for (SSlot& objOld : vOld) {
+			if (objOld.bUsed) {
+				std::size_t iSlot = Mix(objOld.uKey) & m_iMask;
+				while (m_vSlots[iSlot].bUsed) {
+					iSlot = (iSlot + 1) & m_iMask;
+				}
+				m_vSlots[iSlot].bUsed = true;
+				m_vSlots[iSlot].uKey = objOld.uKey;
+				m_vSlots[iSlot].objValue = std::move(objOld.objValue);
+			}
+		}
+	}
+
+	std::vector<SSlot> m_vSlots;		/*!<Slot array, size is a power of 2.*/
+	std::size_t m_iSize;				/*!<Number of used slots.*/
+	std::size_t m_iMask;				/*!<Slot array size minus 1.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,384 @@
+/*! \file SpliceJournal.cpp
+*	\brief Splice append-only binary cue journal classes definition.
+*	\details CPP file for definition of classes SJournalSummary, CSpliceJournal, CSpliceJournalWriter and CSpliceJournalReader whose
+*	declaration is in SpliceJournal.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceJournal.hpp"
+#include "SpliceCRC.hpp"
+#include "SpliceTimeline.hpp"	//for CSpliceTimeline::GetCuePts
+#include <algorithm>			//for std::max
+#include <cstring>				//for std::memcpy, std::memset, std::memcmp
+#if defined(_WIN32)
+#include <io.h>					//for _open, _write, _lseeki64, _chsize_s, _commit, _close
+#include <fcntl.h>				//for _O_RDWR, _O_CREAT, _O_BINARY
+#include <sys/stat.h>			//for _S_IREAD, _S_IWRITE
+#else
+#include <fcntl.h>				//for open
+#include <unistd.h>				//for write, lseek, ftruncate, fsync, close
+#include <cerrno>				//for errno, EINTR
+#endif
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const uint8_t SJournalSummary::uParsed;
+const uint8_t SJournalSummary::uHasPts;
+const uint8_t SJournalSummary::uHasSegmentation;
+const std::size_t CSpliceJournal::iFileHeaderSize;
+const std::size_t CSpliceJournal::iRecordHeaderSize;
+const std::size_t CSpliceJournal::iRecordAlignment;
+const std::size_t CSpliceJournal::iMaxSectionLength;
+const uint32_t CSpliceJournal::uVersion;
+
+/*! \brief Magic of the journal file header.
+*/
+static const char cJournalMagic[8] = { 'S', 'C', 'T', 'E', '3', '5', 'J', 'R' };
+
+/*! \brief Function to store a value in little-endian order.
+*/
+static void StoreLE(uint8_t* pOutput, uint64_t uValue, const std::size_t& iBytes) {
+	for (std::size_t i = 0;i < iBytes;i++) {
+		pOutput[i] = (uint8_t)uValue;
+		uValue >>= 8;
+	}
+}
+
+/*! \brief Function to load a value stored in little-endian order.
+*/
+static uint64_t LoadLE(const uint8_t* pInput, const std::size_t& iBytes) {
+	uint64_t uValue = 0;
+	for (std::size_t i = iBytes;i > 0;i--) {
+		uValue = (uValue << 8) | pInput[i - 1];
+	}
+	return uValue;
+}
+
+/*! \brief Function to decode a record header already checked, pSection pointing after it.
+*/
+static void DecodeRecord(const uint8_t* pInput, SJournalRecord& objRecord) {
+	objRecord.iLength = (std::size_t)LoadLE(pInput, 4);
+	objRecord.uSequence = LoadLE(pInput + 8, 8);
+	objRecord.uReceiveTime = LoadLE(pInput + 16, 8);
+	objRecord.uChannel = LoadLE(pInput + 24, 8);
+	objRecord.objSummary.uFlags = pInput[32];
+	objRecord.objSummary.uCommandType = pInput[33];
+	objRecord.objSummary.uSegmentationType = pInput[34];
+	objRecord.objSummary.uError = pInput[35];
+	objRecord.objSummary.uEventId = (uint32_t)LoadLE(pInput + 36, 4);
+	objRecord.objSummary.uPts = LoadLE(pInput + 40, 8);
+	objRecord.pSection = pInput + CSpliceJournal::iRecordHeaderSize;
+}
+
+//--------------------------------------- File access -------------------------------------------------------//
+
+#if defined(_WIN32)
+static int FileOpen(const std::string& sPath) { return _open(sPath.c_str(), _O_RDWR | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE); }
+static int64_t FileSeek(const int& iFile, const int64_t& iOffset, const int& iWhence) { return _lseeki64(iFile, iOffset, iWhence); }
+static bool FileTruncate(const int& iFile, const int64_t& iSize) { return _chsize_s(iFile, iSize) == 0; }
+static bool FileSync(const int& iFile) { return _commit(iFile) == 0; }
+static void FileClose(const int& iFile) { _close(iFile); }
+static bool FileWrite(const int& iFile, const uint8_t* pData, std::size_t iLength) {
+	while (iLength > 0) {
+		const int iWritten = _write(iFile, pData, (unsigned int)iLength);
+		if (iWritten <= 0) {
+			return false;
+		}
+		pData += iWritten;
+		iLength -= (std::size_t)iWritten;
+	}
+	return true;
+}
+#else
+static int FileOpen(const std::string& sPath) { return open(sPath.c_str(), O_RDWR | O_CREAT, 0644); }
+static int64_t FileSeek(const int& iFile, const int64_t& iOffset, const int& iWhence) { return (int64_t)lseek(iFile, (off_t)iOffset, iWhence); }
+static bool FileTruncate(const int& iFile, const int64_t& iSize) { return ftruncate(iFile, (off_t)iSize) == 0; }
+static bool FileSync(const int& iFile) { return fsync(iFile) == 0; }
+static void FileClose(const int& iFile) { close(iFile); }
+static bool FileWrite(const int& iFile, const uint8_t* pData, std::size_t iLength) {
+	while (iLength > 0) {
+		const ssize_t iWritten = write(iFile, pData, iLength);
+		if (iWritten < 0 && errno == EINTR) {
+			continue;
+		}
+		if (iWritten <= 0) {
+			return false;
+		}
+		pData += iWritten;
+		iLength -= (std::size_t)iWritten;
+	}
+	return true;
+}
+#endif
+
+//--------------------------------------- SJournalSummary -------------------------------------------------------//
+
+void SJournalSummary::Set(const CSpliceClass& objCue) {
+	*this = SJournalSummary();
+	uError = (uint8_t)objCue.GetLastError();
+	if (objCue.GetLastError() != scte35Error::none) {
+		return;
+	}
+
+	uFlags = uParsed;
+	const uint32_t uCommand = objCue.GetSInfoData().splice_command_type;
+	uCommandType = (uint8_t)uCommand;
+	if (uCommand == scte35Cmd::splice_insert) {
+		uEventId = objCue.GetSpliceInsert().splice_event_id;
+	}
+	if (CSpliceTimeline::GetCuePts(objCue, uPts)) {
+		uFlags |= uHasPts;
+	}
+
+	const std::vector<SDBase*>& vDescriptors = objCue.GetDescriptors();
+	for (std::size_t i = 0;i < vDescriptors.size();i++) {
+		if (vDescriptors[i]->splice_descriptor_tag == scte35Desc::segmentation_descriptor && CSpliceClass::IsBuiltInDescriptor(*vDescriptors[i])) {
+			const SegmentationDescriptor& objSegmentation = *static_cast<const SegmentationDescriptor*>(vDescriptors[i]);
+			uFlags |= uHasSegmentation;
+			uSegmentationType = (uint8_t)objSegmentation.segmentation_type_id;
+			if (uCommand != scte35Cmd::splice_insert) {
+				uEventId = objSegmentation.segmentation_event_id;
+			}
+			break;
+		}
+	}
+}
+
+//--------------------------------------- CSpliceJournal -------------------------------------------------------//
+
+void CSpliceJournal::WriteFileHeader(uint8_t* pOutput, const uint64_t& uFirstSequence) {
+	std::memcpy(pOutput, cJournalMagic, sizeof(cJournalMagic));
+	StoreLE(pOutput + 8, uVersion, 4);
+	StoreLE(pOutput + 12, 0, 4);
+	StoreLE(pOutput + 16, uFirstSequence, 8);
+}
+
+bool CSpliceJournal::CheckFileHeader(const uint8_t* pInput, uint64_t& uFirstSequence) {
+	uFirstSequence = LoadLE(pInput + 16, 8);
+	return std::memcmp(pInput, cJournalMagic, sizeof(cJournalMagic)) == 0 && LoadLE(pInput + 8, 4) == uVersion;
+}
+
+void CSpliceJournal::WriteRecord(const SJournalRecord& objRecord, uint8_t* pOutput) {
+	const SJournalSummary& objSummary = objRecord.objSummary;
+	const std::size_t iSize = GetRecordSize(objRecord.iLength);
+	StoreLE(pOutput, objRecord.iLength, 4);
+	StoreLE(pOutput + 8, objRecord.uSequence, 8);
+	StoreLE(pOutput + 16, objRecord.uReceiveTime, 8);
+	StoreLE(pOutput + 24, objRecord.uChannel, 8);
+	pOutput[32] = objSummary.uFlags;
+	pOutput[33] = objSummary.uCommandType;
+	pOutput[34] = objSummary.uSegmentationType;
+	pOutput[35] = objSummary.uError;
+	StoreLE(pOutput + 36, objSummary.uEventId, 4);
+	StoreLE(pOutput + 40, objSummary.uPts, 8);
+	std::memcpy(pOutput + iRecordHeaderSize, objRecord.pSection, objRecord.iLength);
+	std::memset(pOutput + iRecordHeaderSize + objRecord.iLength, 0, iSize - iRecordHeaderSize - objRecord.iLength);
+	StoreLE(pOutput + 4, CSpliceCRC::Compute(pOutput + 8, iRecordHeaderSize - 8 + objRecord.iLength), 4);
+}
+
+std::size_t CSpliceJournal::ReadRecord(const uint8_t* pInput, const std::size_t& iAvailable, SJournalRecord& objRecord) {
+	if (iAvailable < iRecordHeaderSize) {
+		return 0;
+	}
+	const std::size_t iLength = (std::size_t)LoadLE(pInput, 4);
+	if (iLength == 0 || iLength > iMaxSectionLength || GetRecordSize(iLength) > iAvailable) {
+		return 0;
+	}
+	if (CSpliceCRC::Compute(pInput + 8, iRecordHeaderSize - 8 + iLength) != (uint32_t)LoadLE(pInput + 4, 4)) {
+		return 0;
+	}
+	DecodeRecord(pInput, objRecord);
+	return GetRecordSize(iLength);
+}
+
+//--------------------------------------- CSpliceJournalWriter -------------------------------------------------------//
+
+CSpliceJournalWriter::CSpliceJournalWriter(const std::size_t& iBatchBytes) :
+m_vBatch(std::max(iBatchBytes, CSpliceJournal::GetRecordSize(CSpliceJournal::iMaxSectionLength))),
+m_iBuffered(0),
+m_iFile(-1),
+m_uWritten(0),
+m_uNextSequence(0)
+{
+
+}
+
+CSpliceJournalWriter::~CSpliceJournalWriter() {
+	Close();
+}
+
+bool CSpliceJournalWriter::Open(const std::string& sPath, const uint64_t& uFirstSequence) {
+	Close();
+	const int iFile = FileOpen(sPath);
+	if (iFile < 0) {
+		return false;
+	}
+
+	const int64_t iSize = FileSeek(iFile, 0, SEEK_END);
+	uint64_t uValidSize = CSpliceJournal::iFileHeaderSize;
+	uint64_t uNextSequence = uFirstSequence;
+	if (iSize >= 0 && (uint64_t)iSize < CSpliceJournal::iFileHeaderSize) {
+		//New journal, or one whose header a crash cut short (it cannot hold a record yet): write the header again
+		uint8_t uHeader[CSpliceJournal::iFileHeaderSize];
+		CSpliceJournal::WriteFileHeader(uHeader, uFirstSequence);
+		if ((iSize > 0 && !FileTruncate(iFile, 0)) || FileSeek(iFile, 0, SEEK_SET) < 0 || !FileWrite(iFile, uHeader, sizeof(uHeader)) || !FileSync(iFile)) {
+			FileClose(iFile);
+			return false;
+		}
+	}
+	else {
+		//Existing journal: keep its valid records and drop what a crash left after them
+		CSpliceJournalReader objReader;
+		if (iSize < 0 || !objReader.Open(sPath)) {
+			FileClose(iFile);
+			return false;
+		}
+		uValidSize = objReader.GetValidSize();
+		uNextSequence = objReader.GetFirstSequence() + objReader.GetCount();
+		objReader.Close();
+		if ((uint64_t)iSize > uValidSize && (!FileTruncate(iFile, (int64_t)uValidSize) || !FileSync(iFile))) {
+			FileClose(iFile);
+			return false;
+		}
+		if (FileSeek(iFile, (int64_t)uValidSize, SEEK_SET) < 0) {
+			FileClose(iFile);
+			return false;
+		}
+	}
+
+	m_iFile = iFile;
+	m_uWritten = uValidSize;
+	m_uNextSequence = uNextSequence;
+	m_iBuffered = 0;
+	return true;
+}
+
+bool CSpliceJournalWriter::Close() {
+	if (m_iFile < 0) {
+		return true;
+	}
+	const bool bFlushed = Flush();
+	FileClose(m_iFile);
+	m_iFile = -1;
+	m_iBuffered = 0;
+	return bFlushed;
+}
+
+bool CSpliceJournalWriter::Append(const uint64_t& uChannel, const uint64_t& uReceiveTime, const uint8_t* pData, const std::size_t& iLength, const CSpliceClass* pCue) {
+	if (m_iFile < 0 || pData == nullptr || iLength == 0 || iLength > CSpliceJournal::iMaxSectionLength) {
+		return false;
+	}
+
+	const std::size_t iSize = CSpliceJournal::GetRecordSize(iLength);
+	if (m_iBuffered + iSize > m_vBatch.size() && !Flush()) {
+		return false;
+	}
+
+	SJournalRecord objRecord;
+	objRecord.uSequence = m_uNextSequence;
+	objRecord.uReceiveTime = uReceiveTime;
+	objRecord.uChannel = uChannel;
+	if (pCue != nullptr) {
+		objRecord.objSummary.Set(*pCue);
+	}
+	objRecord.pSection = pData;
+	objRecord.iLength = iLength;
+	CSpliceJournal::WriteRecord(objRecord, m_vBatch.data() + m_iBuffered);
+	m_iBuffered += iSize;
+	m_uNextSequence++;
+	return true;
+}
+
+bool CSpliceJournalWriter::Flush() {
+	if (m_iFile < 0) {
+		return false;
+	}
+	if (m_iBuffered == 0) {
+		return true;
+	}
+	if (!FileWrite(m_iFile, m_vBatch.data(), m_iBuffered)) {
+		//Records after a partial batch would be lost behind it, the next Open drops the torn tail and continues the sequence
+		FileClose(m_iFile);
+		m_iFile = -1;
+		m_iBuffered = 0;
+		return false;
+	}
+	m_uWritten += m_iBuffered;
+	m_iBuffered = 0;
+	return true;
+}
+
+bool CSpliceJournalWriter::Sync() {
+	return Flush() && FileSync(m_iFile);
+}
+
+//--------------------------------------- CSpliceJournalReader -------------------------------------------------------//
+
+CSpliceJournalReader::CSpliceJournalReader() :
+m_objFile(),
+m_vOffsets(),
+m_uFirstSequence(0),
+m_uValidSize(0)
+{
+
+}
+
+CSpliceJournalReader::~CSpliceJournalReader() {
+	Close();
+}
+
+bool CSpliceJournalReader::Open(const std::string& sPath) {
+	Close();
+	if (!m_objFile.Open(sPath)) {
+		return false;
+	}
+	const uint8_t* pData = m_objFile.GetData();
+	const std::size_t iFileSize = m_objFile.GetSize();
+	if (iFileSize < CSpliceJournal::iFileHeaderSize || !CSpliceJournal::CheckFileHeader(pData, m_uFirstSequence)) {
+		Close();
+		return false;
+	}
+
+	//Check every record once, the first invalid one (or one out of sequence) ends the journal
+	std::size_t iOffset = CSpliceJournal::iFileHeaderSize;
+	SJournalRecord objRecord;
+	for (;;) {
+		const std::size_t iSize = CSpliceJournal::ReadRecord(pData + iOffset, iFileSize - iOffset, objRecord);
+		if (iSize == 0 || objRecord.uSequence != m_uFirstSequence + m_vOffsets.size()) {
+			break;
+		}
+		m_vOffsets.push_back(iOffset);
+		iOffset += iSize;
+	}
+	m_uValidSize = iOffset;
+	return true;
+}
+
+void CSpliceJournalReader::Close() {
+	m_objFile.Close();
+	m_vOffsets.clear();
+	m_uFirstSequence = 0;
+	m_uValidSize = 0;
+}
+
+bool CSpliceJournalReader::GetRecord(const std::size_t& iIndex, SJournalRecord& objRecord) const {
+	if (iIndex >= m_vOffsets.size()) {
+		return false;
+	}
+	DecodeRecord(m_objFile.GetData() + m_vOffsets[iIndex], objRecord);
+	return true;
+}
+
+bool CSpliceJournalReader::FindRecord(const uint64_t& uSequence, SJournalRecord& objRecord) const {
+	//Sequence numbers are consecutive from the first record (checked by Open)
+	if (uSequence < m_uFirstSequence) {
+		return false;
+	}
+	return GetRecord((std::size_t)(uSequence - m_uFirstSequence), objRecord);
+}
+
+};
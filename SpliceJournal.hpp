@@ -0,0 +1,313 @@
+/*! \file SpliceJournal.hpp
+*	\brief Splice append-only binary cue journal classes declaration.
+*	\details Header file for declaration of classes SJournalSummary, SJournalRecord, CSpliceJournal, CSpliceJournalWriter and CSpliceJournalReader whose
+*	definition is in SpliceJournal.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEJOURNAL_HPP_
+/*! \brief SpliceJournal.hpp header guard define.
+*/
+#define _SPLICEJOURNAL_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceMappedFile.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class SJournalSummary
+*	\brief #SJournalSummary class holding the parse summary stored with every journal record (16 bytes on disk).
+*
+*	It lets a reader select records (command, segmentation type, event, splice time) without parsing the sections again.
+*/
+class SJournalSummary {
+public:
+	/*! \brief uFlags bit set when the section was parsed successfully.
+	*/
+	static const uint8_t uParsed = 0x01;
+	/*! \brief uFlags bit set when uPts holds the splice time of the cue.
+	*/
+	static const uint8_t uHasPts = 0x02;
+	/*! \brief uFlags bit set when uSegmentationType comes from a segmentation_descriptor.
+	*/
+	static const uint8_t uHasSegmentation = 0x04;
+
+	uint8_t uFlags;					/*!<Combination of #uParsed, #uHasPts and #uHasSegmentation.*/
+	uint8_t uCommandType;			/*!<splice_command_type, 0xFF when not parsed.*/
+	uint8_t uSegmentationType;		/*!<segmentation_type_id of the first segmentation_descriptor.*/
+	uint8_t uError;					/*!<scte35Error::type of the parse, scte35Error::none when parsed.*/
+	uint32_t uEventId;				/*!<splice_event_id of a splice_insert, else segmentation_event_id of the first segmentation_descriptor.*/
+	uint64_t uPts;					/*!<Splice time with pts_adjustment applied (see CSpliceTimeline::GetCuePts).*/
+
+	/*! \brief #SJournalSummary class default constructor with intializer list.
+	*/
+	SJournalSummary() :
+	 uFlags(PARAMETER_DEF_VAL),
+	 uCommandType(0xFF),
+	 uSegmentationType(PARAMETER_DEF_VAL),
+	 uError(PARAMETER_DEF_VAL),
+	 uEventId(PARAMETER_DEF_VAL),
+	 uPts(PARAMETER_DEF_VAL)
+	{
+	}
+
+	/*! \brief Function to fill the summary from the last parse of a parser.
+	*	\param objCue parser after the parse of the section being journaled.
+	*/
+	void Set(const CSpliceClass& objCue);
+};
+
+/*!	\class SJournalRecord
+*	\brief #SJournalRecord class holding one record read from a journal, the section bytes point into the mapped file (no copy).
+*/
+class SJournalRecord {
+public:
+	uint64_t uSequence;				/*!<Sequence number given by the writer, consecutive in a journal.*/
+	uint64_t uReceiveTime;			/*!<Receive time given to CSpliceJournalWriter::Append.*/
+	uint64_t uChannel;				/*!<Channel identifier given to CSpliceJournalWriter::Append.*/
+	SJournalSummary objSummary;		/*!<Parse summary.*/
+	const uint8_t* pSection;		/*!<Section bytes, valid while the reader is open.*/
+	std::size_t iLength;			/*!<Number of bytes in pSection.*/
+
+	/*! \brief #SJournalRecord class default constructor with intializer list.
+	*/
+	SJournalRecord() :
+	 uSequence(PARAMETER_DEF_VAL),
+	 uReceiveTime(PARAMETER_DEF_VAL),
+	 uChannel(PARAMETER_DEF_VAL),
+	 objSummary(),
+	 pSection(nullptr),
+	 iLength(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSpliceJournal
+*	\brief #CSpliceJournal class holding the on-disk format shared by #CSpliceJournalWriter and #CSpliceJournalReader.
+*
+*	A journal starts with a 24-byte file header (magic "SCTE35JR", version, sequence number of its first record). Each record is a 48-byte little-endian header
+*	(section length, CRC_32, sequence, receive time, channel, summary) followed by the section bytes, padded to a multiple of 8 bytes.
+*	The CRC_32 covers the record header after itself and the section, so a record torn by a crash fails the check and ends the journal.
+*/
+class CSpliceJournal {
+public:
+	/*! \brief Size of the file header in bytes.
+	*/
+	static const std::size_t iFileHeaderSize = 24;
+	/*! \brief Size of a record header in bytes.
+	*/
+	static const std::size_t iRecordHeaderSize = 48;
+	/*! \brief Alignment of the records in bytes.
+	*/
+	static const std::size_t iRecordAlignment = 8;
+	/*! \brief Largest section length accepted (a splice_info_section is at most 4096 bytes).
+	*/
+	static const std::size_t iMaxSectionLength = 4096;
+	/*! \brief Version written in the file header.
+	*/
+	static const uint32_t uVersion = 2;
+
+	/*! \brief Function to get the size of a record holding a section of iLength bytes, padding included.
+	*/
+	static std::size_t GetRecordSize(const std::size_t& iLength) { return (iRecordHeaderSize + iLength + iRecordAlignment - 1) & ~(iRecordAlignment - 1); }
+
+	/*! \brief Function to write the file header.
+	*	\param pOutput output of #iFileHeaderSize bytes.
+	*	\param uFirstSequence sequence number of the first record of the journal.
+	*/
+	static void WriteFileHeader(uint8_t* pOutput, const uint64_t& uFirstSequence);
+
+	/*! \brief Function to check a file header.
+	*	\param pInput input of #iFileHeaderSize bytes.
+	*	\param uFirstSequence receives the sequence number of the first record of the journal.
+	*	\returns true if the magic and the version match.
+	*/
+	static bool CheckFileHeader(const uint8_t* pInput, uint64_t& uFirstSequence);
+
+	/*! \brief Function to write a record.
+	*	\param objRecord record to write, pSection and iLength give the section.
+	*	\param pOutput output of #GetRecordSize bytes.
+	*/
+	static void WriteRecord(const SJournalRecord& objRecord, uint8_t* pOutput);
+
+	/*! \brief Function to read and check a record.
+	*	\param pInput input starting at a record.
+	*	\param iAvailable number of bytes available from pInput.
+	*	\param objRecord receives the record, pSection pointing into pInput.
+	*	\returns size of the record, 0 if it is truncated or its length or CRC_32 is wrong.
+	*/
+	static std::size_t ReadRecord(const uint8_t* pInput, const std::size_t& iAvailable, SJournalRecord& objRecord);
+};
+
+/*!	\class CSpliceJournalWriter
+*	\brief #CSpliceJournalWriter class appends received sections to a journal file.
+*
+*	Records are encoded into a batch buffer and written with one system call when it is full, on #Flush or on #Sync; only #Sync makes
+*	them durable. Opening an existing journal drops a torn tail left by a crash (a header it cut short is written again) and continues its
+*	sequence numbers; both repairs are synced before appending. A journal rotated into a new file continues the sequence numbers of the
+*	previous one when opened with its #GetNextSequence, so an index over the files (see CSpliceArchive) sees one run of records.
+*/
+class CSpliceJournalWriter {
+public:
+	/*! \brief #CSpliceJournalWriter class constructor.
+	*	\param iBatchBytes size of the batch buffer written at once.
+	*/
+	explicit CSpliceJournalWriter(const std::size_t& iBatchBytes = 64 * 1024);
+
+	/*! \brief #CSpliceJournalWriter class destructor, flushes and closes the journal.
+	*/
+	~CSpliceJournalWriter();
+
+	/*!	\brief Deleted copy constructor so #CSpliceJournalWriter class object cannot be copied.
+	*/
+	CSpliceJournalWriter(const CSpliceJournalWriter&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceJournalWriter class object cannot be assigned.
+	*/
+	void operator=(const CSpliceJournalWriter&) = delete;
+
+	/*! \brief Function to open a journal for appending, creating it if needed.
+	*	\param sPath journal file path.
+	*	\param uFirstSequence sequence number of the first record of a new journal, an existing one continues its own.
+	*	\returns true if opened and false if the file cannot be opened or is not a journal.
+	*/
+	bool Open(const std::string& sPath, const uint64_t& uFirstSequence = 0);
+
+	/*! \brief Function to flush and close the journal.
+	*	\returns true if the buffered records were written.
+	*/
+	bool Close();
+
+	/*! \brief Function to check whether a journal is open.
+	*/
+	bool IsOpen() const { return m_iFile >= 0; }
+
+	/*! \brief Function to append a section.
+	*	\param uChannel channel identifier.
+	*	\param uReceiveTime receive time, in the unit chosen by the application.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength number of bytes in pData.
+	*	\param pCue parser whose last parse is the one of this section for the summary, nullptr when the section was not parsed.
+	*	\returns true if appended and false if the journal is closed, the length is wrong or a batch write failed.
+	*/
+	bool Append(const uint64_t& uChannel, const uint64_t& uReceiveTime, const uint8_t* pData, const std::size_t& iLength, const CSpliceClass* pCue);
+
+	/*! \brief Function to write the buffered records.
+	*	\returns true if written, a failed write closes the journal (#Open continues after its valid records).
+	*/
+	bool Flush();
+
+	/*! \brief Function to write the buffered records and wait for them to reach the storage.
+	*	\returns true if written and synchronized.
+	*/
+	bool Sync();
+
+	/*! \brief Function to get the sequence number of the next appended record, kept after #Close to open the next journal of a rotation.
+	*/
+	uint64_t GetNextSequence() const { return m_uNextSequence; }
+
+	/*! \brief Function to get the size of the journal in bytes, buffered records included.
+	*/
+	uint64_t GetSize() const { return m_uWritten + m_iBuffered; }
+
+private:
+	std::vector<uint8_t> m_vBatch;		/*!<Batch buffer.*/
+	std::size_t m_iBuffered;			/*!<Bytes used in m_vBatch.*/
+	int m_iFile;						/*!<File descriptor, -1 when closed.*/
+	uint64_t m_uWritten;				/*!<Bytes written to the file.*/
+	uint64_t m_uNextSequence;			/*!<Sequence number of the next record.*/
+};
+
+/*!	\class CSpliceJournalReader
+*	\brief #CSpliceJournalReader class maps a journal into memory and gives its records without copying the sections.
+*
+*	#Open checks every record once and indexes their offsets, so #GetRecord and #FindRecord are constant time. Reading stops at the
+*	first invalid record, which is how a journal torn by a crash ends. The records are the ones present when the journal was opened.
+*/
+class CSpliceJournalReader {
+public:
+	/*! \brief #CSpliceJournalReader class default constructor.
+	*/
+	CSpliceJournalReader();
+
+	/*! \brief #CSpliceJournalReader class destructor, unmaps the journal.
+	*/
+	~CSpliceJournalReader();
+
+	/*!	\brief Deleted copy constructor so #CSpliceJournalReader class object cannot be copied.
+	*/
+	CSpliceJournalReader(const CSpliceJournalReader&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceJournalReader class object cannot be assigned.
+	*/
+	void operator=(const CSpliceJournalReader&) = delete;
+
+	/*! \brief Function to map and index a journal.
+	*	\param sPath journal file path.
+	*	\returns true if opened and false if the file cannot be mapped or is not a journal.
+	*/
+	bool Open(const std::string& sPath);
+
+	/*! \brief Function to unmap the journal, the sections of the records read become invalid.
+	*/
+	void Close();
+
+	/*! \brief Function to get the number of valid records.
+	*/
+	std::size_t GetCount() const { return m_vOffsets.size(); }
+
+	/*! \brief Function to get the sequence number of the first record, given by the file header even when the journal has no record.
+	*/
+	uint64_t GetFirstSequence() const { return m_uFirstSequence; }
+
+	/*! \brief Function to get the size of the file header and the valid records in bytes, the file may be longer after a crash.
+	*/
+	uint64_t GetValidSize() const { return m_uValidSize; }
+
+	/*! \brief Function to get a record by position.
+	*	\param iIndex position from 0 to #GetCount - 1.
+	*	\param objRecord receives the record.
+	*	\returns true if found.
+	*/
+	bool GetRecord(const std::size_t& iIndex, SJournalRecord& objRecord) const;
+
+	/*! \brief Function to get a record by sequence number.
+	*	\param uSequence sequence number.
+	*	\param objRecord receives the record.
+	*	\returns true if found.
+	*/
+	bool FindRecord(const uint64_t& uSequence, SJournalRecord& objRecord) const;
+
+	/*! \brief Function to call a function for every record in order.
+	*	\param fnVisit function called with const SJournalRecord&, returning false to stop.
+	*	\returns number of records visited.
+	*/
+	template <typename F>
+	std::size_t ForEach(F fnVisit) const {
+		SJournalRecord objRecord;
+		for (std::size_t i = 0;i < m_vOffsets.size();i++) {
+			GetRecord(i, objRecord);
+			if (!fnVisit(static_cast<const SJournalRecord&>(objRecord))) {
+				return i + 1;
+			}
+		}
+		return m_vOffsets.size();
+	}
+
+private:
+	CSpliceMappedFile m_objFile;		/*!<Mapped journal.*/
+	std::vector<uint64_t> m_vOffsets;	/*!<Offset of every valid record.*/
+	uint64_t m_uFirstSequence;			/*!<Sequence number of the first record.*/
+	uint64_t m_uValidSize;				/*!<File header and valid records in bytes.*/
+};
+
+};
+
+#endif
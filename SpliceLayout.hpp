@@ -0,0 +1,735 @@
+/*! \file SpliceLayout.hpp
+*	\brief Splice field layout tables and their generated decoders, encoders and serializers.
+*	\details Header only file holding the constexpr field layout of each SCTE-35 structure and the class template CSpliceLayout built from them.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICELAYOUT_HPP_
+/*! \brief SpliceLayout.hpp header guard define.
+*/
+#define _SPLICELAYOUT_HPP_
+
+#include "SpliceClass.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <ostream>
+#include <type_traits>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class SFieldLayout
+*	\brief #SFieldLayout class describing one field of a structure : name, width and the member it is stored in.
+*
+*	A conditional field is present only when an earlier field of the same table is present and holds uCondValue (e.g. pts_time when
+*	time_specified_flag is 1). Tables only hold fields in wire order, loops and variable length data are left to the caller.
+*/
+template <typename TStruct, typename TMember>
+class SFieldLayout {
+public:
+	const char* sName;				/*!<Field name as written by the text output.*/
+	int iBits;						/*!<Field width in bits, 1 to 57.*/
+	TMember TStruct::* pMember;		/*!<Member holding the field value.*/
+	int iCondField;					/*!<Index of the field the presence depends on, -1 if always present.*/
+	uint32_t uCondValue;			/*!<Value of field iCondField for this field to be present.*/
+};
+
+/*! \brief Function to make a #SFieldLayout for a member of TStruct or of one of its bases.
+*	\param sName field name.
+*	\param iBits field width in bits.
+*	\param pMember member holding the value.
+*	\param iCondField index of the field the presence depends on, -1 if always present.
+*	\param uCondValue value of field iCondField for the field to be present.
+*/
+template <typename TStruct, typename TMember, typename TOwner>
+constexpr SFieldLayout<TStruct, TMember> MakeField(const char* sName, const int& iBits, TMember TOwner::* pMember, const int& iCondField = -1, const uint32_t& uCondValue = 0) {
+	return SFieldLayout<TStruct, TMember>{ sName, iBits, pMember, iCondField, uCondValue };
+}
+
+//======================= Layout Tables Start =============================//
+
+/*! \brief splice_info_section fields from table_id up to and including splice_command_type (112 bits).
+*/
+struct SInfoHeaderLayout {
+	typedef SInfoData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("table_id", 8, &value_type::table_id),
+		MakeField<value_type>("section_syntax_indicator", 1, &value_type::section_syntax_indicator),
+		MakeField<value_type>("private_indicator", 1, &value_type::private_indicator),
+		MakeField<value_type>("reserved", 2, &value_type::reserved),
+		MakeField<value_type>("section_length", 12, &value_type::section_length),
+		MakeField<value_type>("protocol_version", 8, &value_type::protocol_version),
+		MakeField<value_type>("encrypted_packet", 1, &value_type::encrypted_packet),
+		MakeField<value_type>("encryption_algorithm", 6, &value_type::encryption_algorithm),
+		MakeField<value_type>("pts_adjustment", 33, &value_type::pts_adjustment),
+		MakeField<value_type>("cw_index", 8, &value_type::cw_index),
+		MakeField<value_type>("tier", 12, &value_type::tier),
+		MakeField<value_type>("splice_command_length", 12, &value_type::splice_command_length),
+		MakeField<value_type>("splice_command_type", 8, &value_type::splice_command_type));
+};
+
+/*! \brief splice_info_section descriptor_loop_length, following the splice command.
+*/
+struct SInfoLoopLayout {
+	typedef SInfoData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("descriptor_loop_length", 16, &value_type::descriptor_loop_length));
+};
+
+/*! \brief splice_info_section E_CRC_32, ending the encrypted part of an encrypted section.
+*/
+struct SInfoECRCLayout {
+	typedef SInfoData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("E_CRC_32", 32, &value_type::E_CRC_32));
+};
+
+/*! \brief splice_info_section CRC_32, ending the section.
+*/
+struct SInfoCRCLayout {
+	typedef SInfoData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("CRC_32", 32, &value_type::CRC_32));
+};
+
+/*! \brief splice_time() of time_signal, splice_insert and splice_insert components.
+*/
+struct SpliceTimeLayout {
+	typedef splice_time value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("time_specified_flag", 1, &value_type::time_specified_flag),
+		MakeField<value_type>("reserved_1", 6, &value_type::reserved_1, 0, 1),
+		MakeField<value_type>("pts_time", 33, &value_type::pts_time, 0, 1),
+		MakeField<value_type>("reserved_2", 7, &value_type::reserved_2, 0, 0));
+};
+
+/*! \brief break_duration() of splice_insert and splice_schedule.
+*/
+struct BreakDurationLayout {
+	typedef break_duration value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("auto_return", 1, &value_type::auto_return),
+		MakeField<value_type>("reserved", 6, &value_type::reserved),
+		MakeField<value_type>("duration", 33, &value_type::duration));
+};
+
+/*! \brief splice_insert() fields up to the splice_time, followed by splice_time, components and break_duration when flagged.
+*/
+struct SpliceInsertLayout {
+	typedef SpliceInsertData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_event_id", 32, &value_type::splice_event_id),
+		MakeField<value_type>("splice_event_cancel_indicator", 1, &value_type::splice_event_cancel_indicator),
+		MakeField<value_type>("reserved_1", 7, &value_type::reserved_1),
+		MakeField<value_type>("out_of_network_indicator", 1, &value_type::out_of_network_indicator, 1, 0),
+		MakeField<value_type>("program_splice_flag", 1, &value_type::program_splice_flag, 1, 0),
+		MakeField<value_type>("duration_flag", 1, &value_type::duration_flag, 1, 0),
+		MakeField<value_type>("splice_immediate_flag", 1, &value_type::splice_immediate_flag, 1, 0),
+		MakeField<value_type>("reserved_2", 4, &value_type::reserved_2, 1, 0));
+};
+
+/*! \brief splice_insert() component_count, present when program_splice_flag is 0.
+*/
+struct SpliceInsertCountLayout {
+	typedef SpliceInsertData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("component_count", 8, &value_type::component_count));
+};
+
+/*! \brief splice_insert() component, followed by its splice_time when splice_immediate_flag is 0.
+*/
+struct SInComponentLayout {
+	typedef SInComponent value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("component_tag", 8, &value_type::component_tag));
+};
+
+/*! \brief splice_insert() fields ending a not cancelled event.
+*/
+struct SpliceInsertTailLayout {
+	typedef SpliceInsertData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("unique_program_id", 16, &value_type::unique_program_id),
+		MakeField<value_type>("avail_num", 8, &value_type::avail_num),
+		MakeField<value_type>("avails_expected", 8, &value_type::avails_expected));
+};
+
+/*! \brief splice_schedule() splice_count.
+*/
+struct SpliceScheduleLayout {
+	typedef SpliceScheduleData value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_count", 8, &value_type::splice_count));
+};
+
+/*! \brief splice_schedule() event fields up to utc_splice_time or component_count, followed by components and break_duration when flagged.
+*/
+struct SpliceScheduleChildLayout {
+	typedef SpliceScheduleChild value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_event_id", 32, &value_type::splice_event_id),
+		MakeField<value_type>("splice_event_cancel_indicator", 1, &value_type::splice_event_cancel_indicator),
+		MakeField<value_type>("reserved_1", 7, &value_type::reserved_1),
+		MakeField<value_type>("out_of_network_indicator", 1, &value_type::out_of_network_indicator, 1, 0),
+		MakeField<value_type>("program_splice_flag", 1, &value_type::program_splice_flag, 1, 0),
+		MakeField<value_type>("duration_flag", 1, &value_type::duration_flag, 1, 0),
+		MakeField<value_type>("reserved_2", 5, &value_type::reserved_2, 1, 0),
+		MakeField<value_type>("utc_splice_time", 32, &value_type::utc_splice_time, 4, 1),
+		MakeField<value_type>("component_count", 8, &value_type::component_count, 4, 0));
+};
+
+/*! \brief splice_schedule() component.
+*/
+struct SSchComponentLayout {
+	typedef SSchComponent value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("component_tag", 8, &value_type::component_tag),
+		MakeField<value_type>("utc_splice_time", 32, &value_type::utc_splice_time));
+};
+
+/*! \brief splice_schedule() fields ending a not cancelled event.
+*/
+struct SpliceScheduleTailLayout {
+	typedef SpliceScheduleChild value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("unique_program_id", 16, &value_type::unique_program_id),
+		MakeField<value_type>("avail_num", 8, &value_type::avail_num),
+		MakeField<value_type>("avails_expected", 8, &value_type::avails_expected));
+};
+
+/*! \brief private_command() identifier, followed by the private bytes.
+*/
+struct PrivateCommandLayout {
+	typedef private_command value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("identifier", 32, &value_type::identifier));
+};
+
+/*! \brief Fields starting every splice_descriptor.
+*/
+struct SDBaseLayout {
+	typedef SDBase value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_descriptor_tag", 8, &value_type::splice_descriptor_tag),
+		MakeField<value_type>("descriptor_length", 8, &value_type::descriptor_length),
+		MakeField<value_type>("identifier", 32, &value_type::identifier));
+};
+
+/*! \brief avail_descriptor().
+*/
+struct AvailDescriptorLayout {
+	typedef AvailDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_descriptor_tag", 8, &value_type::splice_descriptor_tag),
+		MakeField<value_type>("descriptor_length", 8, &value_type::descriptor_length),
+		MakeField<value_type>("identifier", 32, &value_type::identifier),
+		MakeField<value_type>("provider_avail_id", 32, &value_type::provider_avail_id));
+};
+
+/*! \brief DTMF_descriptor() fields up to the DTMF characters.
+*/
+struct DTMFDescriptorLayout {
+	typedef DTMFDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_descriptor_tag", 8, &value_type::splice_descriptor_tag),
+		MakeField<value_type>("descriptor_length", 8, &value_type::descriptor_length),
+		MakeField<value_type>("identifier", 32, &value_type::identifier),
+		MakeField<value_type>("preroll", 8, &value_type::preroll),
+		MakeField<value_type>("dtmf_count", 3, &value_type::dtmf_count),
+		MakeField<value_type>("reserved", 5, &value_type::reserved));
+};
+
+/*! \brief segmentation_descriptor() fields up to the flags, followed by components, duration, UPID and type when not cancelled.
+*/
+struct SegmentationDescriptorLayout {
+	typedef SegmentationDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_descriptor_tag", 8, &value_type::splice_descriptor_tag),
+		MakeField<value_type>("descriptor_length", 8, &value_type::descriptor_length),
+		MakeField<value_type>("identifier", 32, &value_type::identifier),
+		MakeField<value_type>("segmentation_event_id", 32, &value_type::segmentation_event_id),
+		MakeField<value_type>("segmentation_event_cancel_indicator", 1, &value_type::segmentation_event_cancel_indicator),
+		MakeField<value_type>("reserved_1", 7, &value_type::reserved_1),
+		MakeField<value_type>("program_segmentation_flag", 1, &value_type::program_segmentation_flag, 4, 0),
+		MakeField<value_type>("segmentation_duration_flag", 1, &value_type::segmentation_duration_flag, 4, 0),
+		MakeField<value_type>("delivery_not_restricted_flag", 1, &value_type::delivery_not_restricted_flag, 4, 0),
+		MakeField<value_type>("web_delivery_allowed_flag", 1, &value_type::web_delivery_allowed_flag, 8, 0),
+		MakeField<value_type>("no_regional_blackout_flag", 1, &value_type::no_regional_blackout_flag, 8, 0),
+		MakeField<value_type>("archive_allowed_flag", 1, &value_type::archive_allowed_flag, 8, 0),
+		MakeField<value_type>("device_restrictions", 2, &value_type::device_restrictions, 8, 0),
+		MakeField<value_type>("reserved_2", 5, &value_type::reserved_2, 8, 1));
+};
+
+/*! \brief segmentation_descriptor() component_count, present when program_segmentation_flag is 0.
+*/
+struct SegmentationCountLayout {
+	typedef SegmentationDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("component_count", 8, &value_type::component_count));
+};
+
+/*! \brief segmentation_descriptor() component.
+*/
+struct SegDescComponentLayout {
+	typedef SegDescComponent value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("component_tag", 8, &value_type::component_tag),
+		MakeField<value_type>("reserved", 7, &value_type::reserved),
+		MakeField<value_type>("pts_offset", 33, &value_type::pts_offset));
+};
+
+/*! \brief segmentation_descriptor() segmentation_duration, present when segmentation_duration_flag is 1.
+*/
+struct SegmentationDurationLayout {
+	typedef SegmentationDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("segmentation_duration", 40, &value_type::segmentation_duration));
+};
+
+/*! \brief segmentation_descriptor() UPID type and length, followed by the UPID bytes.
+*/
+struct SegmentationUpidLayout {
+	typedef SegmentationDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("segmentation_upid_type", 8, &value_type::segmentation_upid_type),
+		MakeField<value_type>("segmentation_upid_length", 8, &value_type::segmentation_upid_length));
+};
+
+/*! \brief segmentation_descriptor() fields following the UPID bytes.
+*/
+struct SegmentationTypeLayout {
+	typedef SegmentationDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("segmentation_type_id", 8, &value_type::segmentation_type_id),
+		MakeField<value_type>("segment_num", 8, &value_type::segment_num),
+		MakeField<value_type>("segments_expected", 8, &value_type::segments_expected));
+};
+
+/*! \brief segmentation_descriptor() sub-segment fields of the segmentation_type_id 0x34, 0x36, 0x38 and 0x3A.
+*/
+struct SubSegmentLayout {
+	typedef SegmentationDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("sub_segment_num", 8, &value_type::sub_segment_num),
+		MakeField<value_type>("sub_segments_expected", 8, &value_type::sub_segments_expected));
+};
+
+/*! \brief time_descriptor().
+*/
+struct TimeDescriptorLayout {
+	typedef TimeDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_descriptor_tag", 8, &value_type::splice_descriptor_tag),
+		MakeField<value_type>("descriptor_length", 8, &value_type::descriptor_length),
+		MakeField<value_type>("identifier", 32, &value_type::identifier),
+		MakeField<value_type>("TAI_seconds", 48, &value_type::TAI_seconds),
+		MakeField<value_type>("TAI_ns", 32, &value_type::TAI_ns),
+		MakeField<value_type>("UTC_offset", 16, &value_type::UTC_offset));
+};
+
+/*! \brief audio_descriptor() fields up to the audio components.
+*/
+struct AudioDescriptorLayout {
+	typedef AudioDescriptor value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("splice_descriptor_tag", 8, &value_type::splice_descriptor_tag),
+		MakeField<value_type>("descriptor_length", 8, &value_type::descriptor_length),
+		MakeField<value_type>("identifier", 32, &value_type::identifier),
+		MakeField<value_type>("audio_count", 4, &value_type::audio_count),
+		MakeField<value_type>("reserved", 4, &value_type::reserved));
+};
+
+/*! \brief audio_descriptor() component.
+*/
+struct AudioDescComponentLayout {
+	typedef AudioDescComponent value_type;
+	static constexpr auto fields = std::make_tuple(
+		MakeField<value_type>("component_tag", 8, &value_type::component_tag),
+		MakeField<value_type>("ISO_code", 24, &value_type::ISO_code),
+		MakeField<value_type>("Bit_Stream_Mode", 3, &value_type::Bit_Stream_Mode),
+		MakeField<value_type>("Num_Channels", 4, &value_type::Num_Channels),
+		MakeField<value_type>("Full_Srvc_Audio", 1, &value_type::Full_Srvc_Audio));
+};
+
+//======================= Layout Tables End =============================//
+
+/*! \brief Function to get the sum of the field widths of a table for the given field indexes.
+*/
+template <typename TLayout, std::size_t... Is>
+constexpr int LayoutSumBits(std::index_sequence<Is...>) {
+	return (0 + ... + std::get<Is>(TLayout::fields).iBits);
+}
+
+/*! \brief Function to get the index of the first conditional field of a table, the field count if none.
+*/
+template <typename TLayout, std::size_t... Is>
+constexpr std::size_t LayoutFirstConditional(std::index_sequence<Is...>) {
+	std::size_t iFirst = sizeof...(Is);
+	((iFirst = (iFirst == sizeof...(Is) && std::get<Is>(TLayout::fields).iCondField >= 0) ? Is : iFirst), ...);
+	return iFirst;
+}
+
+/*!	\class CSpliceLayout
+*	\brief #CSpliceLayout class template generating the decoder, encoder, text serializer and field visitor of a layout table.
+*
+*	Fields before the first conditional one have compile-time bit offsets: each is extracted from the few bytes it spans, all loads happen before
+*	any store to the destination object, so the compiler merges the loads of adjacent fields into single word loads. Later fields are read at a
+*	running offset. Every structure of the tables starts on a byte boundary.
+*	\tparam TLayout layout table (one of the *Layout structures) with a value_type and a fields tuple.
+*/
+template <typename TLayout>
+class CSpliceLayout {
+public:
+	typedef typename TLayout::value_type value_type;
+
+	/*! \brief Number of fields of the table.
+	*/
+	static constexpr std::size_t iFieldCount = std::tuple_size<typename std::decay<decltype(TLayout::fields)>::type>::value;
+	/*! \brief Index of the first conditional field, iFieldCount if none.
+	*/
+	static constexpr std::size_t iFirstConditional = LayoutFirstConditional<TLayout>(std::make_index_sequence<iFieldCount>());
+	/*! \brief Number of bits of the fields always present.
+	*/
+	static constexpr int iFixedBits = LayoutSumBits<TLayout>(std::make_index_sequence<iFirstConditional>());
+	/*! \brief Number of bits when every field is present (upper bound of a structure size).
+	*/
+	static constexpr int iMaxBits = LayoutSumBits<TLayout>(std::make_index_sequence<iFieldCount>());
+
+	/*! \brief Function to get the width of a field.
+	*/
+	template <std::size_t I>
+	static constexpr int GetBits() { return std::get<I>(TLayout::fields).iBits; }
+
+	/*! \brief Function to get the bit offset of a field placed before the first conditional one.
+	*/
+	template <std::size_t I>
+	static constexpr int GetOffset() {
+		static_assert(I <= iFirstConditional, "offset of a field following a conditional field is not constant");
+		return LayoutSumBits<TLayout>(std::make_index_sequence<I>());
+	}
+
+	/*! \brief Function to get the name of a field.
+	*/
+	template <std::size_t I>
+	static constexpr const char* GetName() { return std::get<I>(TLayout::fields).sName; }
+
+	/*! \brief Function to decode the structure from bytes.
+	*
+	*	The destination is written only on success, absent conditional fields keep their value.
+	*	\param pData first byte of the structure.
+	*	\param iLength number of bytes readable from pData.
+	*	\param objValue receives the present fields.
+	*	\param iBits receives the number of bits decoded.
+	*	\returns true if decoded and false if the structure goes beyond iLength.
+	*/
+	static bool Decode(const uint8_t* pData, const std::size_t& iLength, value_type& objValue, std::size_t& iBits) {
+		if (iLength * 8 < (std::size_t)iFixedBits) {
+			return false;
+		}
+
+		uint64_t uValues[iFieldCount];
+		bool bPresent[iFieldCount];
+		std::size_t iPos = iFixedBits;
+		if (!DecodeFields(pData, iLength * 8, uValues, bPresent, iPos, std::make_index_sequence<iFieldCount>())) {
+			return false;
+		}
+
+		AssignFields(objValue, uValues, bPresent, std::make_index_sequence<iFieldCount>());
+		iBits = iPos;
+		return true;
+	}
+
+	/*! \brief Function to decode the structure from a '0' and '1' bit string, field by field.
+	*
+	*	Fields are stored as they are read, a field going beyond the string stops the decoding with the earlier fields stored. A field
+	*	holding another character than '0' or '1' is stored as 0.
+	*	\param sBits an input bit string.
+	*	\param iPos position of the first bit, moved past every stored field.
+	*	\param objValue receives the present fields.
+	*	\returns true if decoded and false if a field goes beyond the string.
+	*/
+	static bool DecodeBits(const std::string& sBits, int& iPos, value_type& objValue) {
+		bool bPresent[iFieldCount];
+		return DecodeBitFields(sBits, iPos, objValue, bPresent, std::make_index_sequence<iFieldCount>());
+	}
+
+	/*! \brief Function to get the number of bits the structure takes, from the values of its condition fields.
+	*/
+	static std::size_t GetBitLength(const value_type& objValue) {
+		bool bPresent[iFieldCount];
+		std::size_t iBits = 0;
+		EncodeFields(objValue, nullptr, bPresent, iBits, std::make_index_sequence<iFieldCount>());
+		return iBits;
+	}
+
+	/*! \brief Function to encode the structure to bytes. Only the bits of the present fields are written, the other bits are kept.
+	*	\param objValue structure to encode, values are truncated to their field width.
+	*	\param pData first byte of the structure.
+	*	\param iLength number of bytes writable from pData.
+	*	\param iBits receives the number of bits encoded.
+	*	\returns true if encoded and false if the structure goes beyond iLength (nothing written).
+	*/
+	static bool Encode(const value_type& objValue, uint8_t* pData, const std::size_t& iLength, std::size_t& iBits) {
+		iBits = GetBitLength(objValue);
+		if (pData == nullptr || iBits > iLength * 8) {
+			return false;
+		}
+
+		bool bPresent[iFieldCount];
+		std::size_t iPos = 0;
+		EncodeFields(objValue, pData, bPresent, iPos, std::make_index_sequence<iFieldCount>());
+		return true;
+	}
+
+	/*! \brief Function to write the present fields as name=value text, each followed by a separator.
+	*	\param objValue structure to write.
+	*	\param osOut output stream.
+	*	\param sSep separator written after each field.
+	*/
+	static void AppendText(const value_type& objValue, std::ostream& osOut, const std::string& sSep) {
+		bool bPresent[iFieldCount];
+		AppendFields(objValue, osOut, sSep, bPresent, std::make_index_sequence<iFieldCount>());
+	}
+
+	/*! \brief Function to decode the structure from bytes at a running bit offset, handing each present field to a function instead of a member.
+	*	\param pData first byte of the buffer, offsets are counted from it.
+	*	\param iTotalBits number of bits readable from pData.
+	*	\param iPos bit offset of the structure, moved past every decoded field.
+	*	\param uValues receives the iFieldCount field values, 0 for absent fields.
+	*	\param fnField called as fnField(sName, uValue, iBitOffset, iBits) for each present field, returns false to stop.
+	*	\returns true if decoded and false if a field goes beyond iTotalBits or fnField stopped.
+	*/
+	template <typename TField>
+	static bool Visit(const uint8_t* pData, const std::size_t& iTotalBits, std::size_t& iPos, uint64_t* uValues, TField& fnField) {
+		bool bPresent[iFieldCount];
+		return VisitFields(pData, iTotalBits, iPos, uValues, bPresent, fnField, std::make_index_sequence<iFieldCount>());
+	}
+
+private:
+	/*! \brief Function to get a mask of the lowest bits.
+	*/
+	static constexpr uint64_t Mask(const int& iBits) { return iBits >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << iBits) - 1); }
+
+	/*! \brief Function to extract a field at a compile-time offset, loading only the bytes it spans.
+	*/
+	template <int iOffset, int iBits>
+	static inline uint64_t ExtractFixed(const uint8_t* pData) {
+		constexpr int iFirst = iOffset / 8;
+		constexpr int iShift = iOffset % 8;
+		constexpr int iSpan = (iShift + iBits + 7) / 8;
+		static_assert(iSpan <= 8, "field spans more than 8 bytes");
+
+		uint64_t uWord = 0;
+		for (int i = 0;i < iSpan;i++) {
+			uWord = (uWord << 8) | pData[iFirst + i];
+		}
+		return (uWord >> (iSpan * 8 - iShift - iBits)) & Mask(iBits);
+	}
+
+	/*! \brief Function to extract a field at a running offset.
+	*/
+	static inline uint64_t Extract(const uint8_t* pData, const std::size_t& iPos, const int& iBits) {
+		std::size_t iFirst = iPos / 8;
+		int iShift = (int)(iPos % 8);
+		int iSpan = (iShift + iBits + 7) / 8;
+
+		uint64_t uWord = 0;
+		for (int i = 0;i < iSpan;i++) {
+			uWord = (uWord << 8) | pData[iFirst + i];
+		}
+		return (uWord >> (iSpan * 8 - iShift - iBits)) & Mask(iBits);
+	}
+
+	/*! \brief Function to write a field at a running offset, keeping the surrounding bits.
+	*/
+	static inline void Insert(uint8_t* pData, const std::size_t& iPos, const int& iBits, const uint64_t& uValue) {
+		for (int i = 0;i < iBits;i++) {
+			std::size_t iBit = iPos + (std::size_t)i;
+			uint8_t uMask = (uint8_t)(0x80 >> (iBit % 8));
+			if ((uValue >> (iBits - 1 - i)) & 1) {
+				pData[iBit / 8] |= uMask;
+			}
+			else {
+				pData[iBit / 8] &= (uint8_t)~uMask;
+			}
+		}
+	}
+
+	/*! \brief Function to check the presence condition of a field from the values of the earlier fields.
+	*/
+	template <std::size_t I, typename TGetValue>
+	static inline bool IsPresent(const bool* bPresent, const TGetValue& fnGetValue) {
+		constexpr int iCond = std::get<I>(TLayout::fields).iCondField;
+		if constexpr (iCond < 0) {
+			return true;
+		}
+		else {
+			static_assert((std::size_t)iCond < I, "condition field must come first");
+			return bPresent[iCond] && fnGetValue.template operator()<(std::size_t)iCond>() == std::get<I>(TLayout::fields).uCondValue;
+		}
+	}
+
+	/*! \brief Function to decode one field from bytes to the value array.
+	*/
+	template <std::size_t I>
+	static inline bool DecodeField(const uint8_t* pData, const std::size_t& iTotalBits, uint64_t* uValues, bool* bPresent, std::size_t& iPos) {
+		constexpr int iBits = std::get<I>(TLayout::fields).iBits;
+		if constexpr (I < iFirstConditional) {
+			uValues[I] = ExtractFixed<GetOffset<I>(), iBits>(pData);
+			bPresent[I] = true;
+			return true;
+		}
+		else {
+			bPresent[I] = IsPresent<I>(bPresent, SGetDecoded{ uValues });
+			uValues[I] = 0;
+			if (!bPresent[I]) {
+				return true;
+			}
+			if (iPos + iBits > iTotalBits) {
+				return false;
+			}
+			uValues[I] = Extract(pData, iPos, iBits);
+			iPos += iBits;
+			return true;
+		}
+	}
+
+	/*! \brief Function to decode every field from bytes to the value array.
+	*/
+	template <std::size_t... Is>
+	static inline bool DecodeFields(const uint8_t* pData, const std::size_t& iTotalBits, uint64_t* uValues, bool* bPresent, std::size_t& iPos, std::index_sequence<Is...>) {
+		return (DecodeField<Is>(pData, iTotalBits, uValues, bPresent, iPos) && ...);
+	}
+
+	/*! \brief Function to store the present values of the value array in their members.
+	*/
+	template <std::size_t... Is>
+	static inline void AssignFields(value_type& objValue, const uint64_t* uValues, const bool* bPresent, std::index_sequence<Is...>) {
+		((bPresent[Is] ? (void)(objValue.*(std::get<Is>(TLayout::fields).pMember) = (typename std::remove_reference<decltype(objValue.*(std::get<Is>(TLayout::fields).pMember))>::type)uValues[Is]) : (void)0), ...);
+	}
+
+	/*! \brief Function-object reading a field value from the decoded value array.
+	*/
+	struct SGetDecoded {
+		const uint64_t* uValues;
+		template <std::size_t C> uint64_t operator()() const { return uValues[C]; }
+	};
+
+	/*! \brief Function-object reading a field value from the member it is stored in.
+	*/
+	struct SGetMember {
+		const value_type& objValue;
+		template <std::size_t C> uint64_t operator()() const { return (uint64_t)(objValue.*(std::get<C>(TLayout::fields).pMember)); }
+	};
+
+	/*! \brief Function to decode one field from a bit string to its member.
+	*/
+	template <std::size_t I>
+	static inline bool DecodeBitField(const std::string& sBits, int& iPos, value_type& objValue, bool* bPresent) {
+		constexpr int iBits = std::get<I>(TLayout::fields).iBits;
+		bPresent[I] = IsPresent<I>(bPresent, SGetMember{ objValue });
+		if (!bPresent[I]) {
+			return true;
+		}
+		if (iPos < 0 || sBits.length() < (std::size_t)iPos + iBits) {
+			return false;
+		}
+
+		uint64_t uValue = 0;
+		bool bValid = true;
+		for (int i = 0;i < iBits;i++) {
+			char c = sBits[(std::size_t)iPos + i];
+			bValid = bValid && (c == '0' || c == '1');
+			uValue = (uValue << 1) | (uint64_t)(c == '1');
+		}
+
+		auto& objMember = objValue.*(std::get<I>(TLayout::fields).pMember);
+		objMember = (typename std::remove_reference<decltype(objMember)>::type)(bValid ? uValue : 0);
+		iPos += iBits;
+		return true;
+	}
+
+	/*! \brief Function to decode every field from a bit string to its member.
+	*/
+	template <std::size_t... Is>
+	static inline bool DecodeBitFields(const std::string& sBits, int& iPos, value_type& objValue, bool* bPresent, std::index_sequence<Is...>) {
+		return (DecodeBitField<Is>(sBits, iPos, objValue, bPresent) && ...);
+	}
+
+	/*! \brief Function to encode one field, or only count its bits when pData is nullptr.
+	*/
+	template <std::size_t I>
+	static inline void EncodeField(const value_type& objValue, uint8_t* pData, bool* bPresent, std::size_t& iPos) {
+		constexpr int iBits = std::get<I>(TLayout::fields).iBits;
+		bPresent[I] = IsPresent<I>(bPresent, SGetMember{ objValue });
+		if (!bPresent[I]) {
+			return;
+		}
+		if (pData != nullptr) {
+			Insert(pData, iPos, iBits, (uint64_t)(objValue.*(std::get<I>(TLayout::fields).pMember)) & Mask(iBits));
+		}
+		iPos += iBits;
+	}
+
+	/*! \brief Function to encode every field, or only count their bits when pData is nullptr.
+	*/
+	template <std::size_t... Is>
+	static inline void EncodeFields(const value_type& objValue, uint8_t* pData, bool* bPresent, std::size_t& iPos, std::index_sequence<Is...>) {
+		(EncodeField<Is>(objValue, pData, bPresent, iPos), ...);
+	}
+
+	/*! \brief Function to write one present field as text.
+	*/
+	template <std::size_t I>
+	static inline void AppendField(const value_type& objValue, std::ostream& osOut, const std::string& sSep, bool* bPresent) {
+		bPresent[I] = IsPresent<I>(bPresent, SGetMember{ objValue });
+		if (bPresent[I]) {
+			osOut << std::get<I>(TLayout::fields).sName << "=" << objValue.*(std::get<I>(TLayout::fields).pMember) << sSep;
+		}
+	}
+
+	/*! \brief Function to write every present field as text.
+	*/
+	template <std::size_t... Is>
+	static inline void AppendFields(const value_type& objValue, std::ostream& osOut, const std::string& sSep, bool* bPresent, std::index_sequence<Is...>) {
+		(AppendField<Is>(objValue, osOut, sSep, bPresent), ...);
+	}
+
+	/*! \brief Function to decode one field from bytes and hand it to a function.
+	*/
+	template <std::size_t I, typename TField>
+	static inline bool VisitField(const uint8_t* pData, const std::size_t& iTotalBits, std::size_t& iPos, uint64_t* uValues, bool* bPresent, TField& fnField) {
+		constexpr int iBits = std::get<I>(TLayout::fields).iBits;
+		bPresent[I] = IsPresent<I>(bPresent, SGetDecoded{ uValues });
+		uValues[I] = 0;
+		if (!bPresent[I]) {
+			return true;
+		}
+		if (iPos + iBits > iTotalBits) {
+			return false;
+		}
+
+		uValues[I] = Extract(pData, iPos, iBits);
+		std::size_t iOffset = iPos;
+		iPos += iBits;
+		return fnField(std::get<I>(TLayout::fields).sName, uValues[I], iOffset, iBits);
+	}
+
+	/*! \brief Function to decode every field from bytes and hand them to a function.
+	*/
+	template <typename TField, std::size_t... Is>
+	static inline bool VisitFields(const uint8_t* pData, const std::size_t& iTotalBits, std::size_t& iPos, uint64_t* uValues, bool* bPresent, TField& fnField, std::index_sequence<Is...>) {
+		return (VisitField<Is>(pData, iTotalBits, iPos, uValues, bPresent, fnField) && ...);
+	}
+};
+
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*! \file SpliceMappedFile.cpp
+*	\brief Splice read-only mapped file class definition.
+*	\details CPP file for definition of class CSpliceMappedFile whose declaration is in SpliceMappedFile.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceMappedFile.hpp"
+#if defined(_WIN32)
+#include <fstream>				//for std::ifstream (no mapping)
+#include <iterator>				//for std::istreambuf_iterator
+#else
+#include <fcntl.h>				//for open
+#include <sys/mman.h>			//for mmap, munmap
+#include <sys/stat.h>			//for fstat
+#include <unistd.h>				//for close
+#endif
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+CSpliceMappedFile::CSpliceMappedFile() :
+m_pData(nullptr),
+m_iSize(0),
+m_vCopy()
+{
+
+}
+
+CSpliceMappedFile::~CSpliceMappedFile() {
+	Close();
+}
+
+bool CSpliceMappedFile::Open(const std::string& sPath) {
+	Close();
+#if defined(_WIN32)
+	std::ifstream objFile(sPath, std::ios::binary);
+	if (!objFile) {
+		return false;
+	}
+	m_vCopy.assign(std::istreambuf_iterator<char>(objFile), std::istreambuf_iterator<char>());
+	if (m_vCopy.empty()) {
+		return false;
+	}
+	m_pData = m_vCopy.data();
+	m_iSize = m_vCopy.size();
+#else
+	const int iFile = open(sPath.c_str(), O_RDONLY);
+	if (iFile < 0) {
+		return false;
+	}
+	struct stat objStat;
+	if (fstat(iFile, &objStat) != 0 || objStat.st_size <= 0) {
+		close(iFile);
+		return false;
+	}
+	//The mapping keeps the file referenced, the descriptor is not needed any more
+	void* pMap = mmap(nullptr, (std::size_t)objStat.st_size, PROT_READ, MAP_PRIVATE, iFile, 0);
+	close(iFile);
+	if (pMap == MAP_FAILED) {
+		return false;
+	}
+	m_pData = static_cast<const uint8_t*>(pMap);
+	m_iSize = (std::size_t)objStat.st_size;
+#endif
+	return true;
+}
+
+void CSpliceMappedFile::Close() {
+#if !defined(_WIN32)
+	if (m_pData != nullptr) {
+		munmap(const_cast<uint8_t*>(m_pData), m_iSize);
+	}
+#endif
+	m_pData = nullptr;
+	m_iSize = 0;
+	m_vCopy.clear();
+}
+
+};
@@ -0,0 +1,73 @@
+/*! \file SpliceMappedFile.hpp
+*	\brief Splice read-only mapped file class declaration.
+*	\details Header file for declaration of class CSpliceMappedFile whose definition is in SpliceMappedFile.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEMAPPEDFILE_HPP_
+/*! \brief SpliceMappedFile.hpp header guard define.
+*/
+#define _SPLICEMAPPEDFILE_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CSpliceMappedFile
+*	\brief #CSpliceMappedFile class maps a whole file read-only, for the readers of the journal and columnar files.
+*
+*	POSIX systems map the file with mmap, so its pages are loaded on first access and shared with the page cache. Elsewhere the file is
+*	read into memory, which keeps the same interface.
+*/
+class CSpliceMappedFile {
+public:
+	/*! \brief #CSpliceMappedFile class default constructor.
+	*/
+	CSpliceMappedFile();
+
+	/*! \brief #CSpliceMappedFile class destructor, unmaps the file.
+	*/
+	~CSpliceMappedFile();
+
+	/*!	\brief Deleted copy constructor so #CSpliceMappedFile class object cannot be copied.
+	*/
+	CSpliceMappedFile(const CSpliceMappedFile&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceMappedFile class object cannot be assigned.
+	*/
+	void operator=(const CSpliceMappedFile&) = delete;
+
+	/*! \brief Function to map a file.
+	*	\param sPath file path.
+	*	\returns true if mapped and false if the file cannot be opened or is empty.
+	*/
+	bool Open(const std::string& sPath);
+
+	/*! \brief Function to unmap the file, pointers into it become invalid.
+	*/
+	void Close();
+
+	/*! \brief Function to get the mapped bytes, nullptr when closed.
+	*/
+	const uint8_t* GetData() const { return m_pData; }
+
+	/*! \brief Function to get the number of mapped bytes.
+	*/
+	std::size_t GetSize() const { return m_iSize; }
+
+private:
+	const uint8_t* m_pData;				/*!<Mapped bytes.*/
+	std::size_t m_iSize;				/*!<Number of mapped bytes.*/
+	std::vector<uint8_t> m_vCopy;		/*!<File read into memory where mapping is not available.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,271 @@
+/*! \file SpliceMetrics.cpp
+*	\brief Splice parse outcome metrics class definition.
+*	\details CPP file for definition of class CSpliceMetrics whose declaration is in SpliceMetrics.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceMetrics.hpp"
+#include <thread>		//for std::thread::hardware_concurrency
+#include <cstdio>		//for std::snprintf
+#include <vector>
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Shard index of the calling thread, SIZE_MAX until assigned.
+*/
+static thread_local std::size_t g_iThreadShard = (std::size_t)-1;
+/*! \brief Next shard index handed out round-robin to threads without a chosen shard.
+*/
+static std::atomic<std::size_t> g_iNextShard(0);
+
+CSpliceMetrics::CSpliceMetrics(const std::size_t& iShardCount) :
+m_iShardCount(iShardCount),
+m_pShards(nullptr)
+{
+	if (m_iShardCount == 0) {
+		m_iShardCount = std::thread::hardware_concurrency();
+	}
+	if (m_iShardCount == 0) {
+		m_iShardCount = 1;
+	}
+
+	m_pShards.reset(new SMetricsShard[m_iShardCount]);
+	ResetValue();
+}
+
+void CSpliceMetrics::SetThreadShard(const std::size_t& iShard) {
+	g_iThreadShard = iShard;
+}
+
+CSpliceMetrics::SMetricsShard& CSpliceMetrics::GetLocalShard() {
+	if (g_iThreadShard == (std::size_t)-1) {
+		g_iThreadShard = g_iNextShard.fetch_add(1, std::memory_order_relaxed);
+	}
+	return m_pShards[g_iThreadShard % m_iShardCount];
+}
+
+void CSpliceMetrics::AddParsed(const uint32_t& uCommandType) {
+	GetLocalShard().parsed[uCommandType & 0xff].fetch_add(1, std::memory_order_relaxed);
+}
+
+void CSpliceMetrics::AddDescriptor(const uint32_t& uDescriptorTag) {
+	GetLocalShard().descriptors[uDescriptorTag & 0xff].fetch_add(1, std::memory_order_relaxed);
+}
+
+void CSpliceMetrics::AddFailure(const scte35Error::type& eError, const scte35Field::type& eField) {
+	if (eError < 0 || eError >= scte35Error::count || eField < 0 || eField >= scte35Field::count) {
+		return;
+	}
+	GetLocalShard().failures[eError][eField].fetch_add(1, std::memory_order_relaxed);
+}
+
+void CSpliceMetrics::AddCRCMismatch() {
+	GetLocalShard().crc_mismatch.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CSpliceMetrics::AddUnsupportedDescriptor(const uint32_t& uDescriptorTag) {
+	GetLocalShard().unsupported[uDescriptorTag & 0xff].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t CSpliceMetrics::GetParsed(const uint32_t& uCommandType) const {
+	uint64_t uTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		uTotal += m_pShards[i].parsed[uCommandType & 0xff].load(std::memory_order_relaxed);
+	}
+	return uTotal;
+}
+
+uint64_t CSpliceMetrics::GetDescriptors(const uint32_t& uDescriptorTag) const {
+	uint64_t uTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		uTotal += m_pShards[i].descriptors[uDescriptorTag & 0xff].load(std::memory_order_relaxed);
+	}
+	return uTotal;
+}
+
+uint64_t CSpliceMetrics::GetFailures(const scte35Error::type& eError, const scte35Field::type& eField) const {
+	if (eError < 0 || eError >= scte35Error::count || eField < 0 || eField >= scte35Field::count) {
+		return 0;
+	}
+	uint64_t uTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		uTotal += m_pShards[i].failures[eError][eField].load(std::memory_order_relaxed);
+	}
+	return uTotal;
+}
+
+uint64_t CSpliceMetrics::GetCRCMismatches() const {
+	uint64_t uTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		uTotal += m_pShards[i].crc_mismatch.load(std::memory_order_relaxed);
+	}
+	return uTotal;
+}
+
+uint64_t CSpliceMetrics::GetUnsupportedDescriptors(const uint32_t& uDescriptorTag) const {
+	uint64_t uTotal = 0;
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		uTotal += m_pShards[i].unsupported[uDescriptorTag & 0xff].load(std::memory_order_relaxed);
+	}
+	return uTotal;
+}
+
+void CSpliceMetrics::ResetValue() {
+	for (std::size_t i = 0;i < m_iShardCount;i++) {
+		SMetricsShard& objShard = m_pShards[i];
+		for (int j = 0;j < 256;j++) {
+			objShard.parsed[j].store(0, std::memory_order_relaxed);
+			objShard.descriptors[j].store(0, std::memory_order_relaxed);
+			objShard.unsupported[j].store(0, std::memory_order_relaxed);
+		}
+		for (int e = 0;e < scte35Error::count;e++) {
+			for (int f = 0;f < scte35Field::count;f++) {
+				objShard.failures[e][f].store(0, std::memory_order_relaxed);
+			}
+		}
+		objShard.crc_mismatch.store(0, std::memory_order_relaxed);
+	}
+}
+
+const char* CSpliceMetrics::GetErrorName(const scte35Error::type& eError) {
+	switch (eError)
+	{
+		case scte35Error::none: return "none";
+		case scte35Error::empty_input: return "empty_input";
+		case scte35Error::odd_length: return "odd_length";
+		case scte35Error::white_space: return "white_space";
+		case scte35Error::base64_decode: return "base64_decode";
+		case scte35Error::truncated: return "truncated";
+		case scte35Error::unknown_command: return "unknown_command";
+		case scte35Error::descriptor_overrun: return "descriptor_overrun";
+		case scte35Error::rejected: return "rejected";
+		default: return "unknown";
+	}
+}
+
+const char* CSpliceMetrics::GetFieldName(const scte35Field::type& eField) {
+	switch (eField)
+	{
+		case scte35Field::input: return "input";
+		case scte35Field::splice_info_section: return "splice_info_section";
+		case scte35Field::splice_null: return "splice_null";
+		case scte35Field::splice_schedule: return "splice_schedule";
+		case scte35Field::splice_insert: return "splice_insert";
+		case scte35Field::time_signal: return "time_signal";
+		case scte35Field::bandwidth_reservation: return "bandwidth_reservation";
+		case scte35Field::private_command: return "private_command";
+		case scte35Field::splice_command: return "splice_command";
+		case scte35Field::descriptor_loop: return "descriptor_loop";
+		case scte35Field::avail_descriptor: return "avail_descriptor";
+		case scte35Field::dtmf_descriptor: return "dtmf_descriptor";
+		case scte35Field::segmentation_descriptor: return "segmentation_descriptor";
+		case scte35Field::time_descriptor: return "time_descriptor";
+		case scte35Field::audio_descriptor: return "audio_descriptor";
+		case scte35Field::crc: return "crc";
+		default: return "unknown";
+	}
+}
+
+/*!	\class CTextSink
+*	\brief #CTextSink class appending formatted text to a fixed buffer while counting the full length.
+*/
+class CTextSink {
+public:
+	CTextSink(char* pBuffer, const std::size_t& iCapacity) :
+	m_pBuffer(pBuffer),
+	m_iCapacity(iCapacity),
+	m_iLength(0)
+	{
+		if (m_iCapacity > 0) {
+			m_pBuffer[0] = '\0';
+		}
+	}
+
+	/*! \brief Function to append one printf formatted line.
+	*/
+	template <typename... Args>
+	void Append(const char* sFormat, Args... args) {
+		char sLine[256];
+		int iWritten = std::snprintf(sLine, sizeof(sLine), sFormat, args...);
+		if (iWritten <= 0) {
+			return;
+		}
+		std::size_t iLineLength = (std::size_t)iWritten < sizeof(sLine) ? (std::size_t)iWritten : sizeof(sLine) - 1;
+		for (std::size_t i = 0;i < iLineLength;i++, m_iLength++) {
+			if (m_iLength + 1 < m_iCapacity) {
+				m_pBuffer[m_iLength] = sLine[i];
+				m_pBuffer[m_iLength + 1] = '\0';
+			}
+		}
+	}
+
+	/*! \brief Function to get the full length of the appended text.
+	*/
+	std::size_t GetLength() const { return m_iLength; }
+
+private:
+	char* m_pBuffer;			/*!<Output buffer.*/
+	std::size_t m_iCapacity;	/*!<Output buffer size.*/
+	std::size_t m_iLength;		/*!<Full length of the appended text.*/
+};
+
+std::size_t CSpliceMetrics::RenderPrometheus(char* pBuffer, const std::size_t& iCapacity) const {
+	CTextSink objSink(pBuffer, iCapacity);
+
+	objSink.Append("# HELP scte35_cues_parsed_total Successfully parsed splice_info_section by splice_command_type.\n");
+	objSink.Append("# TYPE scte35_cues_parsed_total counter\n");
+	for (uint32_t i = 0;i < 256;i++) {
+		uint64_t uValue = GetParsed(i);
+		if (uValue != 0) {
+			objSink.Append("scte35_cues_parsed_total{splice_command_type=\"%u\"} %llu\n", i, (unsigned long long)uValue);
+		}
+	}
+
+	objSink.Append("# HELP scte35_descriptors_parsed_total Parsed splice descriptors by splice_descriptor_tag.\n");
+	objSink.Append("# TYPE scte35_descriptors_parsed_total counter\n");
+	for (uint32_t i = 0;i < 256;i++) {
+		uint64_t uValue = GetDescriptors(i);
+		if (uValue != 0) {
+			objSink.Append("scte35_descriptors_parsed_total{splice_descriptor_tag=\"%u\"} %llu\n", i, (unsigned long long)uValue);
+		}
+	}
+
+	objSink.Append("# HELP scte35_parse_failures_total Failed parses by reason and structure.\n");
+	objSink.Append("# TYPE scte35_parse_failures_total counter\n");
+	for (int e = 0;e < scte35Error::count;e++) {
+		for (int f = 0;f < scte35Field::count;f++) {
+			uint64_t uValue = GetFailures((scte35Error::type)e, (scte35Field::type)f);
+			if (uValue != 0) {
+				objSink.Append("scte35_parse_failures_total{reason=\"%s\",field=\"%s\"} %llu\n", GetErrorName((scte35Error::type)e), GetFieldName((scte35Field::type)f), (unsigned long long)uValue);
+			}
+		}
+	}
+
+	objSink.Append("# HELP scte35_crc_mismatches_total Parsed splice_info_section whose CRC_32 does not match.\n");
+	objSink.Append("# TYPE scte35_crc_mismatches_total counter\n");
+	objSink.Append("scte35_crc_mismatches_total %llu\n", (unsigned long long)GetCRCMismatches());
+
+	objSink.Append("# HELP scte35_unsupported_descriptors_total Skipped splice descriptors by splice_descriptor_tag.\n");
+	objSink.Append("# TYPE scte35_unsupported_descriptors_total counter\n");
+	for (uint32_t i = 0;i < 256;i++) {
+		uint64_t uValue = GetUnsupportedDescriptors(i);
+		if (uValue != 0) {
+			objSink.Append("scte35_unsupported_descriptors_total{splice_descriptor_tag=\"%u\"} %llu\n", i, (unsigned long long)uValue);
+		}
+	}
+
+	return objSink.GetLength();
+}
+
+std::string CSpliceMetrics::GetPrometheusText() const {
+	std::size_t iLength = RenderPrometheus(nullptr, 0);
+	std::vector<char> vBuffer(iLength + 1);
+	RenderPrometheus(vBuffer.data(), vBuffer.size());
+	return std::string(vBuffer.data(), iLength);
+}
+
+};
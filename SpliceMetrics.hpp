@@ -0,0 +1,133 @@
+/*! \file SpliceMetrics.hpp
+*	\brief Splice parse outcome metrics class declaration.
+*	\details Header file for declaration of class CSpliceMetrics whose definition is in SpliceMetrics.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEMETRICS_HPP_
+/*! \brief SpliceMetrics.hpp header guard define.
+*/
+#define _SPLICEMETRICS_HPP_
+
+#include "SpliceClass.hpp"
+#include <atomic>
+#include <memory>
+#include <string>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CSpliceMetrics
+*	\brief #CSpliceMetrics class counting parse outcomes of any number of #CSpliceClass objects.
+*
+*	Attach with CSpliceClass::SetMetrics. The counters are relaxed atomics spread over shards (one cache line aligned block each) so that parsers
+*	running on different cores do not write the same cache lines. A thread uses the shard given by #SetThreadShard (e.g. its core index) or
+*	else a shard assigned round-robin on its first count. Reading and rendering sum all the shards.
+*/
+class CSpliceMetrics {
+public:
+	/*! \brief #CSpliceMetrics class constructor.
+	*	\param iShardCount number of counter shards, 0 for one per hardware thread.
+	*/
+	explicit CSpliceMetrics(const std::size_t& iShardCount = 0);
+
+	/*!	\brief Deleted copy constructor so #CSpliceMetrics class object cannot be copied.
+	*/
+	CSpliceMetrics(const CSpliceMetrics&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceMetrics class object cannot be assigned.
+	*/
+	void operator=(const CSpliceMetrics&) = delete;
+
+	/*! \brief Function to choose the shard used by the calling thread, typically the index of the core it is pinned to.
+	*	\param iShard shard index (taken modulo the shard count of each metrics object).
+	*/
+	static void SetThreadShard(const std::size_t& iShard);
+
+	/*! \brief Function to count a successfully parsed section.
+	*	\param uCommandType splice_command_type of the section.
+	*/
+	void AddParsed(const uint32_t& uCommandType);
+	/*! \brief Function to count a parsed descriptor of a successfully parsed section.
+	*	\param uDescriptorTag splice_descriptor_tag of the descriptor.
+	*/
+	void AddDescriptor(const uint32_t& uDescriptorTag);
+	/*! \brief Function to count a failed parse.
+	*	\param eError reason of the failure.
+	*	\param eField structure in which the failure happened.
+	*/
+	void AddFailure(const scte35Error::type& eError, const scte35Field::type& eField);
+	/*! \brief Function to count a parsed section whose CRC_32 does not match its content.
+	*/
+	void AddCRCMismatch();
+	/*! \brief Function to count a descriptor of a successfully parsed section kept raw because no parser or decoder handles it.
+	*	\param uDescriptorTag splice_descriptor_tag of the descriptor.
+	*/
+	void AddUnsupportedDescriptor(const uint32_t& uDescriptorTag);
+
+	/*! \brief Function to get the number of parsed sections of a splice_command_type.
+	*/
+	uint64_t GetParsed(const uint32_t& uCommandType) const;
+	/*! \brief Function to get the number of parsed descriptors of a splice_descriptor_tag.
+	*/
+	uint64_t GetDescriptors(const uint32_t& uDescriptorTag) const;
+	/*! \brief Function to get the number of failures of a reason in a structure.
+	*/
+	uint64_t GetFailures(const scte35Error::type& eError, const scte35Field::type& eField) const;
+	/*! \brief Function to get the number of CRC_32 mismatches.
+	*/
+	uint64_t GetCRCMismatches() const;
+	/*! \brief Function to get the number of skipped descriptors of a splice_descriptor_tag.
+	*/
+	uint64_t GetUnsupportedDescriptors(const uint32_t& uDescriptorTag) const;
+
+	/*! \brief Function to render all the counters in the Prometheus text exposition format.
+	*
+	*	Counters with labels are only written when not zero. Like snprintf the output is truncated to iCapacity - 1 characters and always terminated.
+	*	\param pBuffer output buffer (may be nullptr if iCapacity is 0).
+	*	\param iCapacity size of pBuffer in bytes.
+	*	\returns number of characters of the full rendering (excluding the terminating null), larger or equal to iCapacity if truncated.
+	*/
+	std::size_t RenderPrometheus(char* pBuffer, const std::size_t& iCapacity) const;
+	/*! \brief Function to render all the counters in the Prometheus text exposition format.
+	*	\returns rendered text.
+	*/
+	std::string GetPrometheusText() const;
+
+	/*! \brief Function to reset all the counters to zero.
+	*/
+	void ResetValue();
+
+	/*! \brief Function to get the label value of a failure reason.
+	*/
+	static const char* GetErrorName(const scte35Error::type& eError);
+	/*! \brief Function to get the label value of a structure.
+	*/
+	static const char* GetFieldName(const scte35Field::type& eField);
+
+private:
+	/*!	\struct SMetricsShard
+	*	\brief #SMetricsShard structure holding one shard of all the counters.
+	*/
+	struct alignas(64) SMetricsShard {
+		std::atomic<uint64_t> parsed[256];											/*!<Parsed sections per splice_command_type.*/
+		std::atomic<uint64_t> descriptors[256];										/*!<Parsed descriptors per splice_descriptor_tag.*/
+		std::atomic<uint64_t> unsupported[256];										/*!<Skipped descriptors per splice_descriptor_tag.*/
+		std::atomic<uint64_t> failures[scte35Error::count][scte35Field::count];	/*!<Failures per reason and structure.*/
+		std::atomic<uint64_t> crc_mismatch;											/*!<CRC_32 mismatches.*/
+	};
+
+	/*! \brief Function to get the shard of the calling thread.
+	*/
+	SMetricsShard& GetLocalShard();
+
+	std::size_t m_iShardCount;						/*!<Number of shards.*/
+	std::unique_ptr<SMetricsShard[]> m_pShards;		/*!<Shards.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,522 @@
+/*! \file SplicePipeline.cpp
+*	\brief Splice multi-stage ingest pipeline class definition.
+*	\details CPP file for definition of class CSplicePipeline whose declaration is in SplicePipeline.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SplicePipeline.hpp"
+#include "SpliceProjection.hpp"
+#include <algorithm>	//for std::min
+#include <chrono>
+#if defined(__linux__)
+#include <pthread.h>	//for pthread_setaffinity_np
+#include <sched.h>		//for cpu_set_t
+#endif
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Size of a transport stream packet.
+*/
+static const std::size_t iTSPacketBytes = 188;
+/*! \brief Largest section a PID buffer keeps (section_length is 12 bits).
+*/
+static const std::size_t iMaxSectionBytes = 3 + 4095;
+
+/*! \brief Function to get the steady clock time in nanoseconds.
+*/
+static uint64_t GetNow() {
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*! \brief Function to raise an atomic maximum.
+*/
+template <typename T>
+static void RaiseMax(std::atomic<T>& objMax, const T& objValue) {
+	T objCurrent = objMax.load(std::memory_order_relaxed);
+	while (objCurrent < objValue && !objMax.compare_exchange_weak(objCurrent, objValue, std::memory_order_relaxed)) {
+	}
+}
+
+/*! \brief Function to get the number of events a pipeline preallocates: enough to fill every queue while each stage thread holds one,
+*	so only full queues hold back a stage.
+*/
+static std::size_t GetEventCount(const SPipelineConfig& objConfig) {
+	const std::size_t iWorkers = objConfig.iParseWorkers == 0 ? 1 : objConfig.iParseWorkers;
+	return (iWorkers + 2) * (SpliceQueueCapacity(objConfig.iQueueCapacity) + 1);
+}
+
+CSplicePipeline::CSplicePipeline(const SPipelineConfig& objConfig) :
+m_objConfig(objConfig),
+m_iEventCount(GetEventCount(objConfig)),
+m_pEvents(new SPipelineEvent[m_iEventCount]),
+m_objFree(m_iEventCount),
+m_vParseQueues(),
+m_objEnrichQueue(objConfig.iQueueCapacity),
+m_objOutputQueue(objConfig.iQueueCapacity),
+m_pCounters(new SStageCounters[scte35PipelineStage::count]),
+m_vParseThreads(),
+m_objEnrichThread(),
+m_objOutputThread(),
+m_bRunning(false),
+m_mSections(),
+m_vSinks(),
+m_pEnricher(nullptr),
+m_pMetrics(nullptr),
+m_uSequence(0),
+m_iNextWorker(0)
+{
+	if (m_objConfig.iParseWorkers == 0) {
+		m_objConfig.iParseWorkers = 1;
+	}
+	for (std::size_t i = 0;i < m_objConfig.iParseWorkers;i++) {
+		m_vParseQueues.emplace_back(new CSpliceSPSCQueue<SPipelineEvent*>(m_objConfig.iQueueCapacity));
+	}
+
+	for (std::size_t i = 0;i < m_iEventCount;i++) {
+		SPipelineEvent* pEvent = &m_pEvents[i];
+		m_objFree.TryPush(pEvent);
+	}
+
+	for (int i = 0;i < scte35PipelineStage::count;i++) {
+		SStageCounters& objCounters = m_pCounters[i];
+		objCounters.uProcessed.store(0, std::memory_order_relaxed);
+		objCounters.uDropped.store(0, std::memory_order_relaxed);
+		objCounters.uFailed.store(0, std::memory_order_relaxed);
+		objCounters.iHighWater.store(0, std::memory_order_relaxed);
+		objCounters.uLatencyTotal.store(0, std::memory_order_relaxed);
+		objCounters.uLatencyMax.store(0, std::memory_order_relaxed);
+		m_bStop[i].store(false, std::memory_order_relaxed);
+	}
+}
+
+CSplicePipeline::~CSplicePipeline() {
+	Stop();
+}
+
+void CSplicePipeline::AddSink(CSpliceSink* pSink) {
+	if (pSink != nullptr && !m_bRunning) {
+		m_vSinks.push_back(pSink);
+	}
+}
+
+void CSplicePipeline::AddPID(const uint32_t& uPID) {
+	bool bInserted = false;
+	SSectionBuffer& objBuffer = m_mSections.Insert(uPID & 0x1FFF, bInserted);
+	if (bInserted || !objBuffer.bActive) {
+		objBuffer.vBytes.clear();
+		objBuffer.iContinuity = -1;
+		objBuffer.bActive = true;
+	}
+}
+
+void CSplicePipeline::RemovePID(const uint32_t& uPID) {
+	//Kept in the map so the buffer capacity is reused if the PID comes back
+	SSectionBuffer* pBuffer = m_mSections.Find(uPID & 0x1FFF);
+	if (pBuffer != nullptr) {
+		pBuffer->bActive = false;
+		pBuffer->vBytes.clear();
+	}
+}
+
+bool CSplicePipeline::Start() {
+	if (m_bRunning) {
+		return false;
+	}
+
+	for (std::size_t i = 0;i < m_iEventCount;i++) {
+		m_pEvents[i].objSplice.SetMetrics(m_pMetrics);
+	}
+	for (int i = 0;i < scte35PipelineStage::count;i++) {
+		m_bStop[i].store(false, std::memory_order_relaxed);
+	}
+
+	m_bRunning = true;
+	for (std::size_t i = 0;i < m_vParseQueues.size();i++) {
+		m_vParseThreads.emplace_back(&CSplicePipeline::ParseLoop, this, i);
+	}
+	m_objEnrichThread = std::thread(&CSplicePipeline::EnrichLoop, this);
+	m_objOutputThread = std::thread(&CSplicePipeline::OutputLoop, this);
+	return true;
+}
+
+void CSplicePipeline::Stop() {
+	if (!m_bRunning) {
+		return;
+	}
+
+	//Each stage drains its queue before exiting, and only stops once the stages feeding it have exited
+	m_bStop[scte35PipelineStage::parse].store(true, std::memory_order_release);
+	for (std::thread& objThread : m_vParseThreads) {
+		objThread.join();
+	}
+	m_vParseThreads.clear();
+	m_bStop[scte35PipelineStage::enrich].store(true, std::memory_order_release);
+	m_objEnrichThread.join();
+	m_bStop[scte35PipelineStage::output].store(true, std::memory_order_release);
+	m_objOutputThread.join();
+	m_bRunning = false;
+}
+
+SPipelineEvent* CSplicePipeline::AcquireEvent() {
+	SPipelineEvent* pEvent = nullptr;
+	if (m_objFree.TryPop(pEvent)) {
+		return pEvent;
+	}
+
+	//Every event in flight means every queue is full, which is the same back-pressure as a full parse queue
+	if (m_objConfig.eDropPolicy != scte35DropPolicy::drop_newest) {
+		const uint64_t uDeadline = GetNow() + (uint64_t)m_objConfig.uBlockTimeoutUs * 1000;
+		CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+		while (!m_objFree.TryPop(pEvent)) {
+			if (m_objConfig.eDropPolicy == scte35DropPolicy::block_timeout && GetNow() >= uDeadline) {
+				break;
+			}
+			objBackoff.Wait();
+		}
+	}
+	if (pEvent == nullptr) {
+		m_pCounters[scte35PipelineStage::demux].uDropped.fetch_add(1, std::memory_order_relaxed);
+	}
+	return pEvent;
+}
+
+template <typename Q>
+bool CSplicePipeline::PushEvent(Q& objQueue, SPipelineEvent* pEvent, SStageCounters& objCounters) {
+	bool bQueued = objQueue.TryPush(pEvent);
+	if (!bQueued && m_objConfig.eDropPolicy != scte35DropPolicy::drop_newest) {
+		const uint64_t uDeadline = GetNow() + (uint64_t)m_objConfig.uBlockTimeoutUs * 1000;
+		CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+		while (!(bQueued = objQueue.TryPush(pEvent))) {
+			if (m_objConfig.eDropPolicy == scte35DropPolicy::block_timeout && GetNow() >= uDeadline) {
+				break;
+			}
+			objBackoff.Wait();
+		}
+	}
+
+	if (!bQueued) {
+		objCounters.uDropped.fetch_add(1, std::memory_order_relaxed);
+		m_objFree.TryPush(pEvent);
+		return false;
+	}
+	RaiseMax(objCounters.iHighWater, objQueue.GetSize());
+	return true;
+}
+
+bool CSplicePipeline::SubmitSection(const uint32_t& uPID, const uint8_t* pData, const std::size_t& iLength) {
+	if (!m_bRunning || pData == nullptr || iLength == 0) {
+		return false;
+	}
+	m_pCounters[scte35PipelineStage::demux].uProcessed.fetch_add(1, std::memory_order_relaxed);
+
+	SPipelineEvent* pEvent = AcquireEvent();
+	if (pEvent == nullptr) {
+		return false;
+	}
+	pEvent->uSequence = m_uSequence++;
+	pEvent->uPID = uPID;
+	pEvent->uCaptureTime = GetNow();
+	pEvent->vSection.assign(pData, pData + iLength);
+	pEvent->bParsed = false;
+	pEvent->uUser = 0;
+
+	std::size_t iWorker = 0;
+	const std::size_t iWorkers = m_vParseQueues.size();
+	if (m_objConfig.bPIDAffinity) {
+		iWorker = (std::size_t)((uPID * 0x9E3779B1u) >> 16) % iWorkers;
+	}
+	else {
+		//Least loaded worker, the search starts after the last choice so equal depths rotate
+		std::size_t iBest = (std::size_t)-1;
+		for (std::size_t i = 0;i < iWorkers;i++) {
+			const std::size_t iCandidate = (m_iNextWorker + i) % iWorkers;
+			const std::size_t iDepth = m_vParseQueues[iCandidate]->GetSize();
+			if (iDepth < iBest) {
+				iBest = iDepth;
+				iWorker = iCandidate;
+			}
+		}
+		m_iNextWorker = iWorker + 1;
+	}
+	return PushEvent(*m_vParseQueues[iWorker], pEvent, m_pCounters[scte35PipelineStage::parse]);
+}
+
+std::size_t CSplicePipeline::SubmitPackets(const uint8_t* pData, const std::size_t& iLength) {
+	std::size_t iSections = 0;
+	if (!m_bRunning || pData == nullptr) {
+		return iSections;
+	}
+
+	SStageCounters& objCounters = m_pCounters[scte35PipelineStage::demux];
+	for (std::size_t iPos = 0;iPos + iTSPacketBytes <= iLength;iPos += iTSPacketBytes) {
+		const uint8_t* pPacket = pData + iPos;
+		const uint32_t uPID = ((uint32_t)(pPacket[1] & 0x1F) << 8) | pPacket[2];
+		SSectionBuffer* pBuffer = m_mSections.Find(uPID);
+		if (pBuffer == nullptr || !pBuffer->bActive) {
+			continue;
+		}
+		//sync_byte and transport_error_indicator
+		if (pPacket[0] != 0x47 || (pPacket[1] & 0x80) != 0) {
+			objCounters.uFailed.fetch_add(1, std::memory_order_relaxed);
+			pBuffer->vBytes.clear();
+			continue;
+		}
+
+		const uint32_t uAdaptation = (pPacket[3] >> 4) & 0x3;
+		const int iContinuity = pPacket[3] & 0xF;
+		if ((uAdaptation & 0x1) == 0) {
+			continue;
+		}
+		if (pBuffer->iContinuity >= 0) {
+			if (iContinuity == pBuffer->iContinuity) {
+				//Duplicate packet
+				continue;
+			}
+			if (iContinuity != ((pBuffer->iContinuity + 1) & 0xF)) {
+				objCounters.uFailed.fetch_add(1, std::memory_order_relaxed);
+				pBuffer->vBytes.clear();
+			}
+		}
+		pBuffer->iContinuity = iContinuity;
+
+		std::size_t iPayload = 4;
+		if (uAdaptation & 0x2) {
+			iPayload += 1 + pPacket[4];
+		}
+		if (iPayload >= iTSPacketBytes) {
+			objCounters.uFailed.fetch_add(1, std::memory_order_relaxed);
+			continue;
+		}
+		iSections += DemuxPayload(uPID, *pBuffer, pPacket + iPayload, iTSPacketBytes - iPayload, (pPacket[1] & 0x40) != 0);
+	}
+	return iSections;
+}
+
+std::size_t CSplicePipeline::DemuxPayload(const uint32_t& uPID, SSectionBuffer& objBuffer, const uint8_t* pPayload, const std::size_t& iLength, const bool& bUnitStart) {
+	std::size_t iSections = 0;
+	if (!bUnitStart) {
+		//Continuation, only meaningful while a section is open
+		if (!objBuffer.vBytes.empty()) {
+			objBuffer.vBytes.insert(objBuffer.vBytes.end(), pPayload, pPayload + iLength);
+			iSections += FlushSections(uPID, objBuffer);
+		}
+		return iSections;
+	}
+
+	const std::size_t iPointer = pPayload[0];
+	if (1 + iPointer > iLength) {
+		m_pCounters[scte35PipelineStage::demux].uFailed.fetch_add(1, std::memory_order_relaxed);
+		objBuffer.vBytes.clear();
+		return iSections;
+	}
+	//Bytes before pointer_field end the open section, what is left of it afterwards is incomplete
+	if (!objBuffer.vBytes.empty()) {
+		objBuffer.vBytes.insert(objBuffer.vBytes.end(), pPayload + 1, pPayload + 1 + iPointer);
+		iSections += FlushSections(uPID, objBuffer);
+		if (!objBuffer.vBytes.empty()) {
+			m_pCounters[scte35PipelineStage::demux].uFailed.fetch_add(1, std::memory_order_relaxed);
+			objBuffer.vBytes.clear();
+		}
+	}
+	objBuffer.vBytes.assign(pPayload + 1 + iPointer, pPayload + iLength);
+	iSections += FlushSections(uPID, objBuffer);
+	return iSections;
+}
+
+std::size_t CSplicePipeline::FlushSections(const uint32_t& uPID, SSectionBuffer& objBuffer) {
+	std::size_t iSections = 0;
+	std::size_t iPos = 0;
+	const std::vector<uint8_t>& vBytes = objBuffer.vBytes;
+	while (vBytes.size() - iPos >= 3) {
+		if (vBytes[iPos] == 0xFF) {
+			//Stuffing up to the end of the packet
+			iPos = vBytes.size();
+			break;
+		}
+		const std::size_t iSection = 3 + (((std::size_t)(vBytes[iPos + 1] & 0x0F) << 8) | vBytes[iPos + 2]);
+		if (vBytes.size() - iPos < iSection) {
+			break;
+		}
+		if (vBytes[iPos] == 0xFC && SubmitSection(uPID, &vBytes[iPos], iSection)) {
+			iSections++;
+		}
+		iPos += iSection;
+	}
+	objBuffer.vBytes.erase(objBuffer.vBytes.begin(), objBuffer.vBytes.begin() + iPos);
+	if (objBuffer.vBytes.size() > iMaxSectionBytes) {
+		objBuffer.vBytes.clear();
+	}
+	return iSections;
+}
+
+void CSplicePipeline::ParseLoop(const std::size_t& iWorker) {
+	if (iWorker < m_objConfig.vParseCores.size()) {
+		PinThread(m_objConfig.vParseCores[iWorker]);
+	}
+
+	CSpliceSPSCQueue<SPipelineEvent*>& objQueue = *m_vParseQueues[iWorker];
+	SStageCounters& objCounters = m_pCounters[scte35PipelineStage::parse];
+	CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+	bool bStopping = false;
+	for (;;) {
+		SPipelineEvent* pEvent = nullptr;
+		if (objQueue.TryPop(pEvent)) {
+			objBackoff.Reset();
+			//CSpliceClass has no byte entry point (its fast path reads the text, the general path expands it to bits), so the section is
+			//encoded once more here; sHexa keeps its capacity across events so this costs no allocation
+			CSpliceProjection::BytesToHexa(pEvent->vSection.data(), pEvent->vSection.size(), pEvent->sHexa);
+			pEvent->bParsed = pEvent->objSplice.ParseHexa(pEvent->sHexa);
+			objCounters.uProcessed.fetch_add(1, std::memory_order_relaxed);
+			if (!pEvent->bParsed) {
+				objCounters.uFailed.fetch_add(1, std::memory_order_relaxed);
+			}
+			PushEvent(m_objEnrichQueue, pEvent, m_pCounters[scte35PipelineStage::enrich]);
+			continue;
+		}
+		//One more poll after the stop request, pushes made before it may not have been visible to the failed pop
+		if (bStopping) {
+			break;
+		}
+		if (m_bStop[scte35PipelineStage::parse].load(std::memory_order_acquire)) {
+			bStopping = true;
+			continue;
+		}
+		objBackoff.Wait();
+	}
+}
+
+void CSplicePipeline::EnrichLoop() {
+	PinThread(m_objConfig.iEnrichCore);
+
+	SStageCounters& objCounters = m_pCounters[scte35PipelineStage::enrich];
+	CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+	bool bStopping = false;
+	for (;;) {
+		SPipelineEvent* pEvent = nullptr;
+		if (m_objEnrichQueue.TryPop(pEvent)) {
+			objBackoff.Reset();
+			objCounters.uProcessed.fetch_add(1, std::memory_order_relaxed);
+			if (m_pEnricher != nullptr && !m_pEnricher->Enrich(*pEvent)) {
+				objCounters.uFailed.fetch_add(1, std::memory_order_relaxed);
+				m_objFree.TryPush(pEvent);
+				continue;
+			}
+			PushEvent(m_objOutputQueue, pEvent, m_pCounters[scte35PipelineStage::output]);
+			continue;
+		}
+		if (bStopping) {
+			break;
+		}
+		if (m_bStop[scte35PipelineStage::enrich].load(std::memory_order_acquire)) {
+			bStopping = true;
+			continue;
+		}
+		objBackoff.Wait();
+	}
+}
+
+void CSplicePipeline::OutputLoop() {
+	PinThread(m_objConfig.iOutputCore);
+
+	SStageCounters& objCounters = m_pCounters[scte35PipelineStage::output];
+	CSpliceBackoff objBackoff(m_objConfig.uIdleSleepUs);
+	bool bStopping = false;
+	for (;;) {
+		SPipelineEvent* pEvent = nullptr;
+		if (m_objOutputQueue.TryPop(pEvent)) {
+			objBackoff.Reset();
+			for (CSpliceSink* pSink : m_vSinks) {
+				pSink->Consume(*pEvent);
+			}
+			const uint64_t uLatency = GetNow() - pEvent->uCaptureTime;
+			objCounters.uLatencyTotal.fetch_add(uLatency, std::memory_order_relaxed);
+			RaiseMax(objCounters.uLatencyMax, uLatency);
+			objCounters.uProcessed.fetch_add(1, std::memory_order_relaxed);
+			m_objFree.TryPush(pEvent);
+			continue;
+		}
+		if (objBackoff.IsReset()) {
+			for (CSpliceSink* pSink : m_vSinks) {
+				pSink->Flush();
+			}
+		}
+		if (bStopping) {
+			break;
+		}
+		if (m_bStop[scte35PipelineStage::output].load(std::memory_order_acquire)) {
+			bStopping = true;
+			continue;
+		}
+		objBackoff.Wait();
+	}
+}
+
+SPipelineStageStats CSplicePipeline::GetStageStats(const scte35PipelineStage::type& eStage) const {
+	SPipelineStageStats objStats;
+	if (eStage < 0 || eStage >= scte35PipelineStage::count) {
+		return objStats;
+	}
+
+	const SStageCounters& objCounters = m_pCounters[eStage];
+	objStats.uProcessed = objCounters.uProcessed.load(std::memory_order_relaxed);
+	objStats.uDropped = objCounters.uDropped.load(std::memory_order_relaxed);
+	objStats.uFailed = objCounters.uFailed.load(std::memory_order_relaxed);
+	objStats.iQueueHighWater = objCounters.iHighWater.load(std::memory_order_relaxed);
+	objStats.uLatencyTotal = objCounters.uLatencyTotal.load(std::memory_order_relaxed);
+	objStats.uLatencyMax = objCounters.uLatencyMax.load(std::memory_order_relaxed);
+	switch (eStage) {
+		case scte35PipelineStage::demux:
+			//The demux has no input queue, its depth is the number of events in flight out of the pool
+			objStats.iQueueCapacity = m_iEventCount;
+			objStats.iQueueDepth = m_iEventCount - std::min(m_iEventCount, m_objFree.GetSize());
+			break;
+		case scte35PipelineStage::parse:
+			for (const std::unique_ptr<CSpliceSPSCQueue<SPipelineEvent*>>& pQueue : m_vParseQueues) {
+				objStats.iQueueCapacity += pQueue->GetCapacity();
+				objStats.iQueueDepth += pQueue->GetSize();
+			}
+			break;
+		case scte35PipelineStage::enrich:
+			objStats.iQueueCapacity = m_objEnrichQueue.GetCapacity();
+			objStats.iQueueDepth = m_objEnrichQueue.GetSize();
+			break;
+		default:
+			objStats.iQueueCapacity = m_objOutputQueue.GetCapacity();
+			objStats.iQueueDepth = m_objOutputQueue.GetSize();
+			break;
+	}
+	return objStats;
+}
+
+const char* CSplicePipeline::GetStageName(const scte35PipelineStage::type& eStage) {
+	switch (eStage) {
+		case scte35PipelineStage::demux: return "demux";
+		case scte35PipelineStage::parse: return "parse";
+		case scte35PipelineStage::enrich: return "enrich";
+		case scte35PipelineStage::output: return "output";
+		default: return "unknown";
+	}
+}
+
+bool CSplicePipeline::PinThread(const int& iCore) {
+	if (iCore < 0) {
+		return false;
+	}
+#if defined(__linux__)
+	if (iCore >= CPU_SETSIZE) {
+		return false;
+	}
+	cpu_set_t objSet;
+	CPU_ZERO(&objSet);
+	CPU_SET(iCore, &objSet);
+	return pthread_setaffinity_np(pthread_self(), sizeof(objSet), &objSet) == 0;
+#else
+	return false;
+#endif
+}
+
+};
@@ -0,0 +1,352 @@
+/*! \file SplicePipeline.hpp
+*	\brief Splice multi-stage ingest pipeline classes declaration.
+*	\details Header file for declaration of classes SPipelineEvent, CSpliceEnricher, CSpliceSink, SPipelineConfig, SPipelineStageStats and
+*	CSplicePipeline whose definition is in SplicePipeline.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEPIPELINE_HPP_
+/*! \brief SplicePipeline.hpp header guard define.
+*/
+#define _SPLICEPIPELINE_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include "SpliceQueue.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35PipelineStage
+*	\brief scte35PipelineStage structure to hold the stages of #CSplicePipeline.
+*/
+struct scte35PipelineStage {
+	/*!
+	*	\brief A type definition for type (Pipeline stages)
+	*/
+	typedef enum {
+		demux = 0,		/*!<Capture and demux, runs on the thread calling the Submit functions*/
+		parse = 1,		/*!<Pool of parse workers*/
+		enrich = 2,		/*!<Enrichment thread*/
+		output = 3,		/*!<Output thread calling the sinks*/
+		count = 4		/*!<Number of stages*/
+	}type;
+};
+
+/*! \struct scte35DropPolicy
+*	\brief scte35DropPolicy structure to hold what a stage does when the queue of the next stage is full.
+*/
+struct scte35DropPolicy {
+	/*!
+	*	\brief A type definition for type (Drop policies)
+	*/
+	typedef enum {
+		block = 0,			/*!<Wait for room, back-pressure reaches the capture thread and nothing is dropped*/
+		drop_newest = 1,	/*!<Drop the event which does not fit at once*/
+		block_timeout = 2	/*!<Wait for room up to SPipelineConfig::uBlockTimeoutUs then drop the event*/
+	}type;
+};
+
+/*!	\class SPipelineEvent
+*	\brief #SPipelineEvent class holding one section travelling through #CSplicePipeline.
+*
+*	Events are preallocated by the pipeline and recycled after the output stage, so the buffers and the parser of an event keep their capacity.
+*/
+class SPipelineEvent {
+public:
+	uint64_t uSequence;					/*!<Submission order over all PIDs.*/
+	uint32_t uPID;						/*!<PID (or any channel number given to CSplicePipeline::SubmitSection).*/
+	uint64_t uCaptureTime;				/*!<Submission time, steady clock nanoseconds.*/
+	std::vector<uint8_t> vSection;		/*!<Section bytes starting with table_id.*/
+	std::string sHexa;					/*!<Hexa-decimal text of vSection given to the parser, which only reads text (no byte entry point).*/
+	CSpliceClass objSplice;				/*!<Parsed cue, valid when bParsed.*/
+	bool bParsed;						/*!<Whether objSplice holds a successful parse.*/
+	uint64_t uUser;						/*!<Free for the enricher.*/
+
+	/*! \brief #SPipelineEvent class default constructor with intializer list.
+	*/
+	SPipelineEvent() :
+	 uSequence(PARAMETER_DEF_VAL),
+	 uPID(PARAMETER_DEF_VAL),
+	 uCaptureTime(PARAMETER_DEF_VAL),
+	 vSection(),
+	 sHexa(),
+	 objSplice(),
+	 bParsed(false),
+	 uUser(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSpliceEnricher
+*	\brief #CSpliceEnricher class is the interface of the enrichment stage (channel lookup, timeline placement, tagging...).
+*/
+class CSpliceEnricher {
+public:
+	/*! \brief #CSpliceEnricher class destructor.
+	*/
+	virtual ~CSpliceEnricher() {}
+
+	/*! \brief Function called on the enrichment thread for every event, in submission order per PID when SPipelineConfig::bPIDAffinity is set.
+	*	\param objEvent event to enrich (failed parses too, see SPipelineEvent::bParsed).
+	*	\returns true to pass the event to the sinks and false to drop it.
+	*/
+	virtual bool Enrich(SPipelineEvent& objEvent) = 0;
+};
+
+/*!	\class CSpliceSink
+*	\brief #CSpliceSink class is the interface of an output of #CSplicePipeline.
+*/
+class CSpliceSink {
+public:
+	/*! \brief #CSpliceSink class destructor.
+	*/
+	virtual ~CSpliceSink() {}
+
+	/*! \brief Function called on the output thread for every event, the event is recycled when it returns.
+	*/
+	virtual void Consume(const SPipelineEvent& objEvent) = 0;
+
+	/*! \brief Function called on the output thread when it has no event to consume, e.g. to flush buffered writes.
+	*/
+	virtual void Flush() {}
+};
+
+/*!	\class SPipelineConfig
+*	\brief #SPipelineConfig class holding the settings of #CSplicePipeline.
+*/
+class SPipelineConfig {
+public:
+	std::size_t iParseWorkers;				/*!<Number of parse worker threads (0 is taken as 1).*/
+	std::size_t iQueueCapacity;				/*!<Capacity of each queue, rounded up to a power of two.*/
+	scte35DropPolicy::type eDropPolicy;		/*!<What a stage does when the next queue (or the event pool) is full.*/
+	uint32_t uBlockTimeoutUs;				/*!<Longest wait of scte35DropPolicy::block_timeout in microseconds.*/
+	uint32_t uIdleSleepUs;					/*!<Sleep of an idle stage after spinning and yielding, bounds the wake-up latency.*/
+	bool bPIDAffinity;						/*!<Send all the sections of a PID to the same worker, keeping their order, instead of the least loaded one.*/
+	std::vector<int> vParseCores;			/*!<Core of each parse worker, missing or negative entries are not pinned.*/
+	int iEnrichCore;						/*!<Core of the enrichment thread, negative for none.*/
+	int iOutputCore;						/*!<Core of the output thread, negative for none.*/
+
+	/*! \brief #SPipelineConfig class default constructor with intializer list.
+	*/
+	SPipelineConfig() :
+	 iParseWorkers(2),
+	 iQueueCapacity(1024),
+	 eDropPolicy(scte35DropPolicy::block),
+	 uBlockTimeoutUs(1000),
+	 uIdleSleepUs(50),
+	 bPIDAffinity(true),
+	 vParseCores(),
+	 iEnrichCore(-1),
+	 iOutputCore(-1)
+	{
+	}
+};
+
+/*!	\class SPipelineStageStats
+*	\brief #SPipelineStageStats class holding the counters of one stage of #CSplicePipeline.
+*/
+class SPipelineStageStats {
+public:
+	uint64_t uProcessed;			/*!<Events handled by the stage (sections submitted for scte35PipelineStage::demux).*/
+	uint64_t uDropped;				/*!<Events dropped because the input queue of the stage (or the event pool for demux) was full.*/
+	uint64_t uFailed;				/*!<Parse failures (parse), events rejected by the enricher (enrich), TS errors (demux).*/
+	std::size_t iQueueDepth;		/*!<Events waiting in the input queue(s) of the stage now (events in flight for scte35PipelineStage::demux).*/
+	std::size_t iQueueHighWater;	/*!<Highest depth seen by a producer of the input queue(s) of the stage.*/
+	std::size_t iQueueCapacity;		/*!<Capacity of the input queue(s) of the stage (event pool size for scte35PipelineStage::demux).*/
+	uint64_t uLatencyTotal;			/*!<Sum of capture to sink times in nanoseconds (output only).*/
+	uint64_t uLatencyMax;			/*!<Largest capture to sink time in nanoseconds (output only).*/
+
+	/*! \brief #SPipelineStageStats class default constructor with intializer list.
+	*/
+	SPipelineStageStats() :
+	 uProcessed(0),
+	 uDropped(0),
+	 uFailed(0),
+	 iQueueDepth(0),
+	 iQueueHighWater(0),
+	 iQueueCapacity(0),
+	 uLatencyTotal(0),
+	 uLatencyMax(0)
+	{
+	}
+};
+
+/*!	\class CSplicePipeline
+*	\brief #CSplicePipeline class running SCTE-35 ingest as stages connected by bounded lock-free queues: demux -> parse -> enrich -> output.
+*
+*	The thread calling #SubmitPackets or #SubmitSection is the capture/demux stage (one thread only). Sections go through a
+*	#CSpliceSPSCQueue to one of the parse workers, then a #CSpliceMPSCQueue to the enrichment thread and a #CSpliceSPSCQueue to the
+*	output thread which calls the sinks. Events come from a preallocated pool, so steady state ingest neither locks nor allocates.
+*	When a queue is full the producing stage applies SPipelineConfig::eDropPolicy and counts the drop on the stage it could not reach.
+*/
+class CSplicePipeline {
+public:
+	/*! \brief #CSplicePipeline class constructor.
+	*	\param objConfig settings, fixed for the life of the object.
+	*/
+	explicit CSplicePipeline(const SPipelineConfig& objConfig);
+
+	/*! \brief #CSplicePipeline class destructor, stops the threads after draining the queues.
+	*/
+	~CSplicePipeline();
+
+	/*!	\brief Deleted copy constructor so #CSplicePipeline class object cannot be copied.
+	*/
+	CSplicePipeline(const CSplicePipeline&) = delete;
+	/*!	\brief Deleted assignment operator so #CSplicePipeline class object cannot be assigned.
+	*/
+	void operator=(const CSplicePipeline&) = delete;
+
+	/*! \brief Function to add a sink, before #Start only.
+	*	\param pSink sink (not owned, must outlive the pipeline).
+	*/
+	void AddSink(CSpliceSink* pSink);
+
+	/*! \brief Function to set the enricher, before #Start only.
+	*	\param pEnricher enricher (not owned, must outlive the pipeline) or nullptr to pass events straight to the sinks.
+	*/
+	void SetEnricher(CSpliceEnricher* pEnricher) { m_pEnricher = pEnricher; }
+
+	/*! \brief Function to attach metrics to the parsers of the workers, before #Start only.
+	*	\param pMetrics metrics object (not owned, must outlive the pipeline).
+	*/
+	void SetMetrics(CSpliceMetrics* pMetrics) { m_pMetrics = pMetrics; }
+
+	/*! \brief Function to add a PID carrying SCTE-35 sections to the demux of #SubmitPackets, from the capture thread.
+	*/
+	void AddPID(const uint32_t& uPID);
+
+	/*! \brief Function to remove a PID from the demux of #SubmitPackets, from the capture thread.
+	*/
+	void RemovePID(const uint32_t& uPID);
+
+	/*! \brief Function to start the stage threads.
+	*	\returns true if started and false if already running.
+	*/
+	bool Start();
+
+	/*! \brief Function to stop the stage threads once every queued event went through the sinks.
+	*/
+	void Stop();
+
+	/*! \brief Function to submit transport stream packets, from the capture thread.
+	*
+	*	Packets of the PIDs added with #AddPID are reassembled into sections (pointer_field, sections spanning packets, several sections in
+	*	a packet, continuity_counter checks) and each section with table_id 0xFC is submitted.
+	*	\param pData 188-byte packets.
+	*	\param iLength size of pData, a trailing partial packet is ignored.
+	*	\returns number of sections submitted (not dropped).
+	*/
+	std::size_t SubmitPackets(const uint8_t* pData, const std::size_t& iLength);
+
+	/*! \brief Function to submit one section, from the capture thread.
+	*	\param uPID PID or channel number of the section.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength size of pData.
+	*	\returns true if submitted and false if dropped or not running.
+	*/
+	bool SubmitSection(const uint32_t& uPID, const uint8_t* pData, const std::size_t& iLength);
+
+	/*! \brief Function to get the counters of a stage, callable from any thread while running.
+	*/
+	SPipelineStageStats GetStageStats(const scte35PipelineStage::type& eStage) const;
+
+	/*! \brief Function to get the name of a stage.
+	*/
+	static const char* GetStageName(const scte35PipelineStage::type& eStage);
+
+	/*! \brief Function to pin the calling thread to a core, e.g. the capture thread. Only implemented on Linux.
+	*	\param iCore core index, negative values do nothing.
+	*	\returns true if pinned.
+	*/
+	static bool PinThread(const int& iCore);
+
+private:
+	/*!	\struct SStageCounters
+	*	\brief #SStageCounters structure holding the counters of one stage on its own cache line.
+	*/
+	struct alignas(iSpliceCacheLine) SStageCounters {
+		std::atomic<uint64_t> uProcessed;			/*!<Handled events.*/
+		std::atomic<uint64_t> uDropped;				/*!<Events dropped before entering the stage.*/
+		std::atomic<uint64_t> uFailed;				/*!<Stage specific failures.*/
+		std::atomic<std::size_t> iHighWater;		/*!<Highest input queue depth.*/
+		std::atomic<uint64_t> uLatencyTotal;		/*!<Sum of capture to sink times.*/
+		std::atomic<uint64_t> uLatencyMax;			/*!<Largest capture to sink time.*/
+	};
+
+	/*!	\struct SSectionBuffer
+	*	\brief #SSectionBuffer structure holding the section being reassembled on one PID.
+	*/
+	struct SSectionBuffer {
+		std::vector<uint8_t> vBytes;	/*!<Bytes received so far.*/
+		int iContinuity;				/*!<Last continuity_counter, -1 before the first packet.*/
+		bool bActive;					/*!<Whether the PID is demuxed (false once removed).*/
+	};
+
+	/*! \brief Function to take an event from the pool applying the drop policy.
+	*	\returns event or nullptr if dropped.
+	*/
+	SPipelineEvent* AcquireEvent();
+
+	/*! \brief Function to push an event to a queue applying the drop policy, the event goes back to the pool if dropped.
+	*	\returns true if queued.
+	*/
+	template <typename Q>
+	bool PushEvent(Q& objQueue, SPipelineEvent* pEvent, SStageCounters& objCounters);
+
+	/*! \brief Function to reassemble the payload of one packet of a demuxed PID.
+	*	\returns number of sections submitted.
+	*/
+	std::size_t DemuxPayload(const uint32_t& uPID, SSectionBuffer& objBuffer, const uint8_t* pPayload, const std::size_t& iLength, const bool& bUnitStart);
+
+	/*! \brief Function to submit the complete sections at the front of a reassembly buffer.
+	*	\returns number of sections submitted.
+	*/
+	std::size_t FlushSections(const uint32_t& uPID, SSectionBuffer& objBuffer);
+
+	/*! \brief Function run by a parse worker thread.
+	*/
+	void ParseLoop(const std::size_t& iWorker);
+	/*! \brief Function run by the enrichment thread.
+	*/
+	void EnrichLoop();
+	/*! \brief Function run by the output thread.
+	*/
+	void OutputLoop();
+
+	SPipelineConfig m_objConfig;												/*!<Settings.*/
+	std::size_t m_iEventCount;													/*!<Number of preallocated events.*/
+	std::unique_ptr<SPipelineEvent[]> m_pEvents;								/*!<Preallocated events.*/
+	CSpliceMPSCQueue<SPipelineEvent*> m_objFree;								/*!<Events not in flight, pushed back by any stage.*/
+	std::vector<std::unique_ptr<CSpliceSPSCQueue<SPipelineEvent*>>> m_vParseQueues;	/*!<Input queue of each parse worker.*/
+	CSpliceMPSCQueue<SPipelineEvent*> m_objEnrichQueue;						/*!<Input queue of the enrichment thread.*/
+	CSpliceSPSCQueue<SPipelineEvent*> m_objOutputQueue;						/*!<Input queue of the output thread.*/
+	std::unique_ptr<SStageCounters[]> m_pCounters;							/*!<Counters of each stage.*/
+	std::vector<std::thread> m_vParseThreads;									/*!<Parse worker threads.*/
+	std::thread m_objEnrichThread;												/*!<Enrichment thread.*/
+	std::thread m_objOutputThread;												/*!<Output thread.*/
+	std::atomic<bool> m_bStop[scte35PipelineStage::count];								/*!<Stop request of each stage, set in stage order by #Stop.*/
+	bool m_bRunning;															/*!<Whether the threads run.*/
+	CSpliceHashMap<SSectionBuffer> m_mSections;								/*!<Reassembly buffers by PID.*/
+	std::vector<CSpliceSink*> m_vSinks;										/*!<Sinks, not owned.*/
+	CSpliceEnricher* m_pEnricher;												/*!<Enricher, not owned.*/
+	CSpliceMetrics* m_pMetrics;												/*!<Metrics of the worker parsers, not owned.*/
+	uint64_t m_uSequence;														/*!<Next submission sequence.*/
+	std::size_t m_iNextWorker;													/*!<Round-robin start of the least loaded worker search.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,125 @@
+/*! \file SpliceProfiler.cpp
+*	\brief Splice parse stage profiler class definition.
+*	\details CPP file for definition of classes CStageHistogram and CSpliceProfiler whose declaration is in SpliceProfiler.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceProfiler.hpp"
+#include <sstream>		//for std::stringstream
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const std::size_t CStageHistogram::iBucketCount;
+
+void CStageHistogram::ClearValues() {
+	for (std::size_t i = 0;i < iBucketCount;i++) {
+		uBuckets[i].store(0, std::memory_order_relaxed);
+	}
+	uCount.store(0, std::memory_order_relaxed);
+	uTotal.store(0, std::memory_order_relaxed);
+	uMin.store(UINT64_MAX, std::memory_order_relaxed);
+	uMax.store(0, std::memory_order_relaxed);
+}
+
+void CStageHistogram::Add(const uint64_t& uNanoSeconds) {
+	std::size_t iBucket = 0;
+	uint64_t uLocal = uNanoSeconds;
+	while (uLocal > 1 && iBucket < iBucketCount - 1) {
+		uLocal >>= 1;
+		iBucket++;
+	}
+	uBuckets[iBucket].fetch_add(1, std::memory_order_relaxed);
+
+	//compare_exchange_weak reloads the current value on failure
+	uint64_t uSeen = uMin.load(std::memory_order_relaxed);
+	while (uNanoSeconds < uSeen && !uMin.compare_exchange_weak(uSeen, uNanoSeconds, std::memory_order_relaxed)) {
+	}
+	uSeen = uMax.load(std::memory_order_relaxed);
+	while (uNanoSeconds > uSeen && !uMax.compare_exchange_weak(uSeen, uNanoSeconds, std::memory_order_relaxed)) {
+	}
+	uCount.fetch_add(1, std::memory_order_relaxed);
+	uTotal.fetch_add(uNanoSeconds, std::memory_order_relaxed);
+}
+
+uint64_t CStageHistogram::GetPercentile(const double& dPercentile) const {
+	const uint64_t uCountLocal = GetCount();
+	const uint64_t uMaxLocal = GetMax();
+	if (uCountLocal == 0) {
+		return 0;
+	}
+
+	uint64_t uRank = (uint64_t)((dPercentile / 100.0) * (double)uCountLocal);
+	if (uRank >= uCountLocal) {
+		uRank = uCountLocal - 1;
+	}
+
+	uint64_t uSeen = 0;
+	for (std::size_t i = 0;i < iBucketCount;i++) {
+		uSeen += GetBucket(i);
+		if (uSeen > uRank) {
+			uint64_t uUpper = ((uint64_t)1 << (i + 1)) - 1;
+			return uUpper < uMaxLocal ? uUpper : uMaxLocal;
+		}
+	}
+	return uMaxLocal;
+}
+
+void CSpliceProfiler::Record(const scte35Stage::type& eStage, const uint64_t& uNanoSeconds) {
+	if (eStage >= 0 && eStage < scte35Stage::count) {
+		m_Stages[eStage].Add(uNanoSeconds);
+	}
+}
+
+const CStageHistogram& CSpliceProfiler::GetStage(const scte35Stage::type& eStage) const {
+	if (eStage >= 0 && eStage < scte35Stage::count) {
+		return m_Stages[eStage];
+	}
+	static const CStageHistogram objEmpty;
+	return objEmpty;
+}
+
+const char* CSpliceProfiler::GetStageName(const scte35Stage::type& eStage) {
+	switch (eStage)
+	{
+		case scte35Stage::input_decode: return "input_decode";
+		case scte35Stage::sinfo_first: return "sinfo_first";
+		case scte35Stage::command_type: return "command_type";
+		case scte35Stage::sinfo_second: return "sinfo_second";
+		case scte35Stage::splice_descriptor: return "splice_descriptor";
+		case scte35Stage::text_generation: return "text_generation";
+		case scte35Stage::fast_path: return "fast_path";
+		default: return "unknown";
+	}
+}
+
+std::string CSpliceProfiler::GetText(const bool& bIfSingleLine) const {
+	std::stringstream sLocalStr;
+	std::string sSepLocal = ",\r\n";
+	if (bIfSingleLine) {
+		sSepLocal = ", ";
+	}
+
+	for (int i = 0;i < scte35Stage::count;i++) {
+		const CStageHistogram& objStage = m_Stages[i];
+		sLocalStr << "stage=" << GetStageName((scte35Stage::type)i) << sSepLocal;
+		sLocalStr << "count=" << objStage.GetCount() << sSepLocal;
+		sLocalStr << "mean_ns=" << (objStage.GetCount() == 0 ? 0 : objStage.GetTotal() / objStage.GetCount()) << sSepLocal;
+		sLocalStr << "p50_ns=" << objStage.GetPercentile(50.0) << sSepLocal;
+		sLocalStr << "p99_ns=" << objStage.GetPercentile(99.0) << sSepLocal;
+		sLocalStr << "max_ns=" << objStage.GetMax() << sSepLocal;
+	}
+
+	return sLocalStr.str();
+}
+
+void CSpliceProfiler::ResetValue() {
+	for (int i = 0;i < scte35Stage::count;i++) {
+		m_Stages[i].ClearValues();
+	}
+}
+
+};
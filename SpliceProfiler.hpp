@@ -0,0 +1,186 @@
+/*! \file SpliceProfiler.hpp
+*	\brief Splice parse stage profiler class declaration.
+*	\details Header file for declaration of classes CStageHistogram, CSpliceProfiler and CStageTimer whose definition is in SpliceProfiler.cpp.
+*	The stage timers are only compiled into CSpliceClass when SCTE35_ENABLE_PROFILING is defined (CMake option SCTE35_ENABLE_PROFILING).
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEPROFILER_HPP_
+/*! \brief SpliceProfiler.hpp header guard define.
+*/
+#define _SPLICEPROFILER_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <chrono>
+#include <atomic>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Stage
+*	\brief scte35Stage structure to hold the parse stage values which are timed by #CSpliceProfiler.
+*/
+struct scte35Stage {
+	/*!
+	*	\brief A type definition for type (Parse stages)
+	*/
+	typedef enum {
+		input_decode = 0,		/*!<Input decoding : HexaStr2BinaryStr and Base64ToHexa (one sample per decoding step)*/
+		sinfo_first = 1,		/*!<ParseSInfoDataFirst*/
+		command_type = 2,		/*!<Parse_Command_Type*/
+		sinfo_second = 3,		/*!<ParseSInfoDataSecond*/
+		splice_descriptor = 4,	/*!<Parse_Splice_Descriptor*/
+		text_generation = 5,	/*!<GetText*/
+		fast_path = 6,			/*!<ParseTimeSignalFast, one sample per attempt (a cue falling back to the general path also counts the stages above)*/
+		count = 7				/*!<Number of stages (not a stage)*/
+	}type;
+};
+
+/*!	\class CStageHistogram
+*	\brief #CStageHistogram class holding a base-2 logarithmic histogram of stage durations in nanoseconds.
+*
+*	Bucket i counts the samples in [2^i, 2^(i+1)) nanoseconds, bucket 0 also counts the 0 ns samples. The counters are relaxed atomics,
+*	so samples may be added from several threads at once (const CSpliceClass::GetText on a cue shared by #CSpliceCache); a reading
+*	taken while samples are added may mix samples before and after it.
+*/
+class CStageHistogram {
+public:
+	/*! \brief Number of histogram buckets (the last one is open ended, about 9 minutes and above).
+	*/
+	static const std::size_t iBucketCount = 40;
+
+	/*! \brief #CStageHistogram class default constructor.
+	*/
+	CStageHistogram() {
+		ClearValues();
+	}
+
+	/*! \brief Function to add one duration sample.
+	*	\param uNanoSeconds duration of the stage in nanoseconds.
+	*/
+	void Add(const uint64_t& uNanoSeconds);
+
+	/*! \brief Member function to clear or reset all the #CStageHistogram class parameters.
+	*/
+	void ClearValues();
+
+	/*! \brief Function to get the number of samples.
+	*/
+	uint64_t GetCount() const { return uCount.load(std::memory_order_relaxed); }
+	/*! \brief Function to get the sum of all samples in nanoseconds.
+	*/
+	uint64_t GetTotal() const { return uTotal.load(std::memory_order_relaxed); }
+	/*! \brief Function to get the smallest sample in nanoseconds (0 if no sample).
+	*/
+	uint64_t GetMin() const { return GetCount() == 0 ? 0 : uMin.load(std::memory_order_relaxed); }
+	/*! \brief Function to get the largest sample in nanoseconds.
+	*/
+	uint64_t GetMax() const { return uMax.load(std::memory_order_relaxed); }
+	/*! \brief Function to get the sample count of one bucket.
+	*	\param iBucket bucket index below #iBucketCount.
+	*/
+	uint64_t GetBucket(const std::size_t& iBucket) const { return iBucket < iBucketCount ? uBuckets[iBucket].load(std::memory_order_relaxed) : 0; }
+	/*! \brief Function to get the approximate percentile duration.
+	*	\param dPercentile percentile between 0 and 100.
+	*	\returns upper bound in nanoseconds of the bucket holding the percentile (capped to the largest sample).
+	*/
+	uint64_t GetPercentile(const double& dPercentile) const;
+
+private:
+	std::atomic<uint64_t> uBuckets[iBucketCount];	/*!<Sample count per bucket.*/
+	std::atomic<uint64_t> uCount;					/*!<Number of samples.*/
+	std::atomic<uint64_t> uTotal;					/*!<Sum of the samples in nanoseconds.*/
+	std::atomic<uint64_t> uMin;						/*!<Smallest sample in nanoseconds, UINT64_MAX before the first one.*/
+	std::atomic<uint64_t> uMax;						/*!<Largest sample in nanoseconds.*/
+};
+
+/*!	\class CSpliceProfiler
+*	\brief #CSpliceProfiler class holding one #CStageHistogram per parse stage.
+*/
+class CSpliceProfiler {
+public:
+	/*! \brief Function to add one duration sample to a stage.
+	*	\param eStage the timed stage.
+	*	\param uNanoSeconds duration of the stage in nanoseconds.
+	*/
+	void Record(const scte35Stage::type& eStage, const uint64_t& uNanoSeconds);
+
+	/*! \brief Function to get the histogram of a stage.
+	*	\param eStage the stage.
+	*	\returns histogram of the stage.
+	*/
+	const CStageHistogram& GetStage(const scte35Stage::type& eStage) const;
+
+	/*! \brief Function to get the textual name of a stage.
+	*	\param eStage the stage.
+	*	\returns stage name.
+	*/
+	static const char* GetStageName(const scte35Stage::type& eStage);
+
+	/*! \brief Function to get a summary of all the stages (count, mean, p50, p99 and max nanoseconds) as string textual data.
+	*	\param bIfSingleLine to whether get textual data in single-line or multi-line.
+	*	\returns stage summary textual data.
+	*/
+	std::string GetText(const bool& bIfSingleLine) const;
+
+	/*! \brief Function to reset all the stage histograms.
+	*/
+	void ResetValue();
+
+private:
+	CStageHistogram m_Stages[scte35Stage::count];	/*!<Histogram per stage.*/
+};
+
+/*!	\class CStageTimer
+*	\brief #CStageTimer class measuring the lifetime of a scope and recording it to a #CSpliceProfiler stage.
+*/
+class CStageTimer {
+public:
+	/*! \brief #CStageTimer class constructor, starts the clock.
+	*	\param objProfiler the profiler receiving the sample.
+	*	\param eStage the timed stage.
+	*/
+	CStageTimer(CSpliceProfiler& objProfiler, const scte35Stage::type& eStage) :
+	m_objProfiler(objProfiler),
+	m_eStage(eStage),
+	m_Start(std::chrono::steady_clock::now())
+	{
+	}
+
+	/*! \brief #CStageTimer class destructor, records the elapsed time.
+	*/
+	~CStageTimer() {
+		m_objProfiler.Record(m_eStage, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start).count());
+	}
+
+	/*!	\brief Deleted copy constructor so #CStageTimer class object cannot be copied.
+	*/
+	CStageTimer(const CStageTimer&) = delete;
+	/*!	\brief Deleted assignment operator so #CStageTimer class object cannot be assigned.
+	*/
+	void operator=(const CStageTimer&) = delete;
+
+private:
+	CSpliceProfiler& m_objProfiler;						/*!<Profiler receiving the sample.*/
+	scte35Stage::type m_eStage;							/*!<Timed stage.*/
+	std::chrono::steady_clock::time_point m_Start;		/*!<Scope start time.*/
+};
+
+/*! \def SCTE35_PROFILE_STAGE
+*	\brief Times the rest of the enclosing scope as the given stage of the CSpliceClass profiler. Expands to nothing unless SCTE35_ENABLE_PROFILING is defined.
+*/
+#ifdef SCTE35_ENABLE_PROFILING
+#define SCTE35_PROFILE_STAGE(stage) scte35::CStageTimer objStageTimerLocal(m_objProfiler, stage)
+#else
+#define SCTE35_PROFILE_STAGE(stage)
+#endif
+
+};
+
+#endif
@@ -0,0 +1,344 @@
+/*! \file SpliceProjection.cpp
+*	\brief Splice field projection classes definition.
+*	\details CPP file for definition of classes CSpliceBitReader and CSpliceProjection whose declaration is in SpliceProjection.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceProjection.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Fields decoded from the splice command.
+*/
+static const uint32_t uCommandFields = scte35Projected::pts_time | scte35Projected::splice_event_id | scte35Projected::out_of_network_indicator | scte35Projected::break_duration;
+/*! \brief Fields decoded from the first segmentation_descriptor.
+*/
+static const uint32_t uSegmentationFields = scte35Projected::segmentation_event_id | scte35Projected::segmentation_type_id | scte35Projected::segmentation_upid | scte35Projected::segment_num;
+/*! \brief Fields decoded from the descriptor loop.
+*/
+static const uint32_t uDescriptorFields = uSegmentationFields | scte35Projected::segmentation_count;
+/*! \brief Bytes from table_id up to and including splice_command_type.
+*/
+static const std::size_t iHeaderBytes = 14;
+/*! \brief splice_command_length of sections which do not give it (legacy encoders).
+*/
+static const uint32_t uUnknownCommandLength = 0xFFF;
+/*! \brief splice_descriptor_tag of segmentation_descriptor.
+*/
+static const uint8_t uSegmentationTag = 0x02;
+/*! \brief identifier of the SCTE-35 descriptors, "CUEI".
+*/
+static const uint32_t uCueIdentifier = 0x43554549;
+
+uint64_t CSpliceBitReader::Read(const int& iBits) {
+	if (iBits <= 0 || iBits > 64 || m_iPos > m_iBits || m_iBits - m_iPos < (std::size_t)iBits) {
+		m_bOverflow = true;
+		m_iPos = m_iBits;
+		return 0;
+	}
+
+	uint64_t uValue = 0;
+	int iLeft = iBits;
+	while (iLeft > 0) {
+		int iOffset = (int)(m_iPos & 7);
+		int iTake = 8 - iOffset;
+		if (iTake > iLeft) {
+			iTake = iLeft;
+		}
+		uint32_t uByte = m_pData[m_iPos >> 3];
+		uValue = (uValue << iTake) | ((uByte >> (8 - iOffset - iTake)) & ((1u << iTake) - 1));
+		m_iPos += iTake;
+		iLeft -= iTake;
+	}
+	return uValue;
+}
+
+void CSpliceBitReader::Skip(const std::size_t& iBits) {
+	if (m_iPos > m_iBits || m_iBits - m_iPos < iBits) {
+		m_bOverflow = true;
+		m_iPos = m_iBits;
+		return;
+	}
+	m_iPos += iBits;
+}
+
+/*! \brief Function to read a splice_time structure.
+*	\returns true if time_specified_flag is 1.
+*/
+static bool ReadSpliceTime(CSpliceBitReader& objReader, uint64_t& uPts) {
+	if (objReader.Read(1) == 1) {
+		objReader.Skip(6);
+		uPts = objReader.Read(33);
+		return true;
+	}
+	objReader.Skip(7);
+	return false;
+}
+
+bool CSpliceProjection::HexaToBytes(const std::string& sInput, std::vector<uint8_t>& vBytes) {
+	std::size_t iStart = 0;
+	if (sInput.length() >= 2 && sInput[0] == '0' && (sInput[1] == 'x' || sInput[1] == 'X')) {
+		iStart = 2;
+	}
+	if ((sInput.length() - iStart) % 2 != 0) {
+		return false;
+	}
+
+	vBytes.resize((sInput.length() - iStart) / 2);
+	return HexaToBytes(sInput.data() + iStart, vBytes.size(), vBytes.data());
+}
+
+bool CSpliceProjection::HexaToBytes(const char* pInput, const std::size_t& iBytes, uint8_t* pBytes) {
+	for (std::size_t i = 0;i < iBytes;i++) {
+		int iByte = 0;
+		for (int j = 0;j < 2;j++) {
+			char c = pInput[i * 2 + j];
+			int iNibble = 0;
+			if (c >= '0' && c <= '9') { iNibble = c - '0'; }
+			else if (c >= 'A' && c <= 'F') { iNibble = c - 'A' + 10; }
+			else if (c >= 'a' && c <= 'f') { iNibble = c - 'a' + 10; }
+			else { return false; }
+			iByte = (iByte << 4) | iNibble;
+		}
+		pBytes[i] = (uint8_t)iByte;
+	}
+	return true;
+}
+
+void CSpliceProjection::BytesToHexa(const uint8_t* pData, const std::size_t& iLength, std::string& sOutput) {
+	static const char cDigits[] = "0123456789ABCDEF";
+	sOutput.resize(iLength * 2);
+	for (std::size_t i = 0;i < iLength;i++) {
+		sOutput[2 * i] = cDigits[pData[i] >> 4];
+		sOutput[2 * i + 1] = cDigits[pData[i] & 0xF];
+	}
+}
+
+bool CSpliceProjection::ParseHexa(const std::string& sInput, SSpliceProjection& objResult) {
+	if (!HexaToBytes(sInput, m_vBytes)) {
+		objResult = SSpliceProjection();
+		return false;
+	}
+	return Parse(m_vBytes.data(), m_vBytes.size(), objResult);
+}
+
+bool CSpliceProjection::ParseCommand(CSpliceBitReader& objReader, SSpliceProjection& objResult) const {
+	uint32_t uFound = 0;
+	switch (objResult.splice_command_type) {
+		case 0x00:/*splice_null*/
+		case 0x07:/*bandwidth_reservation*/
+			break;
+		case 0x04:/*splice_schedule*/
+		{
+			uint32_t uCount = (uint32_t)objReader.Read(8);
+			for (uint32_t i = 0;i < uCount && !objReader.IsOverflow();i++) {
+				objReader.Skip(32);
+				if (objReader.Read(1) == 1) {
+					objReader.Skip(7);
+					continue;
+				}
+				//reserved and out_of_network_indicator
+				objReader.Skip(8);
+				uint32_t uProgram = (uint32_t)objReader.Read(1);
+				uint32_t uDuration = (uint32_t)objReader.Read(1);
+				objReader.Skip(5);
+				if (uProgram == 1) {
+					objReader.Skip(32);
+				}
+				else {
+					objReader.Skip((std::size_t)objReader.Read(8) * 40);
+				}
+				objReader.Skip((uDuration == 1 ? 40 : 0) + 32);
+			}
+			break;
+		}
+		case 0x05:/*splice_insert*/
+		{
+			objResult.splice_event_id = (uint32_t)objReader.Read(32);
+			objResult.splice_event_cancel_indicator = (uint32_t)objReader.Read(1);
+			objReader.Skip(7);
+			uFound |= scte35Projected::splice_event_id;
+			if (objResult.splice_event_cancel_indicator == 1) {
+				break;
+			}
+
+			objResult.out_of_network_indicator = (uint32_t)objReader.Read(1);
+			uint32_t uProgram = (uint32_t)objReader.Read(1);
+			uint32_t uDuration = (uint32_t)objReader.Read(1);
+			objResult.splice_immediate_flag = (uint32_t)objReader.Read(1);
+			objReader.Skip(4);
+			uFound |= scte35Projected::out_of_network_indicator;
+			if (uProgram == 1) {
+				if (objResult.splice_immediate_flag == 0 && ReadSpliceTime(objReader, objResult.pts_time)) {
+					uFound |= scte35Projected::pts_time;
+				}
+			}
+			else {
+				uint32_t uComponents = (uint32_t)objReader.Read(8);
+				for (uint32_t i = 0;i < uComponents && !objReader.IsOverflow();i++) {
+					objReader.Skip(8);
+					if (objResult.splice_immediate_flag == 0) {
+						uint64_t uIgnored = 0;
+						ReadSpliceTime(objReader, uIgnored);
+					}
+				}
+			}
+			if (uDuration == 1) {
+				objResult.auto_return = (uint32_t)objReader.Read(1);
+				objReader.Skip(6);
+				objResult.duration = objReader.Read(33);
+				uFound |= scte35Projected::break_duration;
+			}
+			objReader.Skip(32);
+			break;
+		}
+		case 0x06:/*time_signal*/
+			if (ReadSpliceTime(objReader, objResult.pts_time)) {
+				uFound |= scte35Projected::pts_time;
+			}
+			break;
+		default:
+			//private_command and reserved commands have no walkable syntax
+			return false;
+	}
+
+	if (objReader.IsOverflow()) {
+		return false;
+	}
+	objResult.uFound |= uFound & m_uFields;
+	return true;
+}
+
+void CSpliceProjection::ParseSegmentation(const uint8_t* pBody, const std::size_t& iLength, SSpliceProjection& objResult) const {
+	CSpliceBitReader objReader(pBody, iLength);
+	if (objReader.Read(32) != uCueIdentifier) {
+		return;
+	}
+
+	uint32_t uFound = 0;
+	uint32_t uEventId = (uint32_t)objReader.Read(32);
+	uint32_t uCancel = (uint32_t)objReader.Read(1);
+	objReader.Skip(7);
+	if (objReader.IsOverflow()) {
+		return;
+	}
+	objResult.segmentation_event_id = uEventId;
+	objResult.segmentation_event_cancel_indicator = uCancel;
+	uFound |= scte35Projected::segmentation_event_id;
+
+	if (uCancel == 0 && (m_uFields & (uSegmentationFields & ~(uint32_t)scte35Projected::segmentation_event_id)) != 0) {
+		uint32_t uProgram = (uint32_t)objReader.Read(1);
+		uint32_t uDuration = (uint32_t)objReader.Read(1);
+		objReader.Skip(6);
+		if (uProgram == 0) {
+			objReader.Skip((std::size_t)objReader.Read(8) * 48);
+		}
+		if (uDuration == 1) {
+			objReader.Skip(40);
+		}
+		uint32_t uUpidType = (uint32_t)objReader.Read(8);
+		uint32_t uUpidLength = (uint32_t)objReader.Read(8);
+		std::size_t iUpidByte = objReader.GetByte();
+		objReader.Skip((std::size_t)uUpidLength * 8);
+		uint32_t uTypeId = (uint32_t)objReader.Read(8);
+		uint32_t uSegmentNum = (uint32_t)objReader.Read(8);
+		uint32_t uSegmentsExpected = (uint32_t)objReader.Read(8);
+		if (!objReader.IsOverflow()) {
+			objResult.segmentation_upid_type = uUpidType;
+			objResult.segmentation_upid_length = uUpidLength;
+			objResult.pSegmentationUpid = pBody + iUpidByte;
+			objResult.segmentation_type_id = uTypeId;
+			objResult.segment_num = uSegmentNum;
+			objResult.segments_expected = uSegmentsExpected;
+			uFound |= scte35Projected::segmentation_upid | scte35Projected::segmentation_type_id | scte35Projected::segment_num;
+		}
+	}
+	objResult.uFound |= uFound & m_uFields;
+}
+
+bool CSpliceProjection::Parse(const uint8_t* pData, const std::size_t& iLength, SSpliceProjection& objResult) const {
+	objResult = SSpliceProjection();
+	if (pData == nullptr || iLength < iHeaderBytes || pData[0] != 0xFC) {
+		return false;
+	}
+
+	std::size_t iSectionEnd = 3 + (((std::size_t)(pData[1] & 0x0F)) << 8 | pData[2]);
+	if (iSectionEnd > iLength || iSectionEnd < iHeaderBytes + 2 + 4) {
+		return false;
+	}
+
+	//Header fields sit at fixed offsets
+	uint32_t uEncrypted = pData[4] >> 7;
+	objResult.pts_adjustment = ((uint64_t)(pData[4] & 0x01) << 32) | ((uint64_t)pData[5] << 24) | ((uint64_t)pData[6] << 16) | ((uint64_t)pData[7] << 8) | pData[8];
+	objResult.tier = ((uint32_t)pData[10] << 4) | (pData[11] >> 4);
+	objResult.uFound |= (scte35Projected::pts_adjustment | scte35Projected::tier) & m_uFields;
+	if (uEncrypted == 1) {
+		return true;
+	}
+
+	uint32_t uCommandLength = ((uint32_t)(pData[11] & 0x0F) << 8) | pData[12];
+	objResult.splice_command_type = pData[13];
+	objResult.uFound |= scte35Projected::splice_command_type & m_uFields;
+
+	//The loop ends before CRC_32
+	std::size_t iLoopEnd = iSectionEnd - 4;
+	std::size_t iCommandEnd = iHeaderBytes + uCommandLength;
+	bool bNeedDescriptors = (m_uFields & uDescriptorFields) != 0;
+	if ((m_uFields & uCommandFields) != 0 || (uCommandLength == uUnknownCommandLength && bNeedDescriptors)) {
+		CSpliceBitReader objReader(pData + iHeaderBytes, iLoopEnd - iHeaderBytes);
+		bool bWalked = ParseCommand(objReader, objResult);
+		if (uCommandLength == uUnknownCommandLength) {
+			if (!bWalked) {
+				//No length and no walkable syntax : the descriptors cannot be located
+				return objResult.splice_command_type == 0xFF;
+			}
+			iCommandEnd = iHeaderBytes + objReader.GetByte();
+		}
+		else if (!bWalked && objResult.splice_command_type != 0xFF && objResult.splice_command_type <= 0x07) {
+			return false;
+		}
+	}
+
+	if (!bNeedDescriptors) {
+		return true;
+	}
+	if (iCommandEnd + 2 > iLoopEnd) {
+		return false;
+	}
+
+	std::size_t iPos = iCommandEnd + 2;
+	std::size_t iDescriptorEnd = iPos + (((std::size_t)pData[iCommandEnd] << 8) | pData[iCommandEnd + 1]);
+	if (iDescriptorEnd > iLoopEnd) {
+		return false;
+	}
+
+	bool bCount = (m_uFields & scte35Projected::segmentation_count) != 0;
+	while (iPos + 2 <= iDescriptorEnd) {
+		uint8_t uTag = pData[iPos];
+		std::size_t iBodyLength = pData[iPos + 1];
+		if (iPos + 2 + iBodyLength > iDescriptorEnd) {
+			return false;
+		}
+
+		if (uTag == uSegmentationTag && iBodyLength >= 4 && pData[iPos + 2] == 'C' && pData[iPos + 3] == 'U' && pData[iPos + 4] == 'E' && pData[iPos + 5] == 'I') {
+			if (objResult.segmentation_count == 0) {
+				ParseSegmentation(pData + iPos + 2, iBodyLength, objResult);
+			}
+			objResult.segmentation_count++;
+			if (!bCount) {
+				break;
+			}
+		}
+		iPos += 2 + iBodyLength;
+	}
+	if (bCount) {
+		objResult.uFound |= scte35Projected::segmentation_count;
+	}
+	return true;
+}
+
+};
@@ -0,0 +1,232 @@
+/*! \file SpliceProjection.hpp
+*	\brief Splice field projection classes declaration.
+*	\details Header file for declaration of classes CSpliceBitReader and CSpliceProjection whose definition is in SpliceProjection.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEPROJECTION_HPP_
+/*! \brief SpliceProjection.hpp header guard define.
+*/
+#define _SPLICEPROJECTION_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Projected
+*	\brief scte35Projected structure to hold the field flags of a #CSpliceProjection mask.
+*/
+struct scte35Projected {
+	/*!
+	*	\brief A type definition for type (Projected field flags, combined with |)
+	*/
+	typedef enum {
+		splice_command_type = 0x0001,			/*!<splice_command_type*/
+		pts_adjustment = 0x0002,				/*!<pts_adjustment*/
+		tier = 0x0004,							/*!<tier*/
+		pts_time = 0x0008,						/*!<pts_time of a time_signal or of a program splice_insert*/
+		splice_event_id = 0x0010,				/*!<splice_event_id and splice_event_cancel_indicator of a splice_insert*/
+		out_of_network_indicator = 0x0020,		/*!<out_of_network_indicator and splice_immediate_flag of a splice_insert*/
+		break_duration = 0x0040,				/*!<auto_return and duration of a splice_insert*/
+		segmentation_event_id = 0x0080,			/*!<segmentation_event_id and segmentation_event_cancel_indicator of the first segmentation_descriptor*/
+		segmentation_type_id = 0x0100,			/*!<segmentation_type_id of the first segmentation_descriptor*/
+		segmentation_upid = 0x0200,				/*!<segmentation_upid_type and segmentation_upid bytes of the first segmentation_descriptor*/
+		segment_num = 0x0400,					/*!<segment_num and segments_expected of the first segmentation_descriptor*/
+		segmentation_count = 0x0800,			/*!<Number of segmentation_descriptor of the section*/
+		all = 0x0FFF							/*!<Every field above*/
+	}type;
+};
+
+/*!	\class CSpliceBitReader
+*	\brief #CSpliceBitReader class reading big-endian bit fields from a byte buffer.
+*
+*	Reads past the end of the buffer return 0 and set the overflow flag, so a chain of reads is checked once with #IsOverflow.
+*/
+class CSpliceBitReader {
+public:
+	/*! \brief #CSpliceBitReader class constructor.
+	*	\param pData first byte.
+	*	\param iLength number of bytes readable from pData.
+	*/
+	CSpliceBitReader(const uint8_t* pData, const std::size_t& iLength) :
+	m_pData(pData),
+	m_iBits(iLength * 8),
+	m_iPos(0),
+	m_bOverflow(false)
+	{
+	}
+
+	/*! \brief Function to read a field.
+	*	\param iBits field size, 1 to 64 bits.
+	*	\returns field value, 0 on overflow.
+	*/
+	uint64_t Read(const int& iBits);
+
+	/*! \brief Function to skip bits.
+	*/
+	void Skip(const std::size_t& iBits);
+
+	/*! \brief Function to get the current position in bits.
+	*/
+	std::size_t GetPosition() const { return m_iPos; }
+	/*! \brief Function to get the current position in bytes (the position must be byte aligned).
+	*/
+	std::size_t GetByte() const { return m_iPos / 8; }
+	/*! \brief Function to get the number of bits left.
+	*/
+	std::size_t GetRemaining() const { return m_iPos < m_iBits ? m_iBits - m_iPos : 0; }
+	/*! \brief Function to check if a read or skip went past the end of the buffer.
+	*/
+	bool IsOverflow() const { return m_bOverflow; }
+
+private:
+	const uint8_t* m_pData;		/*!<First byte.*/
+	std::size_t m_iBits;		/*!<Number of readable bits.*/
+	std::size_t m_iPos;			/*!<Current position in bits.*/
+	bool m_bOverflow;			/*!<Whether a read or skip went past the end.*/
+};
+
+/*!	\class SSpliceProjection
+*	\brief #SSpliceProjection class holding the fields decoded by #CSpliceProjection.
+*
+*	Only the fields whose scte35Projected flag is set in uFound were decoded, the others keep their default value.
+*/
+class SSpliceProjection {
+public:
+	uint32_t uFound;								/*!<scte35Projected flags of the decoded fields.*/
+	uint32_t splice_command_type;					/*!<8-bit : splice_command_type.*/
+	uint64_t pts_adjustment;						/*!<33-bit : pts_adjustment.*/
+	uint32_t tier;									/*!<12-bit : tier.*/
+	uint64_t pts_time;								/*!<33-bit : pts_time without pts_adjustment.*/
+	uint32_t splice_event_id;						/*!<32-bit : splice_event_id of the splice_insert.*/
+	uint32_t splice_event_cancel_indicator;			/*!<1-bit : splice_event_cancel_indicator of the splice_insert.*/
+	uint32_t out_of_network_indicator;				/*!<1-bit : out_of_network_indicator of the splice_insert.*/
+	uint32_t splice_immediate_flag;					/*!<1-bit : splice_immediate_flag of the splice_insert.*/
+	uint32_t auto_return;							/*!<1-bit : auto_return of the break_duration.*/
+	uint64_t duration;								/*!<33-bit : duration of the break_duration.*/
+	uint32_t segmentation_event_id;					/*!<32-bit : segmentation_event_id of the first segmentation_descriptor.*/
+	uint32_t segmentation_event_cancel_indicator;	/*!<1-bit : segmentation_event_cancel_indicator of the first segmentation_descriptor.*/
+	uint32_t segmentation_type_id;					/*!<8-bit : segmentation_type_id of the first segmentation_descriptor.*/
+	uint32_t segmentation_upid_type;				/*!<8-bit : segmentation_upid_type of the first segmentation_descriptor.*/
+	const uint8_t* pSegmentationUpid;				/*!<segmentation_upid bytes, points into the parsed buffer.*/
+	uint32_t segmentation_upid_length;				/*!<8-bit : segmentation_upid_length of the first segmentation_descriptor.*/
+	uint32_t segment_num;							/*!<8-bit : segment_num of the first segmentation_descriptor.*/
+	uint32_t segments_expected;						/*!<8-bit : segments_expected of the first segmentation_descriptor.*/
+	uint32_t segmentation_count;					/*!<Number of segmentation_descriptor of the section.*/
+
+	/*! \brief #SSpliceProjection class default constructor with intializer list.
+	*/
+	SSpliceProjection() :
+	 uFound(0),
+	 splice_command_type(0),
+	 pts_adjustment(0),
+	 tier(0),
+	 pts_time(0),
+	 splice_event_id(0),
+	 splice_event_cancel_indicator(0),
+	 out_of_network_indicator(0),
+	 splice_immediate_flag(0),
+	 auto_return(0),
+	 duration(0),
+	 segmentation_event_id(0),
+	 segmentation_event_cancel_indicator(0),
+	 segmentation_type_id(0),
+	 segmentation_upid_type(0),
+	 pSegmentationUpid(nullptr),
+	 segmentation_upid_length(0),
+	 segment_num(0),
+	 segments_expected(0),
+	 segmentation_count(0)
+	{
+	}
+
+	/*! \brief Function to check if a field was decoded.
+	*/
+	bool Has(const scte35Projected::type& eField) const { return (uFound & (uint32_t)eField) != 0; }
+};
+
+/*!	\class CSpliceProjection
+*	\brief #CSpliceProjection class decoding only the requested fields of a splice_info_section.
+*
+*	Sections are read from bytes with #CSpliceBitReader instead of being expanded to a bit string, and nothing outside the field mask is decoded:
+*	the splice command is skipped with splice_command_length and descriptors with descriptor_length unless a requested field lives in them, and
+*	decoding stops as soon as every requested field is found. Parse results match CSpliceClass for the fields they hold; CRC_32 is not checked.
+*	Fields of an encrypted section beyond tier are not available.
+*/
+class CSpliceProjection {
+public:
+	/*! \brief #CSpliceProjection class constructor.
+	*	\param uFields scte35Projected flags to decode.
+	*/
+	explicit CSpliceProjection(const uint32_t& uFields = scte35Projected::all) :
+	m_uFields(uFields)
+	{
+	}
+
+	/*! \brief Function to set the fields to decode.
+	*/
+	void SetFields(const uint32_t& uFields) { m_uFields = uFields; }
+	/*! \brief Function to get the fields to decode.
+	*/
+	uint32_t GetFields() const { return m_uFields; }
+
+	/*! \brief Function to decode the requested fields of a binary splice_info_section.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength number of bytes available in pData.
+	*	\param objResult decoded fields, reset first.
+	*	\returns true if the requested fields present in the section were decoded and false if the bytes do not hold a splice_info_section.
+	*/
+	bool Parse(const uint8_t* pData, const std::size_t& iLength, SSpliceProjection& objResult) const;
+
+	/*! \brief Function to decode the requested fields of hexa-decimal textual data (without spaces). pSegmentationUpid points into an internal buffer valid until the next call.
+	*	\param sInput an input hexa-decimal string data.
+	*	\param objResult decoded fields, reset first.
+	*	\returns true if decoded and false on invalid hexa-decimal data or section.
+	*/
+	bool ParseHexa(const std::string& sInput, SSpliceProjection& objResult);
+
+	/*! \brief Function to convert hexa-decimal textual data to bytes.
+	*	\param sInput an input hexa-decimal string data, optionally starting with 0x.
+	*	\param vBytes output bytes, replaced.
+	*	\returns true if converted and false on an odd length or a non hexa-decimal character.
+	*/
+	static bool HexaToBytes(const std::string& sInput, std::vector<uint8_t>& vBytes);
+
+	/*! \brief Function to convert hexa-decimal characters to bytes, the decoder every hexa-decimal input of the library goes through.
+	*	\param pInput 2 * iBytes hexa-decimal characters, upper or lower case.
+	*	\param iBytes number of bytes to decode.
+	*	\param pBytes output of iBytes bytes.
+	*	\returns true if converted and false on a non hexa-decimal character.
+	*/
+	static bool HexaToBytes(const char* pInput, const std::size_t& iBytes, uint8_t* pBytes);
+
+	/*! \brief Function to convert bytes to upper case hexa-decimal textual data, the input of CSpliceClass::ParseHexa.
+	*	\param pData input bytes.
+	*	\param iLength number of bytes.
+	*	\param sOutput output text, replaced (its capacity is reused).
+	*/
+	static void BytesToHexa(const uint8_t* pData, const std::size_t& iLength, std::string& sOutput);
+
+private:
+	/*! \brief Function to decode the splice command fields.
+	*/
+	bool ParseCommand(CSpliceBitReader& objReader, SSpliceProjection& objResult) const;
+	/*! \brief Function to decode the segmentation fields of one segmentation_descriptor body (after descriptor_length).
+	*/
+	void ParseSegmentation(const uint8_t* pBody, const std::size_t& iLength, SSpliceProjection& objResult) const;
+
+	uint32_t m_uFields;					/*!<scte35Projected flags to decode.*/
+	std::vector<uint8_t> m_vBytes;		/*!<Bytes of the last #ParseHexa input.*/
+};
+
+};
+
+#endif
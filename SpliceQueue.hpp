@@ -0,0 +1,291 @@
+/*! \file SpliceQueue.hpp
+*	\brief Splice bounded lock-free queue classes declaration and definition.
+*	\details Header file for declaration and definition of the class CSpliceBackoff and the class templates CSpliceSPSCQueue and CSpliceMPSCQueue (header only as they are small or templates).
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEQUEUE_HPP_
+/*! \brief SpliceQueue.hpp header guard define.
+*/
+#define _SPLICEQUEUE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \brief Size of the cache line the queue indexes are aligned on, so producer and consumer do not write the same line.
+*/
+static const std::size_t iSpliceCacheLine = 64;
+
+/*! \brief Function to round a queue capacity up to a power of two (at least 2).
+*/
+inline std::size_t SpliceQueueCapacity(const std::size_t& iCapacity) {
+	std::size_t iSlots = 2;
+	while (iSlots < iCapacity) {
+		iSlots <<= 1;
+	}
+	return iSlots;
+}
+
+/*!	\class CSpliceBackoff
+*	\brief #CSpliceBackoff class is the wait of a thread polling lock-free queues: spin, then yield, then sleep.
+*
+*	The first polls after some work stay on the core so a burst is picked up at once; a thread idle for longer sleeps so it does not burn
+*	the core, the sleep bounding its wake-up latency.
+*/
+class CSpliceBackoff {
+public:
+	/*! \brief #CSpliceBackoff class constructor.
+	*	\param uSleepUs sleep of each wait once spinning and yielding are exhausted, in microseconds.
+	*/
+	explicit CSpliceBackoff(const uint32_t& uSleepUs) :
+	m_uSleepUs(uSleepUs),
+	m_iWaits(0)
+	{
+
+	}
+
+	/*! \brief Function to wait after an empty poll.
+	*/
+	void Wait() {
+		m_iWaits++;
+		if (m_iWaits <= iSpins) {
+			return;
+		}
+		if (m_iWaits <= 2 * iSpins) {
+			std::this_thread::yield();
+			return;
+		}
+		std::this_thread::sleep_for(std::chrono::microseconds(m_uSleepUs));
+	}
+
+	/*! \brief Function to restart from spinning after a successful poll.
+	*/
+	void Reset() { m_iWaits = 0; }
+
+	/*! \brief Function to check whether no wait happened since the last #Reset.
+	*/
+	bool IsReset() const { return m_iWaits == 0; }
+
+private:
+	/*! \brief Empty polls spent spinning, then as many yielding, before sleeping.
+	*/
+	static const std::size_t iSpins = 64;
+
+	uint32_t m_uSleepUs;		/*!<Sleep of a wait in microseconds.*/
+	std::size_t m_iWaits;		/*!<Waits since the last #Reset.*/
+};
+
+/*!	\class CSpliceSPSCQueue
+*	\brief #CSpliceSPSCQueue class template is a bounded lock-free queue for exactly one producer thread and one consumer thread.
+*
+*	Head and tail live on their own cache lines and each side keeps a cached copy of the other index, so a push or a pop only reads the
+*	shared index of the other side when the cached one says the queue is full or empty. Nothing is allocated after construction.
+*	\tparam T value type, must be default constructible and movable.
+*/
+template <typename T>
+class CSpliceSPSCQueue {
+public:
+	/*! \brief #CSpliceSPSCQueue class constructor.
+	*	\param iCapacity maximum number of queued values, rounded up to a power of two.
+	*/
+	explicit CSpliceSPSCQueue(const std::size_t& iCapacity) :
+	m_iMask(SpliceQueueCapacity(iCapacity) - 1),
+	m_pSlots(new T[m_iMask + 1]),
+	m_iHead(0),
+	m_iTailCache(0),
+	m_iTail(0),
+	m_iHeadCache(0)
+	{
+
+	}
+
+	/*!	\brief Deleted copy constructor so #CSpliceSPSCQueue class object cannot be copied.
+	*/
+	CSpliceSPSCQueue(const CSpliceSPSCQueue&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceSPSCQueue class object cannot be assigned.
+	*/
+	void operator=(const CSpliceSPSCQueue&) = delete;
+
+	/*! \brief Function to append a value, called by the producer thread only.
+	*	\param objValue value moved into the queue on success.
+	*	\returns true if queued and false if the queue is full.
+	*/
+	bool TryPush(T& objValue) {
+		const std::size_t iTail = m_iTail.load(std::memory_order_relaxed);
+		if (iTail - m_iHeadCache > m_iMask) {
+			m_iHeadCache = m_iHead.load(std::memory_order_acquire);
+			if (iTail - m_iHeadCache > m_iMask) {
+				return false;
+			}
+		}
+		m_pSlots[iTail & m_iMask] = std::move(objValue);
+		m_iTail.store(iTail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*! \brief Function to remove the oldest value, called by the consumer thread only.
+	*	\param objValue receives the value on success.
+	*	\returns true if a value was removed and false if the queue is empty.
+	*/
+	bool TryPop(T& objValue) {
+		const std::size_t iHead = m_iHead.load(std::memory_order_relaxed);
+		if (iHead == m_iTailCache) {
+			m_iTailCache = m_iTail.load(std::memory_order_acquire);
+			if (iHead == m_iTailCache) {
+				return false;
+			}
+		}
+		objValue = std::move(m_pSlots[iHead & m_iMask]);
+		m_iHead.store(iHead + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*! \brief Function to get the number of queued values, exact only when neither side is running.
+	*/
+	std::size_t GetSize() const {
+		const std::size_t iHead = m_iHead.load(std::memory_order_acquire);
+		const std::size_t iTail = m_iTail.load(std::memory_order_acquire);
+		return iTail > iHead ? iTail - iHead : 0;
+	}
+
+	/*! \brief Function to get the maximum number of queued values.
+	*/
+	std::size_t GetCapacity() const { return m_iMask + 1; }
+
+private:
+	const std::size_t m_iMask;										/*!<Slot count minus one.*/
+	std::unique_ptr<T[]> m_pSlots;									/*!<Slots.*/
+	alignas(iSpliceCacheLine) std::atomic<std::size_t> m_iHead;	/*!<Next slot to pop, written by the consumer.*/
+	std::size_t m_iTailCache;										/*!<Consumer copy of m_iTail.*/
+	alignas(iSpliceCacheLine) std::atomic<std::size_t> m_iTail;	/*!<Next slot to push, written by the producer.*/
+	std::size_t m_iHeadCache;										/*!<Producer copy of m_iHead.*/
+	char m_cPad[iSpliceCacheLine - sizeof(std::size_t)];			/*!<Keeps the producer line away from following members.*/
+};
+
+/*!	\class CSpliceMPSCQueue
+*	\brief #CSpliceMPSCQueue class template is a bounded lock-free queue for any number of producer threads and one consumer thread.
+*
+*	Every slot carries a sequence number telling whether it holds a value of the current lap, so producers only contend on one
+*	compare-and-swap of the tail and never wait for each other. Pops claim the head with a compare-and-swap too, which keeps them
+*	safe when several threads pop (a free list of preallocated objects, or a producer shedding the oldest value).
+*	\tparam T value type, must be default constructible and movable.
+*/
+template <typename T>
+class CSpliceMPSCQueue {
+public:
+	/*! \brief #CSpliceMPSCQueue class constructor.
+	*	\param iCapacity maximum number of queued values, rounded up to a power of two.
+	*/
+	explicit CSpliceMPSCQueue(const std::size_t& iCapacity) :
+	m_iMask(SpliceQueueCapacity(iCapacity) - 1),
+	m_pSlots(new SSlot[m_iMask + 1]),
+	m_iHead(0),
+	m_iTail(0)
+	{
+		for (std::size_t i = 0;i <= m_iMask;i++) {
+			m_pSlots[i].iSequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	/*!	\brief Deleted copy constructor so #CSpliceMPSCQueue class object cannot be copied.
+	*/
+	CSpliceMPSCQueue(const CSpliceMPSCQueue&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceMPSCQueue class object cannot be assigned.
+	*/
+	void operator=(const CSpliceMPSCQueue&) = delete;
+
+	/*! \brief Function to append a value, callable from any thread.
+	*	\param objValue value moved into the queue on success.
+	*	\returns true if queued and false if the queue is full.
+	*/
+	bool TryPush(T& objValue) {
+		std::size_t iTail = m_iTail.load(std::memory_order_relaxed);
+		for (;;) {
+			SSlot& objSlot = m_pSlots[iTail & m_iMask];
+			const std::size_t iSequence = objSlot.iSequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t iDiff = (std::ptrdiff_t)iSequence - (std::ptrdiff_t)iTail;
+			if (iDiff == 0) {
+				if (m_iTail.compare_exchange_weak(iTail, iTail + 1, std::memory_order_relaxed)) {
+					objSlot.objValue = std::move(objValue);
+					objSlot.iSequence.store(iTail + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (iDiff < 0) {
+				return false;
+			}
+			else {
+				iTail = m_iTail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/*! \brief Function to remove the oldest value.
+	*	\param objValue receives the value on success.
+	*	\returns true if a value was removed and false if the queue is empty.
+	*/
+	bool TryPop(T& objValue) {
+		std::size_t iHead = m_iHead.load(std::memory_order_relaxed);
+		for (;;) {
+			SSlot& objSlot = m_pSlots[iHead & m_iMask];
+			const std::size_t iSequence = objSlot.iSequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t iDiff = (std::ptrdiff_t)iSequence - (std::ptrdiff_t)(iHead + 1);
+			if (iDiff == 0) {
+				if (m_iHead.compare_exchange_weak(iHead, iHead + 1, std::memory_order_relaxed)) {
+					objValue = std::move(objSlot.objValue);
+					objSlot.iSequence.store(iHead + m_iMask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (iDiff < 0) {
+				return false;
+			}
+			else {
+				iHead = m_iHead.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/*! \brief Function to get the number of queued values, exact only when no thread is pushing or popping.
+	*/
+	std::size_t GetSize() const {
+		const std::size_t iHead = m_iHead.load(std::memory_order_acquire);
+		const std::size_t iTail = m_iTail.load(std::memory_order_acquire);
+		return iTail > iHead ? iTail - iHead : 0;
+	}
+
+	/*! \brief Function to get the maximum number of queued values.
+	*/
+	std::size_t GetCapacity() const { return m_iMask + 1; }
+
+private:
+	/*!	\struct SSlot
+	*	\brief #SSlot structure holding one value and its lap sequence number.
+	*/
+	struct SSlot {
+		std::atomic<std::size_t> iSequence;		/*!<Equal to the push index when free, to the push index + 1 when holding a value.*/
+		T objValue;								/*!<Value.*/
+	};
+
+	const std::size_t m_iMask;										/*!<Slot count minus one.*/
+	std::unique_ptr<SSlot[]> m_pSlots;								/*!<Slots.*/
+	alignas(iSpliceCacheLine) std::atomic<std::size_t> m_iHead;	/*!<Next slot to pop.*/
+	alignas(iSpliceCacheLine) std::atomic<std::size_t> m_iTail;	/*!<Next slot to push.*/
+	char m_cPad[iSpliceCacheLine - sizeof(std::size_t)];			/*!<Keeps the tail line away from following members.*/
+};
+
+};
+
+#endif
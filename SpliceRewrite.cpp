@@ -0,0 +1,129 @@
+/*! \file SpliceRewrite.cpp
+*	\brief Splice in-place rewrite class definition.
+*	\details CPP file for definition of class CSpliceRewrite whose declaration is in SpliceRewrite.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceRewrite.hpp"
+#include "SpliceCRC.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Byte offset of the first byte holding pts_adjustment (shared with encrypted_packet and encryption_algorithm).
+*/
+static const std::size_t iPtsByteOffset = 4;
+/*! \brief Number of bytes from the pts_adjustment byte up to and including the byte holding the low tier bits.
+*/
+static const std::size_t iPatchBytes = 8;
+/*! \brief Smallest splice_info_section : 14 header bytes, descriptor_loop_length and CRC_32.
+*/
+static const std::size_t iMinSectionBytes = 20;
+
+bool CSpliceRewrite::LocateCRC(const uint8_t* pSection, const std::size_t& iLength, std::size_t& iCrcOffset) {
+	if (pSection == nullptr || iLength < iMinSectionBytes) {
+		return false;
+	}
+
+	if (pSection[0] != 0xFC) {
+		return false;/*Not splice_info_section*/
+	}
+
+	std::size_t iSectionEnd = 3 + ((((std::size_t)pSection[1]) & 0x0F) << 8 | pSection[2]);
+	if (iSectionEnd < iMinSectionBytes || iSectionEnd > iLength) {
+		return false;
+	}
+
+	iCrcOffset = iSectionEnd - 4;
+	return true;
+}
+
+bool CSpliceRewrite::GetPtsAdjustment(const uint8_t* pSection, const std::size_t& iLength, uint64_t& ptsAdjustment) {
+	std::size_t iCrcOffset = 0;
+	if (!LocateCRC(pSection, iLength, iCrcOffset)) {
+		return false;
+	}
+
+	ptsAdjustment = ((uint64_t)(pSection[4] & 0x01) << 32) |
+		((uint64_t)pSection[5] << 24) |
+		((uint64_t)pSection[6] << 16) |
+		((uint64_t)pSection[7] << 8) |
+		(uint64_t)pSection[8];
+	return true;
+}
+
+bool CSpliceRewrite::PatchHeader(uint8_t* pSection, const std::size_t& iLength, const uint64_t& ptsAdjustment, const bool& bSetTier, const uint32_t& tier) {
+	std::size_t iCrcOffset = 0;
+	if (!LocateCRC(pSection, iLength, iCrcOffset)) {
+		return false;
+	}
+
+	if (bSetTier && tier > 0xFFF) {
+		return false;
+	}
+
+	uint8_t* pPatch = pSection + iPtsByteOffset;
+	uint8_t uOld[iPatchBytes];
+	for (std::size_t i = 0;i < iPatchBytes;i++) {
+		uOld[i] = pPatch[i];
+	}
+
+	//encrypted_packet and encryption_algorithm share the byte with the top pts_adjustment bit
+	pPatch[0] = (uint8_t)((pPatch[0] & 0xFE) | ((ptsAdjustment >> 32) & 0x01));
+	pPatch[1] = (uint8_t)(ptsAdjustment >> 24);
+	pPatch[2] = (uint8_t)(ptsAdjustment >> 16);
+	pPatch[3] = (uint8_t)(ptsAdjustment >> 8);
+	pPatch[4] = (uint8_t)ptsAdjustment;
+	//pPatch[5] is cw_index and is left as is
+	if (bSetTier) {
+		pPatch[6] = (uint8_t)(tier >> 4);
+		pPatch[7] = (uint8_t)(((tier & 0x0F) << 4) | (pPatch[7] & 0x0F));
+	}
+
+	//CRC_32 is linear : the new CRC is the old CRC xor the zero-initialised CRC of the changed bits
+	uint8_t uDelta[iPatchBytes];
+	bool bChanged = false;
+	for (std::size_t i = 0;i < iPatchBytes;i++) {
+		uDelta[i] = uOld[i] ^ pPatch[i];
+		bChanged = bChanged || (uDelta[i] != 0);
+	}
+	if (!bChanged) {
+		return true;
+	}
+
+	uint32_t uDiff = CSpliceCRC::Update(0, uDelta, iPatchBytes);
+	uDiff = CSpliceCRC::ShiftZeros(uDiff, iCrcOffset - (iPtsByteOffset + iPatchBytes));
+
+	uint8_t* pCrc = pSection + iCrcOffset;
+	uint32_t uCrc = ((uint32_t)pCrc[0] << 24) | ((uint32_t)pCrc[1] << 16) | ((uint32_t)pCrc[2] << 8) | (uint32_t)pCrc[3];
+	uCrc ^= uDiff;
+	pCrc[0] = (uint8_t)(uCrc >> 24);
+	pCrc[1] = (uint8_t)(uCrc >> 16);
+	pCrc[2] = (uint8_t)(uCrc >> 8);
+	pCrc[3] = (uint8_t)uCrc;
+
+	return true;
+}
+
+bool CSpliceRewrite::SetPtsAdjustment(uint8_t* pSection, const std::size_t& iLength, const uint64_t& ptsAdjustment) {
+	return PatchHeader(pSection, iLength, ptsAdjustment, false, 0);
+}
+
+bool CSpliceRewrite::SetPtsAdjustmentTier(uint8_t* pSection, const std::size_t& iLength, const uint64_t& ptsAdjustment, const uint32_t& tier) {
+	return PatchHeader(pSection, iLength, ptsAdjustment, true, tier);
+}
+
+bool CSpliceRewrite::AddPtsAdjustment(uint8_t* pSection, const std::size_t& iLength, const int64_t& iDelta) {
+	uint64_t ptsAdjustment = 0;
+	if (!GetPtsAdjustment(pSection, iLength, ptsAdjustment)) {
+		return false;
+	}
+
+	//Two's complement addition then modulo 2^33 handles negative shifts as well
+	return PatchHeader(pSection, iLength, ptsAdjustment + (uint64_t)iDelta, false, 0);
+}
+
+};
@@ -0,0 +1,87 @@
+/*! \file SpliceRewrite.hpp
+*	\brief Splice in-place rewrite class declaration.
+*	\details Header file for declaration of class CSpliceRewrite whose definition is in SpliceRewrite.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEREWRITE_HPP_
+/*! \brief SpliceRewrite.hpp header guard define.
+*/
+#define _SPLICEREWRITE_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CSpliceRewrite
+*	\brief #CSpliceRewrite class is the utility for patching header fields of a binary splice_info_section in place.
+*
+*	Only the bytes of the patched fields and the trailing CRC_32 are written. The CRC_32 is corrected from the changed bits alone, so the cost
+*	does not depend on the section size and no parsing of the splice command or descriptors is done. A section with a wrong CRC_32 keeps a wrong CRC_32.
+*/
+class CSpliceRewrite {
+public:
+	/*! \brief Function to set pts_adjustment of a binary splice_info_section.
+	*	\param pSection an input/output splice_info_section bytes starting with table_id.
+	*	\param iLength number of bytes available in pSection.
+	*	\param ptsAdjustment new pts_adjustment value (taken modulo 2^33).
+	*	\returns true if successfully patched and false if the bytes do not hold a splice_info_section.
+	*/
+	static bool SetPtsAdjustment(uint8_t* pSection, const std::size_t& iLength, const uint64_t& ptsAdjustment);
+
+	/*! \brief Function to set pts_adjustment and tier of a binary splice_info_section.
+	*	\param pSection an input/output splice_info_section bytes starting with table_id.
+	*	\param iLength number of bytes available in pSection.
+	*	\param ptsAdjustment new pts_adjustment value (taken modulo 2^33).
+	*	\param tier new 12-bit tier value.
+	*	\returns true if successfully patched and false if the bytes do not hold a splice_info_section or tier is out of range.
+	*/
+	static bool SetPtsAdjustmentTier(uint8_t* pSection, const std::size_t& iLength, const uint64_t& ptsAdjustment, const uint32_t& tier);
+
+	/*! \brief Function to shift pts_adjustment of a binary splice_info_section by a signed number of 90kHz ticks.
+	*
+	*	The addition is done modulo 2^33, the carry is ignored as required for pts_adjustment.
+	*	\param pSection an input/output splice_info_section bytes starting with table_id.
+	*	\param iLength number of bytes available in pSection.
+	*	\param iDelta number of 90kHz ticks to add to the current pts_adjustment.
+	*	\returns true if successfully patched and false if the bytes do not hold a splice_info_section.
+	*/
+	static bool AddPtsAdjustment(uint8_t* pSection, const std::size_t& iLength, const int64_t& iDelta);
+
+	/*! \brief Function to read pts_adjustment from a binary splice_info_section without parsing it.
+	*	\param pSection an input splice_info_section bytes starting with table_id.
+	*	\param iLength number of bytes available in pSection.
+	*	\param ptsAdjustment receives the 33-bit pts_adjustment value.
+	*	\returns true if successfully read and false if the bytes do not hold a splice_info_section.
+	*/
+	static bool GetPtsAdjustment(const uint8_t* pSection, const std::size_t& iLength, uint64_t& ptsAdjustment);
+
+private:
+	/*! \brief Function to check the section header and get the byte offset of CRC_32.
+	*	\param pSection an input splice_info_section bytes starting with table_id.
+	*	\param iLength number of bytes available in pSection.
+	*	\param iCrcOffset receives the byte offset of CRC_32.
+	*	\returns true if the section header is usable and false if not.
+	*/
+	static bool LocateCRC(const uint8_t* pSection, const std::size_t& iLength, std::size_t& iCrcOffset);
+
+	/*! \brief Function to write pts_adjustment (and optionally tier) and fold the change into CRC_32.
+	*	\param pSection an input/output splice_info_section bytes starting with table_id.
+	*	\param iLength number of bytes available in pSection.
+	*	\param ptsAdjustment new pts_adjustment value.
+	*	\param bSetTier to whether tier is written too.
+	*	\param tier new 12-bit tier value.
+	*	\returns true if successfully patched and false if any failure.
+	*/
+	static bool PatchHeader(uint8_t* pSection, const std::size_t& iLength, const uint64_t& ptsAdjustment, const bool& bSetTier, const uint32_t& tier);
+};
+
+};
+
+#endif
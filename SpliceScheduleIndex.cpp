@@ -0,0 +1,361 @@
+/*! \file SpliceScheduleIndex.cpp
+*	\brief Splice schedule UTC conversion and index classes definition.
+*	\details CPP file for definition of classes CSpliceUTC and CSpliceScheduleIndex whose declaration is in SpliceScheduleIndex.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceScheduleIndex.hpp"
+#include <algorithm>
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const int64_t CSpliceUTC::iGpsEpochUnix;
+
+/*! \brief Unix time of the UTC midnights following each leap second inserted since the GPS epoch, the GPS to UTC offset is the index plus one from there.
+*/
+static const int64_t iLeapSecondsUnix[] = {
+	362793600,		//1981-07-01
+	394329600,		//1982-07-01
+	425865600,		//1983-07-01
+	489024000,		//1985-07-01
+	567993600,		//1988-01-01
+	631152000,		//1990-01-01
+	662688000,		//1991-01-01
+	709948800,		//1992-07-01
+	741484800,		//1993-07-01
+	773020800,		//1994-07-01
+	820454400,		//1996-01-01
+	867715200,		//1997-07-01
+	915148800,		//1999-01-01
+	1136073600,		//2006-01-01
+	1230768000,		//2009-01-01
+	1341100800,		//2012-07-01
+	1435708800,		//2015-07-01
+	1483228800		//2017-01-01
+};
+
+/*! \brief Number of entries of the leap second table.
+*/
+static const int iLeapSecondCount = (int)(sizeof(iLeapSecondsUnix) / sizeof(iLeapSecondsUnix[0]));
+
+/*! \brief 90 kHz ticks per second.
+*/
+static const uint64_t uTicksPerSecond = 90000;
+
+int CSpliceUTC::GetGpsUtcOffset(const int64_t& iGpsSeconds) {
+	//GPS time of the leap midnight i is its Unix time shifted to the GPS epoch plus the i + 1 leap seconds counted at that point
+	int iOffset = 0;
+	while (iOffset < iLeapSecondCount && iGpsSeconds >= iLeapSecondsUnix[iOffset] - iGpsEpochUnix + iOffset + 1) {
+		iOffset++;
+	}
+	return iOffset;
+}
+
+int64_t CSpliceUTC::GpsToUnix(const uint32_t& uGpsSeconds) {
+	return GpsToUnix(uGpsSeconds, GetGpsUtcOffset(uGpsSeconds));
+}
+
+int64_t CSpliceUTC::GpsToUnix(const uint32_t& uGpsSeconds, const int& iGpsUtcOffset) {
+	return (int64_t)uGpsSeconds + iGpsEpochUnix - iGpsUtcOffset;
+}
+
+int64_t CSpliceUTC::UnixToGps(const int64_t& iUnixSeconds) {
+	int iOffset = 0;
+	while (iOffset < iLeapSecondCount && iUnixSeconds >= iLeapSecondsUnix[iOffset]) {
+		iOffset++;
+	}
+	return iUnixSeconds - iGpsEpochUnix + iOffset;
+}
+
+bool CSpliceScheduleIndex::SEntryLess::operator()(const SScheduleEntry& objLeft, const SScheduleEntry& objRight) const {
+	if (objLeft.iStart != objRight.iStart) {
+		return objLeft.iStart < objRight.iStart;
+	}
+	if (objLeft.uChannel != objRight.uChannel) {
+		return objLeft.uChannel < objRight.uChannel;
+	}
+	if (objLeft.splice_event_id != objRight.splice_event_id) {
+		return objLeft.splice_event_id < objRight.splice_event_id;
+	}
+	return objLeft.component_tag < objRight.component_tag;
+}
+
+const uint32_t CSpliceScheduleIndex::CEntryTree::uNil;
+
+void CSpliceScheduleIndex::CEntryTree::Refresh(const uint32_t& uNode) {
+	SNode& objNode = m_vNodes[uNode];
+	objNode.iMaxEnd = objNode.objEntry.iEnd;
+	if (objNode.uLeft != uNil) {
+		objNode.iMaxEnd = std::max(objNode.iMaxEnd, m_vNodes[objNode.uLeft].iMaxEnd);
+	}
+	if (objNode.uRight != uNil) {
+		objNode.iMaxEnd = std::max(objNode.iMaxEnd, m_vNodes[objNode.uRight].iMaxEnd);
+	}
+}
+
+void CSpliceScheduleIndex::CEntryTree::Split(const uint32_t& uNode, const SScheduleEntry& objEntry, uint32_t& uLess, uint32_t& uNotLess) {
+	const uint32_t uIndex = uNode;
+	if (uIndex == uNil) {
+		uLess = uNil;
+		uNotLess = uNil;
+		return;
+	}
+
+	uint32_t uChild = uNil;
+	if (SEntryLess()(m_vNodes[uIndex].objEntry, objEntry)) {
+		Split(m_vNodes[uIndex].uRight, objEntry, uChild, uNotLess);
+		m_vNodes[uIndex].uRight = uChild;
+		uLess = uIndex;
+	}
+	else {
+		Split(m_vNodes[uIndex].uLeft, objEntry, uLess, uChild);
+		m_vNodes[uIndex].uLeft = uChild;
+		uNotLess = uIndex;
+	}
+	Refresh(uIndex);
+}
+
+uint32_t CSpliceScheduleIndex::CEntryTree::Merge(const uint32_t& uLess, const uint32_t& uNotLess) {
+	if (uLess == uNil) {
+		return uNotLess;
+	}
+	if (uNotLess == uNil) {
+		return uLess;
+	}
+
+	const uint32_t uLeft = uLess;
+	const uint32_t uRight = uNotLess;
+	if (m_vNodes[uLeft].uPriority > m_vNodes[uRight].uPriority) {
+		const uint32_t uChild = Merge(m_vNodes[uLeft].uRight, uRight);
+		m_vNodes[uLeft].uRight = uChild;
+		Refresh(uLeft);
+		return uLeft;
+	}
+	const uint32_t uChild = Merge(uLeft, m_vNodes[uRight].uLeft);
+	m_vNodes[uRight].uLeft = uChild;
+	Refresh(uRight);
+	return uRight;
+}
+
+void CSpliceScheduleIndex::CEntryTree::Insert(const SScheduleEntry& objEntry) {
+	const SEntryLess objLess;
+	uint32_t uNode = m_uRoot;
+	while (uNode != uNil) {
+		const SScheduleEntry& objNodeEntry = m_vNodes[uNode].objEntry;
+		if (objLess(objEntry, objNodeEntry)) {
+			uNode = m_vNodes[uNode].uLeft;
+		}
+		else if (objLess(objNodeEntry, objEntry)) {
+			uNode = m_vNodes[uNode].uRight;
+		}
+		else {
+			return;
+		}
+	}
+
+	uint32_t uAdded = 0;
+	if (!m_vFree.empty()) {
+		uAdded = m_vFree.back();
+		m_vFree.pop_back();
+	}
+	else {
+		uAdded = (uint32_t)m_vNodes.size();
+		m_vNodes.emplace_back();
+	}
+
+	//splitmix64 of a counter, priorities only have to be independent of the entry order
+	uint64_t uPriority = (m_uSeed += 0x9E3779B97F4A7C15ull);
+	uPriority = (uPriority ^ (uPriority >> 30)) * 0xBF58476D1CE4E5B9ull;
+	uPriority = (uPriority ^ (uPriority >> 27)) * 0x94D049BB133111EBull;
+
+	SNode& objNode = m_vNodes[uAdded];
+	objNode.objEntry = objEntry;
+	objNode.iMaxEnd = objEntry.iEnd;
+	objNode.uPriority = uPriority ^ (uPriority >> 31);
+	objNode.uLeft = uNil;
+	objNode.uRight = uNil;
+
+	uint32_t uLess = uNil;
+	uint32_t uNotLess = uNil;
+	Split(m_uRoot, objEntry, uLess, uNotLess);
+	m_uRoot = Merge(Merge(uLess, uAdded), uNotLess);
+}
+
+uint32_t CSpliceScheduleIndex::CEntryTree::Erase(const uint32_t& uNode, const SScheduleEntry& objEntry, bool& bErased) {
+	const uint32_t uIndex = uNode;
+	if (uIndex == uNil) {
+		return uNil;
+	}
+
+	const SEntryLess objLess;
+	if (objLess(objEntry, m_vNodes[uIndex].objEntry)) {
+		const uint32_t uChild = Erase(m_vNodes[uIndex].uLeft, objEntry, bErased);
+		m_vNodes[uIndex].uLeft = uChild;
+	}
+	else if (objLess(m_vNodes[uIndex].objEntry, objEntry)) {
+		const uint32_t uChild = Erase(m_vNodes[uIndex].uRight, objEntry, bErased);
+		m_vNodes[uIndex].uRight = uChild;
+	}
+	else {
+		bErased = true;
+		m_vFree.push_back(uIndex);
+		return Merge(m_vNodes[uIndex].uLeft, m_vNodes[uIndex].uRight);
+	}
+	Refresh(uIndex);
+	return uIndex;
+}
+
+bool CSpliceScheduleIndex::CEntryTree::Erase(const SScheduleEntry& objEntry) {
+	bool bErased = false;
+	m_uRoot = Erase(m_uRoot, objEntry, bErased);
+	return bErased;
+}
+
+void CSpliceScheduleIndex::CEntryTree::Query(const uint32_t& uNode, const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries, std::size_t& iFound) const {
+	//A subtree whose latest end is before the window holds nothing to report
+	if (uNode == uNil || m_vNodes[uNode].iMaxEnd < iFrom) {
+		return;
+	}
+
+	const SNode& objNode = m_vNodes[uNode];
+	Query(objNode.uLeft, iFrom, iTo, vEntries, iFound);
+	if (objNode.objEntry.iStart > iTo) {
+		return;//So does the right subtree
+	}
+	if (objNode.objEntry.iEnd >= iFrom) {
+		vEntries.push_back(objNode.objEntry);
+		iFound++;
+	}
+	Query(objNode.uRight, iFrom, iTo, vEntries, iFound);
+}
+
+std::size_t CSpliceScheduleIndex::CEntryTree::Query(const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries) const {
+	std::size_t iFound = 0;
+	if (iFrom <= iTo) {
+		Query(m_uRoot, iFrom, iTo, vEntries, iFound);
+	}
+	return iFound;
+}
+
+void CSpliceScheduleIndex::CEntryTree::Clear() {
+	m_vNodes.clear();
+	m_vFree.clear();
+	m_uRoot = uNil;
+}
+
+CSpliceScheduleIndex::CSpliceScheduleIndex(const std::size_t& iExpectedChannels) :
+m_mChannels(iExpectedChannels)
+{
+}
+
+void CSpliceScheduleIndex::RemoveEvent(SChannelSchedule& objChannel, const uint32_t& uSpliceEventId) {
+	std::vector<SScheduleEntry>* pEntries = objChannel.mEvents.Find(uSpliceEventId);
+	if (pEntries == nullptr) {
+		return;
+	}
+
+	for (const SScheduleEntry& objEntry : *pEntries) {
+		objChannel.objEntries.Erase(objEntry);
+		m_objAll.Erase(objEntry);
+	}
+	objChannel.mEvents.Erase(uSpliceEventId);
+}
+
+std::size_t CSpliceScheduleIndex::Update(const uint64_t& uChannel, const CSpliceClass& objCue) {
+	if (objCue.GetSInfoData().splice_command_type != scte35Cmd::splice_schedule) {
+		return 0;
+	}
+
+	bool bInserted = false;
+	SChannelSchedule& objChannel = m_mChannels.Insert(uChannel, bInserted);
+	std::size_t iAdded = 0;
+	for (const SpliceScheduleChild& objChild : objCue.GetSpliceSchedule().v_childs) {
+		RemoveEvent(objChannel, objChild.splice_event_id);
+		if (objChild.splice_event_cancel_indicator == 1) {
+			continue;
+		}
+
+		SScheduleEntry objEntry;
+		objEntry.uChannel = uChannel;
+		objEntry.splice_event_id = objChild.splice_event_id;
+		objEntry.out_of_network_indicator = objChild.out_of_network_indicator;
+		objEntry.unique_program_id = objChild.unique_program_id;
+		objEntry.avail_num = objChild.avail_num;
+		objEntry.avails_expected = objChild.avails_expected;
+
+		int64_t iDuration = 0;
+		if (objChild.duration_flag == 1) {
+			objEntry.auto_return = objChild.m_breakD.auto_return;
+			iDuration = (int64_t)((objChild.m_breakD.duration + uTicksPerSecond - 1) / uTicksPerSecond);
+		}
+
+		std::vector<SScheduleEntry>& vEvent = objChannel.mEvents.Insert(objChild.splice_event_id, bInserted);
+		if (objChild.program_splice_flag == 1) {
+			objEntry.iStart = CSpliceUTC::GpsToUnix(objChild.utc_splice_time);
+			objEntry.iEnd = objEntry.iStart + iDuration;
+			vEvent.push_back(objEntry);
+		}
+		else {
+			for (const SSchComponent& objComponent : objChild.v_Component_childs) {
+				objEntry.component_tag = objComponent.component_tag;
+				objEntry.iStart = CSpliceUTC::GpsToUnix(objComponent.utc_splice_time);
+				objEntry.iEnd = objEntry.iStart + iDuration;
+				vEvent.push_back(objEntry);
+			}
+		}
+
+		for (const SScheduleEntry& objAdded : vEvent) {
+			objChannel.objEntries.Insert(objAdded);
+			m_objAll.Insert(objAdded);
+		}
+		if (vEvent.empty()) {
+			objChannel.mEvents.Erase(objChild.splice_event_id);
+		}
+		iAdded += vEvent.size();
+	}
+	return iAdded;
+}
+
+std::size_t CSpliceScheduleIndex::Query(const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries) const {
+	return m_objAll.Query(iFrom, iTo, vEntries);
+}
+
+std::size_t CSpliceScheduleIndex::Query(const uint64_t& uChannel, const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries) const {
+	const SChannelSchedule* pChannel = m_mChannels.Find(uChannel);
+	if (pChannel == nullptr) {
+		return 0;
+	}
+	return pChannel->objEntries.Query(iFrom, iTo, vEntries);
+}
+
+std::size_t CSpliceScheduleIndex::EraseBefore(const int64_t& iTime) {
+	std::size_t iRemoved = 0;
+	m_mChannels.ForEach([&](const uint64_t&, SChannelSchedule& objChannel) {
+		std::vector<uint32_t> vEnded;
+		objChannel.mEvents.ForEach([&](const uint64_t& uEventId, const std::vector<SScheduleEntry>& vEvent) {
+			bool bEnded = true;
+			for (const SScheduleEntry& objEntry : vEvent) {
+				bEnded = bEnded && objEntry.iEnd < iTime;
+			}
+			if (bEnded) {
+				vEnded.push_back((uint32_t)uEventId);
+				iRemoved += vEvent.size();
+			}
+		});
+		for (const uint32_t& uEventId : vEnded) {
+			RemoveEvent(objChannel, uEventId);
+		}
+	});
+	return iRemoved;
+}
+
+void CSpliceScheduleIndex::ResetValue() {
+	m_objAll.Clear();
+	m_mChannels.Clear();
+}
+
+};
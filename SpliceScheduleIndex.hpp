@@ -0,0 +1,261 @@
+/*! \file SpliceScheduleIndex.hpp
+*	\brief Splice schedule UTC conversion and index classes declaration.
+*	\details Header file for declaration of classes CSpliceUTC and CSpliceScheduleIndex whose definition is in SpliceScheduleIndex.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICESCHEDULEINDEX_HPP_
+/*! \brief SpliceScheduleIndex.hpp header guard define.
+*/
+#define _SPLICESCHEDULEINDEX_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CSpliceUTC
+*	\brief #CSpliceUTC class converting utc_splice_time values (GPS seconds) to Unix time.
+*
+*	utc_splice_time counts the seconds since 00:00:00 UTC, January 6th 1980 including the leap seconds inserted since then, which is GPS time.
+*	Unix time excludes leap seconds, so the conversion subtracts the GPS to UTC offset (18 seconds since January 1st 2017) taken from a built-in
+*	leap second table. When a newer offset is known (e.g. from the GPS_UTC_offset of a system time table) pass it explicitly.
+*/
+class CSpliceUTC {
+public:
+	/*! \brief Unix time of the GPS epoch, 00:00:00 UTC January 6th 1980.
+	*/
+	static const int64_t iGpsEpochUnix = 315964800;
+
+	/*! \brief Function to convert GPS seconds to Unix time with the built-in leap second table.
+	*	\param uGpsSeconds utc_splice_time value.
+	*	\returns Unix time in seconds.
+	*/
+	static int64_t GpsToUnix(const uint32_t& uGpsSeconds);
+
+	/*! \brief Function to convert GPS seconds to Unix time with a known GPS to UTC offset.
+	*	\param uGpsSeconds utc_splice_time value.
+	*	\param iGpsUtcOffset leap seconds between GPS and UTC at that time.
+	*	\returns Unix time in seconds.
+	*/
+	static int64_t GpsToUnix(const uint32_t& uGpsSeconds, const int& iGpsUtcOffset);
+
+	/*! \brief Function to convert Unix time to GPS seconds with the built-in leap second table.
+	*	\param iUnixSeconds Unix time in seconds, not before the GPS epoch.
+	*	\returns GPS seconds.
+	*/
+	static int64_t UnixToGps(const int64_t& iUnixSeconds);
+
+	/*! \brief Function to get the GPS to UTC offset of the built-in leap second table at a GPS time.
+	*	\param iGpsSeconds GPS seconds.
+	*	\returns leap seconds between GPS and UTC.
+	*/
+	static int GetGpsUtcOffset(const int64_t& iGpsSeconds);
+};
+
+/*! \brief Component tag of the program level entries of #CSpliceScheduleIndex (real component tags are 8-bit).
+*/
+#define SCTE35_PROGRAM_COMPONENT 0xFFFFFFFFu
+
+/*!	\class SScheduleEntry
+*	\brief #SScheduleEntry class holding one scheduled splice of a splice_schedule command in Unix time.
+*/
+class SScheduleEntry {
+public:
+	int64_t iStart;							/*!<Unix time of utc_splice_time.*/
+	int64_t iEnd;							/*!<Unix time of the end of break_duration (rounded up), iStart if no duration.*/
+	uint64_t uChannel;						/*!<Channel identifier.*/
+	uint32_t splice_event_id;				/*!<32-bit : splice_event_id of the event.*/
+	uint32_t component_tag;					/*!<8-bit : component_tag, SCTE35_PROGRAM_COMPONENT for a program splice.*/
+	uint32_t out_of_network_indicator;		/*!<1-bit : out_of_network_indicator of the event.*/
+	uint32_t auto_return;					/*!<1-bit : auto_return of break_duration, 0 if no duration.*/
+	uint32_t unique_program_id;				/*!<16-bit : unique_program_id of the event.*/
+	uint32_t avail_num;						/*!<8-bit : avail_num of the event.*/
+	uint32_t avails_expected;				/*!<8-bit : avails_expected of the event.*/
+
+	/*! \brief #SScheduleEntry class default constructor with intializer list.
+	*/
+	SScheduleEntry() :
+	 iStart(PARAMETER_DEF_VAL),
+	 iEnd(PARAMETER_DEF_VAL),
+	 uChannel(PARAMETER_DEF_VAL),
+	 splice_event_id(PARAMETER_DEF_VAL),
+	 component_tag(SCTE35_PROGRAM_COMPONENT),
+	 out_of_network_indicator(PARAMETER_DEF_VAL),
+	 auto_return(PARAMETER_DEF_VAL),
+	 unique_program_id(PARAMETER_DEF_VAL),
+	 avail_num(PARAMETER_DEF_VAL),
+	 avails_expected(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSpliceScheduleIndex
+*	\brief #CSpliceScheduleIndex class indexing the splice_schedule events of many channels by Unix time.
+*
+*	Every program utc_splice_time and every component utc_splice_time becomes one [start, end] interval. Entries are kept in interval trees,
+*	one for all the channels and one per channel: treaps ordered by start time whose nodes carry the latest end of their subtree, so a window
+*	query ("what is scheduled in the next N minutes") skips every subtree ending before the window and stops at the window end, whatever the
+*	durations of the other entries.
+*	A splice_schedule repeating a splice_event_id of a channel replaces its previous entries, splice_event_cancel_indicator removes them.
+*/
+class CSpliceScheduleIndex {
+public:
+	/*! \brief #CSpliceScheduleIndex class constructor.
+	*	\param iExpectedChannels number of channels before the channel map grows.
+	*/
+	explicit CSpliceScheduleIndex(const std::size_t& iExpectedChannels = 64);
+
+	/*!	\brief Deleted copy constructor so #CSpliceScheduleIndex class object cannot be copied.
+	*/
+	CSpliceScheduleIndex(const CSpliceScheduleIndex&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceScheduleIndex class object cannot be assigned.
+	*/
+	void operator=(const CSpliceScheduleIndex&) = delete;
+
+	/*! \brief Function to index the events of a parsed splice_schedule cue.
+	*	\param uChannel channel identifier.
+	*	\param objCue parsed cue, ignored if it is not a splice_schedule.
+	*	\returns number of entries added by the cue.
+	*/
+	std::size_t Update(const uint64_t& uChannel, const CSpliceClass& objCue);
+
+	/*! \brief Function to get the entries of all the channels overlapping [iFrom, iTo], ordered by start time.
+	*	\param iFrom window start in Unix seconds.
+	*	\param iTo window end in Unix seconds.
+	*	\param vEntries matching entries are appended to it.
+	*	\returns number of appended entries.
+	*/
+	std::size_t Query(const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries) const;
+
+	/*! \brief Function to get the entries of one channel overlapping [iFrom, iTo], ordered by start time.
+	*	\param uChannel channel identifier.
+	*	\param iFrom window start in Unix seconds.
+	*	\param iTo window end in Unix seconds.
+	*	\param vEntries matching entries are appended to it.
+	*	\returns number of appended entries.
+	*/
+	std::size_t Query(const uint64_t& uChannel, const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries) const;
+
+	/*! \brief Function to remove the events whose entries all ended before a time.
+	*	\param iTime Unix seconds, an event is removed when the end of each of its entries is < iTime.
+	*	\returns number of removed entries.
+	*/
+	std::size_t EraseBefore(const int64_t& iTime);
+
+	/*! \brief Function to get the number of entries of all the channels.
+	*/
+	std::size_t GetSize() const { return m_objAll.GetSize(); }
+
+	/*! \brief Function to remove all the entries.
+	*/
+	void ResetValue();
+
+private:
+	/*!	\struct SEntryLess
+	*	\brief #SEntryLess structure ordering entries by start time, channel, splice_event_id and component_tag.
+	*/
+	struct SEntryLess {
+		bool operator()(const SScheduleEntry& objLeft, const SScheduleEntry& objRight) const;
+	};
+
+	/*!	\class CEntryTree
+	*	\brief #CEntryTree class holding entries in a treap ordered by #SEntryLess, each node keeping the latest end of its subtree.
+	*/
+	class CEntryTree {
+	public:
+		CEntryTree() : m_uRoot(uNil), m_uSeed(0) {}
+
+		/*! \brief Function to add an entry, an entry equal to one in the tree is ignored.
+		*/
+		void Insert(const SScheduleEntry& objEntry);
+
+		/*! \brief Function to remove an entry.
+		*	\returns true if the entry was in the tree.
+		*/
+		bool Erase(const SScheduleEntry& objEntry);
+
+		/*! \brief Function to append the entries overlapping [iFrom, iTo] ordered by start time.
+		*	\returns number of appended entries.
+		*/
+		std::size_t Query(const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries) const;
+
+		/*! \brief Function to get the number of entries.
+		*/
+		std::size_t GetSize() const { return m_vNodes.size() - m_vFree.size(); }
+
+		/*! \brief Function to remove all the entries.
+		*/
+		void Clear();
+
+	private:
+		/*! \brief Index of a missing child.
+		*/
+		static const uint32_t uNil = 0xFFFFFFFFu;
+
+		/*!	\struct SNode
+		*	\brief #SNode structure holding one entry of the treap.
+		*/
+		struct SNode {
+			SScheduleEntry objEntry;		/*!<Entry of the node.*/
+			int64_t iMaxEnd;				/*!<Latest end of the entries of the subtree.*/
+			uint64_t uPriority;				/*!<Heap priority, the root has the largest.*/
+			uint32_t uLeft;					/*!<Index of the left child, uNil if none.*/
+			uint32_t uRight;				/*!<Index of the right child, uNil if none.*/
+		};
+
+		/*! \brief Function to recompute the latest end of a node from its children.
+		*/
+		void Refresh(const uint32_t& uNode);
+
+		/*! \brief Function to split a subtree in the entries ordered before an entry and the others.
+		*/
+		void Split(const uint32_t& uNode, const SScheduleEntry& objEntry, uint32_t& uLess, uint32_t& uNotLess);
+
+		/*! \brief Function to join two subtrees whose entries of the first are all ordered before the ones of the second.
+		*	\returns root of the joined subtree.
+		*/
+		uint32_t Merge(const uint32_t& uLess, const uint32_t& uNotLess);
+
+		/*! \brief Function to remove an entry from a subtree.
+		*	\returns root of the subtree.
+		*/
+		uint32_t Erase(const uint32_t& uNode, const SScheduleEntry& objEntry, bool& bErased);
+
+		/*! \brief Function to append the entries of a subtree overlapping [iFrom, iTo].
+		*/
+		void Query(const uint32_t& uNode, const int64_t& iFrom, const int64_t& iTo, std::vector<SScheduleEntry>& vEntries, std::size_t& iFound) const;
+
+		std::vector<SNode> m_vNodes;		/*!<Node pool.*/
+		std::vector<uint32_t> m_vFree;		/*!<Indexes of the free nodes of the pool.*/
+		uint32_t m_uRoot;					/*!<Index of the root, uNil if empty.*/
+		uint64_t m_uSeed;					/*!<State of the priority generator.*/
+	};
+
+	/*!	\struct SChannelSchedule
+	*	\brief #SChannelSchedule structure holding the entries of one channel.
+	*/
+	struct SChannelSchedule {
+		CEntryTree objEntries;										/*!<Entries of the channel.*/
+		CSpliceHashMap<std::vector<SScheduleEntry> > mEvents;		/*!<Entries by splice_event_id, to replace or cancel an event.*/
+
+		SChannelSchedule() : mEvents(16) {}
+	};
+
+	/*! \brief Function to remove the entries of an event of a channel.
+	*/
+	void RemoveEvent(SChannelSchedule& objChannel, const uint32_t& uSpliceEventId);
+
+	CEntryTree m_objAll;								/*!<Entries of all the channels.*/
+	CSpliceHashMap<SChannelSchedule> m_mChannels;		/*!<Entries by channel identifier.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,378 @@
+/*! \file SpliceScheduler.cpp
+*	\brief Splice point scheduler class definition.
+*	\details CPP file for definition of class CSpliceScheduler whose declaration is in SpliceScheduler.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceScheduler.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const int CSpliceScheduler::iLevels;
+const int CSpliceScheduler::iSlotBits;
+const uint32_t CSpliceScheduler::uSlots;
+const uint32_t CSpliceScheduler::uWords;
+const uint32_t CSpliceScheduler::uDueList;
+const uint32_t CSpliceScheduler::uNone;
+const uint64_t CSpliceScheduler::uNoKey;
+
+CSpliceScheduler::CSpliceScheduler(const uint64_t& uPreroll, const uint64_t& uResolution) :
+m_uPreroll(uPreroll),
+m_iResolution(uResolution == 0 ? 1 : (int64_t)uResolution),
+m_fCallback(nullptr),
+m_iCurrent(0),
+m_uFree(uNone),
+m_iPending(0)
+{
+	ResetValue();
+}
+
+/*! \brief Function to get the index of the lowest set bit of a non-zero word (de Bruijn multiplication, no intrinsic needed).
+*/
+static uint32_t GetLowestBit(const uint64_t& uWord) {
+	static const uint8_t uIndex[64] = {
+		0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+		62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+		63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+		46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6
+	};
+	return uIndex[((uWord & (~uWord + 1)) * 0x03F79D71B4CB0A89ULL) >> 58];
+}
+
+int64_t CSpliceScheduler::GetTick(const int64_t& iTime) const {
+	if (iTime >= 0) {
+		return iTime / m_iResolution;
+	}
+	return -((-iTime + m_iResolution - 1) / m_iResolution);
+}
+
+uint32_t CSpliceScheduler::AllocNode() {
+	if (m_uFree == uNone) {
+		m_vNodes.emplace_back();
+		m_vNodes.back().uList = uNone;
+		return (uint32_t)(m_vNodes.size() - 1);
+	}
+	uint32_t uNode = m_uFree;
+	m_uFree = m_vNodes[uNode].uNext;
+	return uNode;
+}
+
+void CSpliceScheduler::FreeNode(const uint32_t& uNode) {
+	SWheelNode& objNode = m_vNodes[uNode];
+	objNode.objSplice.pCue.reset();
+	objNode.uList = uNone;
+	objNode.uNext = m_uFree;
+	m_uFree = uNode;
+}
+
+void CSpliceScheduler::Link(const uint32_t& uNode, const uint32_t& uList) {
+	SWheelNode& objNode = m_vNodes[uNode];
+	objNode.uList = uList;
+	objNode.uNext = uNone;
+	objNode.uPrev = m_uTails[uList];
+	if (m_uTails[uList] == uNone) {
+		m_uHeads[uList] = uNode;
+		if (uList < uDueList) {
+			m_uOccupied[uList / uSlots][(uList % uSlots) / 64] |= (uint64_t)1 << (uList % 64);
+		}
+	}
+	else {
+		m_vNodes[m_uTails[uList]].uNext = uNode;
+	}
+	m_uTails[uList] = uNode;
+}
+
+void CSpliceScheduler::Unlink(const uint32_t& uNode) {
+	SWheelNode& objNode = m_vNodes[uNode];
+	if (objNode.uPrev == uNone) {
+		m_uHeads[objNode.uList] = objNode.uNext;
+	}
+	else {
+		m_vNodes[objNode.uPrev].uNext = objNode.uNext;
+	}
+	if (objNode.uNext == uNone) {
+		m_uTails[objNode.uList] = objNode.uPrev;
+		if (objNode.uPrev == uNone && objNode.uList < uDueList) {
+			m_uOccupied[objNode.uList / uSlots][(objNode.uList % uSlots) / 64] &= ~((uint64_t)1 << (objNode.uList % 64));
+		}
+	}
+	else {
+		m_vNodes[objNode.uNext].uPrev = objNode.uPrev;
+	}
+	objNode.uList = uNone;
+}
+
+void CSpliceScheduler::Place(const uint32_t& uNode) {
+	int64_t iExpire = m_vNodes[uNode].iExpire;
+	if (iExpire <= m_iCurrent) {
+		Link(uNode, uDueList);
+		return;
+	}
+
+	uint64_t uDelta = (uint64_t)(iExpire - m_iCurrent);
+	if (uDelta >= ((uint64_t)1 << (iSlotBits * iLevels))) {
+		//Beyond the wheel : park in the farthest slot, the node is placed again when that slot cascades
+		iExpire = m_iCurrent + (int64_t)((uint64_t)1 << (iSlotBits * iLevels)) - 1;
+		uDelta = (uint64_t)(iExpire - m_iCurrent);
+	}
+
+	int iLevel = 0;
+	while (iLevel < iLevels - 1 && uDelta >= ((uint64_t)1 << (iSlotBits * (iLevel + 1)))) {
+		iLevel++;
+	}
+	uint32_t uSlot = (uint32_t)(((uint64_t)iExpire >> (iSlotBits * iLevel)) & (uSlots - 1));
+	Link(uNode, (uint32_t)iLevel * uSlots + uSlot);
+}
+
+void CSpliceScheduler::Remove(const uint32_t& uNode) {
+	Unlink(uNode);
+	if (m_vNodes[uNode].uKey != uNoKey) {
+		m_mKeys.Erase(m_vNodes[uNode].uKey);
+	}
+	FreeNode(uNode);
+	m_iPending--;
+}
+
+void CSpliceScheduler::Cascade(const int& iLevel, const uint32_t& uSlot) {
+	uint32_t uList = (uint32_t)iLevel * uSlots + uSlot;
+	uint32_t uNode = m_uHeads[uList];
+	m_uHeads[uList] = uNone;
+	m_uTails[uList] = uNone;
+	m_uOccupied[iLevel][uSlot / 64] &= ~((uint64_t)1 << (uSlot % 64));
+
+	while (uNode != uNone) {
+		uint32_t uNext = m_vNodes[uNode].uNext;
+		Place(uNode);
+		uNode = uNext;
+	}
+}
+
+uint32_t CSpliceScheduler::GetSlotDistance(const int& iLevel, const uint32_t& uFrom) const {
+	//Words from the one after uFrom round to uFrom itself, the first word is visited twice : high bits first, low bits last
+	const uint32_t uStart = (uFrom + 1) & (uSlots - 1);
+	const uint64_t uHigh = ~0ULL << (uStart % 64);
+	for (uint32_t i = 0;i <= uWords;i++) {
+		const uint32_t uWord = (uStart / 64 + i) % uWords;
+		uint64_t uBits = m_uOccupied[iLevel][uWord];
+		if (i == 0) {
+			uBits &= uHigh;
+		}
+		else if (i == uWords) {
+			uBits &= ~uHigh;
+		}
+		if (uBits != 0) {
+			const uint32_t uDistance = (uWord * 64 + GetLowestBit(uBits) - uFrom) & (uSlots - 1);
+			return uDistance == 0 ? uSlots : uDistance;
+		}
+	}
+	return 0;
+}
+
+std::size_t CSpliceScheduler::FireList(const uint32_t& uList) {
+	if (m_uHeads[uList] == uNone) {
+		return 0;
+	}
+
+	//Release the nodes first so the callbacks may schedule and cancel freely
+	m_vFiring.clear();
+	while (m_uHeads[uList] != uNone) {
+		uint32_t uNode = m_uHeads[uList];
+		m_vFiring.push_back(m_vNodes[uNode].objSplice);
+		Remove(uNode);
+	}
+
+	for (std::size_t i = 0;i < m_vFiring.size();i++) {
+		if (m_fCallback) {
+			m_fCallback(m_vFiring[i]);
+		}
+	}
+
+	std::size_t iFired = m_vFiring.size();
+	m_vFiring.clear();
+	return iFired;
+}
+
+void CSpliceScheduler::Queue(const SScheduledSplice& objSplice, const bool& bCancellable) {
+	uint64_t uKey = bCancellable ? GetKey(objSplice.splice_event_id, objSplice.eAction) : uNoKey;
+	if (uKey != uNoKey) {
+		const uint32_t* pExisting = m_mKeys.Find(uKey);
+		if (pExisting != nullptr) {
+			//Copy the node index, the map slot is cleared by Remove
+			uint32_t uExisting = *pExisting;
+			Remove(uExisting);
+		}
+	}
+
+	uint32_t uNode = AllocNode();
+	SWheelNode& objNode = m_vNodes[uNode];
+	objNode.objSplice = objSplice;
+	objNode.iExpire = objSplice.bImmediate ? m_iCurrent : GetTick(objSplice.iFireTime);
+	objNode.uKey = uKey;
+	Place(uNode);
+	m_iPending++;
+
+	if (uKey != uNoKey) {
+		bool bInserted = false;
+		m_mKeys.Insert(uKey, bInserted) = uNode;
+	}
+}
+
+bool CSpliceScheduler::Schedule(const std::shared_ptr<const CSpliceClass>& pCue) {
+	if (pCue == nullptr || !m_objClock.HasValue()) {
+		return false;
+	}
+
+	const CSpliceClass& objCue = *pCue;
+	uint64_t uAdjustment = objCue.GetSInfoData().pts_adjustment;
+	SScheduledSplice objSplice;
+	objSplice.pCue = pCue;
+	objSplice.iSpliceTime = m_objClock.GetLast();
+
+	uint32_t uCommandType = objCue.GetSInfoData().splice_command_type;
+	if (uCommandType == scte35Cmd::splice_insert) {
+		const SpliceInsertData& objInsert = objCue.GetSpliceInsert();
+		if (objInsert.splice_event_cancel_indicator == 1) {
+			Cancel(objInsert.splice_event_id);
+			return true;
+		}
+
+		objSplice.eAction = objInsert.out_of_network_indicator == 1 ? scte35SpliceAction::splice_out : scte35SpliceAction::splice_in;
+		objSplice.splice_event_id = objInsert.splice_event_id;
+		objSplice.bImmediate = true;
+
+		if (objInsert.splice_immediate_flag == 0) {
+			if (objInsert.program_splice_flag == 1) {
+				if (objInsert.m_spliceT.time_specified_flag == 1) {
+					objSplice.iSpliceTime = m_objClock.GetNearest(CSpliceTimeline::AddPts(objInsert.m_spliceT.pts_time, uAdjustment));
+					objSplice.bImmediate = false;
+				}
+			}
+			else {
+				for (std::size_t i = 0;i < objInsert.v_ChildComps.size();i++) {
+					const splice_time& objTime = objInsert.v_ChildComps[i].m_spliceT;
+					if (objTime.time_specified_flag == 1) {
+						int64_t iTime = m_objClock.GetNearest(CSpliceTimeline::AddPts(objTime.pts_time, uAdjustment));
+						if (objSplice.bImmediate || iTime < objSplice.iSpliceTime) {
+							objSplice.iSpliceTime = iTime;
+						}
+						objSplice.bImmediate = false;
+					}
+				}
+			}
+		}
+		objSplice.iFireTime = objSplice.bImmediate ? objSplice.iSpliceTime : objSplice.iSpliceTime - (int64_t)m_uPreroll;
+		Queue(objSplice, true);
+
+		if (objSplice.eAction == scte35SpliceAction::splice_out && objInsert.duration_flag == 1 && objInsert.m_breakD.auto_return == 1) {
+			SScheduledSplice objReturn = objSplice;
+			objReturn.eAction = scte35SpliceAction::splice_in;
+			objReturn.bImmediate = false;
+			objReturn.bAutoReturn = true;
+			objReturn.iSpliceTime = objSplice.iSpliceTime + (int64_t)objInsert.m_breakD.duration;
+			objReturn.iFireTime = objReturn.iSpliceTime - (int64_t)m_uPreroll;
+			Queue(objReturn, true);
+		}
+		return true;
+	}
+	else if (uCommandType == scte35Cmd::time_signal) {
+		const splice_time& objTime = objCue.GetTimeSignal();
+		objSplice.eAction = scte35SpliceAction::time_signal;
+		objSplice.bImmediate = objTime.time_specified_flag != 1;
+		if (!objSplice.bImmediate) {
+			objSplice.iSpliceTime = m_objClock.GetNearest(CSpliceTimeline::AddPts(objTime.pts_time, uAdjustment));
+		}
+		objSplice.iFireTime = objSplice.bImmediate ? objSplice.iSpliceTime : objSplice.iSpliceTime - (int64_t)m_uPreroll;
+		Queue(objSplice, false);
+		return true;
+	}
+
+	return false;
+}
+
+std::size_t CSpliceScheduler::Cancel(const uint32_t& uSpliceEventId) {
+	std::size_t iRemoved = 0;
+	const scte35SpliceAction::type eActions[] = { scte35SpliceAction::splice_out, scte35SpliceAction::splice_in };
+	for (const scte35SpliceAction::type& eAction : eActions) {
+		const uint32_t* pNode = m_mKeys.Find(GetKey(uSpliceEventId, eAction));
+		if (pNode != nullptr) {
+			uint32_t uNode = *pNode;
+			Remove(uNode);
+			iRemoved++;
+		}
+	}
+	return iRemoved;
+}
+
+std::size_t CSpliceScheduler::Advance(const uint64_t& uPts) {
+	bool bFirst = !m_objClock.HasValue();
+	int64_t iTarget = GetTick(m_objClock.Unwrap(uPts));
+	if (bFirst) {
+		m_iCurrent = iTarget;
+	}
+
+	std::size_t iFired = FireList(uDueList);
+	if (iTarget <= m_iCurrent) {
+		return iFired;
+	}
+	if (m_iPending == 0) {
+		m_iCurrent = iTarget;
+		return iFired;
+	}
+
+	while (m_iCurrent < iTarget) {
+		//Jump to the first tick reaching a non-empty slot of any level (a slot of level L is cascaded at the start of its period)
+		const uint64_t uCurrent = (uint64_t)m_iCurrent;
+		uint64_t uStep = (uint64_t)(iTarget - m_iCurrent);
+		for (int iLevel = 0;iLevel < iLevels;iLevel++) {
+			const uint64_t uPeriod = uCurrent >> (iSlotBits * iLevel);
+			const uint32_t uDistance = GetSlotDistance(iLevel, (uint32_t)(uPeriod & (uSlots - 1)));
+			if (uDistance != 0) {
+				const uint64_t uNext = ((uPeriod + uDistance) << (iSlotBits * iLevel)) - uCurrent;
+				uStep = uNext < uStep ? uNext : uStep;
+			}
+		}
+		m_iCurrent += (int64_t)uStep;
+		uint64_t uTick = (uint64_t)m_iCurrent;
+
+		//At the start of each higher level period, move its slot down (highest level first)
+		if ((uTick & (uSlots - 1)) == 0) {
+			int iTop = 1;
+			while (iTop < iLevels - 1 && ((uTick >> (iSlotBits * iTop)) & (uSlots - 1)) == 0) {
+				iTop++;
+			}
+			for (int iLevel = iTop;iLevel >= 1;iLevel--) {
+				Cascade(iLevel, (uint32_t)((uTick >> (iSlotBits * iLevel)) & (uSlots - 1)));
+			}
+		}
+
+		iFired += FireList((uint32_t)(uTick & (uSlots - 1)));
+		//Points queued by the callbacks for a time already reached
+		iFired += FireList(uDueList);
+	}
+	return iFired;
+}
+
+void CSpliceScheduler::ResetValue() {
+	m_vNodes.clear();
+	m_uFree = uNone;
+	for (uint32_t i = 0;i <= uDueList;i++) {
+		m_uHeads[i] = uNone;
+		m_uTails[i] = uNone;
+	}
+	for (int i = 0;i < iLevels;i++) {
+		for (uint32_t j = 0;j < uWords;j++) {
+			m_uOccupied[i][j] = 0;
+		}
+	}
+	m_iPending = 0;
+	m_mKeys.Clear();
+	m_objClock.ResetValue();
+	m_iCurrent = 0;
+	m_vFiring.clear();
+}
+
+};
@@ -0,0 +1,231 @@
+/*! \file SpliceScheduler.hpp
+*	\brief Splice point scheduler class declaration.
+*	\details Header file for declaration of class CSpliceScheduler whose definition is in SpliceScheduler.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICESCHEDULER_HPP_
+/*! \brief SpliceScheduler.hpp header guard define.
+*/
+#define _SPLICESCHEDULER_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include "SpliceTimeline.hpp"
+#include <functional>
+#include <memory>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35SpliceAction
+*	\brief scte35SpliceAction structure to hold the splice point kinds fired by #CSpliceScheduler.
+*/
+struct scte35SpliceAction {
+	/*!
+	*	\brief A type definition for type (Splice point kinds)
+	*/
+	typedef enum {
+		splice_out = 0,		/*!<splice_insert with out_of_network_indicator 1 (leave the network feed)*/
+		splice_in = 1,		/*!<splice_insert with out_of_network_indicator 0, or the return of a break_duration with auto_return*/
+		time_signal = 2		/*!<time_signal*/
+	}type;
+};
+
+/*!	\class SScheduledSplice
+*	\brief #SScheduledSplice class holding one splice point handed to the #CSpliceScheduler callback.
+*/
+class SScheduledSplice {
+public:
+	scte35SpliceAction::type eAction;				/*!<Kind of splice point.*/
+	uint32_t splice_event_id;						/*!<32-bit : splice_event_id of a splice_insert, 0 for time_signal.*/
+	bool bImmediate;								/*!<Whether splice_immediate_flag (or a time_signal without time) asked for the next possible point.*/
+	bool bAutoReturn;								/*!<Whether this splice_in was generated from break_duration with auto_return.*/
+	int64_t iSpliceTime;							/*!<Unwrapped 90 kHz splice time on the stream clock.*/
+	int64_t iFireTime;								/*!<Unwrapped 90 kHz time the callback was due (splice time minus preroll).*/
+	std::shared_ptr<const CSpliceClass> pCue;		/*!<Parsed cue which scheduled the point.*/
+
+	/*! \brief #SScheduledSplice class default constructor with intializer list.
+	*/
+	SScheduledSplice() :
+	 eAction(scte35SpliceAction::time_signal),
+	 splice_event_id(PARAMETER_DEF_VAL),
+	 bImmediate(false),
+	 bAutoReturn(false),
+	 iSpliceTime(PARAMETER_DEF_VAL),
+	 iFireTime(PARAMETER_DEF_VAL),
+	 pCue(nullptr)
+	{
+	}
+};
+
+/*!	\class CSpliceScheduler
+*	\brief #CSpliceScheduler class firing a callback ahead of the splice points of one stream.
+*
+*	Cues given to #Schedule are converted to the stream clock (pts_time plus pts_adjustment, unwrapped next to the current stream time) and queued
+*	for splice time minus the preroll. The stream time is given to #Advance, which fires every due point in time order of the wheel ticks.
+*	Points are kept in a hierarchical timer wheel of 4 levels of 256 slots: queueing and cancelling are O(1) whatever the number of pending
+*	points. A bitmap of the non-empty slots of each level lets #Advance jump straight to the next tick with a slot to fire or cascade, so
+*	moving the clock costs per occupied slot reached, not per elapsed tick. Nodes come from a pool and are chained in intrusive lists, so a
+*	steady state does not allocate.
+*
+*	- splice_immediate_flag (and time_signal without time) fires at the next #Advance.
+*	- splice_event_cancel_indicator removes the pending points of the splice_event_id.
+*	- break_duration with auto_return queues the splice_in at splice time plus duration.
+*	- A repeated splice_insert of the same splice_event_id and direction replaces the pending point.
+*	- Component splice mode uses the earliest component splice_time.
+*/
+class CSpliceScheduler {
+public:
+	/*! \brief Callback receiving the due splice points.
+	*/
+	typedef std::function<void(const SScheduledSplice&)> Callback;
+
+	/*! \brief #CSpliceScheduler class constructor.
+	*	\param uPreroll 90 kHz ticks the callback fires before the splice time.
+	*	\param uResolution 90 kHz ticks per wheel tick (accuracy of the firing time), 0 is taken as 1.
+	*/
+	explicit CSpliceScheduler(const uint64_t& uPreroll = 0, const uint64_t& uResolution = 90);
+
+	/*!	\brief Deleted copy constructor so #CSpliceScheduler class object cannot be copied.
+	*/
+	CSpliceScheduler(const CSpliceScheduler&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceScheduler class object cannot be assigned.
+	*/
+	void operator=(const CSpliceScheduler&) = delete;
+
+	/*! \brief Function to set the callback receiving the due splice points. It may call #Schedule and #Cancel but not #Advance.
+	*/
+	void SetCallback(const Callback& fCallback) { m_fCallback = fCallback; }
+
+	/*! \brief Function to set the preroll of the points scheduled afterwards.
+	*/
+	void SetPreroll(const uint64_t& uPreroll) { m_uPreroll = uPreroll; }
+
+	/*! \brief Function to queue the splice points of a parsed splice_insert or time_signal cue.
+	*	\param pCue parsed cue.
+	*	\returns true if the cue was handled (queued or cancelled) and false if it is not a splice_insert or time_signal, or no stream time was
+	*	given to #Advance yet.
+	*/
+	bool Schedule(const std::shared_ptr<const CSpliceClass>& pCue);
+
+	/*! \brief Function to remove the pending points of a splice_event_id.
+	*	\param uSpliceEventId splice_event_id.
+	*	\returns number of removed points.
+	*/
+	std::size_t Cancel(const uint32_t& uSpliceEventId);
+
+	/*! \brief Function to move the stream clock forward and fire the due points.
+	*	\param uPts 33-bit 90 kHz current stream time.
+	*	\returns number of fired points.
+	*/
+	std::size_t Advance(const uint64_t& uPts);
+
+	/*! \brief Function to get the current unwrapped stream time (valid once #Advance was called).
+	*/
+	int64_t GetNow() const { return m_objClock.GetLast(); }
+
+	/*! \brief Function to get the number of pending points.
+	*/
+	std::size_t GetPendingCount() const { return m_iPending; }
+
+	/*! \brief Function to drop all the pending points and forget the stream clock.
+	*/
+	void ResetValue();
+
+private:
+	/*! \brief Number of wheel levels.
+	*/
+	static const int iLevels = 4;
+	/*! \brief Bits of the slot index of one level.
+	*/
+	static const int iSlotBits = 8;
+	/*! \brief Slots per level.
+	*/
+	static const uint32_t uSlots = 1u << iSlotBits;
+	/*! \brief 64-bit words of the occupancy bitmap of one level.
+	*/
+	static const uint32_t uWords = uSlots / 64;
+	/*! \brief List index of the points due at the next #Advance.
+	*/
+	static const uint32_t uDueList = iLevels * uSlots;
+	/*! \brief Null node index of the intrusive lists.
+	*/
+	static const uint32_t uNone = 0xFFFFFFFFu;
+	/*! \brief Key of the points which cannot be cancelled (time_signal).
+	*/
+	static const uint64_t uNoKey = ~0ULL;
+
+	/*!	\struct SWheelNode
+	*	\brief #SWheelNode structure holding one pending point and its intrusive list links.
+	*/
+	struct SWheelNode {
+		SScheduledSplice objSplice;		/*!<Pending point.*/
+		int64_t iExpire;				/*!<Wheel tick of the point.*/
+		uint64_t uKey;					/*!<Key in m_mKeys, or uNoKey if not cancellable.*/
+		uint32_t uList;					/*!<List holding the node, uNone when free.*/
+		uint32_t uPrev;					/*!<Previous node of the list.*/
+		uint32_t uNext;					/*!<Next node of the list (or of the free list).*/
+	};
+
+	/*! \brief Function to queue one point.
+	*/
+	void Queue(const SScheduledSplice& objSplice, const bool& bCancellable);
+	/*! \brief Function to take a node from the pool.
+	*/
+	uint32_t AllocNode();
+	/*! \brief Function to return a node to the pool.
+	*/
+	void FreeNode(const uint32_t& uNode);
+	/*! \brief Function to link a node into the list matching its expiry.
+	*/
+	void Place(const uint32_t& uNode);
+	/*! \brief Function to link a node at the tail of a list.
+	*/
+	void Link(const uint32_t& uNode, const uint32_t& uList);
+	/*! \brief Function to unlink a node from its list.
+	*/
+	void Unlink(const uint32_t& uNode);
+	/*! \brief Function to remove a pending node and its key.
+	*/
+	void Remove(const uint32_t& uNode);
+	/*! \brief Function to get the number of slot steps from a slot index to the next non-empty slot of a level.
+	*	\returns 1 to #uSlots (the slot itself comes last, one turn later), 0 if every slot of the level is empty.
+	*/
+	uint32_t GetSlotDistance(const int& iLevel, const uint32_t& uFrom) const;
+	/*! \brief Function to re-place all the nodes of a higher level slot.
+	*/
+	void Cascade(const int& iLevel, const uint32_t& uSlot);
+	/*! \brief Function to fire and remove all the nodes of a list.
+	*/
+	std::size_t FireList(const uint32_t& uList);
+	/*! \brief Function to get the wheel tick of an unwrapped time.
+	*/
+	int64_t GetTick(const int64_t& iTime) const;
+	/*! \brief Function to get the key of a cancellable point.
+	*/
+	static uint64_t GetKey(const uint32_t& uSpliceEventId, const scte35SpliceAction::type& eAction) { return ((uint64_t)uSpliceEventId << 1) | (eAction == scte35SpliceAction::splice_in ? 1 : 0); }
+
+	uint64_t m_uPreroll;							/*!<Preroll in 90 kHz ticks.*/
+	int64_t m_iResolution;							/*!<90 kHz ticks per wheel tick.*/
+	Callback m_fCallback;							/*!<Receiver of the due points.*/
+	CPtsUnwrapper m_objClock;						/*!<Stream clock.*/
+	int64_t m_iCurrent;								/*!<Last processed wheel tick.*/
+	std::vector<SWheelNode> m_vNodes;				/*!<Node pool.*/
+	uint32_t m_uFree;								/*!<Head of the free node list.*/
+	uint32_t m_uHeads[iLevels * uSlots + 1];		/*!<Heads of the slot lists and of the due list.*/
+	uint32_t m_uTails[iLevels * uSlots + 1];		/*!<Tails of the slot lists and of the due list, points of a list fire in queueing order.*/
+	uint64_t m_uOccupied[iLevels][uWords];			/*!<Bit per non-empty slot list of each level.*/
+	std::vector<SScheduledSplice> m_vFiring;		/*!<Points of the list being fired, the callbacks run once the list is released.*/
+	std::size_t m_iPending;							/*!<Number of pending points.*/
+	CSpliceHashMap<uint32_t> m_mKeys;				/*!<Nodes of the cancellable points by splice_event_id and direction.*/
+};
+
+};
+
+#endif
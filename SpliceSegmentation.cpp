@@ -0,0 +1,236 @@
+/*! \file SpliceSegmentation.cpp
+*	\brief Splice segmentation event tracker class definition.
+*	\details CPP file for definition of class CSegmentationTracker whose declaration is in SpliceSegmentation.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceSegmentation.hpp"
+#include "SpliceTimeline.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Differences of 33-bit PTS values at or above this are taken as negative (the later time is before the earlier one).
+*/
+static const uint64_t uPtsHalfRange = 0x100000000ULL;
+
+CSegmentationTracker::CSegmentationTracker(const std::size_t& iExpectedEvents) :
+m_mEvents(iExpectedEvents),
+m_iOpenCount(0)
+{
+}
+
+bool CSegmentationTracker::IsStartType(const uint32_t& uTypeId) {
+	switch (uTypeId)
+	{
+		case 0x10: case 0x13: case 0x17: case 0x19:
+		case 0x20: case 0x22: case 0x24: case 0x26:
+		case 0x30: case 0x32: case 0x34: case 0x36: case 0x38: case 0x3A: case 0x3C: case 0x3E:
+		case 0x40: case 0x42: case 0x44: case 0x46: case 0x50:
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool CSegmentationTracker::IsEndType(const uint32_t& uTypeId) {
+	switch (uTypeId)
+	{
+		case 0x11: case 0x12: case 0x14:
+		case 0x21: case 0x23: case 0x25: case 0x27:
+		case 0x31: case 0x33: case 0x35: case 0x37: case 0x39: case 0x3B: case 0x3D: case 0x3F:
+		case 0x41: case 0x43: case 0x45: case 0x47: case 0x51:
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool CSegmentationTracker::IsPair(const uint32_t& uStartTypeId, const uint32_t& uEndTypeId) {
+	switch (uEndTypeId)
+	{
+		case 0x11:	//Program End closes Program Start, Program Overlap Start and Program Start-In Progress
+			return uStartTypeId == 0x10 || uStartTypeId == 0x17 || uStartTypeId == 0x19;
+		case 0x12:	//Program Early Termination overrides Program End
+			return uStartTypeId == 0x10 || uStartTypeId == 0x19;
+		case 0x14:	//Program Resumption closes Program Breakaway
+			return uStartTypeId == 0x13;
+		default:	//Other pairs are start and start + 1
+			return IsStartType(uStartTypeId) && uStartTypeId >= 0x20 && uEndTypeId == uStartTypeId + 1;
+	}
+}
+
+void CSegmentationTracker::Emit(const SSegmentationEvent& objState, const scte35SegEvent::type& eKind, std::vector<SSegmentationEvent>& vEvents) {
+	vEvents.push_back(objState);
+	vEvents.back().eKind = eKind;
+}
+
+std::size_t CSegmentationTracker::Update(const CSpliceClass& objCue, std::vector<SSegmentationEvent>& vEvents) {
+	uint64_t uPts = 0;
+	bool bHasPts = CSpliceTimeline::GetCuePts(objCue, uPts);
+
+	std::size_t iAdded = 0;
+	const std::vector<SDBase*>& vDescriptors = objCue.GetDescriptors();
+	for (std::size_t i = 0;i < vDescriptors.size();i++) {
+		if (vDescriptors[i]->splice_descriptor_tag == scte35Desc::segmentation_descriptor && CSpliceClass::IsBuiltInDescriptor(*vDescriptors[i])) {
+			iAdded += Update(*static_cast<const SegmentationDescriptor*>(vDescriptors[i]), bHasPts, uPts, vEvents);
+		}
+	}
+	return iAdded;
+}
+
+std::size_t CSegmentationTracker::Update(const SegmentationDescriptor& objDesc, const bool& bHasPts, const uint64_t& uPts, std::vector<SSegmentationEvent>& vEvents) {
+	std::size_t iBefore = vEvents.size();
+	SSegmentationEvent* pState = m_mEvents.Find(objDesc.segmentation_event_id);
+	bool bOpen = pState != nullptr && pState->eKind == scte35SegEvent::opened;
+
+	if (objDesc.segmentation_event_cancel_indicator == 1) {
+		if (bOpen) {
+			pState->end_type_id = 0;
+			pState->bHasEndPts = bHasPts;
+			pState->uEndPts = uPts;
+			pState->eKind = scte35SegEvent::cancelled;
+			m_iOpenCount--;
+			Emit(*pState, scte35SegEvent::cancelled, vEvents);
+		}
+		return vEvents.size() - iBefore;
+	}
+
+	uint32_t uTypeId = objDesc.segmentation_type_id;
+	if (IsStartType(uTypeId)) {
+		if (pState != nullptr && pState->start_type_id == uTypeId) {
+			if (bOpen) {
+				//Repeated start, only the segment numbering may progress
+				pState->segment_num = objDesc.segment_num;
+				pState->segments_expected = objDesc.segments_expected;
+				return 0;
+			}
+			if (pState->eKind != scte35SegEvent::cancelled && pState->bHasStartPts && bHasPts && pState->uStartPts == uPts) {
+				//Late repeat of the start of an already closed event
+				return 0;
+			}
+		}
+
+		if (bOpen) {
+			//Another start type reusing an open segmentation_event_id, the previous segment never ended
+			pState->bHasEndPts = bHasPts;
+			pState->uEndPts = uPts;
+			Emit(*pState, scte35SegEvent::orphaned, vEvents);
+			m_iOpenCount--;
+		}
+
+		bool bInserted = false;
+		SSegmentationEvent& objState = m_mEvents.Insert(objDesc.segmentation_event_id, bInserted);
+		objState = SSegmentationEvent();
+		objState.eKind = scte35SegEvent::opened;
+		objState.segmentation_event_id = objDesc.segmentation_event_id;
+		objState.start_type_id = uTypeId;
+		objState.segment_num = objDesc.segment_num;
+		objState.segments_expected = objDesc.segments_expected;
+		objState.bHasStartPts = bHasPts;
+		objState.uStartPts = uPts;
+		objState.bHasDuration = objDesc.segmentation_duration_flag == 1;
+		objState.uDuration = objState.bHasDuration ? objDesc.segmentation_duration : 0;
+		m_iOpenCount++;
+		Emit(objState, scte35SegEvent::opened, vEvents);
+	}
+	else if (IsEndType(uTypeId)) {
+		if (bOpen && IsPair(pState->start_type_id, uTypeId)) {
+			pState->eKind = scte35SegEvent::closed;
+			pState->end_type_id = uTypeId;
+			pState->segment_num = objDesc.segment_num;
+			pState->segments_expected = objDesc.segments_expected;
+			pState->bHasEndPts = bHasPts;
+			pState->uEndPts = uPts;
+			m_iOpenCount--;
+			Emit(*pState, scte35SegEvent::closed, vEvents);
+		}
+		else if (pState != nullptr && !bOpen && pState->end_type_id == uTypeId) {
+			//Repeated end of an already closed event or of an already reported orphaned end
+		}
+		else {
+			SSegmentationEvent objOrphan;
+			objOrphan.eKind = scte35SegEvent::orphaned;
+			objOrphan.segmentation_event_id = objDesc.segmentation_event_id;
+			objOrphan.end_type_id = uTypeId;
+			objOrphan.segment_num = objDesc.segment_num;
+			objOrphan.segments_expected = objDesc.segments_expected;
+			objOrphan.bHasEndPts = bHasPts;
+			objOrphan.uEndPts = uPts;
+			Emit(objOrphan, scte35SegEvent::orphaned, vEvents);
+
+			if (!bOpen) {
+				//Remember it so the repeats of this end are not reported again
+				bool bInserted = false;
+				m_mEvents.Insert(objDesc.segmentation_event_id, bInserted) = objOrphan;
+			}
+		}
+	}
+
+	return vEvents.size() - iBefore;
+}
+
+std::size_t CSegmentationTracker::Expire(const uint64_t& uPts, const uint64_t& uGrace, std::vector<SSegmentationEvent>& vEvents) {
+	std::size_t iBefore = vEvents.size();
+	m_vExpired.clear();
+
+	m_mEvents.ForEach([&](const uint64_t& uKey, SSegmentationEvent& objState) {
+		if (objState.eKind == scte35SegEvent::opened) {
+			if (objState.bHasStartPts && objState.bHasDuration) {
+				uint64_t uElapsed = (uPts - objState.uStartPts) & CSpliceTimeline::uPtsMask;
+				if (uElapsed < uPtsHalfRange && uElapsed > objState.uDuration + uGrace) {
+					objState.bHasEndPts = true;
+					objState.uEndPts = uPts & CSpliceTimeline::uPtsMask;
+					Emit(objState, scte35SegEvent::orphaned, vEvents);
+					m_vExpired.push_back(uKey);
+				}
+			}
+		}
+		else if (!objState.bHasEndPts) {
+			m_vExpired.push_back(uKey);
+		}
+		else {
+			uint64_t uElapsed = (uPts - objState.uEndPts) & CSpliceTimeline::uPtsMask;
+			if (uElapsed < uPtsHalfRange && uElapsed > uGrace) {
+				m_vExpired.push_back(uKey);
+			}
+		}
+	});
+
+	for (std::size_t i = 0;i < m_vExpired.size();i++) {
+		const SSegmentationEvent* pState = m_mEvents.Find(m_vExpired[i]);
+		if (pState != nullptr && pState->eKind == scte35SegEvent::opened) {
+			m_iOpenCount--;
+		}
+		m_mEvents.Erase(m_vExpired[i]);
+	}
+
+	return vEvents.size() - iBefore;
+}
+
+const SSegmentationEvent* CSegmentationTracker::FindOpen(const uint32_t& uEventId) const {
+	const SSegmentationEvent* pState = m_mEvents.Find(uEventId);
+	if (pState == nullptr || pState->eKind != scte35SegEvent::opened) {
+		return nullptr;
+	}
+	return pState;
+}
+
+void CSegmentationTracker::GetOpenEvents(std::vector<SSegmentationEvent>& vEvents) const {
+	m_mEvents.ForEach([&](const uint64_t&, const SSegmentationEvent& objState) {
+		if (objState.eKind == scte35SegEvent::opened) {
+			vEvents.push_back(objState);
+		}
+	});
+}
+
+void CSegmentationTracker::ResetValue() {
+	m_mEvents.Clear();
+	m_iOpenCount = 0;
+	m_vExpired.clear();
+}
+
+};
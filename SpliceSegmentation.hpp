@@ -0,0 +1,165 @@
+/*! \file SpliceSegmentation.hpp
+*	\brief Splice segmentation event tracker class declaration.
+*	\details Header file for declaration of class CSegmentationTracker whose definition is in SpliceSegmentation.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICESEGMENTATION_HPP_
+/*! \brief SpliceSegmentation.hpp header guard define.
+*/
+#define _SPLICESEGMENTATION_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35SegEvent
+*	\brief scte35SegEvent structure to hold the lifecycle event values emitted by #CSegmentationTracker.
+*/
+struct scte35SegEvent {
+	/*!
+	*	\brief A type definition for type (Segmentation lifecycle events)
+	*/
+	typedef enum {
+		opened = 0,		/*!<A start segmentation_type_id opened a segmentation_event_id*/
+		closed = 1,		/*!<The matching end segmentation_type_id closed an open segmentation_event_id*/
+		cancelled = 2,	/*!<segmentation_event_cancel_indicator cancelled an open segmentation_event_id*/
+		orphaned = 3	/*!<An end without open start, a start replaced by another start type, or a start whose duration elapsed without end*/
+	}type;
+};
+
+/*!	\class SSegmentationEvent
+*	\brief #SSegmentationEvent class holding one lifecycle event of a segmentation_event_id.
+*/
+class SSegmentationEvent {
+public:
+	scte35SegEvent::type eKind;			/*!<Lifecycle event.*/
+	uint32_t segmentation_event_id;		/*!<32-bit : segmentation_event_id of the event.*/
+	uint32_t start_type_id;				/*!<8-bit : segmentation_type_id which opened the event, 0 for an orphaned end.*/
+	uint32_t end_type_id;				/*!<8-bit : segmentation_type_id which closed the event, 0 if not closed by an end.*/
+	uint32_t segment_num;				/*!<8-bit : Latest segment_num received for the event.*/
+	uint32_t segments_expected;			/*!<8-bit : Latest segments_expected received for the event.*/
+	bool bHasStartPts;					/*!<Whether uStartPts is known (start carried by a time_signal with time_specified_flag).*/
+	uint64_t uStartPts;					/*!<33-bit : Start time, pts_time plus pts_adjustment.*/
+	bool bHasEndPts;					/*!<Whether uEndPts is known.*/
+	uint64_t uEndPts;					/*!<33-bit : Time of the cue which closed, cancelled or orphaned the event.*/
+	bool bHasDuration;					/*!<Whether uDuration is known (segmentation_duration_flag of the start).*/
+	uint64_t uDuration;					/*!<40-bit : segmentation_duration of the start.*/
+
+	/*! \brief #SSegmentationEvent class default constructor with intializer list.
+	*/
+	SSegmentationEvent() :
+	 eKind(scte35SegEvent::opened),
+	 segmentation_event_id(PARAMETER_DEF_VAL),
+	 start_type_id(PARAMETER_DEF_VAL),
+	 end_type_id(PARAMETER_DEF_VAL),
+	 segment_num(PARAMETER_DEF_VAL),
+	 segments_expected(PARAMETER_DEF_VAL),
+	 bHasStartPts(false),
+	 uStartPts(PARAMETER_DEF_VAL),
+	 bHasEndPts(false),
+	 uEndPts(PARAMETER_DEF_VAL),
+	 bHasDuration(false),
+	 uDuration(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSegmentationTracker
+*	\brief #CSegmentationTracker class keeping the segmentation event state of one channel from its parsed cues.
+*
+*	Feed every successfully parsed cue of the channel in arrival order to #Update. Each segmentation descriptor is matched by segmentation_event_id
+*	in an open-addressing hash map (#CSpliceHashMap) and start/end segmentation_type_id values are paired as in the SCTE-35 segmentation type table
+*	(Program End also closes Program Overlap Start, Program Early Termination closes Program Start and Program Start-In Progress).
+*	Repeated starts and repeated ends of the same event (cues are sent several times for robustness) do not emit events again: closed events and
+*	orphaned ends are remembered until #Expire drops them or a new start reuses their segmentation_event_id. Segmentation types which are not paired
+*	(Content Identification, Program Runover, ...) are ignored.
+*/
+class CSegmentationTracker {
+public:
+	/*! \brief #CSegmentationTracker class constructor.
+	*	\param iExpectedEvents number of concurrently tracked segmentation_event_id values before the map grows.
+	*/
+	explicit CSegmentationTracker(const std::size_t& iExpectedEvents = 64);
+
+	/*!	\brief Deleted copy constructor so #CSegmentationTracker class object cannot be copied.
+	*/
+	CSegmentationTracker(const CSegmentationTracker&) = delete;
+	/*!	\brief Deleted assignment operator so #CSegmentationTracker class object cannot be assigned.
+	*/
+	void operator=(const CSegmentationTracker&) = delete;
+
+	/*! \brief Function to apply the segmentation descriptors of one parsed cue.
+	*	\param objCue successfully parsed cue of this channel.
+	*	\param vEvents lifecycle events caused by the cue are appended to it (in descriptor order).
+	*	\returns number of appended events.
+	*/
+	std::size_t Update(const CSpliceClass& objCue, std::vector<SSegmentationEvent>& vEvents);
+
+	/*! \brief Function to apply one segmentation descriptor.
+	*	\param objDesc segmentation descriptor.
+	*	\param bHasPts whether uPts is known.
+	*	\param uPts 33-bit time of the cue carrying the descriptor, pts_time plus pts_adjustment.
+	*	\param vEvents lifecycle events caused by the descriptor are appended to it.
+	*	\returns number of appended events.
+	*/
+	std::size_t Update(const SegmentationDescriptor& objDesc, const bool& bHasPts, const uint64_t& uPts, std::vector<SSegmentationEvent>& vEvents);
+
+	/*! \brief Function to orphan the open events whose segmentation_duration elapsed more than uGrace ago and to forget the closed
+	*	events which ended more than uGrace ago (or at an unknown time). Open events without known start or duration are kept.
+	*	\param uPts 33-bit current time of the channel (90 kHz, wraps are handled modulo 2^33).
+	*	\param uGrace 90 kHz ticks of tolerance.
+	*	\param vEvents orphaned events are appended to it.
+	*	\returns number of appended events.
+	*/
+	std::size_t Expire(const uint64_t& uPts, const uint64_t& uGrace, std::vector<SSegmentationEvent>& vEvents);
+
+	/*! \brief Function to get the state of an open segmentation_event_id.
+	*	\param uEventId segmentation_event_id.
+	*	\returns pointer to the state (eKind is scte35SegEvent::opened) or nullptr if the event is not open.
+	*/
+	const SSegmentationEvent* FindOpen(const uint32_t& uEventId) const;
+
+	/*! \brief Function to get the number of open events.
+	*/
+	std::size_t GetOpenCount() const { return m_iOpenCount; }
+
+	/*! \brief Function to get all the open events (order is unspecified).
+	*	\param vEvents open events are appended to it.
+	*/
+	void GetOpenEvents(std::vector<SSegmentationEvent>& vEvents) const;
+
+	/*! \brief Function to forget all the tracked events.
+	*/
+	void ResetValue();
+
+	/*! \brief Function to check if a segmentation_type_id starts a paired segment.
+	*/
+	static bool IsStartType(const uint32_t& uTypeId);
+	/*! \brief Function to check if a segmentation_type_id ends a paired segment.
+	*/
+	static bool IsEndType(const uint32_t& uTypeId);
+	/*! \brief Function to check if an end segmentation_type_id closes a start segmentation_type_id.
+	*/
+	static bool IsPair(const uint32_t& uStartTypeId, const uint32_t& uEndTypeId);
+
+private:
+	/*! \brief Function to append an event built from a tracked state.
+	*/
+	static void Emit(const SSegmentationEvent& objState, const scte35SegEvent::type& eKind, std::vector<SSegmentationEvent>& vEvents);
+
+	CSpliceHashMap<SSegmentationEvent> m_mEvents;		/*!<Open (eKind opened) and recently ended events by segmentation_event_id.*/
+	std::size_t m_iOpenCount;							/*!<Number of open events in m_mEvents.*/
+	std::vector<uint64_t> m_vExpired;					/*!<Scratch list of keys removed by #Expire.*/
+};
+
+};
+
+#endif
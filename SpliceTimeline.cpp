@@ -0,0 +1,185 @@
+/*! \file SpliceTimeline.cpp
+*	\brief Splice PTS timeline classes definition.
+*	\details CPP file for definition of classes CPtsUnwrapper, CSpliceTimeIndex and CSpliceTimeline whose declaration is in SpliceTimeline.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceTimeline.hpp"
+#include <algorithm>
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+const uint64_t CSpliceTimeline::uPtsMask;
+
+/*! \brief Function to order timeline entries by time then insertion order.
+*/
+static bool EntryBefore(const STimelineEntry& objLeft, const STimelineEntry& objRight) {
+	if (objLeft.iTime != objRight.iTime) {
+		return objLeft.iTime < objRight.iTime;
+	}
+	return objLeft.uSequence < objRight.uSequence;
+}
+
+int64_t CPtsUnwrapper::GetNearest(const uint64_t& uPts) const {
+	uint64_t uValue = uPts & CSpliceTimeline::uPtsMask;
+	if (!m_bHasValue) {
+		return (int64_t)uValue;
+	}
+
+	//Signed distance from the last value modulo 2^33, in [-2^32, 2^32)
+	uint64_t uDelta = (uValue - ((uint64_t)m_iLast & CSpliceTimeline::uPtsMask)) & CSpliceTimeline::uPtsMask;
+	int64_t iDelta = uDelta >= 0x100000000ULL ? (int64_t)uDelta - 0x200000000LL : (int64_t)uDelta;
+	return m_iLast + iDelta;
+}
+
+int64_t CPtsUnwrapper::Unwrap(const uint64_t& uPts) {
+	m_iLast = GetNearest(uPts);
+	m_bHasValue = true;
+	return m_iLast;
+}
+
+void CPtsUnwrapper::ResetValue() {
+	m_bHasValue = false;
+	m_iLast = 0;
+}
+
+void CSpliceTimeIndex::Add(const int64_t& iTime, const std::shared_ptr<const CSpliceClass>& pCue) {
+	STimelineEntry objEntry;
+	objEntry.iTime = iTime;
+	objEntry.uSequence = m_uSequence++;
+	objEntry.pCue = pCue;
+
+	if (m_vEntries.empty() || m_vEntries.back().iTime <= iTime) {
+		m_vEntries.push_back(std::move(objEntry));
+	}
+	else {
+		m_vLate.push_back(std::move(objEntry));
+	}
+}
+
+void CSpliceTimeIndex::Merge() {
+	if (m_vLate.empty()) {
+		return;
+	}
+
+	std::sort(m_vLate.begin(), m_vLate.end(), EntryBefore);
+	std::size_t iMiddle = m_vEntries.size();
+	m_vEntries.insert(m_vEntries.end(), std::make_move_iterator(m_vLate.begin()), std::make_move_iterator(m_vLate.end()));
+	std::inplace_merge(m_vEntries.begin(), m_vEntries.begin() + iMiddle, m_vEntries.end(), EntryBefore);
+	m_vLate.clear();
+}
+
+std::size_t CSpliceTimeIndex::Query(const int64_t& iFrom, const int64_t& iTo, std::vector<STimelineEntry>& vEntries) {
+	Merge();
+	if (iFrom > iTo) {
+		return 0;
+	}
+
+	auto itFirst = std::lower_bound(m_vEntries.begin(), m_vEntries.end(), iFrom, [](const STimelineEntry& objEntry, const int64_t& iValue) { return objEntry.iTime < iValue; });
+	auto itLast = std::upper_bound(itFirst, m_vEntries.end(), iTo, [](const int64_t& iValue, const STimelineEntry& objEntry) { return iValue < objEntry.iTime; });
+	vEntries.insert(vEntries.end(), itFirst, itLast);
+	return (std::size_t)(itLast - itFirst);
+}
+
+std::size_t CSpliceTimeIndex::Count(const int64_t& iFrom, const int64_t& iTo) {
+	Merge();
+	if (iFrom > iTo) {
+		return 0;
+	}
+
+	auto itFirst = std::lower_bound(m_vEntries.begin(), m_vEntries.end(), iFrom, [](const STimelineEntry& objEntry, const int64_t& iValue) { return objEntry.iTime < iValue; });
+	auto itLast = std::upper_bound(itFirst, m_vEntries.end(), iTo, [](const int64_t& iValue, const STimelineEntry& objEntry) { return iValue < objEntry.iTime; });
+	return (std::size_t)(itLast - itFirst);
+}
+
+std::size_t CSpliceTimeIndex::EraseBefore(const int64_t& iTime) {
+	Merge();
+	auto itFirst = std::lower_bound(m_vEntries.begin(), m_vEntries.end(), iTime, [](const STimelineEntry& objEntry, const int64_t& iValue) { return objEntry.iTime < iValue; });
+	std::size_t iRemoved = (std::size_t)(itFirst - m_vEntries.begin());
+	m_vEntries.erase(m_vEntries.begin(), itFirst);
+	return iRemoved;
+}
+
+void CSpliceTimeIndex::ResetValue() {
+	m_vEntries.clear();
+	m_vLate.clear();
+	m_uSequence = 0;
+}
+
+CSpliceTimeline::CSpliceTimeline(const std::size_t& iExpectedChannels) :
+m_mChannels(iExpectedChannels)
+{
+}
+
+bool CSpliceTimeline::GetCuePts(const CSpliceClass& objCue, uint64_t& uPts) {
+	const splice_time* pTime = nullptr;
+	uint32_t uCommandType = objCue.GetSInfoData().splice_command_type;
+	if (uCommandType == scte35Cmd::time_signal) {
+		pTime = &objCue.GetTimeSignal();
+	}
+	else if (uCommandType == scte35Cmd::splice_insert) {
+		const SpliceInsertData& objInsert = objCue.GetSpliceInsert();
+		if (objInsert.splice_event_cancel_indicator == 0 && objInsert.program_splice_flag == 1 && objInsert.splice_immediate_flag == 0) {
+			pTime = &objInsert.m_spliceT;
+		}
+	}
+
+	if (pTime == nullptr || pTime->time_specified_flag != 1) {
+		return false;
+	}
+	uPts = AddPts(pTime->pts_time, objCue.GetSInfoData().pts_adjustment);
+	return true;
+}
+
+CSpliceTimeline::SChannelTimeline& CSpliceTimeline::GetChannel(const uint64_t& uChannel) {
+	bool bInserted = false;
+	return m_mChannels.Insert(uChannel, bInserted);
+}
+
+bool CSpliceTimeline::Add(const uint64_t& uChannel, const std::shared_ptr<const CSpliceClass>& pCue, int64_t& iTime) {
+	uint64_t uPts = 0;
+	if (pCue == nullptr || !GetCuePts(*pCue, uPts)) {
+		return false;
+	}
+	iTime = Add(uChannel, uPts, pCue);
+	return true;
+}
+
+int64_t CSpliceTimeline::Add(const uint64_t& uChannel, const uint64_t& uPts, const std::shared_ptr<const CSpliceClass>& pCue) {
+	SChannelTimeline& objChannel = GetChannel(uChannel);
+	int64_t iTime = objChannel.objUnwrapper.Unwrap(uPts);
+	objChannel.objIndex.Add(iTime, pCue);
+	return iTime;
+}
+
+int64_t CSpliceTimeline::Unwrap(const uint64_t& uChannel, const uint64_t& uPts) {
+	return GetChannel(uChannel).objUnwrapper.Unwrap(uPts);
+}
+
+std::size_t CSpliceTimeline::Query(const uint64_t& uChannel, const int64_t& iFrom, const int64_t& iTo, std::vector<STimelineEntry>& vEntries) {
+	SChannelTimeline* pChannel = m_mChannels.Find(uChannel);
+	if (pChannel == nullptr) {
+		return 0;
+	}
+	return pChannel->objIndex.Query(iFrom, iTo, vEntries);
+}
+
+std::size_t CSpliceTimeline::EraseOlderThan(const int64_t& iRetention) {
+	std::size_t iRemoved = 0;
+	m_mChannels.ForEach([&](const uint64_t&, SChannelTimeline& objChannel) {
+		if (objChannel.objUnwrapper.HasValue()) {
+			iRemoved += objChannel.objIndex.EraseBefore(objChannel.objUnwrapper.GetLast() - iRetention);
+		}
+	});
+	return iRemoved;
+}
+
+void CSpliceTimeline::ResetValue() {
+	m_mChannels.Clear();
+}
+
+};
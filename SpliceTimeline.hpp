@@ -0,0 +1,244 @@
+/*! \file SpliceTimeline.hpp
+*	\brief Splice PTS timeline classes declaration.
+*	\details Header file for declaration of classes CPtsUnwrapper, CSpliceTimeIndex and CSpliceTimeline whose definition is in SpliceTimeline.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICETIMELINE_HPP_
+/*! \brief SpliceTimeline.hpp header guard define.
+*/
+#define _SPLICETIMELINE_HPP_
+
+#include "SpliceClass.hpp"
+#include "SpliceHashMap.hpp"
+#include <memory>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\class CPtsUnwrapper
+*	\brief #CPtsUnwrapper class turning the 33-bit 90 kHz PTS values of one clock into a 64-bit timeline without wraps.
+*
+*	Each value is placed at the position nearest to the previous one modulo 2^33, so forward wraps add 2^33 and values a little older than the
+*	previous one (late or repeated cues) stay before it instead of being taken as a wrap. Consecutive values must be less than 2^32 ticks (about
+*	13 hours) apart.
+*/
+class CPtsUnwrapper {
+public:
+	/*! \brief #CPtsUnwrapper class default constructor.
+	*/
+	CPtsUnwrapper() :
+	m_bHasValue(false),
+	m_iLast(0)
+	{
+	}
+
+	/*! \brief Function to place a 33-bit value on the timeline.
+	*	\param uPts 33-bit 90 kHz value (upper bits are ignored).
+	*	\returns unwrapped 90 kHz time, the first value is placed at itself.
+	*/
+	int64_t Unwrap(const uint64_t& uPts);
+
+	/*! \brief Function to get the position a 33-bit value would take, without placing it (e.g. a future splice time relative to the stream clock).
+	*	\param uPts 33-bit 90 kHz value (upper bits are ignored).
+	*	\returns unwrapped 90 kHz time nearest to the last placed value, the value itself if none was placed.
+	*/
+	int64_t GetNearest(const uint64_t& uPts) const;
+
+	/*! \brief Function to check if a value was already placed.
+	*/
+	bool HasValue() const { return m_bHasValue; }
+	/*! \brief Function to get the unwrapped time of the last placed value.
+	*/
+	int64_t GetLast() const { return m_iLast; }
+
+	/*! \brief Function to forget the previous values (after a clock discontinuity).
+	*/
+	void ResetValue();
+
+private:
+	bool m_bHasValue;		/*!<Whether a value was placed.*/
+	int64_t m_iLast;		/*!<Unwrapped time of the last placed value.*/
+};
+
+/*!	\class STimelineEntry
+*	\brief #STimelineEntry class holding one cue placed on a channel timeline.
+*/
+class STimelineEntry {
+public:
+	int64_t iTime;								/*!<Unwrapped 90 kHz splice time.*/
+	uint64_t uSequence;							/*!<Insertion order, keeps cues of the same time in arrival order.*/
+	std::shared_ptr<const CSpliceClass> pCue;	/*!<Parsed cue (e.g. from CSpliceCache), may be nullptr if only times are indexed.*/
+
+	/*! \brief #STimelineEntry class default constructor with intializer list.
+	*/
+	STimelineEntry() :
+	 iTime(PARAMETER_DEF_VAL),
+	 uSequence(PARAMETER_DEF_VAL),
+	 pCue(nullptr)
+	{
+	}
+};
+
+/*!	\class CSpliceTimeIndex
+*	\brief #CSpliceTimeIndex class keeping timeline entries sorted by time for range queries.
+*
+*	Cues mostly arrive in time order, so an entry not older than the last one is appended in O(1). Older entries go to a side list which is sorted
+*	and merged into the main list by the next query, so a burst of late cues costs one merge instead of one shift per cue.
+*/
+class CSpliceTimeIndex {
+public:
+	/*! \brief #CSpliceTimeIndex class default constructor.
+	*/
+	CSpliceTimeIndex() :
+	m_uSequence(0)
+	{
+	}
+
+	/*! \brief Function to add an entry.
+	*	\param iTime unwrapped 90 kHz time.
+	*	\param pCue parsed cue, may be nullptr.
+	*/
+	void Add(const int64_t& iTime, const std::shared_ptr<const CSpliceClass>& pCue);
+
+	/*! \brief Function to get the entries with iFrom <= time <= iTo in time order.
+	*	\param iFrom first time of the range.
+	*	\param iTo last time of the range.
+	*	\param vEntries matching entries are appended to it.
+	*	\returns number of appended entries.
+	*/
+	std::size_t Query(const int64_t& iFrom, const int64_t& iTo, std::vector<STimelineEntry>& vEntries);
+
+	/*! \brief Function to count the entries with iFrom <= time <= iTo.
+	*/
+	std::size_t Count(const int64_t& iFrom, const int64_t& iTo);
+
+	/*! \brief Function to drop the entries older than a time (retention).
+	*	\param iTime entries with time < iTime are removed.
+	*	\returns number of removed entries.
+	*/
+	std::size_t EraseBefore(const int64_t& iTime);
+
+	/*! \brief Function to get the number of entries.
+	*/
+	std::size_t GetSize() const { return m_vEntries.size() + m_vLate.size(); }
+
+	/*! \brief Function to remove all the entries.
+	*/
+	void ResetValue();
+
+private:
+	/*! \brief Function to merge the late entries into the sorted list.
+	*/
+	void Merge();
+
+	std::vector<STimelineEntry> m_vEntries;		/*!<Entries sorted by time then sequence.*/
+	std::vector<STimelineEntry> m_vLate;		/*!<Entries older than the last entry, not merged yet.*/
+	uint64_t m_uSequence;						/*!<Next insertion sequence.*/
+};
+
+/*!	\class CSpliceTimeline
+*	\brief #CSpliceTimeline class placing the cues of many channels on one unwrapped timeline per channel.
+*
+*	The splice time of a cue is pts_time plus pts_adjustment modulo 2^33 (#GetCuePts). Each channel has its own #CPtsUnwrapper, because PTS clocks
+*	of different channels are unrelated, and its own #CSpliceTimeIndex. Channels are looked up in an open-addressing hash map.
+*/
+class CSpliceTimeline {
+public:
+	/*! \brief #CSpliceTimeline class constructor.
+	*	\param iExpectedChannels number of channels before the channel map grows.
+	*/
+	explicit CSpliceTimeline(const std::size_t& iExpectedChannels = 64);
+
+	/*!	\brief Deleted copy constructor so #CSpliceTimeline class object cannot be copied.
+	*/
+	CSpliceTimeline(const CSpliceTimeline&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceTimeline class object cannot be assigned.
+	*/
+	void operator=(const CSpliceTimeline&) = delete;
+
+	/*! \brief Function to add a parsed cue to the timeline of its channel.
+	*	\param uChannel channel identifier.
+	*	\param pCue parsed cue.
+	*	\param iTime unwrapped splice time of the cue.
+	*	\returns true if added and false if the cue carries no splice time (splice_null, immediate splice_insert, time_signal without time...).
+	*/
+	bool Add(const uint64_t& uChannel, const std::shared_ptr<const CSpliceClass>& pCue, int64_t& iTime);
+
+	/*! \brief Function to add a cue with a known 33-bit time to the timeline of its channel.
+	*	\param uChannel channel identifier.
+	*	\param uPts 33-bit 90 kHz splice time.
+	*	\param pCue parsed cue, may be nullptr.
+	*	\returns unwrapped splice time of the cue.
+	*/
+	int64_t Add(const uint64_t& uChannel, const uint64_t& uPts, const std::shared_ptr<const CSpliceClass>& pCue);
+
+	/*! \brief Function to place a 33-bit value on the timeline of a channel without adding a cue (e.g. the current stream time).
+	*	\param uChannel channel identifier.
+	*	\param uPts 33-bit 90 kHz value.
+	*	\returns unwrapped time.
+	*/
+	int64_t Unwrap(const uint64_t& uChannel, const uint64_t& uPts);
+
+	/*! \brief Function to get the cues of a channel with iFrom <= time <= iTo in time order.
+	*	\param uChannel channel identifier.
+	*	\param iFrom first unwrapped time of the range.
+	*	\param iTo last unwrapped time of the range.
+	*	\param vEntries matching entries are appended to it.
+	*	\returns number of appended entries.
+	*/
+	std::size_t Query(const uint64_t& uChannel, const int64_t& iFrom, const int64_t& iTo, std::vector<STimelineEntry>& vEntries);
+
+	/*! \brief Function to drop the cues of every channel older than a time relative to the last value of the channel.
+	*	\param iRetention 90 kHz ticks kept before the last unwrapped value of each channel.
+	*	\returns number of removed entries.
+	*/
+	std::size_t EraseOlderThan(const int64_t& iRetention);
+
+	/*! \brief Function to get the number of channels.
+	*/
+	std::size_t GetChannelCount() const { return m_mChannels.GetSize(); }
+
+	/*! \brief Function to forget all the channels.
+	*/
+	void ResetValue();
+
+	/*! \brief Function to add two 90 kHz values modulo 2^33, as done for pts_time and pts_adjustment.
+	*/
+	static uint64_t AddPts(const uint64_t& uPts, const uint64_t& uAdjustment) { return (uPts + uAdjustment) & uPtsMask; }
+
+	/*! \brief Function to get the splice time of a parsed cue, pts_time plus pts_adjustment modulo 2^33.
+	*	\param objCue parsed cue.
+	*	\param uPts splice time if found.
+	*	\returns true for a time_signal with time_specified_flag and for a program splice_insert which is not immediate or cancelled, else false.
+	*/
+	static bool GetCuePts(const CSpliceClass& objCue, uint64_t& uPts);
+
+	/*! \brief Mask of the 33-bit 90 kHz values.
+	*/
+	static const uint64_t uPtsMask = 0x1FFFFFFFFULL;
+
+private:
+	/*!	\struct SChannelTimeline
+	*	\brief #SChannelTimeline structure holding the timeline of one channel.
+	*/
+	struct SChannelTimeline {
+		CPtsUnwrapper objUnwrapper;		/*!<Wrap tracking of the channel clock.*/
+		CSpliceTimeIndex objIndex;		/*!<Cues of the channel.*/
+	};
+
+	/*! \brief Function to get the timeline of a channel, created if needed.
+	*/
+	SChannelTimeline& GetChannel(const uint64_t& uChannel);
+
+	CSpliceHashMap<SChannelTimeline> m_mChannels;		/*!<Timelines by channel identifier.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,289 @@
+/*! \file SpliceUpid.cpp
+*	\brief Splice segmentation_upid decoding class definition.
+*	\details CPP file for definition of class CSpliceUpid whose declaration is in SpliceUpid.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceUpid.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Function to get the length of the fixed length UPID types.
+*	\returns number of bytes, 0 for a variable length type.
+*/
+static std::size_t GetFixedLength(const uint32_t& uType) {
+	switch (uType) {
+		case scte35Upid::isci: return 8;
+		case scte35Upid::ad_id: return 12;
+		case scte35Upid::umid: return 32;
+		case scte35Upid::isan_deprecated: return 8;
+		case scte35Upid::isan: return 12;
+		case scte35Upid::tid: return 12;
+		case scte35Upid::ti: return 8;
+		case scte35Upid::eidr: return 12;
+		case scte35Upid::uuid: return 16;
+		default: return 0;
+	}
+}
+
+/*! \brief Function to read a big-endian value of up to 8 bytes.
+*/
+static uint64_t ReadBigEndian(const uint8_t* pData, const std::size_t& iCount) {
+	uint64_t uValue = 0;
+	for (std::size_t i = 0;i < iCount;i++) {
+		uValue = (uValue << 8) | pData[i];
+	}
+	return uValue;
+}
+
+/*! \brief Function to append bytes as upper case hexa-decimal digits.
+*/
+static void AppendHexa(const uint8_t* pData, const std::size_t& iLength, std::string& sText) {
+	static const char cDigits[] = "0123456789ABCDEF";
+	for (std::size_t i = 0;i < iLength;i++) {
+		sText += cDigits[pData[i] >> 4];
+		sText += cDigits[pData[i] & 0xF];
+	}
+}
+
+/*! \brief Function to append hexa-decimal digits in groups of 4 separated by '-'.
+*/
+static void AppendGroups(const char* pDigits, const std::size_t& iCount, std::string& sText) {
+	for (std::size_t i = 0;i < iCount;i += 4) {
+		if (i > 0) {
+			sText += '-';
+		}
+		sText.append(pDigits + i, 4);
+	}
+}
+
+bool CSpliceUpid::Decode(const uint32_t& uType, const uint8_t* pData, const std::size_t& iLength, SUpidView& objUpid) {
+	objUpid = SUpidView();
+	objUpid.segmentation_upid_type = uType;
+	objUpid.pData = pData;
+	objUpid.iLength = iLength;
+
+	const std::size_t iFixed = GetFixedLength(uType);
+	if ((iFixed != 0 && iLength != iFixed) || (iLength > 0 && pData == nullptr)) {
+		return false;
+	}
+	const char* pCharacters = reinterpret_cast<const char*>(pData);
+
+	switch (uType) {
+		case scte35Upid::not_used: {
+			return iLength == 0;
+		}
+		case scte35Upid::user_defined:
+		case scte35Upid::isci:
+		case scte35Upid::ad_id:
+		case scte35Upid::tid:
+		case scte35Upid::adi:
+		case scte35Upid::ads_info:
+		case scte35Upid::uri:
+		case scte35Upid::scr: {
+			objUpid.sText = std::string_view(pCharacters, iLength);
+		}break;
+		case scte35Upid::isan_deprecated:
+		case scte35Upid::isan: {
+			objUpid.uValue = ReadBigEndian(pData, 6);
+		}break;
+		case scte35Upid::ti: {
+			objUpid.uValue = ReadBigEndian(pData, 8);
+		}break;
+		case scte35Upid::eidr: {
+			objUpid.uValue = ReadBigEndian(pData, 2);
+		}break;
+		case scte35Upid::atsc: {
+			//TSID, then reserved, end_of_day and unique_for in 2 bytes, then content_id
+			if (iLength < 4) {
+				return false;
+			}
+			objUpid.uValue = ReadBigEndian(pData, 2);
+			objUpid.sText = std::string_view(pCharacters + 4, iLength - 4);
+		}break;
+		case scte35Upid::mpu: {
+			if (iLength < 4) {
+				return false;
+			}
+			objUpid.format_identifier = (uint32_t)ReadBigEndian(pData, 4);
+			objUpid.sText = std::string_view(pCharacters + 4, iLength - 4);
+		}break;
+		case scte35Upid::mid: {
+			//Every entry must fit and the entries must fill the UPID
+			std::size_t iPosition = 0;
+			while (iPosition < iLength) {
+				if (iPosition + 2 > iLength || iPosition + 2 + pData[iPosition + 1] > iLength) {
+					return false;
+				}
+				iPosition += 2 + (std::size_t)pData[iPosition + 1];
+			}
+		}break;
+		default: {
+			//UMID, UUID and reserved types are bytes only
+		}break;
+	}
+	return true;
+}
+
+bool CSpliceUpid::Decode(const SegmentationDescriptor& objDescriptor, SUpidView& objUpid) {
+	if (objDescriptor.pUpid == nullptr) {
+		objUpid = SUpidView();
+		return false;
+	}
+	return Decode(objDescriptor.segmentation_upid_type, objDescriptor.pUpid, objDescriptor.segmentation_upid_length, objUpid);
+}
+
+bool CSpliceUpid::Next(const SUpidView& objMid, std::size_t& iPosition, SUpidView& objUpid) {
+	if (objMid.segmentation_upid_type != scte35Upid::mid || iPosition + 2 > objMid.iLength) {
+		return false;
+	}
+	const uint8_t* pEntry = objMid.pData + iPosition;
+	const std::size_t iEntryLength = pEntry[1];
+	if (iPosition + 2 + iEntryLength > objMid.iLength) {
+		return false;
+	}
+	iPosition += 2 + iEntryLength;
+	//An entry whose length does not fit its type is still given, with its bytes only
+	Decode(pEntry[0], pEntry + 2, iEntryLength, objUpid);
+	return true;
+}
+
+bool CSpliceUpid::Find(const SegmentationDescriptor& objDescriptor, const uint32_t& uType, SUpidView& objUpid) {
+	SUpidView objDecoded;
+	if (!Decode(objDescriptor, objDecoded)) {
+		return false;
+	}
+	bool bFound = false;
+	ForEach(objDecoded, [&](const SUpidView& objEntry) {
+		if (objEntry.segmentation_upid_type == uType) {
+			objUpid = objEntry;
+			bFound = true;
+		}
+		return !bFound;
+	});
+	return bFound;
+}
+
+char CSpliceUpid::GetCheckCharacter(const char* pDigits, const std::size_t& iCount) {
+	static const char cCharacters[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	uint32_t uProduct = 36;
+	for (std::size_t i = 0;i < iCount;i++) {
+		const char c = pDigits[i];
+		uint32_t uValue = 0;
+		if (c >= '0' && c <= '9') {
+			uValue = (uint32_t)(c - '0');
+		}
+		else if (c >= 'A' && c <= 'Z') {
+			uValue = (uint32_t)(c - 'A') + 10;
+		}
+		else if (c >= 'a' && c <= 'z') {
+			uValue = (uint32_t)(c - 'a') + 10;
+		}
+		uint32_t uSum = (uProduct + uValue) % 36;
+		if (uSum == 0) {
+			uSum = 36;
+		}
+		uProduct = (uSum * 2) % 37;
+	}
+	return cCharacters[(37 - uProduct) % 36];
+}
+
+void CSpliceUpid::GetText(const SUpidView& objUpid, std::string& sText) {
+	const std::size_t iFixed = GetFixedLength(objUpid.segmentation_upid_type);
+	if (objUpid.iLength == 0 || objUpid.pData == nullptr) {
+		return;
+	}
+	if (iFixed != 0 && objUpid.iLength != iFixed) {
+		AppendHexa(objUpid.pData, objUpid.iLength, sText);
+		return;
+	}
+
+	//Digits of the fixed length types, at most 16 bytes are formatted from them
+	char cDigits[32];
+	static const char cHexa[] = "0123456789ABCDEF";
+	switch (objUpid.segmentation_upid_type) {
+		case scte35Upid::user_defined:
+		case scte35Upid::isci:
+		case scte35Upid::ad_id:
+		case scte35Upid::tid:
+		case scte35Upid::adi:
+		case scte35Upid::ads_info:
+		case scte35Upid::uri:
+		case scte35Upid::scr: {
+			sText.append(objUpid.sText.data(), objUpid.sText.size());
+		}break;
+		case scte35Upid::eidr: {
+			for (std::size_t i = 0;i < 10;i++) {
+				cDigits[2 * i] = cHexa[objUpid.pData[2 + i] >> 4];
+				cDigits[2 * i + 1] = cHexa[objUpid.pData[2 + i] & 0xF];
+			}
+			sText += "10.";
+			sText += std::to_string(objUpid.uValue);
+			sText += '/';
+			AppendGroups(cDigits, 20, sText);
+			sText += '-';
+			sText += GetCheckCharacter(cDigits, 20);
+		}break;
+		case scte35Upid::isan_deprecated:
+		case scte35Upid::isan: {
+			for (std::size_t i = 0;i < objUpid.iLength;i++) {
+				cDigits[2 * i] = cHexa[objUpid.pData[i] >> 4];
+				cDigits[2 * i + 1] = cHexa[objUpid.pData[i] & 0xF];
+			}
+			//Root and episode are checked by the first character, the version by the second one over all the digits
+			AppendGroups(cDigits, 16, sText);
+			sText += '-';
+			sText += GetCheckCharacter(cDigits, 16);
+			if (objUpid.iLength == 12) {
+				sText += '-';
+				AppendGroups(cDigits + 16, 8, sText);
+				sText += '-';
+				sText += GetCheckCharacter(cDigits, 24);
+			}
+		}break;
+		case scte35Upid::ti: {
+			sText += "0x";
+			AppendHexa(objUpid.pData, 8, sText);
+		}break;
+		case scte35Upid::uuid: {
+			static const char cLower[] = "0123456789abcdef";
+			for (std::size_t i = 0;i < 16;i++) {
+				if (i == 4 || i == 6 || i == 8 || i == 10) {
+					sText += '-';
+				}
+				sText += cLower[objUpid.pData[i] >> 4];
+				sText += cLower[objUpid.pData[i] & 0xF];
+			}
+		}break;
+		case scte35Upid::mpu: {
+			if (objUpid.iLength < 4) {
+				AppendHexa(objUpid.pData, objUpid.iLength, sText);
+				break;
+			}
+			sText += "0x";
+			AppendHexa(objUpid.pData, 4, sText);
+			sText += ':';
+			AppendHexa(objUpid.pData + 4, objUpid.iLength - 4, sText);
+		}break;
+		case scte35Upid::mid: {
+			bool bFirst = true;
+			ForEach(objUpid, [&](const SUpidView& objEntry) {
+				if (!bFirst) {
+					sText += ';';
+				}
+				bFirst = false;
+				GetText(objEntry, sText);
+				return true;
+			});
+		}break;
+		default: {
+			AppendHexa(objUpid.pData, objUpid.iLength, sText);
+		}break;
+	}
+}
+
+};
@@ -0,0 +1,161 @@
+/*! \file SpliceUpid.hpp
+*	\brief Splice segmentation_upid decoding classes declaration.
+*	\details Header file for declaration of structure scte35Upid and classes SUpidView and CSpliceUpid whose definition is in SpliceUpid.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEUPID_HPP_
+/*! \brief SpliceUpid.hpp header guard define.
+*/
+#define _SPLICEUPID_HPP_
+
+#include "SpliceClass.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Upid
+*	\brief scte35Upid structure to hold the segmentation_upid_type values.
+*/
+struct scte35Upid {
+	/*!
+	*	\brief A type definition for type (segmentation_upid_type values)
+	*/
+	typedef enum {
+		not_used = 0x00,			/*!<No segmentation_upid*/
+		user_defined = 0x01,		/*!<User defined (deprecated), characters*/
+		isci = 0x02,				/*!<ISCI (deprecated), 8 characters*/
+		ad_id = 0x03,				/*!<Ad-ID, 12 characters*/
+		umid = 0x04,				/*!<UMID (SMPTE 330), 32 bytes*/
+		isan_deprecated = 0x05,		/*!<ISAN without version (deprecated), 8 bytes*/
+		isan = 0x06,				/*!<V-ISAN (ISO 15706-2), 12 bytes*/
+		tid = 0x07,					/*!<Tribune Media Systems program identifier, 12 characters*/
+		ti = 0x08,					/*!<AiringID, 64-bit*/
+		adi = 0x09,					/*!<CableLabs ADI identifier, characters*/
+		eidr = 0x0A,				/*!<EIDR compact binary encoding, 12 bytes*/
+		atsc = 0x0B,				/*!<ATSC_content_identifier()*/
+		mpu = 0x0C,					/*!<Managed Private UPID: format_identifier and private_data*/
+		mid = 0x0D,					/*!<Multiple UPIDs: segmentation_upid_type, segmentation_upid_length and bytes of each*/
+		ads_info = 0x0E,			/*!<Advertising information, characters*/
+		uri = 0x0F,					/*!<URI, characters*/
+		uuid = 0x10,				/*!<UUID (RFC 4122), 16 bytes*/
+		scr = 0x11					/*!<Subscriber Company Reporting, characters*/
+	}type;
+};
+
+/*!	\class SUpidView
+*	\brief #SUpidView class holding one decoded segmentation_upid as views over the bytes it was decoded from (nothing is copied).
+*
+*	The views are valid as long as those bytes: until the next parse for SegmentationDescriptor::pUpid.
+*/
+class SUpidView {
+public:
+	uint32_t segmentation_upid_type;	/*!<8-bit : segmentation_upid_type (see #scte35Upid).*/
+	const uint8_t* pData;				/*!<segmentation_upid bytes.*/
+	std::size_t iLength;				/*!<Number of bytes in pData.*/
+	std::string_view sText;				/*!<Characters of the character UPIDs (ISCI, Ad-ID, TID, ADI, ADS Info, URI, SCR, user defined), private_data of an MPU, content_id of an ATSC UPID, empty otherwise.*/
+	uint64_t uValue;					/*!<AiringID of a TI, sub-prefix of an EIDR (5240 for 10.5240/), root of an ISAN, TSID of an ATSC UPID, 0 otherwise.*/
+	uint32_t format_identifier;			/*!<32-bit : format_identifier of an MPU, 0 otherwise.*/
+
+	/*! \brief #SUpidView class default constructor with intializer list.
+	*/
+	SUpidView() :
+	 segmentation_upid_type(scte35Upid::not_used),
+	 pData(nullptr),
+	 iLength(PARAMETER_DEF_VAL),
+	 sText(),
+	 uValue(PARAMETER_DEF_VAL),
+	 format_identifier(PARAMETER_DEF_VAL)
+	{
+	}
+};
+
+/*!	\class CSpliceUpid
+*	\brief #CSpliceUpid class decodes segmentation_upid bytes according to segmentation_upid_type.
+*
+*	Decoding only reads the bytes and fills an #SUpidView, it does not allocate; the entries of an MID are visited in place with #Next
+*	or #ForEach. #GetText gives the usual textual form (EIDR DOI, ISAN with check characters, hexa-decimal AiringID...).
+*/
+class CSpliceUpid {
+public:
+	/*! \brief Function to decode segmentation_upid bytes.
+	*	\param uType segmentation_upid_type.
+	*	\param pData segmentation_upid bytes.
+	*	\param iLength number of bytes.
+	*	\param objUpid receives the decoded UPID, pData and iLength are set even if the decoding fails.
+	*	\returns true if decoded and false if the length does not fit the type or an MID is malformed.
+	*/
+	static bool Decode(const uint32_t& uType, const uint8_t* pData, const std::size_t& iLength, SUpidView& objUpid);
+
+	/*! \brief Function to decode the segmentation_upid of a parsed segmentation_descriptor.
+	*	\returns true if decoded and false if the descriptor has no segmentation_upid or as #Decode.
+	*/
+	static bool Decode(const SegmentationDescriptor& objDescriptor, SUpidView& objUpid);
+
+	/*! \brief Function to decode the next entry of an MID.
+	*	\param objMid decoded MID.
+	*	\param iPosition byte position of the entry, 0 for the first one, moved to the following entry.
+	*	\param objUpid receives the entry.
+	*	\returns true if an entry was decoded and false at the end of the MID or on a truncated entry.
+	*/
+	static bool Next(const SUpidView& objMid, std::size_t& iPosition, SUpidView& objUpid);
+
+	/*! \brief Function to visit the UPIDs carried by a decoded UPID: the entries of an MID, the UPID itself otherwise.
+	*	\tparam F callable taking const SUpidView& and returning false to stop.
+	*	\returns number of UPIDs visited.
+	*/
+	template <typename F>
+	static std::size_t ForEach(const SUpidView& objUpid, F fnVisit) {
+		if (objUpid.segmentation_upid_type != scte35Upid::mid) {
+			fnVisit(objUpid);
+			return 1;
+		}
+		std::size_t iVisited = 0;
+		std::size_t iPosition = 0;
+		SUpidView objEntry;
+		while (Next(objUpid, iPosition, objEntry)) {
+			iVisited++;
+			if (!fnVisit(static_cast<const SUpidView&>(objEntry))) {
+				break;
+			}
+		}
+		return iVisited;
+	}
+
+	/*! \brief Function to find a UPID type in a segmentation_descriptor, directly or as an MID entry.
+	*	\param objDescriptor parsed segmentation_descriptor.
+	*	\param uType segmentation_upid_type searched.
+	*	\param objUpid receives the first UPID of that type.
+	*	\returns true if found.
+	*/
+	static bool Find(const SegmentationDescriptor& objDescriptor, const uint32_t& uType, SUpidView& objUpid);
+
+	/*! \brief Function to append the textual form of a decoded UPID.
+	*
+	*	Characters are appended as they are, an EIDR as 10.prefix/XXXX-XXXX-XXXX-XXXX-XXXX-C, an ISAN as XXXX-XXXX-XXXX-XXXX-C-XXXX-XXXX-C,
+	*	an AiringID as 0x and 16 digits, a UUID as 8-4-4-4-12 digits, an MPU as its format_identifier and private_data in hexa-decimal,
+	*	the entries of an MID separated by ';' and anything else (or a UPID whose length does not fit its type) in hexa-decimal.
+	*	\param objUpid decoded UPID.
+	*	\param sText text the form is appended to.
+	*/
+	static void GetText(const SUpidView& objUpid, std::string& sText);
+
+	/*! \brief Function to get the ISO 7064 Mod 37,36 check character of EIDR and ISAN.
+	*	\param pDigits hexa-decimal digits.
+	*	\param iCount number of digits.
+	*	\returns check character, '0' to '9' or 'A' to 'Z'.
+	*/
+	static char GetCheckCharacter(const char* pDigits, const std::size_t& iCount);
+};
+
+};
+
+#endif
@@ -0,0 +1,468 @@
+/*! \file SpliceValidator.cpp
+*	\brief Splice conformance validator class definition.
+*	\details CPP file for definition of class CSpliceValidator whose declaration is in SpliceValidator.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceValidator.hpp"
+#include "SpliceClass.hpp"
+#include "SpliceCRC.hpp"
+#include "SpliceProjection.hpp"
+#include "SpliceUpid.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Number of bytes from table_id to splice_command_type.
+*/
+static const std::size_t iHeaderBytes = 14;
+/*! \brief Largest section_length.
+*/
+static const std::size_t iMaxSectionLength = 4093;
+/*! \brief splice_command_length of sections which do not give it (legacy encoders).
+*/
+static const uint32_t uUnknownCommandLength = 0xFFF;
+/*! \brief identifier of the descriptors defined by SCTE-35 ("CUEI").
+*/
+static const uint32_t uCueIdentifier = 0x43554549;
+
+/*! \brief Function to read a reserved field, which must be all '1'.
+*/
+static void CheckReserved(CSpliceBitReader& objReader, const int& iBits, uint32_t& uFindings) {
+	if (objReader.Read(iBits) != ((uint64_t)1 << iBits) - 1 && !objReader.IsOverflow()) {
+		uFindings |= scte35Finding::reserved_bits;
+	}
+}
+
+/*! \brief Function to walk a splice_time().
+*/
+static void CheckSpliceTime(CSpliceBitReader& objReader, uint32_t& uFindings) {
+	if (objReader.Read(1) == 1) {
+		CheckReserved(objReader, 6, uFindings);
+		objReader.Skip(33);
+	}
+	else {
+		CheckReserved(objReader, 7, uFindings);
+	}
+}
+
+/*! \brief Function to walk a break_duration().
+*/
+static void CheckBreakDuration(CSpliceBitReader& objReader, uint32_t& uFindings) {
+	objReader.Skip(1);
+	CheckReserved(objReader, 6, uFindings);
+	if (objReader.Read(33) == 0 && !objReader.IsOverflow()) {
+		uFindings |= scte35Finding::break_duration;
+	}
+}
+
+/*! \brief Function to walk unique_program_id, avail_num and avails_expected.
+*/
+static void CheckAvail(CSpliceBitReader& objReader, uint32_t& uFindings) {
+	objReader.Skip(16);
+	const uint64_t uAvailNum = objReader.Read(8);
+	const uint64_t uAvailsExpected = objReader.Read(8);
+	if (uAvailsExpected != 0 && uAvailNum > uAvailsExpected) {
+		uFindings |= scte35Finding::avail_num;
+	}
+}
+
+/*! \brief Function to walk a splice_insert().
+*/
+static void CheckSpliceInsert(CSpliceBitReader& objReader, uint32_t& uFindings) {
+	objReader.Skip(32);
+	const uint64_t uCancel = objReader.Read(1);
+	CheckReserved(objReader, 7, uFindings);
+	if (uCancel == 1) {
+		return;
+	}
+	objReader.Skip(1);
+	const uint64_t uProgram = objReader.Read(1);
+	const uint64_t uDuration = objReader.Read(1);
+	const uint64_t uImmediate = objReader.Read(1);
+	//event_id_compliance_flag was the first bit of reserved before SCTE-35 2020, either value conforms
+	objReader.Skip(1);
+	CheckReserved(objReader, 3, uFindings);
+	if (uProgram == 1) {
+		if (uImmediate == 0) {
+			CheckSpliceTime(objReader, uFindings);
+		}
+	}
+	else {
+		const uint64_t uComponents = objReader.Read(8);
+		if (uComponents == 0 && !objReader.IsOverflow()) {
+			uFindings |= scte35Finding::component_count;
+		}
+		for (uint64_t i = 0;i < uComponents && !objReader.IsOverflow();i++) {
+			objReader.Skip(8);
+			if (uImmediate == 0) {
+				CheckSpliceTime(objReader, uFindings);
+			}
+		}
+	}
+	if (uDuration == 1) {
+		CheckBreakDuration(objReader, uFindings);
+	}
+	CheckAvail(objReader, uFindings);
+}
+
+/*! \brief Function to walk a splice_schedule().
+*/
+static void CheckSpliceSchedule(CSpliceBitReader& objReader, uint32_t& uFindings) {
+	const uint64_t uEvents = objReader.Read(8);
+	for (uint64_t e = 0;e < uEvents && !objReader.IsOverflow();e++) {
+		objReader.Skip(32);
+		const uint64_t uCancel = objReader.Read(1);
+		CheckReserved(objReader, 7, uFindings);
+		if (uCancel == 1) {
+			continue;
+		}
+		objReader.Skip(1);
+		const uint64_t uProgram = objReader.Read(1);
+		const uint64_t uDuration = objReader.Read(1);
+		CheckReserved(objReader, 5, uFindings);
+		if (uProgram == 1) {
+			objReader.Skip(32);
+		}
+		else {
+			const uint64_t uComponents = objReader.Read(8);
+			if (uComponents == 0 && !objReader.IsOverflow()) {
+				uFindings |= scte35Finding::component_count;
+			}
+			objReader.Skip((std::size_t)uComponents * 40);
+		}
+		if (uDuration == 1) {
+			CheckBreakDuration(objReader, uFindings);
+		}
+		CheckAvail(objReader, uFindings);
+	}
+}
+
+/*! \brief Function to check whether a segmentation_type_id is defined.
+*/
+static bool IsSegmentationType(const uint64_t& uType) {
+	return uType <= 0x02 || (uType >= 0x10 && uType <= 0x19) || (uType >= 0x20 && uType <= 0x27) || (uType >= 0x30 && uType <= 0x47) || uType == 0x50 || uType == 0x51;
+}
+
+/*! \brief Function to walk the fields of a segmentation_descriptor() after identifier.
+*/
+static void CheckSegmentation(CSpliceBitReader& objReader, const uint8_t* pBody, uint32_t& uFindings) {
+	objReader.Skip(32);
+	const uint64_t uCancel = objReader.Read(1);
+	//segmentation_event_id_compliance_indicator, then 6 reserved bits
+	objReader.Skip(1);
+	CheckReserved(objReader, 6, uFindings);
+	if (uCancel == 1) {
+		return;
+	}
+	const uint64_t uProgram = objReader.Read(1);
+	const uint64_t uDuration = objReader.Read(1);
+	if (objReader.Read(1) == 1) {
+		CheckReserved(objReader, 5, uFindings);
+	}
+	else {
+		objReader.Skip(5);
+	}
+	if (uProgram == 0) {
+		const uint64_t uComponents = objReader.Read(8);
+		if (uComponents == 0 && !objReader.IsOverflow()) {
+			uFindings |= scte35Finding::component_count;
+		}
+		for (uint64_t i = 0;i < uComponents && !objReader.IsOverflow();i++) {
+			objReader.Skip(8);
+			CheckReserved(objReader, 7, uFindings);
+			objReader.Skip(33);
+		}
+	}
+	if (uDuration == 1 && objReader.Read(40) == 0 && !objReader.IsOverflow()) {
+		uFindings |= scte35Finding::segmentation_duration;
+	}
+	const uint32_t uUpidType = (uint32_t)objReader.Read(8);
+	const std::size_t iUpidLength = (std::size_t)objReader.Read(8);
+	const std::size_t iUpidStart = objReader.GetByte();
+	objReader.Skip(iUpidLength * 8);
+	if (objReader.IsOverflow()) {
+		return;
+	}
+	SUpidView objUpid;
+	if (!CSpliceUpid::Decode(uUpidType, iUpidLength > 0 ? pBody + iUpidStart : nullptr, iUpidLength, objUpid)) {
+		uFindings |= scte35Finding::segmentation_upid;
+	}
+	const uint64_t uType = objReader.Read(8);
+	const uint64_t uNum = objReader.Read(8);
+	const uint64_t uExpected = objReader.Read(8);
+	if (objReader.IsOverflow()) {
+		return;
+	}
+	if (!IsSegmentationType(uType)) {
+		uFindings |= scte35Finding::segmentation_type;
+	}
+	if (uExpected != 0 && (uNum == 0 || uNum > uExpected)) {
+		uFindings |= scte35Finding::segment_num;
+	}
+	//sub_segment_num and sub_segments_expected are optional and only belong to placement opportunity starts
+	if ((uType == 0x34 || uType == 0x36 || uType == 0x38 || uType == 0x3A) && objReader.GetRemaining() >= 16) {
+		const uint64_t uSubNum = objReader.Read(8);
+		const uint64_t uSubExpected = objReader.Read(8);
+		if (uSubExpected != 0 && (uSubNum == 0 || uSubNum > uSubExpected)) {
+			uFindings |= scte35Finding::segment_num;
+		}
+	}
+}
+
+/*! \brief Function to walk a descriptor defined by SCTE-35, from its first byte.
+*/
+static void CheckDescriptor(const uint8_t* pDescriptor, const std::size_t& iLength, uint32_t& uFindings) {
+	const uint32_t uTag = pDescriptor[0];
+	if (uTag > scte35Desc::audio_descriptor) {
+		uFindings |= scte35Finding::descriptor_tag;
+		return;
+	}
+	//Fields after identifier, bounded by descriptor_length
+	const uint8_t* pBody = pDescriptor + 6;
+	CSpliceBitReader objReader(pBody, iLength - 6);
+	switch (uTag) {
+		case scte35Desc::avail_descriptor: {
+			objReader.Skip(32);
+		}break;
+		case scte35Desc::dtmf_descriptor: {
+			objReader.Skip(8);
+			const uint64_t uChars = objReader.Read(3);
+			CheckReserved(objReader, 5, uFindings);
+			objReader.Skip((std::size_t)uChars * 8);
+		}break;
+		case scte35Desc::segmentation_descriptor: {
+			CheckSegmentation(objReader, pBody, uFindings);
+		}break;
+		case scte35Desc::time_descriptor: {
+			objReader.Skip(48 + 32 + 16);
+		}break;
+		default: {
+			const uint64_t uAudio = objReader.Read(4);
+			CheckReserved(objReader, 4, uFindings);
+			objReader.Skip((std::size_t)uAudio * 40);
+		}break;
+	}
+	if (objReader.IsOverflow()) {
+		uFindings |= scte35Finding::descriptor_truncated;
+	}
+	else if (objReader.GetRemaining() > 0) {
+		uFindings |= scte35Finding::descriptor_extra;
+	}
+}
+
+CSpliceValidator::CSpliceValidator() :
+m_vBytes(),
+m_uSections(0),
+m_uFailed(0),
+m_uFindings(0)
+{
+	Reset();
+}
+
+uint32_t CSpliceValidator::Validate(const uint8_t* pData, const std::size_t& iLength, const bool& bCheckCRC) {
+	uint32_t uFindings = 0;
+	if (pData == nullptr || iLength < 3) {
+		return scte35Finding::section_length;
+	}
+
+	if (pData[0] != 0xFC) {
+		uFindings |= scte35Finding::table_id;
+	}
+	if ((pData[1] & 0xC0) != 0) {
+		uFindings |= scte35Finding::section_syntax;
+	}
+	const std::size_t iSectionLength = ((std::size_t)(pData[1] & 0x0F) << 8) | pData[2];
+	const std::size_t iSectionEnd = 3 + iSectionLength;
+	if (iSectionLength > iMaxSectionLength || iSectionEnd != iLength) {
+		uFindings |= scte35Finding::section_length;
+	}
+	//The rest is checked over the bytes both the input and section_length hold, up to CRC_32
+	const std::size_t iEnd = iSectionEnd < iLength ? iSectionEnd : iLength;
+	if (iEnd < iHeaderBytes + 2 + 4) {
+		return uFindings | scte35Finding::section_length;
+	}
+	const std::size_t iBodyEnd = iEnd - 4;
+
+	if (pData[3] != 0) {
+		uFindings |= scte35Finding::protocol_version;
+	}
+	if (bCheckCRC && iSectionEnd == iEnd && CSpliceCRC::Compute(pData, iBodyEnd) != (((uint32_t)pData[iBodyEnd] << 24) | ((uint32_t)pData[iBodyEnd + 1] << 16) | ((uint32_t)pData[iBodyEnd + 2] << 8) | pData[iBodyEnd + 3])) {
+		uFindings |= scte35Finding::crc;
+	}
+	const bool bEncrypted = (pData[4] & 0x80) != 0;
+	const uint32_t uAlgorithm = (pData[4] >> 1) & 0x3F;
+	if (bEncrypted) {
+		//0 to 3 are defined, 32 to 63 user private, and the command and descriptors cannot be read
+		if (uAlgorithm >= 4 && uAlgorithm < 32) {
+			uFindings |= scte35Finding::encryption_algorithm;
+		}
+		return uFindings;
+	}
+
+	//================================== Command =========================================//
+
+	const uint32_t uCommandLength = ((uint32_t)(pData[11] & 0x0F) << 8) | pData[12];
+	const uint32_t uCommandType = pData[13];
+	CSpliceBitReader objCommand(pData + iHeaderBytes, iBodyEnd - iHeaderBytes);
+	bool bKnown = true;
+	switch (uCommandType) {
+		case scte35Cmd::splice_null:
+		case scte35Cmd::bandwidth_reservation: {
+		}break;
+		case scte35Cmd::splice_schedule: {
+			CheckSpliceSchedule(objCommand, uFindings);
+		}break;
+		case scte35Cmd::splice_insert: {
+			CheckSpliceInsert(objCommand, uFindings);
+		}break;
+		case scte35Cmd::time_signal: {
+			CheckSpliceTime(objCommand, uFindings);
+		}break;
+		case scte35Cmd::private_command: {
+			//identifier then private bytes up to splice_command_length, which must be given
+			objCommand.Skip(32);
+			if (uCommandLength == uUnknownCommandLength) {
+				uFindings |= scte35Finding::command_length;
+				return uFindings;
+			}
+			if (uCommandLength >= 4) {
+				objCommand.Skip((uCommandLength - 4) * 8);
+			}
+		}break;
+		default: {
+			uFindings |= scte35Finding::command_type;
+			bKnown = false;
+		}break;
+	}
+	if (objCommand.IsOverflow()) {
+		return uFindings | scte35Finding::command_truncated;
+	}
+	std::size_t iLoop = iHeaderBytes + (std::size_t)uCommandLength;
+	if (bKnown) {
+		if (uCommandLength == uUnknownCommandLength) {
+			iLoop = iHeaderBytes + objCommand.GetByte();
+		}
+		else if (objCommand.GetByte() != uCommandLength) {
+			uFindings |= scte35Finding::command_length;
+		}
+	}
+	else if (uCommandLength == uUnknownCommandLength) {
+		//The end of a reserved command is unknown
+		return uFindings;
+	}
+
+	//================================== Descriptors =========================================//
+
+	if (iLoop + 2 > iBodyEnd) {
+		return uFindings | scte35Finding::command_truncated;
+	}
+	const std::size_t iLoopLength = ((std::size_t)pData[iLoop] << 8) | pData[iLoop + 1];
+	if (iLoop + 2 + iLoopLength != iBodyEnd) {
+		uFindings |= scte35Finding::descriptor_loop_length;
+	}
+	const std::size_t iLoopEnd = iLoop + 2 + iLoopLength < iBodyEnd ? iLoop + 2 + iLoopLength : iBodyEnd;
+	std::size_t iPos = iLoop + 2;
+	while (iPos < iLoopEnd) {
+		if (iPos + 2 > iLoopEnd || iPos + 2 + pData[iPos + 1] > iLoopEnd) {
+			uFindings |= scte35Finding::descriptor_overrun;
+			break;
+		}
+		const std::size_t iDescriptorBytes = 2 + (std::size_t)pData[iPos + 1];
+		if (iDescriptorBytes < 6) {
+			//Too short for identifier, a "CUEI" tag cannot be told from a private one
+			if (pData[iPos] <= scte35Desc::audio_descriptor) {
+				uFindings |= scte35Finding::descriptor_truncated;
+			}
+		}
+		else if ((((uint32_t)pData[iPos + 2] << 24) | ((uint32_t)pData[iPos + 3] << 16) | ((uint32_t)pData[iPos + 4] << 8) | pData[iPos + 5]) == uCueIdentifier) {
+			CheckDescriptor(pData + iPos, iDescriptorBytes, uFindings);
+		}
+		iPos += iDescriptorBytes;
+	}
+	return uFindings;
+}
+
+uint32_t CSpliceValidator::ValidateHexa(const std::string& sInput, const bool& bCheckCRC) {
+	if (!CSpliceProjection::HexaToBytes(sInput, m_vBytes)) {
+		return scte35Finding::input;
+	}
+	return Validate(m_vBytes.data(), m_vBytes.size(), bCheckCRC);
+}
+
+uint32_t CSpliceValidator::Add(const uint8_t* pData, const std::size_t& iLength, const bool& bCheckCRC) {
+	const uint32_t uFindings = Validate(pData, iLength, bCheckCRC);
+	m_uSections++;
+	if (uFindings != 0) {
+		m_uFailed++;
+		m_uFindings |= uFindings;
+		for (std::size_t i = 0;i < scte35Finding::count;i++) {
+			m_uCounts[i] += (uFindings >> i) & 1;
+		}
+	}
+	return uFindings;
+}
+
+uint64_t CSpliceValidator::GetFindingCount(const scte35Finding::type& eFinding) const {
+	for (std::size_t i = 0;i < scte35Finding::count;i++) {
+		if ((uint32_t)eFinding == (1u << i)) {
+			return m_uCounts[i];
+		}
+	}
+	return 0;
+}
+
+void CSpliceValidator::Reset() {
+	m_uSections = 0;
+	m_uFailed = 0;
+	m_uFindings = 0;
+	for (std::size_t i = 0;i < scte35Finding::count;i++) {
+		m_uCounts[i] = 0;
+	}
+}
+
+const char* CSpliceValidator::GetFindingName(const scte35Finding::type& eFinding) {
+	switch (eFinding) {
+		case scte35Finding::input: return "input";
+		case scte35Finding::table_id: return "table_id";
+		case scte35Finding::section_syntax: return "section_syntax";
+		case scte35Finding::section_length: return "section_length";
+		case scte35Finding::protocol_version: return "protocol_version";
+		case scte35Finding::encryption_algorithm: return "encryption_algorithm";
+		case scte35Finding::command_type: return "command_type";
+		case scte35Finding::command_length: return "command_length";
+		case scte35Finding::command_truncated: return "command_truncated";
+		case scte35Finding::descriptor_loop_length: return "descriptor_loop_length";
+		case scte35Finding::descriptor_overrun: return "descriptor_overrun";
+		case scte35Finding::descriptor_truncated: return "descriptor_truncated";
+		case scte35Finding::descriptor_extra: return "descriptor_extra";
+		case scte35Finding::descriptor_tag: return "descriptor_tag";
+		case scte35Finding::reserved_bits: return "reserved_bits";
+		case scte35Finding::crc: return "crc";
+		case scte35Finding::component_count: return "component_count";
+		case scte35Finding::break_duration: return "break_duration";
+		case scte35Finding::avail_num: return "avail_num";
+		case scte35Finding::segmentation_duration: return "segmentation_duration";
+		case scte35Finding::segmentation_type: return "segmentation_type";
+		case scte35Finding::segment_num: return "segment_num";
+		case scte35Finding::segmentation_upid: return "segmentation_upid";
+		default: return "unknown";
+	}
+}
+
+void CSpliceValidator::GetFindingNames(const uint32_t& uFindings, std::string& sText) {
+	sText.clear();
+	for (std::size_t i = 0;i < scte35Finding::count;i++) {
+		if (((uFindings >> i) & 1) != 0) {
+			if (!sText.empty()) {
+				sText += ',';
+			}
+			sText += GetFindingName((scte35Finding::type)(1u << i));
+		}
+	}
+}
+
+};
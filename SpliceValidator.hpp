@@ -0,0 +1,144 @@
+/*! \file SpliceValidator.hpp
+*	\brief Splice conformance validator class declaration.
+*	\details Header file for declaration of structure scte35Finding and class CSpliceValidator whose definition is in SpliceValidator.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEVALIDATOR_HPP_
+/*! \brief SpliceValidator.hpp header guard define.
+*/
+#define _SPLICEVALIDATOR_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Finding
+*	\brief scte35Finding structure to hold the findings of #CSpliceValidator.
+*/
+struct scte35Finding {
+	/*!
+	*	\brief A type definition for type (Conformance findings, combined with |)
+	*/
+	typedef enum {
+		input = 0x00000001,						/*!<Hexa-decimal input holds a non hexa-decimal character or has an odd length*/
+		table_id = 0x00000002,					/*!<table_id is not 0xFC*/
+		section_syntax = 0x00000004,			/*!<section_syntax_indicator or private_indicator is not 0*/
+		section_length = 0x00000008,			/*!<section_length is above 4093 or does not match the input length*/
+		protocol_version = 0x00000010,			/*!<protocol_version is not 0*/
+		encryption_algorithm = 0x00000020,		/*!<encryption_algorithm is a reserved value*/
+		command_type = 0x00000040,				/*!<splice_command_type is reserved*/
+		command_length = 0x00000080,			/*!<splice_command_length is not the number of bytes of the command (0xFFF is accepted where the command gives its own size)*/
+		command_truncated = 0x00000100,			/*!<Command fields go beyond the section*/
+		descriptor_loop_length = 0x00000200,	/*!<descriptor_loop_length and CRC_32 do not end the section*/
+		descriptor_overrun = 0x00000400,		/*!<descriptor_length goes beyond the descriptor loop*/
+		descriptor_truncated = 0x00000800,		/*!<Fields of a "CUEI" descriptor go beyond its descriptor_length*/
+		descriptor_extra = 0x00001000,			/*!<A "CUEI" descriptor has bytes after its last field (sub_segment fields of a segmentation_type_id without them)*/
+		descriptor_tag = 0x00002000,			/*!<splice_descriptor_tag is reserved for the "CUEI" identifier*/
+		reserved_bits = 0x00004000,				/*!<A reserved field is not all '1'*/
+		crc = 0x00008000,						/*!<CRC_32 does not match*/
+		component_count = 0x00010000,			/*!<component_count is 0 where components replace the program wide fields*/
+		break_duration = 0x00020000,			/*!<break_duration duration is 0*/
+		avail_num = 0x00040000,					/*!<avail_num is above avails_expected*/
+		segmentation_duration = 0x00080000,		/*!<segmentation_duration is 0 while segmentation_duration_flag is set*/
+		segmentation_type = 0x00100000,			/*!<segmentation_type_id is not defined*/
+		segment_num = 0x00200000,				/*!<segment_num is above segments_expected (or sub_segment_num above sub_segments_expected) or 0 while segments are expected*/
+		segmentation_upid = 0x00400000,			/*!<segmentation_upid_length does not fit segmentation_upid_type or an MID is malformed*/
+		all = 0x007FFFFF,						/*!<Every finding above*/
+		count = 23								/*!<Number of findings (not a finding)*/
+	}type;
+};
+
+/*!	\class CSpliceValidator
+*	\brief #CSpliceValidator class checks the SCTE-35 rules a parse does not enforce, per cue or over a batch.
+*
+*	The section bytes are walked once without decoding them into classes: lengths are compared with the bytes the structures use, reserved
+*	fields with all '1', and durations, type and number fields with their legal values. Nothing is allocated (except the buffer of
+*	#ValidateHexa, reused), so a check costs about as much as reading the section and can run on every cue. Every broken rule sets its
+*	scte35Finding bit; an encrypted section is checked up to its encrypted part. #Add keeps per finding counts over a batch.
+*/
+class CSpliceValidator {
+public:
+	/*! \brief #CSpliceValidator class default constructor.
+	*/
+	CSpliceValidator();
+
+	/*!	\brief Deleted copy constructor so #CSpliceValidator class object cannot be copied.
+	*/
+	CSpliceValidator(const CSpliceValidator&) = delete;
+	/*!	\brief Deleted assignment operator so #CSpliceValidator class object cannot be assigned.
+	*/
+	void operator=(const CSpliceValidator&) = delete;
+
+	/*! \brief Function to check a binary splice_info_section.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength number of bytes in pData.
+	*	\param bCheckCRC whether CRC_32 is checked too.
+	*	\returns scte35Finding bits of the broken rules, 0 for a conforming section.
+	*/
+	static uint32_t Validate(const uint8_t* pData, const std::size_t& iLength, const bool& bCheckCRC = true);
+
+	/*! \brief Function to check a hexa-decimal splice_info_section (without spaces).
+	*	\param sInput an input hexa-decimal string data.
+	*	\param bCheckCRC whether CRC_32 is checked too.
+	*	\returns scte35Finding bits of the broken rules, scte35Finding::input if the input is not hexa-decimal.
+	*/
+	uint32_t ValidateHexa(const std::string& sInput, const bool& bCheckCRC = true);
+
+	/*! \brief Function to check a binary splice_info_section and count its findings in the batch.
+	*	\returns scte35Finding bits of the broken rules.
+	*/
+	uint32_t Add(const uint8_t* pData, const std::size_t& iLength, const bool& bCheckCRC = true);
+
+	/*! \brief Function to get the number of sections checked by #Add since the last #Reset.
+	*/
+	uint64_t GetSectionCount() const { return m_uSections; }
+
+	/*! \brief Function to get the number of sections checked by #Add with at least one finding.
+	*/
+	uint64_t GetFailedCount() const { return m_uFailed; }
+
+	/*! \brief Function to get the number of sections checked by #Add with a finding.
+	*	\param eFinding one scte35Finding bit.
+	*/
+	uint64_t GetFindingCount(const scte35Finding::type& eFinding) const;
+
+	/*! \brief Function to get the scte35Finding bits found at least once by #Add.
+	*/
+	uint32_t GetFindings() const { return m_uFindings; }
+
+	/*! \brief Function to clear the batch counts.
+	*/
+	void Reset();
+
+	/*! \brief Function to get the name of a finding.
+	*	\param eFinding one scte35Finding bit.
+	*	\returns finding name, "unknown" for any other value.
+	*/
+	static const char* GetFindingName(const scte35Finding::type& eFinding);
+
+	/*! \brief Function to get the names of findings.
+	*	\param uFindings scte35Finding bits.
+	*	\param sText names separated by ',' (replaced).
+	*/
+	static void GetFindingNames(const uint32_t& uFindings, std::string& sText);
+
+private:
+	std::vector<uint8_t> m_vBytes;					/*!<Decoded bytes of #ValidateHexa.*/
+	uint64_t m_uSections;							/*!<Sections checked by #Add.*/
+	uint64_t m_uFailed;								/*!<Sections with a finding.*/
+	uint32_t m_uFindings;							/*!<Findings seen.*/
+	uint64_t m_uCounts[scte35Finding::count];		/*!<Sections with each finding, by bit position.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,504 @@
+/*! \file SpliceVisitor.cpp
+*	\brief Splice event driven parse classes definition.
+*	\details CPP file for definition of class CSpliceWalker whose declaration is in SpliceVisitor.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#include "SpliceVisitor.hpp"
+#include "SpliceLayout.hpp"
+#include "SpliceProjection.hpp"
+
+/*! \brief scte35 namespace for grouping implementation in one place
+*/
+namespace scte35{
+
+/*! \brief Bytes from table_id up to and including splice_command_type.
+*/
+static const std::size_t iHeaderBytes = 14;
+/*! \brief Bytes of CRC_32 and of E_CRC_32.
+*/
+static const std::size_t iCRCBytes = 4;
+/*! \brief Bytes of descriptor_loop_length.
+*/
+static const std::size_t iLoopLengthBytes = 2;
+/*! \brief splice_command_length of sections which do not give it (legacy encoders).
+*/
+static const uint32_t uUnknownCommandLength = 0xFFF;
+/*! \brief identifier of the SCTE-35 descriptors, "CUEI".
+*/
+static const uint32_t uCueIdentifier = 0x43554549;
+
+/*!	\class CWalkContext
+*	\brief #CWalkContext class holding the state of one walk and forwarding the decoded values to the visitor.
+*
+*	Positions are bit offsets from table_id. Every step returns false once the walk ends, m_eError then tells a failure from a stop.
+*/
+class CWalkContext {
+public:
+	/*! \brief #CWalkContext class constructor.
+	*/
+	CWalkContext(const uint8_t* pData, CSpliceVisitor& objVisitor) :
+	m_pData(pData),
+	m_objVisitor(objVisitor),
+	m_eError(scte35Error::none),
+	m_bStopped(false),
+	m_bMuted(false)
+	{
+	}
+
+	/*! \brief Function to apply the control returned by an event.
+	*	\returns false if the event stopped the walk.
+	*/
+	bool Event(const scte35Visit::type& eVisit) {
+		if (eVisit == scte35Visit::stop) {
+			m_bStopped = true;
+		}
+		return !m_bStopped;
+	}
+
+	/*! \brief Function to end the walk with a failure.
+	*/
+	bool Fail(const scte35Error::type& eError) {
+		if (!m_bStopped && m_eError == scte35Error::none) {
+			m_eError = eError;
+		}
+		return false;
+	}
+
+	/*! \brief Function-call operator forwarding a decoded field, the CSpliceLayout::Visit callback.
+	*/
+	bool operator()(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) {
+		return m_bMuted || Event(m_objVisitor.OnField(sName, uValue, iBitOffset, iBits));
+	}
+
+	/*! \brief Function to decode the fields of a layout table.
+	*	\param iPos position of the structure, moved past it.
+	*	\param iEnd position the structure must end before.
+	*	\param uValues receives the field values.
+	*/
+	template <typename TLayout>
+	bool Fields(std::size_t& iPos, const std::size_t& iEnd, uint64_t* uValues) {
+		if (CSpliceLayout<TLayout>::Visit(m_pData, iEnd, iPos, uValues, *this)) {
+			return true;
+		}
+		return Fail(scte35Error::truncated);
+	}
+
+	/*! \brief Function to report a run of bytes.
+	*/
+	bool Bytes(const char* sName, std::size_t& iPos, const std::size_t& iCount, const std::size_t& iEnd) {
+		if (iPos + iCount * 8 > iEnd) {
+			return Fail(scte35Error::truncated);
+		}
+		std::size_t iByte = iPos / 8;
+		iPos += iCount * 8;
+		return m_bMuted || Event(m_objVisitor.OnBytes(sName, m_pData + iByte, iCount, iByte));
+	}
+
+	/*! \brief Function to report the start of a loop element.
+	*/
+	bool Loop(const char* sName, const uint32_t& uIndex, const std::size_t& iPos) {
+		return m_bMuted || Event(m_objVisitor.OnLoop(sName, uIndex, iPos / 8));
+	}
+
+	/*! \brief Function to walk the splice command.
+	*/
+	bool Command(const uint32_t& uType, std::size_t& iPos, const std::size_t& iEnd);
+	/*! \brief Function to walk a splice_descriptor from its splice_descriptor_tag.
+	*/
+	bool Descriptor(const uint32_t& uTag, const uint32_t& uIdentifier, std::size_t& iPos, const std::size_t& iEnd);
+
+	const uint8_t* m_pData;				/*!<First byte of the section.*/
+	CSpliceVisitor& m_objVisitor;		/*!<Receiver of the events.*/
+	scte35Error::type m_eError;			/*!<Failure reason, scte35Error::none while walking.*/
+	bool m_bStopped;					/*!<Whether an event stopped the walk.*/
+	bool m_bMuted;						/*!<Whether fields are decoded without events (skipped command of unknown length).*/
+
+private:
+	/*! \brief Function to walk a splice_time whose fields are reported.
+	*/
+	bool SpliceTime(std::size_t& iPos, const std::size_t& iEnd) {
+		uint64_t uValues[CSpliceLayout<SpliceTimeLayout>::iFieldCount];
+		return Fields<SpliceTimeLayout>(iPos, iEnd, uValues);
+	}
+	/*! \brief Function to walk a break_duration whose fields are reported.
+	*/
+	bool BreakDuration(std::size_t& iPos, const std::size_t& iEnd) {
+		uint64_t uValues[CSpliceLayout<BreakDurationLayout>::iFieldCount];
+		return Fields<BreakDurationLayout>(iPos, iEnd, uValues);
+	}
+	/*! \brief Function to walk splice_schedule().
+	*/
+	bool SpliceSchedule(std::size_t& iPos, const std::size_t& iEnd);
+	/*! \brief Function to walk splice_insert().
+	*/
+	bool SpliceInsert(std::size_t& iPos, const std::size_t& iEnd);
+	/*! \brief Function to walk segmentation_descriptor().
+	*/
+	bool Segmentation(std::size_t& iPos, const std::size_t& iEnd);
+};
+
+bool CWalkContext::SpliceSchedule(std::size_t& iPos, const std::size_t& iEnd) {
+	uint64_t uSchedule[CSpliceLayout<SpliceScheduleLayout>::iFieldCount];
+	if (!Fields<SpliceScheduleLayout>(iPos, iEnd, uSchedule)) {
+		return false;
+	}
+
+	for (uint32_t i = 0;i < (uint32_t)uSchedule[0];i++) {
+		uint64_t uChild[CSpliceLayout<SpliceScheduleChildLayout>::iFieldCount];
+		if (!Loop("splice", i, iPos) || !Fields<SpliceScheduleChildLayout>(iPos, iEnd, uChild)) {
+			return false;
+		}
+		//splice_event_cancel_indicator
+		if (uChild[1] == 1) {
+			continue;
+		}
+
+		//program_splice_flag 0 : component_count components
+		if (uChild[4] == 0) {
+			for (uint32_t j = 0;j < (uint32_t)uChild[8];j++) {
+				uint64_t uComponent[CSpliceLayout<SSchComponentLayout>::iFieldCount];
+				if (!Loop("component", j, iPos) || !Fields<SSchComponentLayout>(iPos, iEnd, uComponent)) {
+					return false;
+				}
+			}
+		}
+
+		//duration_flag
+		if (uChild[5] == 1 && !BreakDuration(iPos, iEnd)) {
+			return false;
+		}
+
+		uint64_t uTail[CSpliceLayout<SpliceScheduleTailLayout>::iFieldCount];
+		if (!Fields<SpliceScheduleTailLayout>(iPos, iEnd, uTail)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CWalkContext::SpliceInsert(std::size_t& iPos, const std::size_t& iEnd) {
+	uint64_t uInsert[CSpliceLayout<SpliceInsertLayout>::iFieldCount];
+	if (!Fields<SpliceInsertLayout>(iPos, iEnd, uInsert)) {
+		return false;
+	}
+	//splice_event_cancel_indicator
+	if (uInsert[1] == 1) {
+		return true;
+	}
+
+	bool bProgram = uInsert[4] == 1;
+	bool bImmediate = uInsert[6] == 1;
+	if (bProgram && !bImmediate && !SpliceTime(iPos, iEnd)) {
+		return false;
+	}
+
+	if (!bProgram) {
+		uint64_t uCount[CSpliceLayout<SpliceInsertCountLayout>::iFieldCount];
+		if (!Fields<SpliceInsertCountLayout>(iPos, iEnd, uCount)) {
+			return false;
+		}
+		for (uint32_t i = 0;i < (uint32_t)uCount[0];i++) {
+			uint64_t uComponent[CSpliceLayout<SInComponentLayout>::iFieldCount];
+			if (!Loop("component", i, iPos) || !Fields<SInComponentLayout>(iPos, iEnd, uComponent)) {
+				return false;
+			}
+			if (!bImmediate && !SpliceTime(iPos, iEnd)) {
+				return false;
+			}
+		}
+	}
+
+	//duration_flag
+	if (uInsert[5] == 1 && !BreakDuration(iPos, iEnd)) {
+		return false;
+	}
+
+	uint64_t uTail[CSpliceLayout<SpliceInsertTailLayout>::iFieldCount];
+	return Fields<SpliceInsertTailLayout>(iPos, iEnd, uTail);
+}
+
+bool CWalkContext::Command(const uint32_t& uType, std::size_t& iPos, const std::size_t& iEnd) {
+	switch (uType)
+	{
+		case scte35Cmd::splice_null:
+		case scte35Cmd::bandwidth_reservation: {
+			return true;
+		}
+		case scte35Cmd::splice_schedule: {
+			return SpliceSchedule(iPos, iEnd);
+		}
+		case scte35Cmd::splice_insert: {
+			return SpliceInsert(iPos, iEnd);
+		}
+		case scte35Cmd::time_signal: {
+			return SpliceTime(iPos, iEnd);
+		}
+		case scte35Cmd::private_command: {
+			uint64_t uPrivate[CSpliceLayout<PrivateCommandLayout>::iFieldCount];
+			if (!Fields<PrivateCommandLayout>(iPos, iEnd, uPrivate)) {
+				return false;
+			}
+			//The private bytes fill the rest of the command
+			return Bytes("private_byte", iPos, (iEnd - iPos) / 8, iEnd);
+		}
+		default: {
+			return Fail(scte35Error::unknown_command);
+		}
+	}
+}
+
+bool CWalkContext::Segmentation(std::size_t& iPos, const std::size_t& iEnd) {
+	uint64_t uSegmentation[CSpliceLayout<SegmentationDescriptorLayout>::iFieldCount];
+	if (!Fields<SegmentationDescriptorLayout>(iPos, iEnd, uSegmentation)) {
+		return false;
+	}
+	//segmentation_event_cancel_indicator
+	if (uSegmentation[4] == 1) {
+		return true;
+	}
+
+	//program_segmentation_flag 0 : component_count components
+	if (uSegmentation[6] == 0) {
+		uint64_t uCount[CSpliceLayout<SegmentationCountLayout>::iFieldCount];
+		if (!Fields<SegmentationCountLayout>(iPos, iEnd, uCount)) {
+			return false;
+		}
+		for (uint32_t i = 0;i < (uint32_t)uCount[0];i++) {
+			uint64_t uComponent[CSpliceLayout<SegDescComponentLayout>::iFieldCount];
+			if (!Loop("component", i, iPos) || !Fields<SegDescComponentLayout>(iPos, iEnd, uComponent)) {
+				return false;
+			}
+		}
+	}
+
+	//segmentation_duration_flag
+	if (uSegmentation[7] == 1) {
+		uint64_t uDuration[CSpliceLayout<SegmentationDurationLayout>::iFieldCount];
+		if (!Fields<SegmentationDurationLayout>(iPos, iEnd, uDuration)) {
+			return false;
+		}
+	}
+
+	uint64_t uUpid[CSpliceLayout<SegmentationUpidLayout>::iFieldCount];
+	if (!Fields<SegmentationUpidLayout>(iPos, iEnd, uUpid) || !Bytes("segmentation_upid", iPos, (std::size_t)uUpid[1], iEnd)) {
+		return false;
+	}
+
+	uint64_t uType[CSpliceLayout<SegmentationTypeLayout>::iFieldCount];
+	if (!Fields<SegmentationTypeLayout>(iPos, iEnd, uType)) {
+		return false;
+	}
+
+	//Sub-segment fields are optional in older encoders, read when the descriptor holds them
+	if ((uType[0] == 0x34 || uType[0] == 0x36 || uType[0] == 0x38 || uType[0] == 0x3A) && iPos + CSpliceLayout<SubSegmentLayout>::iMaxBits <= iEnd) {
+		uint64_t uSubSegment[CSpliceLayout<SubSegmentLayout>::iFieldCount];
+		return Fields<SubSegmentLayout>(iPos, iEnd, uSubSegment);
+	}
+	return true;
+}
+
+bool CWalkContext::Descriptor(const uint32_t& uTag, const uint32_t& uIdentifier, std::size_t& iPos, const std::size_t& iEnd) {
+	if (uIdentifier == uCueIdentifier) {
+		switch (uTag)
+		{
+			case scte35Desc::avail_descriptor: {
+				uint64_t uValues[CSpliceLayout<AvailDescriptorLayout>::iFieldCount];
+				return Fields<AvailDescriptorLayout>(iPos, iEnd, uValues);
+			}
+			case scte35Desc::dtmf_descriptor: {
+				uint64_t uValues[CSpliceLayout<DTMFDescriptorLayout>::iFieldCount];
+				//dtmf_count DTMF_char
+				return Fields<DTMFDescriptorLayout>(iPos, iEnd, uValues) && Bytes("DTMF_char", iPos, (std::size_t)uValues[4], iEnd);
+			}
+			case scte35Desc::segmentation_descriptor: {
+				return Segmentation(iPos, iEnd);
+			}
+			case scte35Desc::time_descriptor: {
+				uint64_t uValues[CSpliceLayout<TimeDescriptorLayout>::iFieldCount];
+				return Fields<TimeDescriptorLayout>(iPos, iEnd, uValues);
+			}
+			case scte35Desc::audio_descriptor: {
+				uint64_t uValues[CSpliceLayout<AudioDescriptorLayout>::iFieldCount];
+				if (!Fields<AudioDescriptorLayout>(iPos, iEnd, uValues)) {
+					return false;
+				}
+				//audio_count components
+				for (uint32_t i = 0;i < (uint32_t)uValues[3];i++) {
+					uint64_t uComponent[CSpliceLayout<AudioDescComponentLayout>::iFieldCount];
+					if (!Loop("component", i, iPos) || !Fields<AudioDescComponentLayout>(iPos, iEnd, uComponent)) {
+						return false;
+					}
+				}
+				return true;
+			}
+			default: {
+			}
+			break;
+		}
+	}
+
+	//Reserved tag or private identifier : the bytes after identifier are private
+	uint64_t uBase[CSpliceLayout<SDBaseLayout>::iFieldCount];
+	if (!Fields<SDBaseLayout>(iPos, iEnd, uBase)) {
+		return false;
+	}
+	return Bytes("private_byte", iPos, (iEnd - iPos) / 8, iEnd);
+}
+
+/*! \brief Function to walk a section whose size was checked, the events up to OnEnd.
+*/
+static bool WalkSection(CWalkContext& objContext, const std::size_t& iSectionBytes) {
+	const uint8_t* pData = objContext.m_pData;
+	CSpliceVisitor& objVisitor = objContext.m_objVisitor;
+	std::size_t iCRCPos = (iSectionBytes - iCRCBytes) * 8;
+
+	if (!objContext.Event(objVisitor.OnSection(pData, iSectionBytes))) {
+		return false;
+	}
+
+	std::size_t iPos = 0;
+	uint64_t uHeader[CSpliceLayout<SInfoHeaderLayout>::iFieldCount];
+	if (!objContext.Fields<SInfoHeaderLayout>(iPos, iCRCPos, uHeader)) {
+		return false;
+	}
+
+	//encrypted_packet : the encrypted part is opaque up to E_CRC_32
+	if (uHeader[6] == 1) {
+		uint64_t uECRC[CSpliceLayout<SInfoECRCLayout>::iFieldCount];
+		std::size_t iECRCPos = iCRCPos - iCRCBytes * 8;
+		if (iECRCPos < iPos) {
+			return objContext.Fail(scte35Error::truncated);
+		}
+		if (!objContext.Bytes("encrypted_data", iPos, (iECRCPos - iPos) / 8, iECRCPos) || !objContext.Fields<SInfoECRCLayout>(iPos, iCRCPos, uECRC)) {
+			return false;
+		}
+	}
+	else {
+		//splice_command_length bounds the command, sections without it are bounded by the section
+		uint32_t uType = (uint32_t)uHeader[12];
+		uint32_t uCommandLength = (uint32_t)uHeader[11];
+		bool bKnownLength = uCommandLength != uUnknownCommandLength;
+		std::size_t iCommandEnd = iCRCPos - iLoopLengthBytes * 8;
+		if (bKnownLength) {
+			if (iHeaderBytes + uCommandLength > iCommandEnd / 8) {
+				return objContext.Fail(scte35Error::truncated);
+			}
+			iCommandEnd = (iHeaderBytes + uCommandLength) * 8;
+		}
+
+		scte35Visit::type eVisit = objVisitor.OnCommand(uType, iHeaderBytes, uCommandLength);
+		if (!objContext.Event(eVisit)) {
+			return false;
+		}
+		if (eVisit == scte35Visit::skip && bKnownLength) {
+			iPos = iCommandEnd;
+		}
+		else {
+			//A skipped command of unknown length is still decoded, without events, to find its end
+			objContext.m_bMuted = eVisit == scte35Visit::skip;
+			bool bWalked = objContext.Command(uType, iPos, iCommandEnd);
+			objContext.m_bMuted = false;
+			if (!bWalked) {
+				return false;
+			}
+			if (bKnownLength) {
+				iPos = iCommandEnd;
+			}
+		}
+		if (!objContext.Event(objVisitor.OnCommandEnd(uType))) {
+			return false;
+		}
+
+		uint64_t uLoop[CSpliceLayout<SInfoLoopLayout>::iFieldCount];
+		if (!objContext.Fields<SInfoLoopLayout>(iPos, iCRCPos, uLoop)) {
+			return false;
+		}
+		std::size_t iLoopEnd = iPos / 8 + (std::size_t)uLoop[0];
+		if (iLoopEnd > iCRCPos / 8) {
+			return objContext.Fail(scte35Error::descriptor_overrun);
+		}
+
+		while (iPos / 8 < iLoopEnd) {
+			std::size_t iDescriptor = iPos / 8;
+			if (iDescriptor + 2 > iLoopEnd) {
+				return objContext.Fail(scte35Error::truncated);
+			}
+			uint32_t uTag = pData[iDescriptor];
+			std::size_t iDescriptorEnd = iDescriptor + 2 + pData[iDescriptor + 1];
+			if (iDescriptorEnd > iLoopEnd) {
+				return objContext.Fail(scte35Error::descriptor_overrun);
+			}
+			uint32_t uIdentifier = 0;
+			if (iDescriptorEnd - iDescriptor >= 6) {
+				uIdentifier = ((uint32_t)pData[iDescriptor + 2] << 24) | ((uint32_t)pData[iDescriptor + 3] << 16) | ((uint32_t)pData[iDescriptor + 4] << 8) | pData[iDescriptor + 5];
+			}
+
+			eVisit = objVisitor.OnDescriptor(uTag, uIdentifier, iDescriptor, iDescriptorEnd - iDescriptor);
+			if (!objContext.Event(eVisit)) {
+				return false;
+			}
+			if (eVisit != scte35Visit::skip && !objContext.Descriptor(uTag, uIdentifier, iPos, iDescriptorEnd * 8)) {
+				return false;
+			}
+			iPos = iDescriptorEnd * 8;
+			if (!objContext.Event(objVisitor.OnDescriptorEnd(uTag))) {
+				return false;
+			}
+		}
+
+		if (iPos < iCRCPos && !objContext.Bytes("alignment_stuffing", iPos, (iCRCPos - iPos) / 8, iCRCPos)) {
+			return false;
+		}
+	}
+
+	uint64_t uCRC[CSpliceLayout<SInfoCRCLayout>::iFieldCount];
+	iPos = iCRCPos;
+	return objContext.Fields<SInfoCRCLayout>(iPos, iSectionBytes * 8, uCRC);
+}
+
+scte35Error::type CSpliceWalker::Walk(const uint8_t* pData, const std::size_t& iLength, CSpliceVisitor& objVisitor) {
+	CWalkContext objContext(pData, objVisitor);
+
+	if (pData == nullptr || iLength == 0) {
+		objContext.Fail(scte35Error::empty_input);
+	}
+	else if (iLength < iHeaderBytes) {
+		objContext.Fail(scte35Error::truncated);
+	}
+	else {
+		std::size_t iSectionBytes = 3 + (((std::size_t)(pData[1] & 0x0F) << 8) | pData[2]);
+		if (iSectionBytes > iLength || iSectionBytes < iHeaderBytes + iCRCBytes) {
+			objContext.Fail(scte35Error::truncated);
+		}
+		else {
+			WalkSection(objContext, iSectionBytes);
+		}
+	}
+
+	objVisitor.OnEnd(objContext.m_eError);
+	return objContext.m_eError;
+}
+
+scte35Error::type CSpliceWalker::WalkHexa(const std::string& sInput, CSpliceVisitor& objVisitor) {
+	if (sInput.empty()) {
+		objVisitor.OnEnd(scte35Error::empty_input);
+		return scte35Error::empty_input;
+	}
+	if (!CSpliceProjection::HexaToBytes(sInput, m_vBytes)) {
+		scte35Error::type eError = scte35Error::rejected;
+		if (sInput.length() % 2 != 0) {
+			eError = scte35Error::odd_length;
+		}
+		else if (sInput.find_first_of(" \t\r\n\v\f") != std::string::npos) {
+			eError = scte35Error::white_space;
+		}
+		objVisitor.OnEnd(eError);
+		return eError;
+	}
+	return Walk(m_vBytes.data(), m_vBytes.size(), objVisitor);
+}
+
+};
@@ -0,0 +1,142 @@
+/*! \file SpliceVisitor.hpp
+*	\brief Splice event driven parse classes declaration.
+*	\details Header file for declaration of classes CSpliceVisitor and CSpliceWalker whose definition is in SpliceVisitor.cpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICEVISITOR_HPP_
+/*! \brief SpliceVisitor.hpp header guard define.
+*/
+#define _SPLICEVISITOR_HPP_
+
+#include "SpliceClass.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*! \struct scte35Visit
+*	\brief scte35Visit structure to hold the values a #CSpliceVisitor event returns to #CSpliceWalker.
+*/
+struct scte35Visit {
+	/*!
+	*	\brief A type definition for type (Walk controls)
+	*/
+	typedef enum {
+		next = 0,	/*!<Continue with the next event*/
+		skip = 1,	/*!<Skip the fields of the command or descriptor just announced (same as next for other events)*/
+		stop = 2	/*!<End the walk, #CSpliceWalker::Walk returns scte35Error::none*/
+	}type;
+};
+
+/*!	\class CSpliceVisitor
+*	\brief #CSpliceVisitor class receiving the events of #CSpliceWalker, override the events of interest.
+*
+*	Events come in wire order: OnSection, the header fields, OnCommand, the command fields, OnCommandEnd, descriptor_loop_length, then
+*	OnDescriptor, its fields and OnDescriptorEnd for each descriptor, CRC_32 and OnEnd. Each element of a loop (splice_schedule events and
+*	components) starts with OnLoop. Field names are the ones of the text output, offsets count from table_id. Names and byte pointers stay
+*	valid until the walk returns.
+*/
+class CSpliceVisitor {
+public:
+	/*! \brief #CSpliceVisitor class destructor.
+	*/
+	virtual ~CSpliceVisitor() {}
+
+	/*! \brief Event of the start of a splice_info_section.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength section size in bytes (section_length + 3).
+	*/
+	virtual scte35Visit::type OnSection(const uint8_t* pData, const std::size_t& iLength) { (void)pData; (void)iLength; return scte35Visit::next; }
+
+	/*! \brief Event of a decoded field.
+	*	\param sName field name.
+	*	\param uValue field value.
+	*	\param iBitOffset offset of the first bit of the field, iBitOffset / 8 being the byte offset.
+	*	\param iBits field width in bits.
+	*/
+	virtual scte35Visit::type OnField(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) { (void)sName; (void)uValue; (void)iBitOffset; (void)iBits; return scte35Visit::next; }
+
+	/*! \brief Event of a run of bytes (private_byte, DTMF_char, segmentation_upid, encrypted data).
+	*	\param sName field name.
+	*	\param pData first byte, points into the walked buffer.
+	*	\param iLength number of bytes.
+	*	\param iOffset byte offset of pData.
+	*/
+	virtual scte35Visit::type OnBytes(const char* sName, const uint8_t* pData, const std::size_t& iLength, const std::size_t& iOffset) { (void)sName; (void)pData; (void)iLength; (void)iOffset; return scte35Visit::next; }
+
+	/*! \brief Event of the start of the splice command, scte35Visit::skip passes over its fields.
+	*	\param uType splice_command_type.
+	*	\param iOffset byte offset of the first command byte.
+	*	\param iLength splice_command_length, 0xFFF when the encoder did not give it.
+	*/
+	virtual scte35Visit::type OnCommand(const uint32_t& uType, const std::size_t& iOffset, const std::size_t& iLength) { (void)uType; (void)iOffset; (void)iLength; return scte35Visit::next; }
+
+	/*! \brief Event of the end of the splice command.
+	*/
+	virtual scte35Visit::type OnCommandEnd(const uint32_t& uType) { (void)uType; return scte35Visit::next; }
+
+	/*! \brief Event of the start of a loop element.
+	*	\param sName loop name ("splice" for splice_schedule events, "component" otherwise).
+	*	\param uIndex element index in the loop.
+	*	\param iOffset byte offset of the element.
+	*/
+	virtual scte35Visit::type OnLoop(const char* sName, const uint32_t& uIndex, const std::size_t& iOffset) { (void)sName; (void)uIndex; (void)iOffset; return scte35Visit::next; }
+
+	/*! \brief Event of the start of a splice_descriptor, scte35Visit::skip passes over its fields.
+	*	\param uTag splice_descriptor_tag.
+	*	\param uIdentifier identifier, 0 if the descriptor is shorter than 4 bytes.
+	*	\param iOffset byte offset of splice_descriptor_tag.
+	*	\param iLength descriptor size in bytes (descriptor_length + 2).
+	*/
+	virtual scte35Visit::type OnDescriptor(const uint32_t& uTag, const uint32_t& uIdentifier, const std::size_t& iOffset, const std::size_t& iLength) { (void)uTag; (void)uIdentifier; (void)iOffset; (void)iLength; return scte35Visit::next; }
+
+	/*! \brief Event of the end of a splice_descriptor.
+	*/
+	virtual scte35Visit::type OnDescriptorEnd(const uint32_t& uTag) { (void)uTag; return scte35Visit::next; }
+
+	/*! \brief Event of the end of the walk, also sent when it fails or a visitor event stops it.
+	*	\param eError scte35Error::none if the section was walked to the end or stopped.
+	*/
+	virtual void OnEnd(const scte35Error::type& eError) { (void)eError; }
+};
+
+/*!	\class CSpliceWalker
+*	\brief #CSpliceWalker class parsing a splice_info_section as a stream of #CSpliceVisitor events.
+*
+*	Nothing is materialized: no SpliceInsertData, SegmentationDescriptor or vector is built, each field is decoded from the bytes with the
+*	SpliceLayout.hpp tables and handed to the visitor, so filters, metrics and converters read every value once. The command is bounded by
+*	splice_command_length and each descriptor by descriptor_length; descriptors of an unknown tag or identifier are reported as private_byte.
+*	Fields follow the SCTE-35 syntax, an encrypted section reports its encrypted part as bytes. CRC_32 is reported, not checked.
+*/
+class CSpliceWalker {
+public:
+	/*! \brief Function to walk a binary splice_info_section.
+	*	\param pData section bytes starting with table_id.
+	*	\param iLength number of bytes available in pData.
+	*	\param objVisitor receiver of the events.
+	*	\returns scte35Error::none if walked or stopped by the visitor, otherwise the failure reason.
+	*/
+	static scte35Error::type Walk(const uint8_t* pData, const std::size_t& iLength, CSpliceVisitor& objVisitor);
+
+	/*! \brief Function to walk hexa-decimal textual data (without spaces). Byte pointers of the events point into an internal buffer.
+	*	\param sInput an input hexa-decimal string data.
+	*	\param objVisitor receiver of the events.
+	*	\returns scte35Error::none if walked or stopped by the visitor, otherwise the failure reason (scte35Error::rejected for a non hexa-decimal character).
+	*/
+	scte35Error::type WalkHexa(const std::string& sInput, CSpliceVisitor& objVisitor);
+
+private:
+	std::vector<uint8_t> m_vBytes;		/*!<Bytes of the last #WalkHexa input.*/
+};
+
+};
+
+#endif
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/SpliceArchive.cpp" "CMakeFiles/SCTE35.dir/SpliceArchive.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceArchive.cpp.o.d"
+  "/root/repo/SpliceBitKernel.cpp" "CMakeFiles/SCTE35.dir/SpliceBitKernel.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceBitKernel.cpp.o.d"
+  "/root/repo/SpliceCApi.cpp" "CMakeFiles/SCTE35.dir/SpliceCApi.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceCApi.cpp.o.d"
+  "/root/repo/SpliceCRC.cpp" "CMakeFiles/SCTE35.dir/SpliceCRC.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceCRC.cpp.o.d"
+  "/root/repo/SpliceCache.cpp" "CMakeFiles/SCTE35.dir/SpliceCache.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceCache.cpp.o.d"
+  "/root/repo/SpliceClass.cpp" "CMakeFiles/SCTE35.dir/SpliceClass.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceClass.cpp.o.d"
+  "/root/repo/SpliceColumnar.cpp" "CMakeFiles/SCTE35.dir/SpliceColumnar.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceColumnar.cpp.o.d"
+  "/root/repo/SpliceDescriptorRegistry.cpp" "CMakeFiles/SCTE35.dir/SpliceDescriptorRegistry.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceDescriptorRegistry.cpp.o.d"
+  "/root/repo/SpliceEngine.cpp" "CMakeFiles/SCTE35.dir/SpliceEngine.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceEngine.cpp.o.d"
+  "/root/repo/SpliceFilter.cpp" "CMakeFiles/SCTE35.dir/SpliceFilter.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceFilter.cpp.o.d"
+  "/root/repo/SpliceFingerprint.cpp" "CMakeFiles/SCTE35.dir/SpliceFingerprint.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceFingerprint.cpp.o.d"
+  "/root/repo/SpliceJournal.cpp" "CMakeFiles/SCTE35.dir/SpliceJournal.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceJournal.cpp.o.d"
+  "/root/repo/SpliceMappedFile.cpp" "CMakeFiles/SCTE35.dir/SpliceMappedFile.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceMappedFile.cpp.o.d"
+  "/root/repo/SpliceMetrics.cpp" "CMakeFiles/SCTE35.dir/SpliceMetrics.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceMetrics.cpp.o.d"
+  "/root/repo/SplicePipeline.cpp" "CMakeFiles/SCTE35.dir/SplicePipeline.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SplicePipeline.cpp.o.d"
+  "/root/repo/SpliceProfiler.cpp" "CMakeFiles/SCTE35.dir/SpliceProfiler.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceProfiler.cpp.o.d"
+  "/root/repo/SpliceProjection.cpp" "CMakeFiles/SCTE35.dir/SpliceProjection.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceProjection.cpp.o.d"
+  "/root/repo/SpliceRewrite.cpp" "CMakeFiles/SCTE35.dir/SpliceRewrite.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceRewrite.cpp.o.d"
+  "/root/repo/SpliceScheduleIndex.cpp" "CMakeFiles/SCTE35.dir/SpliceScheduleIndex.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceScheduleIndex.cpp.o.d"
+  "/root/repo/SpliceScheduler.cpp" "CMakeFiles/SCTE35.dir/SpliceScheduler.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceScheduler.cpp.o.d"
+  "/root/repo/SpliceSegmentation.cpp" "CMakeFiles/SCTE35.dir/SpliceSegmentation.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceSegmentation.cpp.o.d"
+  "/root/repo/SpliceTimeline.cpp" "CMakeFiles/SCTE35.dir/SpliceTimeline.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceTimeline.cpp.o.d"
+  "/root/repo/SpliceUpid.cpp" "CMakeFiles/SCTE35.dir/SpliceUpid.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceUpid.cpp.o.d"
+  "/root/repo/SpliceValidator.cpp" "CMakeFiles/SCTE35.dir/SpliceValidator.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceValidator.cpp.o.d"
+  "/root/repo/SpliceVisitor.cpp" "CMakeFiles/SCTE35.dir/SpliceVisitor.cpp.o" "gcc" "CMakeFiles/SCTE35.dir/SpliceVisitor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
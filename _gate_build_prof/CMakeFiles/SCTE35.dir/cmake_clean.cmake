@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SCTE35.dir/SpliceArchive.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceArchive.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceBitKernel.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceBitKernel.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceCApi.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceCApi.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceCRC.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceCRC.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceCache.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceCache.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceClass.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceClass.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceColumnar.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceColumnar.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceDescriptorRegistry.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceDescriptorRegistry.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceEngine.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceEngine.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceFilter.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceFilter.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceFingerprint.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceFingerprint.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceJournal.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceJournal.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceMappedFile.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceMappedFile.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceMetrics.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceMetrics.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SplicePipeline.cpp.o"
+  "CMakeFiles/SCTE35.dir/SplicePipeline.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceProfiler.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceProfiler.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceProjection.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceProjection.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceRewrite.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceRewrite.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceScheduleIndex.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceScheduleIndex.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceScheduler.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceScheduler.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceSegmentation.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceSegmentation.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceTimeline.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceTimeline.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceUpid.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceUpid.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceValidator.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceValidator.cpp.o.d"
+  "CMakeFiles/SCTE35.dir/SpliceVisitor.cpp.o"
+  "CMakeFiles/SCTE35.dir/SpliceVisitor.cpp.o.d"
+  "libSCTE35.a"
+  "libSCTE35.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SCTE35.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
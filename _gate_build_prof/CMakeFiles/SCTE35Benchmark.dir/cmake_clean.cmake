@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SCTE35Benchmark.dir/benchmark/SpliceBenchmark.cpp.o"
+  "CMakeFiles/SCTE35Benchmark.dir/benchmark/SpliceBenchmark.cpp.o.d"
+  "SCTE35Benchmark"
+  "SCTE35Benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SCTE35Benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
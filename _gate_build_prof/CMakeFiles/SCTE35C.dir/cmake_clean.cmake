@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SCTE35C.dir/SpliceCApi.cpp.o"
+  "CMakeFiles/SCTE35C.dir/SpliceCApi.cpp.o.d"
+  "libSCTE35C.pdb"
+  "libSCTE35C.so"
+  "libSCTE35C.so.1"
+  "libSCTE35C.so.1.0.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SCTE35C.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
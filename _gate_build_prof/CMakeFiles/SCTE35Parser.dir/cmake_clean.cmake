@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SCTE35Parser.dir/main.cpp.o"
+  "CMakeFiles/SCTE35Parser.dir/main.cpp.o.d"
+  "SCTE35Parser"
+  "SCTE35Parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SCTE35Parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SCTE35Test.dir/test/SpliceTest.cpp.o"
+  "CMakeFiles/SCTE35Test.dir/test/SpliceTest.cpp.o.d"
+  "SCTE35Test"
+  "SCTE35Test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SCTE35Test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,918 @@
+/*! \file SpliceBenchmark.cpp
+*	\brief Benchmark suite file.
+*	\details CPP file containing the Google Benchmark entry point measuring ParseHexa, ParseBase64, ParseBinary, cached ParseHexa, projected ParseHexa, header kernels, visitor walks, journal appends and scans, columnar exports and scans, archive indexing and queries, UPID decoding, conformance validation, fingerprints and diffs and GetText throughput over the cues of SpliceCorpus.hpp.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+#include <benchmark/benchmark.h>
+#include "SpliceClass.hpp"
+#include "SpliceCache.hpp"
+#include "SpliceCorpus.hpp"
+#include "SpliceProjection.hpp"
+#include "SpliceBitKernel.hpp"
+#include "SpliceLayout.hpp"
+#include "SpliceVisitor.hpp"
+#include "SpliceDescriptorRegistry.hpp"
+#include "SpliceCApi.h"
+#include "SplicePipeline.hpp"
+#include "SpliceEngine.hpp"
+#include "SpliceJournal.hpp"
+#include "SpliceColumnar.hpp"
+#include "SpliceArchive.hpp"
+#include "SpliceUpid.hpp"
+#include "SpliceValidator.hpp"
+#include "SpliceFingerprint.hpp"
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/*! \brief Function to convert hexa-decimal string to Base64 string (benchmark input preparation only).
+*	\param sHexa an input hexa-decimal string data.
+*	\returns Base64 string data.
+*/
+std::string HexaToBase64(const std::string& sHexa) {
+	static const char* sAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	std::vector<unsigned char> vBytes;
+	for (std::size_t i = 0;i + 1 < sHexa.length();i += 2) {
+		vBytes.push_back((unsigned char)std::stoul(sHexa.substr(i, 2), nullptr, 16));
+	}
+
+	std::string sOut;
+	for (std::size_t i = 0;i < vBytes.size();i += 3) {
+		uint32_t uGroup = (uint32_t)vBytes[i] << 16;
+		if (i + 1 < vBytes.size()) { uGroup |= (uint32_t)vBytes[i + 1] << 8; }
+		if (i + 2 < vBytes.size()) { uGroup |= vBytes[i + 2]; }
+
+		sOut += sAlphabet[(uGroup >> 18) & 0x3f];
+		sOut += sAlphabet[(uGroup >> 12) & 0x3f];
+		sOut += (i + 1 < vBytes.size()) ? sAlphabet[(uGroup >> 6) & 0x3f] : '=';
+		sOut += (i + 2 < vBytes.size()) ? sAlphabet[uGroup & 0x3f] : '=';
+	}
+	return sOut;
+}
+
+/*! \brief Function to convert hexa-decimal string to binary textual string (benchmark input preparation only).
+*	\param sHexa an input hexa-decimal string data.
+*	\returns binary textual string data.
+*/
+std::string HexaToBinary(const std::string& sHexa) {
+	std::string sOut;
+	for (std::size_t i = 0;i < sHexa.length();i++) {
+		unsigned long uNibble = std::stoul(sHexa.substr(i, 1), nullptr, 16);
+		for (int j = 3;j >= 0;j--) {
+			sOut += ((uNibble >> j) & 1) ? '1' : '0';
+		}
+	}
+	return sOut;
+}
+
+/*! \brief Input encodings measured by the parse benchmarks.
+*/
+enum class EInput { hexa, base64, binary };
+
+/*! \brief Function to get the benchmark input string for one corpus entry.
+*	\param eInput requested input encoding.
+*	\param pEntry corpus entry.
+*	\returns encoded cue data.
+*/
+std::string MakeInput(const EInput& eInput, const scte35::SpliceCorpusEntry* pEntry) {
+	switch (eInput) {
+		case EInput::base64: return HexaToBase64(pEntry->sHexa);
+		case EInput::binary: return HexaToBinary(pEntry->sHexa);
+		default: return pEntry->sHexa;
+	}
+}
+
+/*! \brief Function to run the matching parse entry point.
+*/
+bool RunParse(scte35::CSpliceClass& objParser, const EInput& eInput, const std::string& sInput) {
+	switch (eInput) {
+		case EInput::base64: return objParser.ParseBase64(sInput);
+		case EInput::binary: return objParser.ParseBinary(sInput);
+		default: return objParser.ParseHexa(sInput);
+	}
+}
+
+/*! \brief Function to publish cues/s and s/cue counters for a finished benchmark.
+*
+*	Google Benchmark prints counters with SI prefixes, so s/cue shows as 1.2us for 1.2 microseconds per cue.
+*/
+void SetCueCounters(benchmark::State& state, const std::size_t& iCuesPerIteration) {
+	double dCues = (double)state.iterations() * (double)iCuesPerIteration;
+	state.counters["cues/s"] = benchmark::Counter(dCues, benchmark::Counter::kIsRate);
+	state.counters["s/cue"] = benchmark::Counter(dCues, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/*! \brief Benchmark of one parse entry point over a list of corpus entries (one cue or the full corpus), with or without the time_signal fast path.
+*/
+void BM_Parse(benchmark::State& state, EInput eInput, bool bFastPath, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::string> vInputs;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vInputs.emplace_back(MakeInput(eInput, pEntry));
+	}
+
+	scte35::CSpliceClass objParser;
+	objParser.SetFastPath(bFastPath);
+	for (std::size_t i = 0;i < vInputs.size();i++) {
+		if (!RunParse(objParser, eInput, vInputs[i])) {
+			state.SkipWithError((std::string("corpus cue does not parse : ") + vEntries[i]->sName).c_str());
+			return;
+		}
+	}
+
+	for (auto _ : state) {
+		for (const std::string& sInput : vInputs) {
+			bool bResult = RunParse(objParser, eInput, sInput);
+			benchmark::DoNotOptimize(bResult);
+		}
+	}
+
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief Benchmark of CSpliceCache::ParseHexa over a list of corpus entries already cached (the repeated cue case).
+*/
+void BM_ParseCached(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::string> vInputs;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vInputs.emplace_back(pEntry->sHexa);
+	}
+
+	scte35::CSpliceCache objCache(vInputs.size());
+	for (std::size_t i = 0;i < vInputs.size();i++) {
+		if (objCache.ParseHexa(vInputs[i]) == nullptr) {
+			state.SkipWithError((std::string("corpus cue does not parse : ") + vEntries[i]->sName).c_str());
+			return;
+		}
+	}
+
+	for (auto _ : state) {
+		for (const std::string& sInput : vInputs) {
+			scte35::CSpliceCache::ResultPtr pResult = objCache.ParseHexa(sInput);
+			benchmark::DoNotOptimize(pResult);
+		}
+	}
+
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief Benchmark of CSpliceProjection::ParseHexa decoding a few routing fields over a list of corpus entries.
+*/
+void BM_ParseProjected(benchmark::State& state, uint32_t uFields, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::string> vInputs;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vInputs.emplace_back(pEntry->sHexa);
+	}
+
+	scte35::CSpliceProjection objProjection(uFields);
+	scte35::SSpliceProjection objResult;
+	for (std::size_t i = 0;i < vInputs.size();i++) {
+		if (!objProjection.ParseHexa(vInputs[i], objResult)) {
+			state.SkipWithError((std::string("corpus cue does not parse : ") + vEntries[i]->sName).c_str());
+			return;
+		}
+	}
+
+	for (auto _ : state) {
+		for (const std::string& sInput : vInputs) {
+			bool bResult = objProjection.ParseHexa(sInput, objResult);
+			benchmark::DoNotOptimize(bResult);
+			benchmark::DoNotOptimize(objResult);
+		}
+	}
+
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief Benchmark of the splice_info_section header extraction from the bit string over a list of corpus entries, with a
+*	#CSpliceBitKernel kernel or field by field (bByField) as the table decoder does.
+*/
+void BM_InfoHeader(benchmark::State& state, scte35::scte35Kernel::type eKernel, bool bByField, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	if (!bByField && !scte35::CSpliceBitKernel::IsSupported(eKernel)) {
+		state.SkipWithError("kernel not supported on this CPU");
+		return;
+	}
+
+	std::vector<std::string> vInputs;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vInputs.emplace_back(HexaToBinary(pEntry->sHexa));
+	}
+
+	scte35::scte35Kernel::type eSaved = scte35::CSpliceBitKernel::GetKernel();
+	scte35::CSpliceBitKernel::SetKernel(eKernel);
+
+	scte35::SInfoData objInfo;
+	uint8_t uHeader[scte35::CSpliceBitKernel::iInfoHeaderBytes];
+	for (auto _ : state) {
+		for (const std::string& sInput : vInputs) {
+			if (bByField) {
+				int iPos = 0;
+				scte35::CSpliceLayout<scte35::SInfoHeaderLayout>::DecodeBits(sInput, iPos, objInfo);
+			}
+			else if (scte35::CSpliceBitKernel::PackBits(sInput.data(), sizeof(uHeader) * 8, uHeader)) {
+				scte35::CSpliceBitKernel::ExtractInfoHeader(uHeader, objInfo);
+			}
+			benchmark::DoNotOptimize(objInfo);
+		}
+	}
+
+	scte35::CSpliceBitKernel::SetKernel(eSaved);
+	SetCueCounters(state, vInputs.size());
+}
+
+/*!	\class CSumVisitor
+*	\brief #CSumVisitor class folding every field value of a walk, standing for a metrics or converter visitor.
+*/
+class CSumVisitor : public scte35::CSpliceVisitor {
+public:
+	uint64_t uSum = 0;		/*!<Sum of the field values and byte counts.*/
+
+	scte35::scte35Visit::type OnField(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) override {
+		(void)sName; (void)iBitOffset; (void)iBits;
+		uSum += uValue;
+		return scte35::scte35Visit::next;
+	}
+	scte35::scte35Visit::type OnBytes(const char* sName, const uint8_t* pData, const std::size_t& iLength, const std::size_t& iOffset) override {
+		(void)sName; (void)pData; (void)iOffset;
+		uSum += iLength;
+		return scte35::scte35Visit::next;
+	}
+};
+
+/*!	\class CTypeFilterVisitor
+*	\brief #CTypeFilterVisitor class reading the segmentation_type_id of each segmentation_descriptor and skipping the command and other descriptors.
+*/
+class CTypeFilterVisitor : public scte35::CSpliceVisitor {
+public:
+	uint32_t uTypes = 0;	/*!<Number of segmentation_type_id seen.*/
+
+	scte35::scte35Visit::type OnCommand(const uint32_t& uType, const std::size_t& iOffset, const std::size_t& iLength) override {
+		(void)uType; (void)iOffset; (void)iLength;
+		return scte35::scte35Visit::skip;
+	}
+	scte35::scte35Visit::type OnDescriptor(const uint32_t& uTag, const uint32_t& uIdentifier, const std::size_t& iOffset, const std::size_t& iLength) override {
+		(void)uIdentifier; (void)iOffset; (void)iLength;
+		return uTag == scte35::scte35Desc::segmentation_descriptor ? scte35::scte35Visit::next : scte35::scte35Visit::skip;
+	}
+	scte35::scte35Visit::type OnField(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) override {
+		(void)uValue; (void)iBitOffset; (void)iBits;
+		if (sName[0] == 's' && std::strcmp(sName, "segmentation_type_id") == 0) {
+			uTypes++;
+		}
+		return scte35::scte35Visit::next;
+	}
+};
+
+/*! \brief Benchmark of CSpliceWalker::WalkHexa over a list of corpus entries with a visitor.
+*/
+template <typename TVisitor>
+void BM_Walk(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::string> vInputs;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vInputs.emplace_back(pEntry->sHexa);
+	}
+
+	scte35::CSpliceWalker objWalker;
+	TVisitor objVisitor;
+	for (std::size_t i = 0;i < vInputs.size();i++) {
+		if (objWalker.WalkHexa(vInputs[i], objVisitor) != scte35::scte35Error::none) {
+			state.SkipWithError((std::string("corpus cue does not walk : ") + vEntries[i]->sName).c_str());
+			return;
+		}
+	}
+
+	for (auto _ : state) {
+		for (const std::string& sInput : vInputs) {
+			scte35::scte35Error::type eError = objWalker.WalkHexa(sInput, objVisitor);
+			benchmark::DoNotOptimize(eError);
+		}
+		benchmark::DoNotOptimize(objVisitor);
+	}
+
+	SetCueCounters(state, vInputs.size());
+}
+
+/*!	\class CVendorDescriptor
+*	\brief #CVendorDescriptor class holding the first private byte of a vendor descriptor, standing for an application descriptor class.
+*/
+class CVendorDescriptor : public scte35::PrivateDescriptor {
+public:
+	uint32_t uFirstByte = 0;	/*!<First byte after identifier.*/
+};
+
+/*!	\class CVendorDecoder
+*	\brief #CVendorDecoder class decoding #CVendorDescriptor.
+*/
+class CVendorDecoder : public scte35::CSpliceDescriptorDecoder {
+public:
+	scte35::PrivateDescriptor* Decode(const uint8_t* pData, const std::size_t& iLength) const override {
+		if (iLength < 7) {
+			return nullptr;
+		}
+		CVendorDescriptor* pDescriptor = new CVendorDescriptor();
+		pDescriptor->uFirstByte = pData[6];
+		return pDescriptor;
+	}
+};
+
+/*! \brief Benchmark of ParseHexa (general path) over a list of corpus entries with the vendor-private descriptors kept raw or decoded by a registry.
+*/
+void BM_ParseRegistry(benchmark::State& state, bool bRegistered, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::string> vInputs;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vInputs.emplace_back(pEntry->sHexa);
+	}
+
+	CVendorDecoder objDecoder;
+	scte35::CSpliceDescriptorRegistry objRegistry;
+	if (bRegistered) {
+		objRegistry.Register(0xF0, 0x41424344, &objDecoder);
+		objRegistry.Register(scte35::scte35Desc::segmentation_descriptor, 0x41424344, &objDecoder);
+	}
+
+	scte35::CSpliceClass objParser;
+	objParser.SetFastPath(false);
+	objParser.SetDescriptorRegistry(&objRegistry);
+	for (std::size_t i = 0;i < vInputs.size();i++) {
+		if (!objParser.ParseHexa(vInputs[i])) {
+			state.SkipWithError((std::string("corpus cue does not parse : ") + vEntries[i]->sName).c_str());
+			return;
+		}
+	}
+
+	for (auto _ : state) {
+		for (const std::string& sInput : vInputs) {
+			bool bResult = objParser.ParseHexa(sInput);
+			benchmark::DoNotOptimize(bResult);
+		}
+	}
+
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief C interface entry points measured by #BM_CApi.
+*/
+enum class ECApi { result, json, packed };
+
+/*! \brief Benchmark of the C interface over a list of corpus entries, from bytes to a caller result or buffer.
+*/
+void BM_CApi(benchmark::State& state, ECApi eEntry, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::vector<uint8_t>> vInputs(vEntries.size());
+	for (std::size_t i = 0;i < vEntries.size();i++) {
+		scte35::CSpliceProjection::HexaToBytes(vEntries[i]->sHexa, vInputs[i]);
+	}
+
+	scte35_parser* pParser = scte35_parser_create();
+	scte35_result objResult;
+	std::vector<uint8_t> vBuffer(64 * 1024);
+	for (auto _ : state) {
+		for (const std::vector<uint8_t>& vInput : vInputs) {
+			std::size_t iWritten = 0;
+			int iStatus = SCTE35_OK;
+			switch (eEntry) {
+				case ECApi::json: iStatus = scte35_parse_json(pParser, vInput.data(), vInput.size(), (char*)vBuffer.data(), vBuffer.size(), &iWritten); break;
+				case ECApi::packed: iStatus = scte35_parse_packed(pParser, vInput.data(), vInput.size(), vBuffer.data(), vBuffer.size(), &iWritten); break;
+				default: iStatus = scte35_parse(pParser, vInput.data(), vInput.size(), &objResult, sizeof(objResult)); break;
+			}
+			if (iStatus != SCTE35_OK) {
+				state.SkipWithError((std::string("corpus cue does not parse : ") + scte35_status_name(iStatus)).c_str());
+				break;
+			}
+			benchmark::DoNotOptimize(iWritten);
+		}
+		benchmark::DoNotOptimize(objResult);
+	}
+	scte35_parser_destroy(pParser);
+
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief Sink of #BM_Pipeline counting the consumed events.
+*/
+class CCountingSink : public scte35::CSpliceSink {
+public:
+	uint64_t uParsed = 0;		/*!<Consumed events holding a successful parse.*/
+
+	void Consume(const scte35::SPipelineEvent& objEvent) override { uParsed += objEvent.bParsed ? 1 : 0; }
+};
+
+/*! \brief Benchmark of CSplicePipeline from SubmitSection to the sink over a list of corpus entries, the capture thread being the benchmark thread.
+*/
+void BM_Pipeline(benchmark::State& state, std::size_t iWorkers, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::vector<uint8_t>> vInputs(vEntries.size());
+	for (std::size_t i = 0;i < vEntries.size();i++) {
+		scte35::CSpliceProjection::HexaToBytes(vEntries[i]->sHexa, vInputs[i]);
+	}
+
+	scte35::SPipelineConfig objConfig;
+	objConfig.iParseWorkers = iWorkers;
+	objConfig.bPIDAffinity = false;
+	scte35::CSplicePipeline objPipeline(objConfig);
+	CCountingSink objSink;
+	objPipeline.AddSink(&objSink);
+	objPipeline.Start();
+	for (auto _ : state) {
+		for (std::size_t i = 0;i < vInputs.size();i++) {
+			objPipeline.SubmitSection((uint32_t)i, vInputs[i].data(), vInputs[i].size());
+		}
+	}
+	objPipeline.Stop();
+
+	if (objSink.uParsed != (uint64_t)state.iterations() * vInputs.size()) {
+		state.SkipWithError("events lost or not parsed");
+	}
+	scte35::SPipelineStageStats objOutput = objPipeline.GetStageStats(scte35::scte35PipelineStage::output);
+	SetCueCounters(state, vInputs.size());
+	state.counters["latency_us"] = objOutput.uProcessed == 0 ? 0.0 : (double)objOutput.uLatencyTotal / (double)objOutput.uProcessed / 1e3;
+	state.counters["latency_max_us"] = (double)objOutput.uLatencyMax / 1e3;
+}
+
+/*! \brief Handler of #BM_Engine counting the parsed cues.
+*/
+class CCountingHandler : public scte35::CSpliceEngineHandler {
+public:
+	std::atomic<uint64_t> uParsed{0};		/*!<Parsed cues over all workers.*/
+
+	void OnCue(scte35::SEngineChannel&, const scte35::CSpliceClass&, const std::vector<scte35::SSegmentationEvent>&) override { uParsed.fetch_add(1, std::memory_order_relaxed); }
+};
+
+/*! \brief Benchmark of CSpliceEngine over many channels, each corpus entry submitted in turn to every channel (duplicate filter off).
+*/
+void BM_Engine(benchmark::State& state, std::size_t iWorkers, std::size_t iChannels, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::vector<uint8_t>> vInputs(vEntries.size());
+	for (std::size_t i = 0;i < vEntries.size();i++) {
+		scte35::CSpliceProjection::HexaToBytes(vEntries[i]->sHexa, vInputs[i]);
+	}
+
+	scte35::SEngineConfig objConfig;
+	objConfig.iWorkers = iWorkers;
+	objConfig.bDedup = false;
+	scte35::CSpliceEngine objEngine(objConfig);
+	CCountingHandler objHandler;
+	objEngine.SetHandler(&objHandler);
+	for (std::size_t i = 0;i < iChannels;i++) {
+		objEngine.AddChannel(i);
+	}
+	objEngine.Start();
+	uint64_t uSubmitted = 0;
+	for (auto _ : state) {
+		for (const std::vector<uint8_t>& vInput : vInputs) {
+			for (std::size_t i = 0;i < iChannels;i++) {
+				//A full mailbox is retried, the benchmark measures handled cues and not drops
+				while (!objEngine.Submit(i, vInput.data(), vInput.size())) {
+					std::this_thread::yield();
+				}
+				uSubmitted++;
+			}
+		}
+	}
+	objEngine.Stop();
+
+	if (objHandler.uParsed.load() != uSubmitted) {
+		state.SkipWithError("cues lost or not parsed");
+	}
+	SetCueCounters(state, vInputs.size() * iChannels);
+	uint64_t uStolen = 0;
+	for (std::size_t i = 0;i < objEngine.GetShardCount();i++) {
+		uStolen += objEngine.GetShardStats(i).uStolen;
+	}
+	state.counters["stolen"] = (double)uStolen;
+}
+
+/*! \brief Journal file written and read by the journal benchmarks, in the working directory.
+*/
+const char* sJournalPath = "SpliceBenchmark.journal";
+
+/*! \brief Benchmark of CSpliceJournalWriter appending the parsed corpus with summaries, the journal restarted every 65536 records.
+*/
+void BM_JournalAppend(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::vector<uint8_t>> vInputs(vEntries.size());
+	std::vector<scte35::CSpliceClass*> vParsers;
+	std::size_t iTextBytes = 0;
+	std::size_t iJournalBytes = 0;
+	for (std::size_t i = 0;i < vEntries.size();i++) {
+		scte35::CSpliceProjection::HexaToBytes(vEntries[i]->sHexa, vInputs[i]);
+		iJournalBytes += scte35::CSpliceJournal::GetRecordSize(vInputs[i].size());
+		vParsers.push_back(new scte35::CSpliceClass());
+		vParsers[i]->ParseHexa(vEntries[i]->sHexa);
+		iTextBytes += vParsers[i]->GetText(true).size() + 1;
+	}
+
+	std::remove(sJournalPath);
+	scte35::CSpliceJournalWriter objWriter;
+	if (!objWriter.Open(sJournalPath)) {
+		state.SkipWithError("journal cannot be opened");
+	}
+	uint64_t uTime = 0;
+	for (auto _ : state) {
+		if (!objWriter.IsOpen()) {
+			break;
+		}
+		for (std::size_t i = 0;i < vInputs.size();i++) {
+			objWriter.Append(i, uTime++, vInputs[i].data(), vInputs[i].size(), vParsers[i]);
+		}
+		if (objWriter.GetNextSequence() >= 65536) {
+			state.PauseTiming();
+			objWriter.Close();
+			std::remove(sJournalPath);
+			objWriter.Open(sJournalPath);
+			state.ResumeTiming();
+		}
+	}
+
+	state.counters["bytes/cue"] = (double)iJournalBytes / (double)vInputs.size();
+	state.counters["text_bytes/cue"] = (double)iTextBytes / (double)vInputs.size();
+	objWriter.Close();
+	std::remove(sJournalPath);
+	SetCueCounters(state, vInputs.size());
+	for (scte35::CSpliceClass* pParser : vParsers) {
+		delete pParser;
+	}
+}
+
+/*! \brief Benchmark of CSpliceJournalReader iterating a mapped journal of the corpus, selecting time_signal records by summary.
+*/
+void BM_JournalScan(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	const std::size_t iRecords = 65536;
+	std::remove(sJournalPath);
+	{
+		scte35::CSpliceJournalWriter objWriter;
+		scte35::CSpliceClass objCue;
+		std::vector<uint8_t> vInput;
+		objWriter.Open(sJournalPath);
+		for (std::size_t i = 0;i < iRecords;i++) {
+			const scte35::SpliceCorpusEntry* pEntry = vEntries[i % vEntries.size()];
+			scte35::CSpliceProjection::HexaToBytes(pEntry->sHexa, vInput);
+			objCue.ParseHexa(pEntry->sHexa);
+			objWriter.Append(i % 1000, i, vInput.data(), vInput.size(), &objCue);
+		}
+	}
+
+	scte35::CSpliceJournalReader objReader;
+	if (!objReader.Open(sJournalPath) || objReader.GetCount() != iRecords) {
+		state.SkipWithError("journal not read back");
+	}
+	for (auto _ : state) {
+		uint64_t uBytes = 0;
+		objReader.ForEach([&uBytes](const scte35::SJournalRecord& objRecord) {
+			if (objRecord.objSummary.uCommandType == scte35::scte35Cmd::time_signal) {
+				uBytes += objRecord.pSection[objRecord.iLength - 1];
+			}
+			return true;
+		});
+		benchmark::DoNotOptimize(uBytes);
+	}
+	objReader.Close();
+	std::remove(sJournalPath);
+	SetCueCounters(state, iRecords);
+}
+
+/*! \brief Columnar file written and read by the columnar benchmarks, in the working directory.
+*/
+const char* sColumnarPath = "SpliceBenchmark.columnar";
+
+/*! \brief Benchmark of CSpliceColumnarWriter::Add over the parsed corpus, the batch cleared every 65536 cues.
+*/
+void BM_ColumnarAdd(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<scte35::CSpliceClass*> vParsers;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vParsers.push_back(new scte35::CSpliceClass());
+		vParsers.back()->ParseHexa(pEntry->sHexa);
+	}
+
+	scte35::CSpliceColumnarWriter objWriter;
+	uint64_t uTime = 0;
+	for (auto _ : state) {
+		for (std::size_t i = 0;i < vParsers.size();i++) {
+			objWriter.Add(*vParsers[i], i, uTime++);
+		}
+		if (objWriter.GetRows() >= 65536) {
+			objWriter.Clear();
+		}
+	}
+	SetCueCounters(state, vParsers.size());
+	for (scte35::CSpliceClass* pParser : vParsers) {
+		delete pParser;
+	}
+}
+
+/*! \brief Benchmark of a query over a mapped columnar file of 65536 corpus cues: count the segmentation_descriptors of one type reading one column in place.
+*/
+void BM_ColumnarScan(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	const std::size_t iCues = 65536;
+	{
+		scte35::CSpliceColumnarWriter objWriter;
+		scte35::CSpliceClass objCue;
+		for (std::size_t i = 0;i < iCues;i++) {
+			objCue.ParseHexa(vEntries[i % vEntries.size()]->sHexa);
+			objWriter.Add(objCue, i % 1000, i);
+		}
+		objWriter.Write(sColumnarPath);
+	}
+
+	scte35::CSpliceColumnarReader objReader;
+	const uint8_t* pTypes = nullptr;
+	if (objReader.Open(sColumnarPath)) {
+		pTypes = objReader.GetValues<uint8_t>("segmentation.segmentation_type_id");
+	}
+	if (pTypes == nullptr) {
+		state.SkipWithError("columnar file not read back");
+	}
+	const std::size_t iRows = (std::size_t)objReader.GetRows(scte35::scte35ColumnTable::segmentation);
+	for (auto _ : state) {
+		std::size_t iPlacementOpportunities = 0;
+		for (std::size_t i = 0;i < iRows;i++) {
+			iPlacementOpportunities += pTypes[i] == 0x34;
+		}
+		benchmark::DoNotOptimize(iPlacementOpportunities);
+	}
+	objReader.Close();
+	std::remove(sColumnarPath);
+	SetCueCounters(state, iCues);
+}
+
+/*! \brief Function to write a journal of iRecords corpus cues over 1000 channels, for the archive benchmarks.
+*/
+void WriteArchiveJournal(const std::vector<const scte35::SpliceCorpusEntry*>& vEntries, const std::size_t& iRecords) {
+	std::remove(sJournalPath);
+	scte35::CSpliceJournalWriter objWriter;
+	scte35::CSpliceClass objCue;
+	std::vector<uint8_t> vInput;
+	objWriter.Open(sJournalPath);
+	for (std::size_t i = 0;i < iRecords;i++) {
+		const scte35::SpliceCorpusEntry* pEntry = vEntries[i % vEntries.size()];
+		scte35::CSpliceProjection::HexaToBytes(pEntry->sHexa, vInput);
+		objCue.ParseHexa(pEntry->sHexa);
+		objWriter.Append(i % 1000, i, vInput.data(), vInput.size(), &objCue);
+	}
+}
+
+/*! \brief Benchmark of CSpliceArchive::IndexJournal over a mapped journal of 65536 corpus cues.
+*/
+void BM_ArchiveIndex(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	const std::size_t iRecords = 65536;
+	WriteArchiveJournal(vEntries, iRecords);
+	scte35::CSpliceJournalReader objReader;
+	if (!objReader.Open(sJournalPath) || objReader.GetCount() != iRecords) {
+		state.SkipWithError("journal not read back");
+	}
+	scte35::CSpliceArchive objArchive;
+	std::size_t iIndexed = 0;
+	for (auto _ : state) {
+		objArchive.Clear();
+		benchmark::DoNotOptimize(objArchive.IndexJournal(objReader, iIndexed));
+	}
+	state.counters["postings/cue"] = (double)objArchive.GetPostingCount() / (double)iRecords;
+	objReader.Close();
+	std::remove(sJournalPath);
+	SetCueCounters(state, iRecords);
+}
+
+/*! \brief Benchmark of CSpliceArchive::Query over 65536 indexed corpus cues: placement opportunity starts of one channel in a receive time range.
+*/
+void BM_ArchiveQuery(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	const std::size_t iRecords = 65536;
+	WriteArchiveJournal(vEntries, iRecords);
+	scte35::CSpliceJournalReader objReader;
+	scte35::CSpliceArchive objArchive;
+	std::size_t iIndexed = 0;
+	if (!objReader.Open(sJournalPath) || !objArchive.IndexJournal(objReader, iIndexed) || iIndexed != iRecords) {
+		state.SkipWithError("journal not indexed");
+	}
+	scte35::SArchiveQuery objQuery;
+	objQuery.vSegmentationTypes.push_back(0x34);
+	objQuery.bChannel = true;
+	objQuery.uChannel = 7;
+	objQuery.bReceiveTime = true;
+	objQuery.uReceiveBegin = iRecords / 4;
+	objQuery.uReceiveEnd = iRecords / 2;
+	std::vector<uint64_t> vSequences;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(objArchive.Query(objQuery, vSequences));
+	}
+	state.counters["results"] = (double)vSequences.size();
+	objReader.Close();
+	std::remove(sJournalPath);
+	//One query stands for the records of the archive it answers over
+	SetCueCounters(state, iRecords);
+}
+
+/*! \brief Benchmark of CSpliceUpid::Decode and CSpliceUpid::ForEach over the segmentation_upid of the corpus parsed up-front.
+*/
+void BM_UpidDecode(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<scte35::CSpliceClass*> vParsers;
+	std::vector<const scte35::SegmentationDescriptor*> vDescriptors;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		vParsers.push_back(new scte35::CSpliceClass());
+		vParsers.back()->ParseHexa(pEntry->sHexa);
+		for (const scte35::SDBase* pDescriptor : vParsers.back()->GetDescriptors()) {
+			if (pDescriptor->splice_descriptor_tag == scte35::scte35Desc::segmentation_descriptor && scte35::CSpliceClass::IsBuiltInDescriptor(*pDescriptor)) {
+				vDescriptors.push_back(static_cast<const scte35::SegmentationDescriptor*>(pDescriptor));
+			}
+		}
+	}
+
+	for (auto _ : state) {
+		std::size_t iBytes = 0;
+		scte35::SUpidView objUpid;
+		for (const scte35::SegmentationDescriptor* pDescriptor : vDescriptors) {
+			scte35::CSpliceUpid::Decode(*pDescriptor, objUpid);
+			scte35::CSpliceUpid::ForEach(objUpid, [&iBytes](const scte35::SUpidView& objEntry) {
+				iBytes += objEntry.sText.size() + (std::size_t)objEntry.uValue;
+				return true;
+			});
+		}
+		benchmark::DoNotOptimize(iBytes);
+	}
+	SetCueCounters(state, vParsers.size());
+	for (scte35::CSpliceClass* pParser : vParsers) {
+		delete pParser;
+	}
+}
+
+/*! \brief Benchmark of CSpliceValidator::Validate over the binary corpus.
+*/
+void BM_Validate(benchmark::State& state, bool bCheckCRC, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::vector<uint8_t>> vInputs(vEntries.size());
+	for (std::size_t i = 0;i < vEntries.size();i++) {
+		scte35::CSpliceProjection::HexaToBytes(vEntries[i]->sHexa, vInputs[i]);
+	}
+
+	for (auto _ : state) {
+		uint32_t uFindings = 0;
+		for (const std::vector<uint8_t>& vInput : vInputs) {
+			uFindings |= scte35::CSpliceValidator::Validate(vInput.data(), vInput.size(), bCheckCRC);
+		}
+		benchmark::DoNotOptimize(uFindings);
+	}
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief Benchmark of CSpliceFingerprint::Compute over a list of corpus entries decoded up-front, pts_adjustment and CRC_32 ignored.
+*/
+void BM_Fingerprint(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::vector<uint8_t>> vInputs(vEntries.size());
+	for (std::size_t i = 0;i < vEntries.size();i++) {
+		scte35::CSpliceProjection::HexaToBytes(vEntries[i]->sHexa, vInputs[i]);
+	}
+
+	scte35::CSpliceFingerprint objFingerprint(scte35::scte35Ignore::pts_adjustment | scte35::scte35Ignore::crc | scte35::scte35Ignore::lengths | scte35::scte35Ignore::reserved);
+	for (auto _ : state) {
+		uint64_t uAll = 0;
+		for (const std::vector<uint8_t>& vInput : vInputs) {
+			uint64_t uFingerprint = 0;
+			objFingerprint.Compute(vInput.data(), vInput.size(), uFingerprint);
+			uAll ^= uFingerprint;
+		}
+		benchmark::DoNotOptimize(uAll);
+	}
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief Benchmark of CSpliceFingerprint::Diff over a list of corpus entries, each cue against the next one.
+*/
+void BM_FingerprintDiff(benchmark::State& state, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	std::vector<std::vector<uint8_t>> vInputs(vEntries.size());
+	for (std::size_t i = 0;i < vEntries.size();i++) {
+		scte35::CSpliceProjection::HexaToBytes(vEntries[i]->sHexa, vInputs[i]);
+	}
+
+	scte35::CSpliceFingerprint objFingerprint;
+	std::vector<scte35::SFieldChange> vChanges;
+	for (auto _ : state) {
+		std::size_t iChanges = 0;
+		for (std::size_t i = 0;i < vInputs.size();i++) {
+			const std::vector<uint8_t>& vNew = vInputs[(i + 1) % vInputs.size()];
+			objFingerprint.Diff(vInputs[i].data(), vInputs[i].size(), vNew.data(), vNew.size(), vChanges);
+			iChanges += vChanges.size();
+		}
+		benchmark::DoNotOptimize(iChanges);
+	}
+	SetCueCounters(state, vInputs.size());
+}
+
+/*! \brief Benchmark of GetText over a list of corpus entries parsed up-front.
+*/
+void BM_GetText(benchmark::State& state, bool bIfSingleLine, std::vector<const scte35::SpliceCorpusEntry*> vEntries) {
+	//One parser per cue so the loop measures text generation only
+	std::vector<scte35::CSpliceClass*> vParsers;
+	for (const scte35::SpliceCorpusEntry* pEntry : vEntries) {
+		scte35::CSpliceClass* pParser = new scte35::CSpliceClass();
+		vParsers.push_back(pParser);
+		if (!pParser->ParseHexa(pEntry->sHexa)) {
+			state.SkipWithError((std::string("corpus cue does not parse : ") + pEntry->sName).c_str());
+			break;
+		}
+	}
+
+	if (!state.error_occurred()) {
+		for (auto _ : state) {
+			for (scte35::CSpliceClass* pParser : vParsers) {
+				std::string sText = pParser->GetText(bIfSingleLine);
+				benchmark::DoNotOptimize(sText);
+			}
+		}
+		SetCueCounters(state, vParsers.size());
+	}
+
+	for (scte35::CSpliceClass* pParser : vParsers) {
+		delete pParser;
+	}
+}
+
+/*! \brief Function to register all benchmarks for every corpus entry and for the whole corpus.
+*/
+void RegisterSpliceBenchmarks() {
+	struct SParseKind { const char* sName; EInput eInput; };
+	const SParseKind parseKinds[] = {
+		{ "ParseHexa", EInput::hexa },
+		{ "ParseBase64", EInput::base64 },
+		{ "ParseBinary", EInput::binary }
+	};
+
+	std::vector<const scte35::SpliceCorpusEntry*> vAll;
+	for (std::size_t i = 0;i < scte35::g_SpliceCorpusCount;i++) {
+		vAll.push_back(&scte35::g_SpliceCorpus[i]);
+	}
+
+	for (const SParseKind& objKind : parseKinds) {
+		for (const scte35::SpliceCorpusEntry* pEntry : vAll) {
+			benchmark::RegisterBenchmark((std::string(objKind.sName) + "/" + pEntry->sName).c_str(), BM_Parse, objKind.eInput, true, std::vector<const scte35::SpliceCorpusEntry*>(1, pEntry));
+		}
+		benchmark::RegisterBenchmark((std::string(objKind.sName) + "/corpus").c_str(), BM_Parse, objKind.eInput, true, vAll);
+	}
+	benchmark::RegisterBenchmark("ParseHexaGeneral/corpus", BM_Parse, EInput::hexa, false, vAll);
+
+	benchmark::RegisterBenchmark("ParseHexaCached/corpus", BM_ParseCached, vAll);
+
+	const uint32_t uRoutingFields = scte35::scte35Projected::splice_command_type | scte35::scte35Projected::pts_time | scte35::scte35Projected::segmentation_event_id | scte35::scte35Projected::segmentation_type_id;
+	benchmark::RegisterBenchmark("ParseHexaProjected/corpus", BM_ParseProjected, uRoutingFields, vAll);
+	benchmark::RegisterBenchmark("ParseHexaProjected/corpus_all_fields", BM_ParseProjected, (uint32_t)scte35::scte35Projected::all, vAll);
+
+	benchmark::RegisterBenchmark("InfoHeader/by_field", BM_InfoHeader, scte35::scte35Kernel::portable, true, vAll);
+	benchmark::RegisterBenchmark("InfoHeader/portable", BM_InfoHeader, scte35::scte35Kernel::portable, false, vAll);
+	benchmark::RegisterBenchmark("InfoHeader/bmi2", BM_InfoHeader, scte35::scte35Kernel::bmi2, false, vAll);
+
+	benchmark::RegisterBenchmark("WalkHexa/corpus", BM_Walk<CSumVisitor>, vAll);
+	benchmark::RegisterBenchmark("WalkHexa/corpus_type_filter", BM_Walk<CTypeFilterVisitor>, vAll);
+
+	std::vector<const scte35::SpliceCorpusEntry*> vPrivate;
+	for (const scte35::SpliceCorpusEntry* pEntry : vAll) {
+		if (std::strcmp(pEntry->sName, "time_signal_private_descriptors") == 0) {
+			vPrivate.push_back(pEntry);
+		}
+	}
+	benchmark::RegisterBenchmark("ParseHexaRegistry/raw", BM_ParseRegistry, false, vPrivate);
+	benchmark::RegisterBenchmark("ParseHexaRegistry/decoded", BM_ParseRegistry, true, vPrivate);
+
+	benchmark::RegisterBenchmark("CApi/corpus", BM_CApi, ECApi::result, vAll);
+	benchmark::RegisterBenchmark("CApi/corpus_json", BM_CApi, ECApi::json, vAll);
+	benchmark::RegisterBenchmark("CApi/corpus_packed", BM_CApi, ECApi::packed, vAll);
+
+	for (std::size_t iWorkers : { 1, 2, 4 }) {
+		benchmark::RegisterBenchmark(("Pipeline/corpus/workers:" + std::to_string(iWorkers)).c_str(), BM_Pipeline, iWorkers, vAll)->UseRealTime();
+	}
+	for (std::size_t iWorkers : { 1, 4 }) {
+		benchmark::RegisterBenchmark(("Engine/corpus/channels:1000/workers:" + std::to_string(iWorkers)).c_str(), BM_Engine, iWorkers, (std::size_t)1000, vAll)->UseRealTime();
+	}
+
+	benchmark::RegisterBenchmark("Journal/append", BM_JournalAppend, vAll);
+	benchmark::RegisterBenchmark("Journal/scan", BM_JournalScan, vAll);
+	benchmark::RegisterBenchmark("Columnar/add", BM_ColumnarAdd, vAll);
+	benchmark::RegisterBenchmark("Columnar/scan_segmentation_type", BM_ColumnarScan, vAll);
+	benchmark::RegisterBenchmark("Archive/index", BM_ArchiveIndex, vAll);
+	benchmark::RegisterBenchmark("Archive/query_type_channel_time", BM_ArchiveQuery, vAll);
+	benchmark::RegisterBenchmark("Upid/decode", BM_UpidDecode, vAll);
+	benchmark::RegisterBenchmark("Validate/corpus", BM_Validate, false, vAll);
+	benchmark::RegisterBenchmark("Validate/corpus_crc", BM_Validate, true, vAll);
+	benchmark::RegisterBenchmark("Fingerprint/corpus", BM_Fingerprint, vAll);
+	benchmark::RegisterBenchmark("Fingerprint/diff_corpus", BM_FingerprintDiff, vAll);
+
+	for (const scte35::SpliceCorpusEntry* pEntry : vAll) {
+		benchmark::RegisterBenchmark((std::string("GetText/") + pEntry->sName).c_str(), BM_GetText, true, std::vector<const scte35::SpliceCorpusEntry*>(1, pEntry));
+	}
+	benchmark::RegisterBenchmark("GetText/corpus", BM_GetText, true, vAll);
+	benchmark::RegisterBenchmark("GetText/corpus_multiline", BM_GetText, false, vAll);
+}
+
+}
+
+/*!	\brief Function main of the benchmark program. Accepts the usual Google Benchmark command line flags (e.g. --benchmark_filter=ParseHexa).
+*/
+int main(int argc, char** argv) {
+	RegisterSpliceBenchmarks();
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+		return 1;
+	}
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
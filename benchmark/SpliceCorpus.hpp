@@ -0,0 +1,81 @@
+/*! \file SpliceCorpus.hpp
+*	\brief Benchmark corpus of SCTE-35 cues.
+*	\details Header file holding the hexa-decimal SCTE-35 cues used by the benchmark suite. Starts with the eight console samples of main.cpp followed by larger multi-descriptor, splice_schedule, private_command and component splice_insert cues.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+
+#ifndef _SPLICECORPUS_HPP_
+/*! \brief SpliceCorpus.hpp header guard define.
+*/
+#define _SPLICECORPUS_HPP_
+
+#include <cstddef>
+
+/*! \namespace scte35
+*	\brief scte35 namespace to keep clean the global scope.
+*/
+namespace scte35 {
+
+/*!	\struct SpliceCorpusEntry
+*	\brief #SpliceCorpusEntry structure to hold one named benchmark cue.
+*/
+struct SpliceCorpusEntry {
+	const char* sName;	/*!<Short name used in the benchmark name.*/
+	const char* sHexa;	/*!<Hexa-decimal SCTE-35 cue data.*/
+};
+
+/*! \brief List of benchmark cues. Every cue carries a valid CRC_32.
+*/
+static const SpliceCorpusEntry g_SpliceCorpus[] = {
+	//Time_Signal - Placement Opportunity Start
+	{ "time_signal_po_start",
+		"FC3034000000000000FFFFF00506FE72BD0050001E021C435545494800008E7FCF0001A599B00808000000002CA0A18A3402009AC9D17E" },
+	//Splice_Insert
+	{ "splice_insert",
+		"FC302F000000000000FFFFF014054800008F7FEFFE7369C02EFE0052CCF500000000000A0008435545490000013562DBA30A" },
+	//Time_Signal - Placement Opportunity End
+	{ "time_signal_po_end",
+		"FC302F000000000000FFFFF00506FE746290A000190217435545494800008E7F9F0808000000002CA0A18A350200A9CC6758" },
+	//Time_Signal - Program Start/End
+	{ "time_signal_program_start_end",
+		"FC3048000000000000FFFFF00506FE7A4D88B60032021743554549480000187F9F0808000000002CCBC344110000021743554549480000197F9F0808000000002CA4DBA01000009972E343" },
+	//Time_Signal - Program Overlap Start
+	{ "time_signal_program_overlap_start",
+		"FC302F000000000000FFFFF00506FEAEBFFF640019021743554549480000087F9F0808000000002CA56CF5170000951DB0A8" },
+	//Time_Signal - Program Blackout Override / Program End
+	{ "time_signal_blackout_override",
+		"FC3048000000000000FFFFF00506FE932E380B00320217435545494800000A7F9F0808000000002CA0A1E3180000021743554549480000097F9F0808000000002CA0A18A110000B4217EB0" },
+	//Time_Signal - Program End
+	{ "time_signal_program_end",
+		"FC302F000000000000FFFFF00506FEAEF17C4C0019021743554549480000077F9F0808000000002CA56C97110000C4876A2E" },
+	//Time_Signal - Program Start/End - Placement Opportunity End
+	{ "time_signal_program_start_end_po_end",
+		"FC3061000000000000FFFFF00506FEA8CD44ED004B021743554549480000AD7F9F0808000000002CB2D79D350200021743554549480000267F9F0808000000002CB2D79D110000021743554549480000277F9F0808000000002CB2D7B31000008A18869F" },
+
+	//Larger cues beyond the console samples
+	//Time_Signal - avail, DTMF, time, audio and three segmentation descriptors with ADI/MPU/URI UPIDs
+	{ "time_signal_multi_descriptor",
+		"FC30F000000000100000FFF00506FF2345678900DA00084355454900000135010A43554549329F31323123023D435545494800008E7FFF0001A599B009275349474E414C3A4C7939454D54566B616A424A62574E5A53566C7A59324E31526A4E4A51773D3D34020001010222435545494800008F7FFF00002932E00C0E414446520102030405060708090A3001040310435545495F00000000001DCD65000025040F435545492F10656E670B1173706105023C43554549480000907FBF0F2D75726E3A757569643A66383164346661652D376465632D313164302D613736352D303061306339316536626636110101891DA29B" },
+	//Splice_Schedule - three events, program and component splice mode
+	{ "splice_schedule",
+		"FC305200000000000000FFF0370403000010017FDF4E8F158000010102000010027F9F03214E8F16AC224E8F16AD234E8F16AE00010102000010037FDF4E8F190400070102000A000843554549000000777CE0F89A" },
+	//Private_Command - 64 private bytes
+	{ "private_command",
+		"FC305500000000000000FFF044FF41424344000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F0000D0D7A18B" },
+	//Splice_Insert - component splice mode with break_duration and two avail descriptors
+	{ "splice_insert_components",
+		"FC304300000000000000FFF01E054800008F7FAF0321FE0736ED7E22FE0736ED80237FFE0052CCF50135010100140008435545490000013500084355454900000136178F0BDB" },
+	//Time_Signal - segmentation descriptor followed by two vendor-private descriptors (identifier "ABCD"), kept as raw views
+	{ "time_signal_private_descriptors",
+		"FC304A00000000000000FFF00506FE72BD00500034021C435545494800008E7FCF0001A599B00808000000002CA0A18A340200F00A41424344010203040506020841424344112233440388C13D" },
+};
+
+/*! \brief Number of entries in #g_SpliceCorpus.
+*/
+static const std::size_t g_SpliceCorpusCount = sizeof(g_SpliceCorpus) / sizeof(g_SpliceCorpus[0]);
+
+};
+
+#endif
@@ -0,0 +1,2667 @@
+/*! \file SpliceTest.cpp
+*	\brief Behaviour checks file.
+*	\details CPP file containing the checks run by ctest: every check compares a library result with an independent computation over
+*	the cues of SpliceCorpus.hpp or hand-made inputs, and the program exits with a non-zero status if any of them fails.
+*	\author https://github.com/satyamsameer
+*	\version 1.0.0.0
+*	\date 18-10-2026
+*/
+#include "SpliceArchive.hpp"
+#include "SpliceBitKernel.hpp"
+#include "SpliceCache.hpp"
+#include "SpliceCApi.h"
+#include "SpliceCRC.hpp"
+#include "SpliceColumnar.hpp"
+#include "SpliceCorpus.hpp"
+#include "SpliceDescriptorRegistry.hpp"
+#include "SpliceEngine.hpp"
+#include "SpliceFilter.hpp"
+#include "SpliceFingerprint.hpp"
+#include "SpliceJournal.hpp"
+#include "SpliceLayout.hpp"
+#include "SpliceMetrics.hpp"
+#include "SplicePipeline.hpp"
+#include "SpliceProjection.hpp"
+#include "SpliceRewrite.hpp"
+#include "SpliceScheduler.hpp"
+#include "SpliceScheduleIndex.hpp"
+#include "SpliceSegmentation.hpp"
+#include "SpliceTimeline.hpp"
+#include "SpliceUpid.hpp"
+#include "SpliceValidator.hpp"
+#include "SpliceVisitor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <random>
+#include <cctype>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+namespace {
+
+/*! \brief Number of failed checks.
+*/
+int g_iFailures = 0;
+
+/*! \brief Function to record one check, printing it when it fails.
+*	\param bPassed check result.
+*	\param sWhat check description.
+*	\param sCue name of the cue checked, nullptr if none.
+*/
+void Check(const bool& bPassed, const char* sWhat, const char* sCue = nullptr) {
+	if (!bPassed) {
+		g_iFailures++;
+		std::printf("FAILED : %s%s%s\n", sWhat, sCue != nullptr ? " : " : "", sCue != nullptr ? sCue : "");
+	}
+}
+
+/*! \brief Function to get the bytes of a corpus cue.
+*/
+std::vector<uint8_t> GetBytes(const scte35::SpliceCorpusEntry& objEntry) {
+	std::vector<uint8_t> vBytes;
+	scte35::CSpliceProjection::HexaToBytes(objEntry.sHexa, vBytes);
+	return vBytes;
+}
+
+/*! \brief Function to read the CRC_32 ending a section.
+*/
+uint32_t GetStoredCRC(const std::vector<uint8_t>& vBytes) {
+	const uint8_t* pCrc = vBytes.data() + vBytes.size() - 4;
+	return ((uint32_t)pCrc[0] << 24) | ((uint32_t)pCrc[1] << 16) | ((uint32_t)pCrc[2] << 8) | (uint32_t)pCrc[3];
+}
+
+/*! \brief Checks of CSpliceCRC and of the CRC_32 folded in by CSpliceRewrite against a full recompute.
+*/
+void CheckCRC() {
+	//ShiftZeros against Update over the same zero bytes
+	std::vector<uint8_t> vZeros(1000, 0);
+	for (std::size_t i = 0;i <= vZeros.size();i += 37) {
+		const uint32_t uStart = 0x12345678u * (uint32_t)(i + 1);
+		Check(scte35::CSpliceCRC::ShiftZeros(uStart, i) == scte35::CSpliceCRC::Update(uStart, vZeros.data(), i), "ShiftZeros equals Update over zero bytes");
+	}
+
+	static const uint64_t uPts[] = { 0, 1, 0x0FFFFFFFFull, 0x100000000ull, 0x1FFFFFFFFull, 0x123456789ull };
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		const char* sName = scte35::g_SpliceCorpus[k].sName;
+		std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+		Check(scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size() - 4) == GetStoredCRC(vBytes), "corpus CRC_32", sName);
+
+		for (const uint64_t& uValue : uPts) {
+			uint64_t uRead = 0;
+			Check(scte35::CSpliceRewrite::SetPtsAdjustment(vBytes.data(), vBytes.size(), uValue), "SetPtsAdjustment", sName);
+			Check(scte35::CSpliceRewrite::GetPtsAdjustment(vBytes.data(), vBytes.size(), uRead) && uRead == uValue, "GetPtsAdjustment after SetPtsAdjustment", sName);
+			Check(scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size() - 4) == GetStoredCRC(vBytes), "CRC_32 patched by SetPtsAdjustment", sName);
+		}
+
+		Check(scte35::CSpliceRewrite::SetPtsAdjustmentTier(vBytes.data(), vBytes.size(), 0x0ABCDEF01ull, 0x5A5), "SetPtsAdjustmentTier", sName);
+		Check((((uint32_t)vBytes[10] << 4) | (vBytes[11] >> 4)) == 0x5A5, "tier written by SetPtsAdjustmentTier", sName);
+		Check(scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size() - 4) == GetStoredCRC(vBytes), "CRC_32 patched by SetPtsAdjustmentTier", sName);
+		Check(!scte35::CSpliceRewrite::SetPtsAdjustmentTier(vBytes.data(), vBytes.size(), 0, 0x1000), "tier above 12 bits rejected", sName);
+
+		//A shift below zero wraps modulo 2^33
+		uint64_t uRead = 0;
+		Check(scte35::CSpliceRewrite::SetPtsAdjustment(vBytes.data(), vBytes.size(), 5), "SetPtsAdjustment", sName);
+		Check(scte35::CSpliceRewrite::AddPtsAdjustment(vBytes.data(), vBytes.size(), -10), "AddPtsAdjustment", sName);
+		Check(scte35::CSpliceRewrite::GetPtsAdjustment(vBytes.data(), vBytes.size(), uRead) && uRead == 0x1FFFFFFFBull, "AddPtsAdjustment wraps modulo 2^33", sName);
+		Check(scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size() - 4) == GetStoredCRC(vBytes), "CRC_32 patched by AddPtsAdjustment", sName);
+	}
+
+	std::vector<uint8_t> vShort(10, 0xFC);
+	Check(!scte35::CSpliceRewrite::SetPtsAdjustment(vShort.data(), vShort.size(), 1), "section shorter than its header rejected");
+}
+
+
+/*! \brief Function to check that CSpliceLayout encodes a parsed structure back to the bytes it was parsed from.
+*	\param objValue structure parsed by CSpliceClass.
+*	\param vBytes bytes of the cue.
+*	\param iStart offset of the structure in vBytes.
+*	\param sWhat check description.
+*	\param sName name of the cue.
+*/
+template <typename TLayout>
+void CheckEncode(const typename TLayout::value_type& objValue, const std::vector<uint8_t>& vBytes, const std::size_t& iStart, const char* sWhat, const char* sName) {
+	const std::size_t iBits = scte35::CSpliceLayout<TLayout>::GetBitLength(objValue);
+	std::vector<uint8_t> vEncoded((iBits + 7) / 8, 0);
+	std::size_t iEncoded = 0;
+	bool bEqual = scte35::CSpliceLayout<TLayout>::Encode(objValue, vEncoded.data(), vEncoded.size(), iEncoded) && iEncoded == iBits && iStart + vEncoded.size() <= vBytes.size();
+	for (std::size_t i = 0;bEqual && i < iBits;i++) {
+		const int iShift = 7 - (int)(i % 8);
+		bEqual = ((vEncoded[i / 8] >> iShift) & 1) == ((vBytes[iStart + i / 8] >> iShift) & 1);
+	}
+
+	//And the byte decoder reads the same number of bits back
+	typename TLayout::value_type objDecoded = objValue;
+	std::size_t iDecoded = 0;
+	bEqual = bEqual && scte35::CSpliceLayout<TLayout>::Decode(vEncoded.data(), vEncoded.size(), objDecoded, iDecoded) && iDecoded == iBits;
+	Check(bEqual, sWhat, sName);
+}
+
+/*! \brief Checks of the CSpliceLayout encoders : every structure CSpliceClass parses through a table encodes back to the corpus bytes.
+*/
+void CheckLayouts() {
+	scte35::CSpliceClass objCue;
+	objCue.SetFastPath(false);
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		const char* sName = scte35::g_SpliceCorpus[k].sName;
+		const std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+		if (!objCue.ParseHexa(scte35::g_SpliceCorpus[k].sHexa)) {
+			continue;
+		}
+
+		const scte35::SInfoData& objInfo = objCue.GetSInfoData();
+		CheckEncode<scte35::SInfoHeaderLayout>(objInfo, vBytes, 0, "splice_info_section header encodes back", sName);
+		if (objInfo.splice_command_type == scte35::scte35Cmd::time_signal) {
+			CheckEncode<scte35::SpliceTimeLayout>(objCue.GetTimeSignal(), vBytes, 14, "time_signal splice_time encodes back", sName);
+		}
+		else if (objInfo.splice_command_type == scte35::scte35Cmd::splice_insert) {
+			CheckEncode<scte35::SpliceInsertLayout>(objCue.GetSpliceInsert(), vBytes, 14, "splice_insert encodes back", sName);
+		}
+		if (objInfo.splice_command_length == 0xFFF) {
+			continue;
+		}
+
+		std::size_t iPos = 14 + objInfo.splice_command_length + 2;
+		for (const scte35::SDBase* pDescriptor : objCue.GetDescriptors()) {
+			if (iPos + 2 > vBytes.size()) {
+				break;
+			}
+			switch (scte35::CSpliceClass::IsBuiltInDescriptor(*pDescriptor) ? pDescriptor->splice_descriptor_tag : (uint32_t)scte35::scte35Desc::unknown) {
+				case scte35::scte35Desc::avail_descriptor: {
+					CheckEncode<scte35::AvailDescriptorLayout>(*static_cast<const scte35::AvailDescriptor*>(pDescriptor), vBytes, iPos, "avail_descriptor encodes back", sName);
+				}break;
+				case scte35::scte35Desc::dtmf_descriptor: {
+					CheckEncode<scte35::DTMFDescriptorLayout>(*static_cast<const scte35::DTMFDescriptor*>(pDescriptor), vBytes, iPos, "DTMF_descriptor encodes back", sName);
+				}break;
+				case scte35::scte35Desc::segmentation_descriptor: {
+					CheckEncode<scte35::SegmentationDescriptorLayout>(*static_cast<const scte35::SegmentationDescriptor*>(pDescriptor), vBytes, iPos, "segmentation_descriptor encodes back", sName);
+				}break;
+				case scte35::scte35Desc::time_descriptor: {
+					CheckEncode<scte35::TimeDescriptorLayout>(*static_cast<const scte35::TimeDescriptor*>(pDescriptor), vBytes, iPos, "time_descriptor encodes back", sName);
+				}break;
+				case scte35::scte35Desc::audio_descriptor: {
+					CheckEncode<scte35::AudioDescriptorLayout>(*static_cast<const scte35::AudioDescriptor*>(pDescriptor), vBytes, iPos, "audio_descriptor encodes back", sName);
+				}break;
+				default: {
+					//Descriptors other than the "CUEI" ones have no table
+				}
+				break;
+			}
+			iPos += 2 + vBytes[iPos + 1];
+		}
+	}
+}
+
+/*! \brief Function to make a hexa-decimal time_signal cue with a pts_time and a correct CRC_32.
+*/
+std::string MakeTimeSignal(const uint64_t& uPts) {
+	std::vector<uint8_t> vBytes = { 0xFC, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x05, 0x06,
+		(uint8_t)(0xFE | ((uPts >> 32) & 0x01)), (uint8_t)(uPts >> 24), (uint8_t)(uPts >> 16), (uint8_t)(uPts >> 8), (uint8_t)uPts, 0x00, 0x00 };
+	const uint32_t uCrc = scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size());
+	for (int i = 3;i >= 0;i--) {
+		vBytes.push_back((uint8_t)(uCrc >> (8 * i)));
+	}
+	std::string sHexa;
+	scte35::CSpliceProjection::BytesToHexa(vBytes.data(), vBytes.size(), sHexa);
+	return sHexa;
+}
+
+/*! \brief Checks of CSpliceScheduler firing against the due ticks, with clock steps from one tick to an hour.
+*/
+void CheckScheduler() {
+	std::mt19937_64 objRandom(35);
+	const uint64_t uResolutions[] = { 1, 90 };
+	for (const uint64_t& uResolution : uResolutions) {
+		scte35::CSpliceScheduler objScheduler(0, uResolution);
+		std::vector<int64_t> vFired;
+		objScheduler.SetCallback([&](const scte35::SScheduledSplice& objSplice) { vFired.push_back(objSplice.iFireTime); });
+
+		uint64_t uNow = 1000;
+		objScheduler.Advance(uNow);
+		std::vector<int64_t> vPending;
+		for (int iRound = 0;iRound < 300;iRound++) {
+			//A few points up to 3 hours ahead, then a step of up to an hour
+			for (int i = 0;i < 3;i++) {
+				const uint64_t uSplice = uNow + 1 + objRandom() % (3ull * 3600 * 90000);
+				std::shared_ptr<scte35::CSpliceClass> pCue = std::make_shared<scte35::CSpliceClass>();
+				Check(pCue->ParseHexa(MakeTimeSignal(uSplice)), "time_signal cue parses");
+				Check(objScheduler.Schedule(pCue), "Schedule time_signal");
+				vPending.push_back((int64_t)uSplice);
+			}
+
+			const uint64_t uSteps[] = { 1, 90, 90000, 3600ull * 90000 };
+			uNow += 1 + objRandom() % uSteps[objRandom() % 4];
+			vFired.clear();
+			objScheduler.Advance(uNow);
+
+			//Due points fire in tick order, the others stay pending
+			const int64_t iNowTick = (int64_t)(uNow / uResolution);
+			std::vector<int64_t> vDue;
+			std::vector<int64_t> vLater;
+			for (const int64_t& iTime : vPending) {
+				(iTime / (int64_t)uResolution <= iNowTick ? vDue : vLater).push_back(iTime);
+			}
+			Check(vFired.size() == vDue.size(), "Advance fires exactly the due points");
+			for (std::size_t i = 1;i < vFired.size();i++) {
+				Check(vFired[i - 1] / (int64_t)uResolution <= vFired[i] / (int64_t)uResolution, "points fire in tick order");
+			}
+			std::sort(vDue.begin(), vDue.end());
+			std::sort(vFired.begin(), vFired.end());
+			Check(vFired == vDue, "fired points are the due points");
+			vPending.swap(vLater);
+			Check(objScheduler.GetPendingCount() == vPending.size(), "pending count after Advance");
+		}
+	}
+}
+
+
+/*! \brief Function to append the low bits of a value to a bit string, most significant first.
+*/
+void AppendBits(std::vector<bool>& vBits, const uint64_t& uValue, const int& iBits) {
+	for (int i = iBits - 1;i >= 0;i--) {
+		vBits.push_back(((uValue >> i) & 1) != 0);
+	}
+}
+
+/*! \brief Function to make a hexa-decimal splice_schedule cue with one program event and a correct CRC_32.
+*	\param uEventId splice_event_id.
+*	\param bCancel splice_event_cancel_indicator.
+*	\param uUtc utc_splice_time.
+*	\param uDuration break_duration in 90 kHz ticks, 32-bit as CSpliceClass reads it in a splice_schedule.
+*/
+std::string MakeSchedule(const uint32_t& uEventId, const bool& bCancel, const uint32_t& uUtc, const uint32_t& uDuration) {
+	std::vector<bool> vCommand;
+	AppendBits(vCommand, 1, 8);
+	AppendBits(vCommand, uEventId, 32);
+	AppendBits(vCommand, bCancel ? 1 : 0, 1);
+	AppendBits(vCommand, 0x7F, 7);
+	if (!bCancel) {
+		AppendBits(vCommand, 0x7F, 8);//out_of_network_indicator, program_splice_flag, duration_flag, reserved
+		AppendBits(vCommand, uUtc, 32);
+		AppendBits(vCommand, 0x7F, 7);//auto_return, reserved
+		AppendBits(vCommand, uDuration, 32);
+		AppendBits(vCommand, 1, 32);//unique_program_id, avail_num, avails_expected
+	}
+	const uint64_t uCommandLength = (vCommand.size() + 7) / 8;
+
+	std::vector<bool> vBits;
+	AppendBits(vBits, 0xFC, 8);
+	AppendBits(vBits, 0x3, 4);
+	AppendBits(vBits, 11 + uCommandLength + 2 + 4, 12);
+	AppendBits(vBits, 0, 56);//protocol_version, encrypted_packet, encryption_algorithm, pts_adjustment, cw_index
+	AppendBits(vBits, 0xFFF, 12);
+	AppendBits(vBits, uCommandLength, 12);
+	AppendBits(vBits, 0x04, 8);
+	vBits.insert(vBits.end(), vCommand.begin(), vCommand.end());
+	AppendBits(vBits, 0, 16);//descriptor_loop_length
+	while (vBits.size() % 8 != 0) {
+		vBits.push_back(false);
+	}
+
+	std::vector<uint8_t> vBytes(vBits.size() / 8, 0);
+	for (std::size_t i = 0;i < vBits.size();i++) {
+		vBytes[i / 8] |= (uint8_t)((vBits[i] ? 1 : 0) << (7 - i % 8));
+	}
+	const uint32_t uCrc = scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size());
+	for (int i = 3;i >= 0;i--) {
+		vBytes.push_back((uint8_t)(uCrc >> (8 * i)));
+	}
+	std::string sHexa;
+	scte35::CSpliceProjection::BytesToHexa(vBytes.data(), vBytes.size(), sHexa);
+	return sHexa;
+}
+
+/*! \brief Function to get the channel, splice_event_id and start of entries, the order CSpliceScheduleIndex reports them in.
+*/
+std::vector<std::pair<int64_t, std::pair<uint64_t, uint32_t> > > GetEntryKeys(const std::vector<scte35::SScheduleEntry>& vEntries) {
+	std::vector<std::pair<int64_t, std::pair<uint64_t, uint32_t> > > vKeys;
+	for (const scte35::SScheduleEntry& objEntry : vEntries) {
+		vKeys.push_back(std::make_pair(objEntry.iStart, std::make_pair(objEntry.uChannel, objEntry.splice_event_id)));
+	}
+	return vKeys;
+}
+
+/*! \brief Checks of CSpliceScheduleIndex window queries against a scan of every live event, with breaks from none to 13 hours long.
+*/
+void CheckScheduleIndex() {
+	std::mt19937_64 objRandom(34);
+	scte35::CSpliceScheduleIndex objIndex(4);
+	std::map<std::pair<uint64_t, uint32_t>, scte35::SScheduleEntry> mLive;
+	const uint32_t uBaseUtc = 1400000000;
+	const uint32_t uDurations[] = { 0, 30 * 90000, 3600 * 90000, 0xFFFFFFFFu };
+
+	int64_t iErasedBefore = 0;
+	for (int iRound = 0;iRound < 4000;iRound++) {
+		const uint64_t uChannel = objRandom() % 8;
+		const uint32_t uEventId = (uint32_t)(objRandom() % 64);
+		const bool bCancel = objRandom() % 5 == 0;
+		const uint32_t uUtc = uBaseUtc + (uint32_t)(objRandom() % (2 * 24 * 3600));
+		const uint32_t uDuration = uDurations[objRandom() % 4];
+
+		scte35::CSpliceClass objCue;
+		Check(objCue.ParseHexa(MakeSchedule(uEventId, bCancel, uUtc, uDuration)), "splice_schedule cue parses");
+		objIndex.Update(uChannel, objCue);
+
+		mLive.erase(std::make_pair(uChannel, uEventId));
+		if (!bCancel) {
+			scte35::SScheduleEntry objEntry;
+			objEntry.iStart = scte35::CSpliceUTC::GpsToUnix(uUtc);
+			objEntry.iEnd = objEntry.iStart + (int64_t)(((uint64_t)uDuration + 89999) / 90000);
+			objEntry.uChannel = uChannel;
+			objEntry.splice_event_id = uEventId;
+			mLive[std::make_pair(uChannel, uEventId)] = objEntry;
+		}
+
+		if (iRound % 500 == 499) {
+			//Events all ended before a time go, which shortens the longest live break as well
+			iErasedBefore += 3 * 3600;
+			const int64_t iTime = scte35::CSpliceUTC::GpsToUnix(uBaseUtc) + iErasedBefore;
+			std::size_t iEnded = 0;
+			for (auto it = mLive.begin();it != mLive.end();) {
+				if (it->second.iEnd < iTime) {
+					it = mLive.erase(it);
+					iEnded++;
+				}
+				else {
+					++it;
+				}
+			}
+			Check(objIndex.EraseBefore(iTime) == iEnded, "EraseBefore removes the ended events");
+		}
+		Check(objIndex.GetSize() == mLive.size(), "index size is the number of live events");
+
+		const int64_t iFrom = scte35::CSpliceUTC::GpsToUnix(uBaseUtc) - 3600 + (int64_t)(objRandom() % (2 * 24 * 3600));
+		const int64_t iTo = iFrom + (int64_t)(objRandom() % 1800);
+		std::vector<scte35::SScheduleEntry> vAll;
+		std::vector<scte35::SScheduleEntry> vChannel;
+		for (const auto& objLive : mLive) {
+			if (objLive.second.iStart <= iTo && objLive.second.iEnd >= iFrom) {
+				vAll.push_back(objLive.second);
+				if (objLive.second.uChannel == uChannel) {
+					vChannel.push_back(objLive.second);
+				}
+			}
+		}
+		std::vector<scte35::SScheduleEntry> vFound;
+		Check(objIndex.Query(iFrom, iTo, vFound) == vFound.size(), "Query returns the number of appended entries");
+		std::vector<std::pair<int64_t, std::pair<uint64_t, uint32_t> > > vExpected = GetEntryKeys(vAll);
+		std::sort(vExpected.begin(), vExpected.end());
+		Check(GetEntryKeys(vFound) == vExpected, "Query of all the channels finds the overlapping events in start order");
+
+		vFound.clear();
+		objIndex.Query(uChannel, iFrom, iTo, vFound);
+		vExpected = GetEntryKeys(vChannel);
+		std::sort(vExpected.begin(), vExpected.end());
+		Check(GetEntryKeys(vFound) == vExpected, "Query of one channel finds its overlapping events in start order");
+	}
+}
+
+
+/*! \brief Function to parse a cue with or without the time_signal fast path and get its text, or its error when it fails.
+*/
+std::string GetParseText(scte35::CSpliceClass& objCue, const std::string& sInput) {
+	if (!objCue.ParseHexa(sInput)) {
+		return "error " + std::to_string((int)objCue.GetLastError());
+	}
+	return objCue.GetText(true);
+}
+
+/*! \brief Checks of the hexa-decimal decoding shared by CSpliceProjection, CSpliceFilter and the time_signal fast path of CSpliceClass,
+*	each compared with a decode of the same cue through another path.
+*/
+void CheckHexaInputs() {
+	scte35::CSpliceClass objFast;
+	scte35::CSpliceClass objGeneral;
+	objFast.SetFastPath(true);
+	objGeneral.SetFastPath(false);
+
+	std::vector<std::string> vInputs;
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		vInputs.push_back(scte35::g_SpliceCorpus[k].sHexa);
+	}
+	for (uint64_t uPts = 0;uPts < 0x200000000ull;uPts += 0x1234567ull * 7) {
+		vInputs.push_back(MakeTimeSignal(uPts));
+	}
+
+	for (const std::string& sHexa : vInputs) {
+		std::vector<uint8_t> vBytes;
+		Check(scte35::CSpliceProjection::HexaToBytes(sHexa, vBytes), "HexaToBytes decodes the cue", sHexa.c_str());
+		std::string sLower = sHexa;
+		std::transform(sLower.begin(), sLower.end(), sLower.begin(), [](const char& c) { return (char)std::tolower((unsigned char)c); });
+		std::vector<uint8_t> vLower;
+		Check(scte35::CSpliceProjection::HexaToBytes("0x" + sLower, vLower) && vLower == vBytes, "HexaToBytes of the lower case cue with 0x", sHexa.c_str());
+
+		//CRC_32 of the hexa-decimal filter against the one of the decoded bytes
+		const scte35::scte35Verdict::type eVerdict = scte35::CSpliceFilter::Check(vBytes.data(), vBytes.size(), true);
+		Check(scte35::CSpliceFilter::CheckHexa(sHexa, true) == eVerdict, "CheckHexa gives the verdict of Check", sHexa.c_str());
+		Check(scte35::CSpliceFilter::CheckHexa(sLower, true) == eVerdict, "CheckHexa of the lower case cue", sHexa.c_str());
+
+		//A bad character, a flipped CRC_32 bit and a cut end, each either decoded the same by both paths or rejected the same way
+		std::string sBadCharacter = sHexa;
+		sBadCharacter[sBadCharacter.length() / 2] = 'G';
+		std::string sBadCrc = sHexa;
+		sBadCrc[sBadCrc.length() - 1] = sBadCrc[sBadCrc.length() - 1] == '0' ? '1' : '0';
+		Check(scte35::CSpliceFilter::CheckHexa(sBadCharacter, true) != scte35::scte35Verdict::accept, "CheckHexa rejects a bad character", sHexa.c_str());
+		Check(scte35::CSpliceFilter::CheckHexa(sBadCrc, true) == scte35::scte35Verdict::crc, "CheckHexa rejects a wrong CRC_32", sHexa.c_str());
+
+		const std::string sVariants[] = { sHexa, sLower, sBadCharacter, sBadCrc, sHexa.substr(0, sHexa.length() - 2) };
+		for (const std::string& sInput : sVariants) {
+			Check(GetParseText(objFast, sInput) == GetParseText(objGeneral, sInput), "fast path decodes as the general path", sInput.c_str());
+		}
+	}
+	Check(objFast.GetFastPathHits() > 0 && objGeneral.GetFastPathHits() == 0, "fast path used only when enabled");
+}
+
+
+/*! \brief Function to replace a file with the first bytes of its content.
+*/
+bool CutFile(const char* sPath, const std::size_t& iSize) {
+	std::FILE* pFile = std::fopen(sPath, "rb");
+	if (pFile == nullptr) {
+		return false;
+	}
+	std::vector<uint8_t> vContent(iSize);
+	const std::size_t iRead = std::fread(vContent.data(), 1, iSize, pFile);
+	std::fclose(pFile);
+	pFile = std::fopen(sPath, "wb");
+	if (pFile == nullptr || iRead != iSize) {
+		if (pFile != nullptr) {
+			std::fclose(pFile);
+		}
+		return false;
+	}
+	const bool bWritten = std::fwrite(vContent.data(), 1, iSize, pFile) == iSize;
+	std::fclose(pFile);
+	return bWritten;
+}
+
+/*! \brief Checks of CSpliceJournalWriter recovery from a torn record or a torn file header, read back with CSpliceJournalReader.
+*/
+void CheckJournal() {
+	const char* sPath = "SCTE35Test_journal.bin";
+	std::remove(sPath);
+
+	std::vector<std::vector<uint8_t> > vSections;
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		vSections.push_back(GetBytes(scte35::g_SpliceCorpus[k]));
+	}
+
+	//Every record cut at any point: reopening drops it and continues the sequence numbers after the last whole record
+	scte35::CSpliceJournalWriter objWriter;
+	Check(objWriter.Open(sPath), "journal created");
+	for (std::size_t k = 0;k < vSections.size();k++) {
+		Check(objWriter.Append(k, 1000 + k, vSections[k].data(), vSections[k].size(), nullptr), "journal Append");
+	}
+	Check(objWriter.Close(), "journal Close");
+
+	scte35::CSpliceJournalReader objReader;
+	Check(objReader.Open(sPath) && objReader.GetCount() == vSections.size(), "journal reads back every record");
+	const uint64_t uFullSize = objReader.GetValidSize();
+	scte35::SJournalRecord objLast;
+	Check(objReader.GetRecord(vSections.size() - 1, objLast), "journal last record");
+	const uint64_t uLastStart = uFullSize - scte35::CSpliceJournal::GetRecordSize(objLast.iLength);
+	objReader.Close();
+
+	for (uint64_t uCut = uLastStart + 1;uCut < uFullSize;uCut += 7) {
+		Check(CutFile(sPath, (std::size_t)uFullSize) && CutFile(sPath, (std::size_t)uCut), "journal cut");
+		Check(objWriter.Open(sPath), "journal with a torn record opens");
+		Check(objWriter.Append(99, 99, vSections[0].data(), vSections[0].size(), nullptr) && objWriter.Close(), "journal Append after a torn record");
+		Check(objReader.Open(sPath) && objReader.GetCount() == vSections.size(), "torn record replaced by the new one");
+		scte35::SJournalRecord objRecord;
+		Check(objReader.FindRecord(vSections.size() - 1, objRecord) && objRecord.uChannel == 99 && objRecord.iLength == vSections[0].size(), "new record takes the sequence number of the torn one");
+		Check(objReader.GetRecord(0, objRecord) && objRecord.uChannel == 0 && std::equal(vSections[0].begin(), vSections[0].end(), objRecord.pSection), "records before the torn one kept");
+		objReader.Close();
+		Check(CutFile(sPath, (std::size_t)uLastStart) && objWriter.Open(sPath) && objWriter.Append(vSections.size() - 1, 0, vSections.back().data(), vSections.back().size(), nullptr) && objWriter.Close(), "journal restored");
+	}
+
+	//A file header cut short by a crash is written again
+	for (std::size_t iCut = 0;iCut < scte35::CSpliceJournal::iFileHeaderSize;iCut++) {
+		Check(CutFile(sPath, iCut), "journal header cut");
+		Check(objWriter.Open(sPath), "journal with a torn header opens");
+		Check(objWriter.Append(7, 7, vSections[0].data(), vSections[0].size(), nullptr) && objWriter.Close(), "journal Append after a torn header");
+		scte35::SJournalRecord objRecord;
+		Check(objReader.Open(sPath) && objReader.GetCount() == 1 && objReader.GetRecord(0, objRecord) && objRecord.uChannel == 7 && objRecord.uSequence == 0, "journal with a torn header restarts at sequence 0");
+		objReader.Close();
+	}
+	std::remove(sPath);
+}
+
+/*! \brief Checks of the C interface: flat results against CSpliceClass, caller buffer sizing of the JSON and packed outputs, and failures.
+*/
+void CheckCApi() {
+	Check(scte35_abi_version() == SCTE35_ABI_VERSION, "C ABI version matches the header");
+	scte35_parser* pParser = scte35_parser_create();
+	Check(pParser != nullptr, "C parser created");
+	if (pParser == nullptr) {
+		return;
+	}
+
+	scte35_result objResult;
+	std::vector<char> vJson;
+	std::vector<uint8_t> vPacked;
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		const char* sCue = scte35::g_SpliceCorpus[k].sName;
+		const std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+		scte35::CSpliceClass objCue;
+		const bool bParsed = objCue.ParseHexa(scte35::g_SpliceCorpus[k].sHexa);
+		const int iStatus = scte35_parse(pParser, vBytes.data(), vBytes.size(), &objResult, sizeof(objResult));
+		Check(iStatus == (bParsed ? SCTE35_OK : (int)objCue.GetLastError()), "C parse status follows CSpliceClass", sCue);
+		if (!bParsed) {
+			continue;
+		}
+
+		//Flat fields against the parsed objects
+		const scte35::SInfoData& objInfo = objCue.GetSInfoData();
+		Check(objResult.table_id == objInfo.table_id && objResult.splice_command_type == objInfo.splice_command_type && objResult.pts_adjustment == objInfo.pts_adjustment
+			&& objResult.tier == objInfo.tier && objResult.CRC_32 == objInfo.CRC_32 && objResult.crc_valid == 1, "C result header", sCue);
+		if (objInfo.splice_command_type == scte35::scte35Cmd::time_signal) {
+			const scte35::splice_time& objTime = objCue.GetTimeSignal();
+			Check(objResult.time_specified_flag == objTime.time_specified_flag && (objTime.time_specified_flag == 0 || objResult.pts_time == objTime.pts_time), "C result time_signal", sCue);
+		}
+		else if (objInfo.splice_command_type == scte35::scte35Cmd::splice_insert) {
+			const scte35::SpliceInsertData& objInsert = objCue.GetSpliceInsert();
+			Check(objResult.splice_event_id == objInsert.splice_event_id && objResult.splice_event_cancel_indicator == objInsert.splice_event_cancel_indicator, "C result splice_insert", sCue);
+		}
+		const std::vector<scte35::SDBase*>& vDescriptors = objCue.GetDescriptors();
+		Check(objResult.descriptor_count == vDescriptors.size(), "C result descriptor count", sCue);
+		uint32_t uSegmentations = 0;
+		for (std::size_t i = 0;i < vDescriptors.size() && i < SCTE35_MAX_DESCRIPTORS;i++) {
+			const scte35_descriptor& objDescriptor = objResult.descriptors[i];
+			Check(objDescriptor.splice_descriptor_tag == vDescriptors[i]->splice_descriptor_tag && objDescriptor.offset + objDescriptor.length <= vBytes.size()
+				&& vBytes[objDescriptor.offset] == objDescriptor.splice_descriptor_tag && objDescriptor.length == vDescriptors[i]->descriptor_length + 2, "C result descriptor location", sCue);
+			if (vDescriptors[i]->splice_descriptor_tag != scte35::scte35Desc::segmentation_descriptor || !scte35::CSpliceClass::IsBuiltInDescriptor(*vDescriptors[i])) {
+				continue;
+			}
+			const scte35::SegmentationDescriptor& objSegmentation = *static_cast<const scte35::SegmentationDescriptor*>(vDescriptors[i]);
+			if (uSegmentations < SCTE35_MAX_SEGMENTATIONS) {
+				const scte35_segmentation& objFlat = objResult.segmentations[uSegmentations];
+				Check(objFlat.descriptor_index == i && objFlat.segmentation_event_id == objSegmentation.segmentation_event_id
+					&& objFlat.segmentation_event_cancel_indicator == objSegmentation.segmentation_event_cancel_indicator, "C result segmentation event", sCue);
+				if (objSegmentation.segmentation_event_cancel_indicator == 0) {
+					Check(objFlat.segmentation_type_id == objSegmentation.segmentation_type_id && objFlat.segmentation_upid_length == objSegmentation.v_upid_list.size()
+						&& objFlat.segmentation_upid_offset + objFlat.segmentation_upid_length <= vBytes.size()
+						&& std::equal(objSegmentation.v_upid_list.begin(), objSegmentation.v_upid_list.end(), vBytes.begin() + objFlat.segmentation_upid_offset), "C result segmentation UPID", sCue);
+				}
+			}
+			uSegmentations++;
+		}
+		Check(objResult.segmentation_count == uSegmentations, "C result segmentation count", sCue);
+
+		//Buffer sizing: a size query, one byte short, then the exact size
+		std::size_t iWritten = 0;
+		Check(scte35_parse_json(pParser, vBytes.data(), vBytes.size(), nullptr, 0, &iWritten) == SCTE35_E_BUFFER_TOO_SMALL && iWritten > 2, "C JSON size query", sCue);
+		vJson.assign(iWritten, '#');
+		std::size_t iShort = 0;
+		Check(scte35_parse_json(pParser, vBytes.data(), vBytes.size(), vJson.data(), iWritten - 1, &iShort) == SCTE35_E_BUFFER_TOO_SMALL && iShort == iWritten, "C JSON one byte short", sCue);
+		Check(scte35_parse_json(pParser, vBytes.data(), vBytes.size(), vJson.data(), vJson.size(), &iShort) == SCTE35_OK && iShort == iWritten
+			&& vJson[0] == '{' && vJson[iWritten - 2] == '}' && vJson[iWritten - 1] == '\0', "C JSON written at the exact size", sCue);
+		Check(scte35_parse_packed(pParser, vBytes.data(), vBytes.size(), nullptr, 0, &iWritten) == SCTE35_E_BUFFER_TOO_SMALL && iWritten > 6, "C packed size query", sCue);
+		vPacked.assign(iWritten, 0);
+		Check(scte35_parse_packed(pParser, vBytes.data(), vBytes.size(), vPacked.data(), iWritten - 1, &iShort) == SCTE35_E_BUFFER_TOO_SMALL && iShort == iWritten, "C packed one byte short", sCue);
+		Check(scte35_parse_packed(pParser, vBytes.data(), vBytes.size(), vPacked.data(), vPacked.size(), &iShort) == SCTE35_OK && iShort == iWritten
+			&& std::equal(vPacked.begin(), vPacked.begin() + 4, "S35R") && vPacked[4] == SCTE35_ABI_VERSION && vPacked[5] == 0, "C packed written at the exact size", sCue);
+	}
+
+	//Failures: arguments, CRC_32 required or not, truncated input, status names
+	const std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[0]);
+	Check(scte35_parse(nullptr, vBytes.data(), vBytes.size(), &objResult, sizeof(objResult)) == SCTE35_E_INVALID_ARGUMENT, "C parse without handle");
+	Check(scte35_parse(pParser, vBytes.data(), vBytes.size(), &objResult, sizeof(objResult) - 1) == SCTE35_E_INVALID_ARGUMENT, "C parse with a smaller result");
+	Check(scte35_parser_set_option(pParser, 0x7F, 1) == SCTE35_E_INVALID_ARGUMENT, "C unknown option");
+	std::vector<uint8_t> vBadCrc = vBytes;
+	vBadCrc.back() ^= 0x01;
+	Check(scte35_parse(pParser, vBadCrc.data(), vBadCrc.size(), &objResult, sizeof(objResult)) == SCTE35_OK && objResult.crc_valid == 0, "C CRC_32 mismatch reported");
+	Check(scte35_parser_set_option(pParser, SCTE35_OPTION_REQUIRE_CRC, 1) == SCTE35_OK
+		&& scte35_parse(pParser, vBadCrc.data(), vBadCrc.size(), &objResult, sizeof(objResult)) == SCTE35_E_CRC_MISMATCH
+		&& scte35_parse(pParser, vBytes.data(), vBytes.size(), &objResult, sizeof(objResult)) == SCTE35_OK, "C CRC_32 required");
+	std::size_t iWritten = 0;
+	Check(scte35_parse_json(pParser, vBadCrc.data(), vBadCrc.size(), nullptr, 0, &iWritten) == SCTE35_E_CRC_MISMATCH, "C JSON parse failure before sizing");
+	for (std::size_t iLength = 1;iLength < vBytes.size();iLength++) {
+		const int iStatus = scte35_parse(pParser, vBytes.data(), iLength, &objResult, sizeof(objResult));
+		Check(iStatus > 0 || iStatus == SCTE35_E_CRC_MISMATCH, "C truncated input fails");
+	}
+	Check(scte35_parse(pParser, vBytes.data(), 0, &objResult, sizeof(objResult)) == SCTE35_E_EMPTY_INPUT, "C empty input");
+	const int iStatuses[] = { SCTE35_OK, SCTE35_E_EMPTY_INPUT, SCTE35_E_TRUNCATED, SCTE35_E_INVALID_ARGUMENT, SCTE35_E_BUFFER_TOO_SMALL, SCTE35_E_CRC_MISMATCH, 12345 };
+	for (int iStatus : iStatuses) {
+		Check(scte35_status_name(iStatus) != nullptr && scte35_status_name(iStatus)[0] != '\0', "C status name");
+	}
+	scte35_parser_destroy(pParser);
+	scte35_parser_destroy(nullptr);
+}
+
+/*! \brief Function to get the text of a segmentation_upid decoded from bytes, empty if it does not decode.
+*/
+std::string GetUpidText(const uint32_t& uType, const std::vector<uint8_t>& vBytes) {
+	scte35::SUpidView objUpid;
+	std::string sText;
+	if (scte35::CSpliceUpid::Decode(uType, vBytes.data(), vBytes.size(), objUpid)) {
+		scte35::CSpliceUpid::GetText(objUpid, sText);
+	}
+	return sText;
+}
+
+/*! \brief Checks of the EIDR and ISAN check characters (ISO 7064 Mod 37,36) against published identifiers.
+*/
+void CheckUpids() {
+	//EIDR 10.5240/7791-8534-2C23-9030-8610-5 in compact binary encoding: sub-prefix 5240 then the 80-bit suffix
+	const std::vector<uint8_t> vEidr = { 0x14, 0x78, 0x77, 0x91, 0x85, 0x34, 0x2C, 0x23, 0x90, 0x30, 0x86, 0x10 };
+	Check(GetUpidText(scte35::scte35Upid::eidr, vEidr) == "10.5240/7791-8534-2C23-9030-8610-5", "EIDR text and check character");
+	//ISAN 0000-0000-D07A-0090-Q-0000-0000-X, and 0000-0001-8CFA-0000-I without version
+	const std::vector<uint8_t> vIsan = { 0x00, 0x00, 0x00, 0x00, 0xD0, 0x7A, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00 };
+	Check(GetUpidText(scte35::scte35Upid::isan, vIsan) == "0000-0000-D07A-0090-Q-0000-0000-X", "V-ISAN text and check characters");
+	const std::vector<uint8_t> vIsanDeprecated = { 0x00, 0x00, 0x00, 0x01, 0x8C, 0xFA, 0x00, 0x00 };
+	Check(GetUpidText(scte35::scte35Upid::isan_deprecated, vIsanDeprecated) == "0000-0001-8CFA-0000-I", "ISAN text and check character");
+	Check(scte35::CSpliceUpid::GetCheckCharacter("000000018CFA000000000000", 24) == 'K' && scte35::CSpliceUpid::GetCheckCharacter("000000018cfa000000000000", 24) == 'K', "ISAN version check character, any case");
+	Check(GetUpidText(scte35::scte35Upid::eidr, std::vector<uint8_t>(vEidr.begin(), vEidr.end() - 1)).empty(), "EIDR of a wrong length does not decode");
+
+	//Mod 37,36 catches every single character change (the hybrid system misses a few swaps of neighbours, 34 in this EIDR)
+	const std::string sDigits = "77918534" "2C239030" "8610";
+	const char cCheck = scte35::CSpliceUpid::GetCheckCharacter(sDigits.data(), sDigits.size());
+	for (std::size_t i = 0;i < sDigits.size();i++) {
+		for (const char c : std::string("0123456789ABCDEF")) {
+			std::string sChanged = sDigits;
+			sChanged[i] = c;
+			Check(c == sDigits[i] || scte35::CSpliceUpid::GetCheckCharacter(sChanged.data(), sChanged.size()) != cCheck, "check character detects a changed character");
+		}
+	}
+}
+
+/*! \brief Checks of CSpliceValidator findings on the corpus and on corpus cues with a field broken by hand.
+*/
+void CheckValidator() {
+	scte35::CSpliceValidator objValidator;
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+		Check(objValidator.Add(vBytes.data(), vBytes.size()) == 0, "corpus cue conforms", scte35::g_SpliceCorpus[k].sName);
+		Check(objValidator.ValidateHexa(scte35::g_SpliceCorpus[k].sHexa) == 0, "corpus hexa-decimal cue conforms", scte35::g_SpliceCorpus[k].sName);
+	}
+
+	//Corpus 0 is a time_signal with a segmentation_descriptor at 21, corpus 1 a splice_insert, corpus 11 a splice_insert with components
+	typedef scte35::scte35Finding F;
+	static const struct {
+		std::size_t iEntry;
+		std::size_t iOffset;
+		std::size_t iCount;
+		uint8_t uValue;
+		uint32_t uFindings;
+		const char* sWhat;
+	} objChanges[] = {
+		{ 0, 0, 1, 0xFD, F::table_id, "table_id 0xFD" },
+		{ 0, 1, 1, 0xB0, F::section_syntax, "section_syntax_indicator set" },
+		{ 0, 2, 1, 0x35, F::section_length, "section_length one too many" },
+		{ 0, 3, 1, 0x01, F::protocol_version, "protocol_version 1" },
+		{ 0, 4, 1, 0x88, F::encryption_algorithm, "reserved encryption_algorithm 4" },
+		{ 0, 4, 1, 0xC0, 0, "user private encryption_algorithm 32" },
+		{ 0, 12, 1, 0x06, F::command_length | F::descriptor_loop_length | F::descriptor_overrun, "splice_command_length one too many" },
+		{ 0, 13, 1, 0x03, F::command_type, "reserved splice_command_type 3" },
+		{ 0, 20, 1, 0x1D, F::descriptor_loop_length | F::descriptor_overrun, "descriptor_loop_length one too few" },
+		{ 0, 21, 1, 0x05, F::descriptor_tag, "descriptor tag 5 reserved" },
+		{ 0, 22, 1, 0x1B, F::descriptor_overrun | F::descriptor_truncated, "descriptor_length one too few" },
+		{ 0, 31, 1, 0x7E, F::reserved_bits, "reserved bits after segmentation_event_cancel_indicator" },
+		{ 0, 31, 1, 0x3F, 0, "segmentation_event_id_compliance_indicator 0" },
+		{ 0, 33, 5, 0x00, F::segmentation_duration, "segmentation_duration 0" },
+		{ 0, 38, 1, 0x0A, F::segmentation_upid, "EIDR of 8 bytes" },
+		{ 0, 48, 1, 0x03, F::segmentation_type, "segmentation_type_id 3 undefined" },
+		{ 0, 50, 1, 0x01, F::segment_num, "segment_num 2 of 1 expected" },
+		{ 1, 19, 1, 0xE0, F::reserved_bits, "reserved bits after splice_immediate_flag" },
+		{ 1, 26, 4, 0x00, F::break_duration, "break_duration 0" },
+		{ 1, 32, 1, 0x02, 0, "avail_num 2 of 0 expected (none announced)" },
+		{ 1, 33, 1, 0x01, 0, "avail_num 0 of 1 expected" },
+		{ 11, 20, 1, 0x00, F::command_length | F::reserved_bits | F::component_count | F::avail_num, "component_count 0" }
+	};
+	uint32_t uAll = 0;
+	uint64_t uExpected[F::count] = {};
+	for (const auto& objChange : objChanges) {
+		std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[objChange.iEntry]);
+		std::fill(vBytes.begin() + objChange.iOffset, vBytes.begin() + objChange.iOffset + objChange.iCount, objChange.uValue);
+		Check(scte35::CSpliceValidator::Validate(vBytes.data(), vBytes.size(), false) == objChange.uFindings, "findings of a broken field", objChange.sWhat);
+		//The CRC_32 no longer matches the changed byte, unless a wrong section_length hides where it is
+		const uint32_t uFindings = objChange.uFindings | ((objChange.uFindings & F::section_length) == 0 ? (uint32_t)F::crc : 0);
+		Check(objValidator.Add(vBytes.data(), vBytes.size()) == uFindings, "Add findings of a broken field", objChange.sWhat);
+		uAll |= uFindings;
+		for (std::size_t i = 0;i < F::count;i++) {
+			uExpected[i] += (uFindings >> i) & 1;
+		}
+	}
+
+	std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[1]);
+	vBytes[32] = 0x02;
+	vBytes[33] = 0x01;
+	Check(scte35::CSpliceValidator::Validate(vBytes.data(), vBytes.size(), false) == F::avail_num, "findings of a broken field", "avail_num 2 of 1 expected");
+
+	//An encrypted section is checked up to its encrypted part, here a reserved descriptor tag
+	vBytes = GetBytes(scte35::g_SpliceCorpus[0]);
+	vBytes[21] = 0x05;
+	Check(scte35::CSpliceValidator::Validate(vBytes.data(), vBytes.size(), false) == F::descriptor_tag, "clear descriptor tag 5 reserved");
+	vBytes[4] = 0x86;
+	Check(scte35::CSpliceValidator::Validate(vBytes.data(), vBytes.size(), false) == 0, "encrypted descriptors are not checked");
+	vBytes.pop_back();
+	Check(scte35::CSpliceValidator::Validate(vBytes.data(), vBytes.size(), false) == F::section_length, "truncated encrypted section");
+
+	Check(objValidator.ValidateHexa("FC3") == F::input && objValidator.ValidateHexa("FC30ZZ") == F::input, "non hexa-decimal input");
+	Check(objValidator.ValidateHexa(scte35::g_SpliceCorpus[0].sHexa, false) == 0, "hexa-decimal input after a failed one");
+
+	//Batch counts
+	const std::size_t iChanges = sizeof(objChanges) / sizeof(objChanges[0]);
+	Check(objValidator.GetSectionCount() == scte35::g_SpliceCorpusCount + iChanges && objValidator.GetFailedCount() == iChanges, "Add section counts");
+	Check(objValidator.GetFindings() == uAll, "Add findings seen");
+	for (std::size_t i = 0;i < F::count;i++) {
+		Check(objValidator.GetFindingCount((F::type)(1u << i)) == uExpected[i], "Add finding count", scte35::CSpliceValidator::GetFindingName((F::type)(1u << i)));
+	}
+	objValidator.Reset();
+	Check(objValidator.GetSectionCount() == 0 && objValidator.GetFailedCount() == 0 && objValidator.GetFindings() == 0 && objValidator.GetFindingCount(F::crc) == 0, "Reset clears the batch");
+
+	//Names
+	std::string sNames;
+	scte35::CSpliceValidator::GetFindingNames(F::table_id | F::crc | F::segment_num, sNames);
+	Check(sNames == "table_id,crc,segment_num", "finding names in bit order");
+	scte35::CSpliceValidator::GetFindingNames(0, sNames);
+	Check(sNames.empty(), "no finding names");
+	Check(std::string(scte35::CSpliceValidator::GetFindingName(F::all)) == "unknown", "finding name of several bits");
+	for (std::size_t i = 0;i < F::count;i++) {
+		Check(std::string(scte35::CSpliceValidator::GetFindingName((F::type)(1u << i))) != "unknown", "finding name", std::to_string(i).c_str());
+	}
+}
+
+/*! \brief Function to get the paths of the differences listed by CSpliceFingerprint::Diff, separated by ',', "fail" if not compared.
+*/
+std::string GetDiffText(scte35::CSpliceFingerprint& objFingerprint, const std::vector<uint8_t>& vOld, const std::vector<uint8_t>& vNew, const scte35::scte35Change::type& eChange = scte35::scte35Change::changed) {
+	std::vector<scte35::SFieldChange> vChanges;
+	if (!objFingerprint.Diff(vOld.data(), vOld.size(), vNew.data(), vNew.size(), vChanges)) {
+		return "fail";
+	}
+	std::string sText;
+	for (const scte35::SFieldChange& objChange : vChanges) {
+		if (objChange.eChange == eChange) {
+			if (!sText.empty()) {
+				sText += ',';
+			}
+			scte35::CSpliceFingerprint::GetPathText(objChange.objPath, sText);
+		}
+	}
+	return sText;
+}
+
+/*! \brief Checks of CSpliceFingerprint fingerprints and diffs, against corpus cues with fields of each ignore group changed by hand.
+*/
+void CheckFingerprint() {
+	scte35::CSpliceFingerprint objFingerprint;
+	std::vector<uint64_t> vFingerprints;
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		const char* sName = scte35::g_SpliceCorpus[k].sName;
+		std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+		uint64_t uFingerprint = 0;
+		uint64_t uHexa = 1;
+		Check(objFingerprint.Compute(vBytes.data(), vBytes.size(), uFingerprint) && objFingerprint.ComputeHexa(scte35::g_SpliceCorpus[k].sHexa, uHexa) && uFingerprint == uHexa, "fingerprint of bytes and hexa-decimal", sName);
+		Check(GetDiffText(objFingerprint, vBytes, vBytes).empty(), "no difference with itself", sName);
+		Check(!objFingerprint.Compute(vBytes.data(), vBytes.size() - 5, uHexa), "truncated cue is not fingerprinted", sName);
+		vFingerprints.push_back(uFingerprint);
+	}
+	std::sort(vFingerprints.begin(), vFingerprints.end());
+	Check(std::unique(vFingerprints.begin(), vFingerprints.end()) == vFingerprints.end(), "corpus fingerprints differ");
+
+	//Corpus 0 changed in one field of a group, CRC_32 recomputed: the two bytes at iOffset are XORed with uXor
+	static const struct {
+		uint32_t uGroup;
+		std::size_t iOffset;
+		uint16_t uXor;
+		const char* sField;
+	} objChanges[] = {
+		{ scte35::scte35Ignore::pts_adjustment, 7, 0x0001, "pts_adjustment" },
+		{ scte35::scte35Ignore::lengths, 11, 0x0FFA, "splice_command_length" },
+		{ scte35::scte35Ignore::reserved, 31, 0x4000, "descriptor[0].reserved_1" },
+		{ scte35::scte35Ignore::crc, 0, 0x0000, "" },
+		{ scte35::scte35Ignore::none, 29, 0x0001, "descriptor[0].segmentation_event_id" }
+	};
+	const std::vector<uint8_t> vOld = GetBytes(scte35::g_SpliceCorpus[0]);
+	for (const auto& objChange : objChanges) {
+		std::vector<uint8_t> vNew = vOld;
+		vNew[objChange.iOffset] ^= (uint8_t)(objChange.uXor >> 8);
+		vNew[objChange.iOffset + 1] ^= (uint8_t)objChange.uXor;
+		const uint32_t uCRC = scte35::CSpliceCRC::Compute(vNew.data(), vNew.size() - 4) ^ (objChange.uGroup == scte35::scte35Ignore::crc ? 1 : 0);
+		for (int i = 0;i < 4;i++) {
+			vNew[vNew.size() - 4 + i] = (uint8_t)(uCRC >> (24 - 8 * i));
+		}
+		for (uint32_t uIgnore = 0;uIgnore < 16;uIgnore++) {
+			scte35::CSpliceFingerprint objIgnoring(uIgnore);
+			uint64_t uOld = 0;
+			uint64_t uNew = 0;
+			objIgnoring.Compute(vOld.data(), vOld.size(), uOld);
+			objIgnoring.Compute(vNew.data(), vNew.size(), uNew);
+			const bool bFieldIgnored = objChange.uGroup == scte35::scte35Ignore::crc || (uIgnore & objChange.uGroup) != 0;
+			const bool bCRCIgnored = (uIgnore & scte35::scte35Ignore::crc) != 0;
+			Check((uOld == uNew) == (bFieldIgnored && bCRCIgnored), "same fingerprint only when every changed field is ignored", objChange.sField);
+			const std::string sExpected = std::string(bFieldIgnored ? "" : objChange.sField) + (bFieldIgnored || bCRCIgnored ? "" : ",") + (bCRCIgnored ? "" : "CRC_32");
+			Check(GetDiffText(objIgnoring, vOld, vNew) == sExpected, "changed fields not ignored", objChange.sField);
+		}
+	}
+
+	//time_signal_program_start_end against time_signal_program_end: the second descriptor is removed, then added the other way round
+	scte35::CSpliceFingerprint objAll(scte35::scte35Ignore::pts_adjustment | scte35::scte35Ignore::crc | scte35::scte35Ignore::lengths | scte35::scte35Ignore::reserved);
+	const std::vector<uint8_t> vTwo = GetBytes(scte35::g_SpliceCorpus[3]);
+	const std::vector<uint8_t> vOne = GetBytes(scte35::g_SpliceCorpus[6]);
+	const std::string sRemoved = GetDiffText(objAll, vTwo, vOne, scte35::scte35Change::removed);
+	Check(sRemoved.find("descriptor[1].splice_descriptor_tag,descriptor[1].identifier,") == 0 && sRemoved.find("descriptor[0]") == std::string::npos && sRemoved.find("descriptor_length") == std::string::npos, "removed descriptor fields");
+	Check(GetDiffText(objAll, vOne, vTwo, scte35::scte35Change::added) == sRemoved && GetDiffText(objAll, vOne, vTwo, scte35::scte35Change::removed).empty(), "added descriptor fields");
+	Check(GetDiffText(objAll, vTwo, vOne) == "pts_time,descriptor[0].segmentation_event_id,descriptor[0].segmentation_upid", "changed fields of the kept descriptor");
+	std::vector<uint8_t> vCut = vOne;
+	vCut.resize(vCut.size() - 5);
+	Check(GetDiffText(objAll, vTwo, vCut) == "fail", "truncated cue is not compared");
+}
+
+/*! \brief Function to get the bytes of a time_signal with a splice time, a cue distinct for each time.
+*/
+std::vector<uint8_t> MakeTimeSignalBytes(const uint64_t& uPts) {
+	std::vector<uint8_t> vBytes;
+	scte35::CSpliceProjection::HexaToBytes(MakeTimeSignal(uPts), vBytes);
+	return vBytes;
+}
+
+/*!	\class CEngineRecorder
+*	\brief #CEngineRecorder class recording the splice times handled per channel by CSpliceEngine.
+*/
+class CEngineRecorder : public scte35::CSpliceEngineHandler {
+public:
+	std::vector<std::vector<uint64_t>> vTimes;		/*!<Splice times of the cues of each channel, in handling order.*/
+	std::vector<int> vRemoved;						/*!<OnChannelRemoved calls of each channel.*/
+	std::vector<std::size_t> vRemovedAfter;			/*!<Cues of each channel handled before its removal.*/
+	std::atomic<uint64_t> uFailures;				/*!<OnFailure calls.*/
+	const scte35::CSpliceEngine* pStealing;			/*!<Engine whose first cue waits until a worker stole, nullptr not to wait.*/
+	std::atomic<bool> bFirst;						/*!<Whether no cue was handled yet.*/
+
+	/*! \brief #CEngineRecorder class constructor for channels 0 to iChannels - 1.
+	*/
+	explicit CEngineRecorder(const std::size_t& iChannels) :
+	 vTimes(iChannels),
+	 vRemoved(iChannels, 0),
+	 vRemovedAfter(iChannels, 0),
+	 uFailures(0),
+	 pStealing(nullptr),
+	 bFirst(true)
+	{
+	}
+
+	void OnCue(scte35::SEngineChannel& objChannel, const scte35::CSpliceClass& objCue, const std::vector<scte35::SSegmentationEvent>& vEvents) override {
+		(void)vEvents;
+		//Holding the first cue leaves the other ready channels of its shard to the idle worker
+		if (pStealing != nullptr && bFirst.exchange(false)) {
+			for (int i = 0;i < 5000 && pStealing->GetShardStats(1).uStolen == 0;i++) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}
+		uint64_t uPts = 0;
+		scte35::CSpliceTimeline::GetCuePts(objCue, uPts);
+		vTimes[(std::size_t)objChannel.uChannel].push_back(uPts);
+	}
+
+	void OnFailure(scte35::SEngineChannel& objChannel, const scte35::CSpliceClass& objCue, const uint8_t* pData, const std::size_t& iLength) override {
+		(void)objChannel;
+		(void)objCue;
+		(void)pData;
+		(void)iLength;
+		uFailures++;
+	}
+
+	void OnChannelRemoved(scte35::SEngineChannel& objChannel) override {
+		vRemoved[(std::size_t)objChannel.uChannel]++;
+		vRemovedAfter[(std::size_t)objChannel.uChannel] = vTimes[(std::size_t)objChannel.uChannel].size();
+	}
+};
+
+/*! \brief Checks of CSpliceEngine ordering with work stealing, duplicate filter, removal and draining, against the cues submitted.
+*/
+void CheckEngine() {
+	scte35::SEngineConfig objConfig;
+	objConfig.iWorkers = 2;
+	objConfig.iMaxChannels = 64;
+	objConfig.iMailboxCapacity = 256;
+	objConfig.iBatch = 1;
+	objConfig.bDedup = false;
+	objConfig.uIdleSleepUs = 10;
+
+	//Consistent hashing: a third shard only takes channels, the others keep their shard
+	{
+		scte35::SEngineConfig objThree = objConfig;
+		objThree.iWorkers = 3;
+		scte35::CSpliceEngine objTwoShards(objConfig);
+		scte35::CSpliceEngine objThreeShards(objThree);
+		std::size_t iMoved = 0;
+		for (uint64_t uChannel = 0;uChannel < 3000;uChannel++) {
+			const std::size_t iShard = objThreeShards.GetShard(uChannel);
+			Check(iShard == objTwoShards.GetShard(uChannel) || iShard == 2, "engine channel moves only to the added shard");
+			iMoved += iShard == 2 ? 1 : 0;
+		}
+		Check(iMoved > 600 && iMoved < 1400, "engine added shard takes about a third of the channels");
+	}
+
+	//Channels homed on shard 0 only, queued before the start so that worker 1 can only steal them
+	const std::size_t iChannels = 8;
+	const uint64_t uCues = 200;
+	{
+		CEngineRecorder objRecorder(64);
+		scte35::CSpliceEngine objEngine(objConfig);
+		objRecorder.pStealing = &objEngine;
+		objEngine.SetHandler(&objRecorder);
+		std::vector<uint64_t> vChannels;
+		for (uint64_t uChannel = 0;uChannel < 64 && vChannels.size() < iChannels;uChannel++) {
+			if (objEngine.GetShard(uChannel) == 0) {
+				Check(objEngine.AddChannel(uChannel), "engine AddChannel");
+				vChannels.push_back(uChannel);
+			}
+		}
+		for (uint64_t i = 0;i < uCues;i++) {
+			for (const uint64_t uChannel : vChannels) {
+				const std::vector<uint8_t> vBytes = MakeTimeSignalBytes(i * 100 + uChannel);
+				Check(objEngine.Submit(uChannel, vBytes.data(), vBytes.size()), "engine Submit");
+			}
+		}
+		Check(objEngine.GetShardStats(0).iReady == iChannels && objEngine.GetShardStats(1).iReady == 0, "engine channels ready on their home shard");
+		Check(objEngine.Start() && !objEngine.Start(), "engine Start once");
+		objEngine.Stop();
+
+		const scte35::SEngineShardStats objStats0 = objEngine.GetShardStats(0);
+		const scte35::SEngineShardStats objStats1 = objEngine.GetShardStats(1);
+		Check(objStats1.uStolen > 0 && objStats1.uCues > 0 && objStats0.uStolen == 0, "engine idle worker steals");
+		Check(objStats0.uCues + objStats1.uCues == uCues * iChannels && objStats0.iReady == 0 && objStats1.iReady == 0, "engine Stop handles every cue");
+		for (const uint64_t uChannel : vChannels) {
+			std::vector<uint64_t> vExpected;
+			for (uint64_t i = 0;i < uCues;i++) {
+				vExpected.push_back(i * 100 + uChannel);
+			}
+			Check(objRecorder.vTimes[(std::size_t)uChannel] == vExpected, "engine channel cues in submission order across workers");
+			scte35::SEngineChannelStats objChannel;
+			Check(objEngine.GetChannelStats(uChannel, objChannel) && objChannel.iHomeShard == 0 && objChannel.iPending == 0 && objChannel.uReceived == uCues && objChannel.uParsed == uCues, "engine channel counters");
+		}
+	}
+
+	//Duplicate filter: length and CRC_32 of the last SEngineChannel::iDedupSlots cues
+	for (int iDedup = 0;iDedup < 2;iDedup++) {
+		scte35::SEngineConfig objDedup = objConfig;
+		objDedup.iWorkers = 1;
+		objDedup.bDedup = iDedup == 1;
+		CEngineRecorder objRecorder(1);
+		scte35::CSpliceEngine objEngine(objDedup);
+		objEngine.SetHandler(&objRecorder);
+		Check(objEngine.AddChannel(0) && !objEngine.AddChannel(0), "engine AddChannel once");
+		std::vector<uint64_t> vTimes = { 1, 1, 2, 1 };
+		for (uint64_t i = 0;i < scte35::SEngineChannel::iDedupSlots;i++) {
+			vTimes.push_back(100 + i);
+		}
+		//1 and 2 left the filter after as many other cues as it remembers, the last of them did not
+		vTimes.push_back(1);
+		vTimes.push_back(100 + scte35::SEngineChannel::iDedupSlots - 1);
+		std::vector<uint8_t> vFailed = MakeTimeSignalBytes(3);
+		vFailed.resize(10);
+		for (const uint64_t uPts : vTimes) {
+			const std::vector<uint8_t> vBytes = MakeTimeSignalBytes(uPts);
+			objEngine.Submit(0, vBytes.data(), vBytes.size());
+		}
+		objEngine.Submit(0, vFailed.data(), vFailed.size());
+		objEngine.Submit(0, vFailed.data(), vFailed.size());
+		objEngine.Start();
+		objEngine.Stop();
+
+		std::vector<uint64_t> vExpected = vTimes;
+		if (objDedup.bDedup) {
+			vExpected = { 1, 2 };
+			for (uint64_t i = 0;i < scte35::SEngineChannel::iDedupSlots;i++) {
+				vExpected.push_back(100 + i);
+			}
+			vExpected.push_back(1);
+		}
+		scte35::SEngineChannelStats objChannel;
+		Check(objRecorder.vTimes[0] == vExpected, "engine duplicate filter hits and misses");
+		Check(objEngine.GetChannelStats(0, objChannel) && objChannel.uReceived == vTimes.size() + 2 && objChannel.uDuplicates == (objDedup.bDedup ? 4u : 0u), "engine duplicate count");
+		Check(objChannel.uFailed == (objDedup.bDedup ? 1u : 2u) && objRecorder.uFailures == objChannel.uFailed && objChannel.uParsed == vExpected.size(), "engine failed cues, a failed duplicate is filtered too");
+	}
+
+	//Removal with cues queued: the cues are still handled, the slot counts against iMaxChannels until the removal is handled
+	{
+		scte35::SEngineConfig objSmall = objConfig;
+		objSmall.iMaxChannels = 2;
+		objSmall.iMailboxCapacity = 3;
+		CEngineRecorder objRecorder(4);
+		scte35::CSpliceEngine objEngine(objSmall);
+		objEngine.SetHandler(&objRecorder);
+		Check(objEngine.AddChannel(1) && objEngine.AddChannel(2) && !objEngine.AddChannel(3), "engine iMaxChannels");
+		for (uint64_t i = 0;i < 5;i++) {
+			const std::vector<uint8_t> vBytes = MakeTimeSignalBytes(10 + i);
+			Check(objEngine.Submit(1, vBytes.data(), vBytes.size()) == (i < 4), "engine mailbox capacity rounded up to a power of two");
+		}
+		scte35::SEngineChannelStats objChannel;
+		Check(objEngine.GetChannelStats(1, objChannel) && objChannel.iPending == 4 && objChannel.uDropped == 1, "engine pending and dropped cues");
+		Check(objEngine.RemoveChannel(1) && !objEngine.RemoveChannel(1) && !objEngine.GetChannelStats(1, objChannel), "engine RemoveChannel");
+		const std::vector<uint8_t> vLate = MakeTimeSignalBytes(99);
+		Check(!objEngine.Submit(1, vLate.data(), vLate.size()) && objEngine.GetChannelCount() == 1, "engine removed channel takes no cue");
+		Check(!objEngine.AddChannel(3) && !objEngine.AddChannel(1), "engine removed channel counts against iMaxChannels until drained");
+		Check(objRecorder.vRemoved[1] == 0, "engine removal waits for a worker");
+
+		objEngine.Start();
+		objEngine.Stop();
+		Check(objRecorder.vTimes[1] == std::vector<uint64_t>({ 10, 11, 12, 13 }) && objRecorder.vRemoved[1] == 1 && objRecorder.vRemovedAfter[1] == 4, "engine removed channel handles its queued cues first");
+		Check(objEngine.AddChannel(3) && objEngine.GetChannelCount() == 2, "engine drained removal frees its slot");
+	}
+
+	//Destructor of a stopped engine handles the cues and removals left, several submitting threads
+	{
+		CEngineRecorder objRecorder(4);
+		{
+			scte35::CSpliceEngine objEngine(objConfig);
+			objEngine.SetHandler(&objRecorder);
+			for (uint64_t uChannel = 0;uChannel < 4;uChannel++) {
+				objEngine.AddChannel(uChannel);
+			}
+			std::vector<std::thread> vThreads;
+			for (uint64_t uChannel = 0;uChannel < 4;uChannel++) {
+				vThreads.emplace_back([&objEngine, uChannel]() {
+					for (uint64_t i = 0;i < 100;i++) {
+						const std::vector<uint8_t> vBytes = MakeTimeSignalBytes(i * 10 + uChannel);
+						objEngine.Submit(uChannel, vBytes.data(), vBytes.size());
+					}
+				});
+			}
+			for (std::thread& objThread : vThreads) {
+				objThread.join();
+			}
+			objEngine.RemoveChannel(3);
+		}
+		for (uint64_t uChannel = 0;uChannel < 4;uChannel++) {
+			Check(objRecorder.vTimes[(std::size_t)uChannel].size() == 100 && std::is_sorted(objRecorder.vTimes[(std::size_t)uChannel].begin(), objRecorder.vTimes[(std::size_t)uChannel].end()), "engine destructor handles every cue in order");
+		}
+		Check(objRecorder.vRemoved[3] == 1 && objRecorder.vRemovedAfter[3] == 100 && objRecorder.vRemoved[0] == 0, "engine destructor handles the removal");
+	}
+}
+
+/*! \brief Checks of CSpliceMPSCQueue and CSpliceSPSCQueue order and full/empty edges, with producers lapping small queues many times.
+*/
+void CheckQueues() {
+	//Full and empty edges, then enough pushes and pops for the sequence numbers to go round the slots many times
+	scte35::CSpliceMPSCQueue<uint64_t> objSmall(3);
+	uint64_t uValue = 0;
+	Check(objSmall.GetCapacity() == 4 && !objSmall.TryPop(uValue), "MPSC queue capacity and empty pop");
+	for (uint64_t i = 0;i < 1000;i++) {
+		bool bPushed = true;
+		for (uint64_t j = 0;j < 4;j++) {
+			uValue = i * 4 + j;
+			bPushed = bPushed && objSmall.TryPush(uValue);
+		}
+		uValue = 0;
+		Check(bPushed && !objSmall.TryPush(uValue) && objSmall.GetSize() == 4, "MPSC queue full after a lap");
+		for (uint64_t j = 0;j < 4;j++) {
+			Check(objSmall.TryPop(uValue) && uValue == i * 4 + j, "MPSC queue pops in push order");
+		}
+		Check(!objSmall.TryPop(uValue) && objSmall.GetSize() == 0, "MPSC queue empty after a lap");
+	}
+
+	//Producers on a full queue: every value comes out once, each producer in its own order
+	const uint64_t uProducers = 4;
+	const uint64_t uValues = 50000;
+	scte35::CSpliceMPSCQueue<uint64_t> objShared(8);
+	std::vector<std::thread> vProducers;
+	for (uint64_t p = 0;p < uProducers;p++) {
+		vProducers.emplace_back([&objShared, p]() {
+			for (uint64_t i = 0;i < uValues;i++) {
+				uint64_t uItem = (p << 32) | i;
+				while (!objShared.TryPush(uItem)) {
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	std::vector<uint64_t> vNext(uProducers, 0);
+	bool bOrdered = true;
+	for (uint64_t uReceived = 0;uReceived < uProducers * uValues;) {
+		if (!objShared.TryPop(uValue)) {
+			std::this_thread::yield();
+			continue;
+		}
+		const uint64_t uProducer = uValue >> 32;
+		bOrdered = bOrdered && uProducer < uProducers && (uValue & 0xFFFFFFFF) == vNext[uProducer];
+		if (uProducer < uProducers) {
+			vNext[uProducer]++;
+		}
+		uReceived++;
+	}
+	for (std::thread& objThread : vProducers) {
+		objThread.join();
+	}
+	Check(bOrdered && !objShared.TryPop(uValue), "MPSC queue keeps each producer order and loses nothing");
+
+	//SPSC: the cached indices are refreshed only on an apparent full or empty queue
+	scte35::CSpliceSPSCQueue<uint64_t> objPair(4);
+	for (uint64_t j = 0;j < 4;j++) {
+		uValue = j;
+		Check(objPair.TryPush(uValue), "SPSC queue push");
+	}
+	Check(!objPair.TryPush(uValue) && objPair.TryPop(uValue) && uValue == 0 && objPair.TryPush(uValue) && objPair.GetSize() == 4, "SPSC queue full, then room after a pop");
+	while (objPair.TryPop(uValue)) {
+	}
+	std::thread objProducer([&objPair]() {
+		for (uint64_t i = 0;i < uValues;i++) {
+			uint64_t uItem = i;
+			while (!objPair.TryPush(uItem)) {
+				std::this_thread::yield();
+			}
+		}
+	});
+	bOrdered = true;
+	for (uint64_t i = 0;i < uValues;) {
+		if (objPair.TryPop(uValue)) {
+			bOrdered = bOrdered && uValue == i;
+			i++;
+		}
+		else {
+			std::this_thread::yield();
+		}
+	}
+	objProducer.join();
+	Check(bOrdered && !objPair.TryPop(uValue), "SPSC queue keeps the order and loses nothing");
+}
+
+/*!	\class CTestSink
+*	\brief #CTestSink class recording the sections reaching the output of CSplicePipeline, optionally held until released.
+*/
+class CTestSink : public scte35::CSpliceSink {
+public:
+	std::vector<std::pair<uint64_t, std::vector<uint8_t>>> vSections;		/*!<Sequence and bytes of each consumed event.*/
+	std::size_t iParsed;													/*!<Consumed events which parsed.*/
+	std::atomic<bool> bHold;												/*!<Whether Consume waits for a release.*/
+
+	/*! \brief #CTestSink class default constructor.
+	*/
+	CTestSink() :
+	 vSections(),
+	 iParsed(0),
+	 bHold(false)
+	{
+	}
+
+	void Consume(const scte35::SPipelineEvent& objEvent) override {
+		while (bHold.load()) {
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+		vSections.emplace_back(objEvent.uSequence, objEvent.vSection);
+		iParsed += objEvent.bParsed ? 1 : 0;
+	}
+};
+
+/*! \brief Function to append one transport stream packet, the payload padded with 0xFF stuffing.
+*/
+void AppendPacket(std::vector<uint8_t>& vStream, const uint32_t& uPID, const bool& bUnitStart, const uint32_t& uContinuity, const std::vector<uint8_t>& vPayload) {
+	vStream.push_back(0x47);
+	vStream.push_back((uint8_t)((bUnitStart ? 0x40 : 0x00) | ((uPID >> 8) & 0x1F)));
+	vStream.push_back((uint8_t)uPID);
+	vStream.push_back((uint8_t)(0x10 | (uContinuity & 0xF)));
+	vStream.insert(vStream.end(), vPayload.begin(), vPayload.end());
+	vStream.resize(vStream.size() + 184 - vPayload.size(), 0xFF);
+}
+
+/*! \brief Function to concatenate byte runs.
+*/
+std::vector<uint8_t> JoinBytes(const std::vector<std::vector<uint8_t>>& vParts) {
+	std::vector<uint8_t> vBytes;
+	for (const std::vector<uint8_t>& vPart : vParts) {
+		vBytes.insert(vBytes.end(), vPart.begin(), vPart.end());
+	}
+	return vBytes;
+}
+
+/*! \brief Checks of CSplicePipeline section reassembly from transport stream packets and of its drop policies against a stalled sink.
+*/
+void CheckPipeline() {
+	//Corpus 8 spans two packets, corpora 1 and 2 share one
+	const std::vector<uint8_t> vA = GetBytes(scte35::g_SpliceCorpus[1]);
+	const std::vector<uint8_t> vB = GetBytes(scte35::g_SpliceCorpus[2]);
+	const std::vector<uint8_t> vC = GetBytes(scte35::g_SpliceCorpus[8]);
+	Check(vC.size() > 183 && vC.size() < 183 + 133, "pipeline corpus section spans two packets");
+	const std::vector<uint8_t> vZero(1, 0x00);
+	const std::vector<uint8_t> vCHead(vC.begin(), vC.begin() + 183);
+	const std::vector<uint8_t> vCTail(vC.begin() + 183, vC.end());
+	const std::vector<uint8_t> vCStart(vC.begin(), vC.begin() + (183 - vA.size()));
+	const std::vector<uint8_t> vCEnd(vC.begin() + (183 - vA.size()), vC.end());
+	std::vector<uint8_t> vStream;
+	AppendPacket(vStream, 0x100, true, 0, JoinBytes({ vZero, vA, vB }));
+	AppendPacket(vStream, 0x101, true, 0, JoinBytes({ vZero, vA }));
+	AppendPacket(vStream, 0x100, true, 1, JoinBytes({ vZero, vCHead }));
+	AppendPacket(vStream, 0x100, false, 2, vCTail);
+	//continuity_counter 4 after 3: the open section is lost
+	AppendPacket(vStream, 0x100, true, 3, JoinBytes({ vZero, vCHead }));
+	AppendPacket(vStream, 0x100, false, 5, vCTail);
+	//pointer_field: the end of an open section before a new one, then the same packet again
+	AppendPacket(vStream, 0x100, true, 6, JoinBytes({ vZero, vA, vCStart }));
+	AppendPacket(vStream, 0x100, true, 7, JoinBytes({ std::vector<uint8_t>(1, (uint8_t)vCEnd.size()), vCEnd, vB }));
+	AppendPacket(vStream, 0x100, true, 7, JoinBytes({ std::vector<uint8_t>(1, (uint8_t)vCEnd.size()), vCEnd, vB }));
+	vStream.push_back(0x47);
+
+	scte35::SPipelineConfig objConfig;
+	objConfig.iParseWorkers = 2;
+	objConfig.iQueueCapacity = 4;
+	objConfig.uIdleSleepUs = 10;
+	{
+		CTestSink objSink;
+		scte35::CSplicePipeline objPipeline(objConfig);
+		objPipeline.AddSink(&objSink);
+		objPipeline.AddPID(0x100);
+		Check(objPipeline.SubmitPackets(vStream.data(), vStream.size()) == 0, "pipeline takes no packet before Start");
+		Check(objPipeline.Start() && !objPipeline.Start(), "pipeline Start once");
+		Check(objPipeline.SubmitPackets(vStream.data(), vStream.size()) == 6, "pipeline sections of the packets");
+		objPipeline.Stop();
+
+		const std::vector<std::vector<uint8_t>> vExpected = { vA, vB, vC, vA, vC, vB };
+		std::sort(objSink.vSections.begin(), objSink.vSections.end());
+		bool bSame = objSink.vSections.size() == vExpected.size();
+		for (std::size_t i = 0;bSame && i < vExpected.size();i++) {
+			bSame = objSink.vSections[i].first == i && objSink.vSections[i].second == vExpected[i];
+		}
+		Check(bSame && objSink.iParsed == vExpected.size(), "pipeline reassembled sections");
+		Check(objPipeline.GetStageStats(scte35::scte35PipelineStage::demux).uFailed == 1, "pipeline continuity_counter gap counted");
+		for (int i = 0;i < scte35::scte35PipelineStage::count;i++) {
+			const scte35::SPipelineStageStats objStats = objPipeline.GetStageStats((scte35::scte35PipelineStage::type)i);
+			Check(objStats.uProcessed == vExpected.size() && objStats.uDropped == 0 && objStats.iQueueDepth == 0, "pipeline stage counts", scte35::CSplicePipeline::GetStageName((scte35::scte35PipelineStage::type)i));
+		}
+	}
+
+	//Drop policies against a sink holding its first event: the in-flight events are bounded by the pool, the rest are dropped or wait
+	const scte35::scte35DropPolicy::type ePolicies[] = { scte35::scte35DropPolicy::block, scte35::scte35DropPolicy::drop_newest, scte35::scte35DropPolicy::block_timeout };
+	const uint64_t uSubmitted = 100;
+	for (const scte35::scte35DropPolicy::type ePolicy : ePolicies) {
+		objConfig.iParseWorkers = 1;
+		objConfig.iQueueCapacity = 2;
+		objConfig.eDropPolicy = ePolicy;
+		objConfig.uBlockTimeoutUs = 200;
+		CTestSink objSink;
+		objSink.bHold = true;
+		scte35::CSplicePipeline objPipeline(objConfig);
+		objPipeline.AddSink(&objSink);
+		objPipeline.Start();
+		const std::size_t iPool = objPipeline.GetStageStats(scte35::scte35PipelineStage::demux).iQueueCapacity;
+		Check(iPool == 3 * 3, "pipeline event pool fills every queue while each stage thread holds one");
+
+		//The sink is released once the pool ran out for a blocking capture (which only resumes then), after the last section otherwise
+		std::atomic<bool> bSubmitted(false);
+		std::thread objRelease([&objSink, &objPipeline, &bSubmitted, iPool, ePolicy]() {
+			for (int i = 0;i < 5000;i++) {
+				if (ePolicy == scte35::scte35DropPolicy::block ? objPipeline.GetStageStats(scte35::scte35PipelineStage::demux).iQueueDepth == iPool : bSubmitted.load()) {
+					break;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			objSink.bHold = false;
+		});
+		uint64_t uAccepted = 0;
+		for (uint64_t i = 0;i < uSubmitted;i++) {
+			uAccepted += objPipeline.SubmitSection(0x100, vA.data(), vA.size()) ? 1 : 0;
+		}
+		bSubmitted = true;
+		objRelease.join();
+		objPipeline.Stop();
+
+		const char* sPolicy = ePolicy == scte35::scte35DropPolicy::block ? "block" : (ePolicy == scte35::scte35DropPolicy::drop_newest ? "drop_newest" : "block_timeout");
+		uint64_t uDropped = 0;
+		scte35::SPipelineStageStats objStats[scte35::scte35PipelineStage::count];
+		for (int i = 0;i < scte35::scte35PipelineStage::count;i++) {
+			objStats[i] = objPipeline.GetStageStats((scte35::scte35PipelineStage::type)i);
+			uDropped += objStats[i].uDropped;
+		}
+		const scte35::SPipelineStageStats& objOutput = objStats[scte35::scte35PipelineStage::output];
+		Check(objStats[scte35::scte35PipelineStage::demux].uProcessed == uSubmitted && objOutput.uProcessed + uDropped == uSubmitted && objSink.vSections.size() == objOutput.uProcessed, "pipeline every section processed or dropped once", sPolicy);
+		Check(uAccepted == uSubmitted - objStats[scte35::scte35PipelineStage::demux].uDropped - objStats[scte35::scte35PipelineStage::parse].uDropped, "pipeline SubmitSection reports the capture drops", sPolicy);
+		Check(ePolicy == scte35::scte35DropPolicy::block ? uDropped == 0 : uDropped >= uSubmitted - iPool, "pipeline drops of the policy", sPolicy);
+		//Only the blocking capture is sure to back up to the output queue, behind the held sink
+		const bool bOutputFull = objOutput.iQueueHighWater == objOutput.iQueueCapacity;
+		Check((bOutputFull || ePolicy != scte35::scte35DropPolicy::block) && objOutput.iQueueHighWater > 0 && objOutput.iQueueHighWater <= objOutput.iQueueCapacity, "pipeline output high-water mark", sPolicy);
+		Check(objStats[scte35::scte35PipelineStage::parse].iQueueHighWater > 0 && objStats[scte35::scte35PipelineStage::parse].iQueueHighWater <= objStats[scte35::scte35PipelineStage::parse].iQueueCapacity, "pipeline parse high-water mark", sPolicy);
+		Check(objStats[scte35::scte35PipelineStage::demux].iQueueDepth == 0 && objOutput.uLatencyMax > 0 && objOutput.uLatencyTotal >= objOutput.uLatencyMax, "pipeline events recycled and latency", sPolicy);
+		Check(std::is_sorted(objSink.vSections.begin(), objSink.vSections.end()), "pipeline keeps the order of a PID", sPolicy);
+	}
+}
+
+/*! \brief Function to get the first field of a table holding different values in two objects.
+*	\returns the field name, nullptr if every field is equal.
+*/
+template <typename TLayout, std::size_t... Is>
+const char* GetFieldMismatch(const typename TLayout::value_type& objA, const typename TLayout::value_type& objB, std::index_sequence<Is...>) {
+	const char* sField = nullptr;
+	((sField = (sField == nullptr && objA.*(std::get<Is>(TLayout::fields).pMember) != objB.*(std::get<Is>(TLayout::fields).pMember)) ? std::get<Is>(TLayout::fields).sName : sField), ...);
+	return sField;
+}
+
+/*! \brief Function to decode a flag cluster with a kernel and with the layout table, comparing the fields and the bit counts.
+*/
+template <typename TLayout>
+void CheckFlagCluster(std::size_t (*pfnKernel)(const uint8_t*, typename TLayout::value_type&), const uint8_t* pData, const std::size_t& iBytes, const char* sWhat, const char* sCue) {
+	typename TLayout::value_type objKernel;
+	typename TLayout::value_type objTable;
+	std::size_t iTableBits = 0;
+	const std::size_t iKernelBits = pfnKernel(pData, objKernel);
+	Check(scte35::CSpliceLayout<TLayout>::Decode(pData, iBytes, objTable, iTableBits) && iKernelBits == iTableBits, sWhat, sCue);
+	const char* sField = GetFieldMismatch<TLayout>(objKernel, objTable, std::make_index_sequence<scte35::CSpliceLayout<TLayout>::iFieldCount>());
+	Check(sField == nullptr, sWhat, sField != nullptr ? sField : sCue);
+}
+
+/*! \brief Checks of every CSpliceBitKernel kernel this CPU runs against the layout tables and against each other.
+*/
+void CheckBitKernels() {
+	typedef scte35::CSpliceBitKernel CKernel;
+	const scte35::scte35Kernel::type eStart = CKernel::GetKernel();
+	const scte35::scte35Kernel::type eKernels[] = { scte35::scte35Kernel::portable, scte35::scte35Kernel::bmi2 };
+	Check(CKernel::IsSupported(scte35::scte35Kernel::portable), "the portable kernel runs everywhere");
+
+	//Texts of the corpus parsed with the first kernel, the general path goes through every kernel function
+	std::vector<std::string> vTexts;
+	scte35::CSpliceClass objCue;
+	objCue.SetFastPath(false);
+
+	for (const scte35::scte35Kernel::type& eKernel : eKernels) {
+		if (!CKernel::IsSupported(eKernel)) {
+			Check(!CKernel::SetKernel(eKernel) && CKernel::GetKernel() != eKernel, "SetKernel refuses a kernel this CPU does not run");
+			continue;
+		}
+		Check(CKernel::SetKernel(eKernel) && CKernel::GetKernel() == eKernel, "SetKernel selects a kernel this CPU runs");
+		const bool bFirst = vTexts.empty();
+
+		for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+			const char* sName = scte35::g_SpliceCorpus[k].sName;
+			const std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+
+			//PackBits over the whole cue
+			std::string sBits;
+			for (const uint8_t& uByte : vBytes) {
+				for (int b = 7;b >= 0;b--) {
+					sBits += ((uByte >> b) & 1) ? '1' : '0';
+				}
+			}
+			std::vector<uint8_t> vPacked(vBytes.size());
+			Check(CKernel::PackBits(sBits.data(), sBits.length(), vPacked.data()) && vPacked == vBytes, "PackBits packs the bits of a cue", sName);
+			sBits[sBits.length() / 2] = 'x';
+			Check(!CKernel::PackBits(sBits.data(), sBits.length(), vPacked.data()), "PackBits refuses a character other than '0' and '1'", sName);
+
+			//Header against the table decode, field by field
+			scte35::SInfoData objKernel;
+			scte35::SInfoData objTable;
+			std::size_t iBits = 0;
+			CKernel::ExtractInfoHeader(vBytes.data(), objKernel);
+			Check(scte35::CSpliceLayout<scte35::SInfoHeaderLayout>::Decode(vBytes.data(), vBytes.size(), objTable, iBits) && iBits == CKernel::iInfoHeaderBytes * 8, "splice_info_section header decodes", sName);
+			const char* sField = GetFieldMismatch<scte35::SInfoHeaderLayout>(objKernel, objTable, std::make_index_sequence<scte35::CSpliceLayout<scte35::SInfoHeaderLayout>::iFieldCount>());
+			Check(sField == nullptr, "ExtractInfoHeader equals the layout decode", sField != nullptr ? sField : sName);
+
+			if (objTable.splice_command_type == scte35::scte35Cmd::splice_insert) {
+				CheckFlagCluster<scte35::SpliceInsertLayout>(CKernel::ExtractInsertFlags, vBytes.data() + CKernel::iInfoHeaderBytes, (std::size_t)CKernel::iInsertFlagsBytes, "ExtractInsertFlags equals the layout decode", sName);
+			}
+
+			//Whole parse, the text must not depend on the kernel
+			const bool bParsed = objCue.ParseHexa(scte35::g_SpliceCorpus[k].sHexa);
+			const std::string sText = bParsed ? objCue.GetText(true) : std::string("failed");
+			if (bFirst) {
+				vTexts.push_back(sText);
+			}
+			else {
+				Check(vTexts[k] == sText, "the parse text does not depend on the kernel", sName);
+			}
+		}
+
+		//Every cancel and flag byte of the clusters, under changing identifiers and event ids
+		uint8_t uInsert[CKernel::iInsertFlagsBytes] = { 0x48, 0x00, 0x00, 0x3F, 0x00, 0x00 };
+		uint8_t uSegmentation[CKernel::iSegmentationFlagsBytes] = { 0x02, 0x1C, 0x43, 0x55, 0x45, 0x49, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00 };
+		for (int i = 0;i < 0x10000;i++) {
+			uInsert[4] = (uint8_t)(i >> 8);
+			uInsert[5] = (uint8_t)i;
+			uInsert[1] = (uint8_t)(i * 7);
+			uSegmentation[10] = (uint8_t)(i >> 8);
+			uSegmentation[11] = (uint8_t)i;
+			uSegmentation[7] = (uint8_t)(i * 13);
+			CheckFlagCluster<scte35::SpliceInsertLayout>(CKernel::ExtractInsertFlags, uInsert, sizeof(uInsert), "ExtractInsertFlags equals the layout decode", "flag bytes");
+			CheckFlagCluster<scte35::SegmentationDescriptorLayout>(CKernel::ExtractSegmentationFlags, uSegmentation, sizeof(uSegmentation), "ExtractSegmentationFlags equals the layout decode", "flag bytes");
+		}
+	}
+
+	CKernel::SetKernel(eStart);
+	Check(CKernel::GetKernel() == eStart, "the start-up kernel is restored");
+}
+
+#ifdef SCTE35_ENABLE_PROFILING
+/*! \brief Checks of the CSpliceClass stage histograms after parsing corpus cues on the fast path and on the general path (profiling builds).
+*/
+void CheckProfiler() {
+	typedef scte35::scte35Stage S;
+	scte35::CSpliceClass objCue;
+	std::size_t iFast = 0;
+	std::size_t iGeneral = 0;
+
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		const char* sName = scte35::g_SpliceCorpus[k].sName;
+		for (int iFastPath = 0;iFastPath < 2;iFastPath++) {
+			objCue.SetFastPath(iFastPath == 1);
+			objCue.ResetProfiler();
+			const uint64_t uHits = objCue.GetFastPathHits();
+			const bool bParsed = objCue.ParseHexa(scte35::g_SpliceCorpus[k].sHexa);
+			const bool bFast = objCue.GetFastPathHits() != uHits;
+			if (bParsed) {
+				objCue.GetText(true);
+			}
+
+			const scte35::CSpliceProfiler& objProfiler = objCue.GetProfiler();
+			uint64_t uCounts[S::count];
+			for (int i = 0;i < S::count;i++) {
+				uCounts[i] = objProfiler.GetStage((S::type)i).GetCount();
+			}
+			Check(uCounts[S::fast_path] == (uint64_t)iFastPath, "one fast_path sample per fast path attempt", sName);
+			Check(uCounts[S::text_generation] == (bParsed ? 1u : 0u), "one text_generation sample per GetText", sName);
+			if (bFast) {
+				iFast++;
+				Check(uCounts[S::input_decode] == 0 && uCounts[S::sinfo_first] == 0 && uCounts[S::command_type] == 0 && uCounts[S::sinfo_second] == 0 && uCounts[S::splice_descriptor] == 0, "a fast path cue skips the general path stages", sName);
+			}
+			else if (bParsed) {
+				iGeneral++;
+				Check(uCounts[S::input_decode] >= 1 && uCounts[S::sinfo_first] == 1 && uCounts[S::command_type] == 1 && uCounts[S::sinfo_second] == 1, "a general path cue times each of its stages once", sName);
+			}
+		}
+	}
+	Check(iFast > 0 && iGeneral > 0, "the corpus runs both the fast path and the general path");
+	Check(objCue.GetProfiler().GetText(true).find("stage=fast_path") != std::string::npos, "the profiler text names the fast_path stage");
+}
+#endif
+
+/*! \brief Checks of the CSpliceMetrics counters and of their Prometheus rendering after parsed, failed and unsupported-descriptor cues.
+*/
+void CheckMetrics() {
+	scte35::CSpliceMetrics objMetrics(2);
+	scte35::CSpliceClass objCue;
+	objCue.SetMetrics(&objMetrics);
+
+	//Expected counters, computed from the bytes and the descriptors each parse returns
+	std::map<uint32_t, uint64_t> mapParsed;
+	std::map<uint32_t, uint64_t> mapDescriptors;
+	std::map<uint32_t, uint64_t> mapUnsupported;
+	uint64_t uCRCMismatches = 0;
+	for (int iFastPath = 0;iFastPath < 2;iFastPath++) {
+		objCue.SetFastPath(iFastPath == 1);
+		for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+			const char* sName = scte35::g_SpliceCorpus[k].sName;
+			const std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+			if (!objCue.ParseHexa(scte35::g_SpliceCorpus[k].sHexa)) {
+				Check(false, "corpus cue parses with metrics attached", sName);
+				continue;
+			}
+			mapParsed[vBytes[13]]++;
+			for (const scte35::SDBase* pDescriptor : objCue.GetDescriptors()) {
+				(scte35::CSpliceClass::IsBuiltInDescriptor(*pDescriptor) ? mapDescriptors : mapUnsupported)[pDescriptor->splice_descriptor_tag]++;
+			}
+			uCRCMismatches += scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size() - 4) != GetStoredCRC(vBytes) ? 1 : 0;
+		}
+	}
+	Check(!mapUnsupported.empty(), "the corpus holds unsupported descriptors");
+
+	//A section failing after its descriptor loop was read counts neither its descriptors nor a parsed cue
+	const std::string sPrivate = scte35::g_SpliceCorpus[12].sHexa;
+	Check(!objCue.ParseHexa(sPrivate.substr(0, sPrivate.length() - 8)), "time_signal_private_descriptors without CRC_32 fails");
+	const scte35::scte35Error::type eError = objCue.GetLastError();
+	const scte35::scte35Field::type eField = objCue.GetLastErrorField();
+	Check(eError != scte35::scte35Error::none, "a failed parse reports its reason");
+	Check(!objCue.ParseHexa(sPrivate.substr(0, sPrivate.length() - 8)), "time_signal_private_descriptors without CRC_32 fails again");
+	Check(!objCue.ParseHexa(""), "an empty cue fails");
+
+	for (uint32_t i = 0;i < 256;i++) {
+		Check(objMetrics.GetParsed(i) == (mapParsed.count(i) ? mapParsed[i] : 0), "parsed cues per splice_command_type");
+		Check(objMetrics.GetDescriptors(i) == (mapDescriptors.count(i) ? mapDescriptors[i] : 0), "parsed descriptors per tag");
+		Check(objMetrics.GetUnsupportedDescriptors(i) == (mapUnsupported.count(i) ? mapUnsupported[i] : 0), "unsupported descriptors per tag, parsed cues only");
+	}
+	Check(objMetrics.GetFailures(eError, eField) == 2, "failures per reason and structure");
+	Check(objMetrics.GetFailures(scte35::scte35Error::empty_input, scte35::scte35Field::input) == 1, "empty input failure");
+	Check(objMetrics.GetCRCMismatches() == uCRCMismatches, "CRC_32 mismatches");
+
+	//Prometheus text : every non-zero labelled counter once, nothing else labelled
+	const std::string sText = objMetrics.GetPrometheusText();
+	std::vector<std::string> vExpected;
+	char sLine[256];
+	for (const auto& objPair : mapParsed) {
+		std::snprintf(sLine, sizeof(sLine), "scte35_cues_parsed_total{splice_command_type=\"%u\"} %llu\n", objPair.first, (unsigned long long)objPair.second);
+		vExpected.push_back(sLine);
+	}
+	for (const auto& objPair : mapDescriptors) {
+		std::snprintf(sLine, sizeof(sLine), "scte35_descriptors_parsed_total{splice_descriptor_tag=\"%u\"} %llu\n", objPair.first, (unsigned long long)objPair.second);
+		vExpected.push_back(sLine);
+	}
+	for (const auto& objPair : mapUnsupported) {
+		std::snprintf(sLine, sizeof(sLine), "scte35_unsupported_descriptors_total{splice_descriptor_tag=\"%u\"} %llu\n", objPair.first, (unsigned long long)objPair.second);
+		vExpected.push_back(sLine);
+	}
+	std::snprintf(sLine, sizeof(sLine), "scte35_parse_failures_total{reason=\"%s\",field=\"%s\"} 2\n", scte35::CSpliceMetrics::GetErrorName(eError), scte35::CSpliceMetrics::GetFieldName(eField));
+	vExpected.push_back(sLine);
+	std::snprintf(sLine, sizeof(sLine), "scte35_parse_failures_total{reason=\"%s\",field=\"%s\"} 1\n", scte35::CSpliceMetrics::GetErrorName(scte35::scte35Error::empty_input), scte35::CSpliceMetrics::GetFieldName(scte35::scte35Field::input));
+	vExpected.push_back(sLine);
+	std::snprintf(sLine, sizeof(sLine), "scte35_crc_mismatches_total %llu\n", (unsigned long long)uCRCMismatches);
+	vExpected.push_back(sLine);
+
+	std::size_t iLabelled = 0;
+	for (std::size_t i = 0;i < sText.length();i = sText.find('\n', i) + 1) {
+		iLabelled += (sText[i] != '#' && sText.find('{', i) < sText.find('\n', i)) ? 1 : 0;
+	}
+	for (const std::string& sExpected : vExpected) {
+		Check(sText.find(sExpected) != std::string::npos, "Prometheus text holds the counter", sExpected.c_str());
+	}
+	Check(iLabelled == vExpected.size() - 1, "Prometheus text has no other labelled counter");
+	Check(sText.find("# TYPE scte35_unsupported_descriptors_total counter\n") != std::string::npos, "Prometheus text types the counters");
+
+	//Truncated rendering, like snprintf
+	char sSmall[16];
+	Check(objMetrics.RenderPrometheus(sSmall, sizeof(sSmall)) == sText.length() && sText.compare(0, sizeof(sSmall) - 1, sSmall) == 0 && sSmall[sizeof(sSmall) - 1] == '\0', "RenderPrometheus truncates and terminates");
+	Check(objMetrics.RenderPrometheus(nullptr, 0) == sText.length(), "RenderPrometheus measures without a buffer");
+
+	objMetrics.ResetValue();
+	Check(objMetrics.GetCRCMismatches() == 0 && objMetrics.GetParsed(scte35::scte35Cmd::time_signal) == 0 && objMetrics.GetFailures(eError, eField) == 0, "ResetValue clears the counters");
+}
+
+/*! \brief Function to make a segmentation_descriptor for CSegmentationTracker::Update.
+*/
+scte35::SegmentationDescriptor MakeSegmentation(const uint32_t& uEventId, const uint32_t& uTypeId, const uint32_t& uCancel = 0, const uint64_t& uDuration = 0, const uint32_t& uSegmentNum = 0) {
+	scte35::SegmentationDescriptor objDesc;
+	objDesc.segmentation_event_id = uEventId;
+	objDesc.segmentation_event_cancel_indicator = uCancel;
+	objDesc.segmentation_type_id = uTypeId;
+	objDesc.segmentation_duration_flag = uDuration != 0 ? 1 : 0;
+	objDesc.segmentation_duration = uDuration;
+	objDesc.segment_num = uSegmentNum;
+	objDesc.segments_expected = 2;
+	return objDesc;
+}
+
+/*! \brief Checks of the CSegmentationTracker type pairs and of the opened, closed, cancelled and orphaned events it reports.
+*/
+void CheckSegmentationTracker() {
+	typedef scte35::CSegmentationTracker CTracker;
+	typedef scte35::scte35SegEvent E;
+
+	//Every start/end pair of the segmentation type table
+	const uint32_t uPairs[][2] = {
+		{ 0x10, 0x11 }, { 0x17, 0x11 }, { 0x19, 0x11 }, { 0x10, 0x12 }, { 0x19, 0x12 }, { 0x13, 0x14 },
+		{ 0x20, 0x21 }, { 0x22, 0x23 }, { 0x24, 0x25 }, { 0x26, 0x27 },
+		{ 0x30, 0x31 }, { 0x32, 0x33 }, { 0x34, 0x35 }, { 0x36, 0x37 }, { 0x38, 0x39 }, { 0x3A, 0x3B }, { 0x3C, 0x3D }, { 0x3E, 0x3F },
+		{ 0x40, 0x41 }, { 0x42, 0x43 }, { 0x44, 0x45 }, { 0x46, 0x47 }, { 0x50, 0x51 } };
+	for (const auto& uPair : uPairs) {
+		Check(CTracker::IsStartType(uPair[0]) && !CTracker::IsEndType(uPair[0]), "start segmentation_type_id");
+		Check(CTracker::IsEndType(uPair[1]) && !CTracker::IsStartType(uPair[1]), "end segmentation_type_id");
+		Check(CTracker::IsPair(uPair[0], uPair[1]), "start and end segmentation_type_id pair");
+	}
+	Check(!CTracker::IsPair(0x3C, 0x3F) && !CTracker::IsPair(0x44, 0x47) && !CTracker::IsPair(0x17, 0x12) && !CTracker::IsPair(0x3D, 0x3E), "types of different segments do not pair");
+	const uint32_t uUnpaired[] = { 0x00, 0x01, 0x02, 0x15, 0x16, 0x18 };
+	for (const uint32_t& uTypeId : uUnpaired) {
+		Check(!CTracker::IsStartType(uTypeId) && !CTracker::IsEndType(uTypeId), "unpaired segmentation_type_id");
+	}
+
+	CTracker objTracker(4);
+	std::vector<scte35::SSegmentationEvent> vEvents;
+
+	//Open, repeated start, close, repeated end
+	Check(objTracker.Update(MakeSegmentation(1, 0x3C, 0, 0, 1), true, 1000, vEvents) == 1 && vEvents.back().eKind == E::opened && vEvents.back().start_type_id == 0x3C && vEvents.back().uStartPts == 1000, "a start opens its event");
+	Check(objTracker.GetOpenCount() == 1 && objTracker.FindOpen(1) != nullptr, "the opened event is open");
+	Check(objTracker.Update(MakeSegmentation(1, 0x3C, 0, 0, 2), true, 2000, vEvents) == 0 && objTracker.FindOpen(1)->segment_num == 2, "a repeated start only moves segment_num");
+	Check(objTracker.Update(MakeSegmentation(1, 0x3D), true, 3000, vEvents) == 1 && vEvents.back().eKind == E::closed && vEvents.back().end_type_id == 0x3D && vEvents.back().uEndPts == 3000, "the paired end closes the event");
+	Check(objTracker.GetOpenCount() == 0 && objTracker.FindOpen(1) == nullptr, "the closed event is not open");
+	Check(objTracker.Update(MakeSegmentation(1, 0x3D), true, 3000, vEvents) == 0, "a repeated end reports nothing");
+	Check(objTracker.Update(MakeSegmentation(1, 0x3C), true, 1000, vEvents) == 0, "a late repeat of the start of a closed event reports nothing");
+
+	//Cancel
+	Check(objTracker.Update(MakeSegmentation(2, 0x44), true, 4000, vEvents) == 1, "Provider Ad Block Start opens");
+	Check(objTracker.Update(MakeSegmentation(2, 0x00, 1), true, 5000, vEvents) == 1 && vEvents.back().eKind == E::cancelled && vEvents.back().start_type_id == 0x44 && vEvents.back().end_type_id == 0 && vEvents.back().uEndPts == 5000, "the cancel indicator cancels the open event");
+	Check(objTracker.Update(MakeSegmentation(2, 0x00, 1), true, 5000, vEvents) == 0 && objTracker.GetOpenCount() == 0, "a repeated cancel reports nothing");
+	Check(objTracker.Update(MakeSegmentation(9, 0x00, 1), true, 5000, vEvents) == 0, "cancelling an unknown event reports nothing");
+
+	//Orphaned ends : no start, or a start of another segment
+	Check(objTracker.Update(MakeSegmentation(3, 0x47), true, 6000, vEvents) == 1 && vEvents.back().eKind == E::orphaned && vEvents.back().start_type_id == 0 && vEvents.back().end_type_id == 0x47, "an end without start is orphaned");
+	Check(objTracker.Update(MakeSegmentation(3, 0x47), true, 6000, vEvents) == 0, "a repeated orphaned end is reported once");
+	Check(objTracker.Update(MakeSegmentation(4, 0x3E), true, 7000, vEvents) == 1, "Distributor Promo Start opens");
+	Check(objTracker.Update(MakeSegmentation(4, 0x3D), true, 7500, vEvents) == 1 && vEvents.back().eKind == E::orphaned && vEvents.back().end_type_id == 0x3D && objTracker.FindOpen(4) != nullptr, "an end of another segment is orphaned and leaves the start open");
+	Check(objTracker.Update(MakeSegmentation(4, 0x3F), true, 8000, vEvents) == 1 && vEvents.back().eKind == E::closed, "Distributor Promo End closes");
+
+	//A start of another type reusing an open segmentation_event_id
+	Check(objTracker.Update(MakeSegmentation(5, 0x46), true, 9000, vEvents) == 1, "Distributor Ad Block Start opens");
+	vEvents.clear();
+	Check(objTracker.Update(MakeSegmentation(5, 0x3C), true, 9500, vEvents) == 2, "a start reusing an open id orphans the previous start");
+	Check(vEvents.size() == 2 && vEvents[0].eKind == E::orphaned && vEvents[0].start_type_id == 0x46 && vEvents[0].uEndPts == 9500 && vEvents[1].eKind == E::opened && vEvents[1].start_type_id == 0x3C, "orphaned start then opened start");
+	Check(objTracker.GetOpenCount() == 1 && objTracker.FindOpen(5)->start_type_id == 0x3C, "the reused id is open once");
+	Check(objTracker.Update(MakeSegmentation(5, 0x3D), true, 9900, vEvents) == 1 && objTracker.GetOpenCount() == 0, "the new start closes with its own end");
+
+	//Expire across the 33-bit wrap : start 900 ticks before the wrap, 900 ticks long, 1000 ticks of grace
+	objTracker.ResetValue();
+	vEvents.clear();
+	const uint64_t uWrap = 0x200000000ULL;
+	Check(objTracker.Update(MakeSegmentation(6, 0x44, 0, 900), true, uWrap - 900, vEvents) == 1, "a start with duration before the wrap opens");
+	Check(objTracker.Update(MakeSegmentation(7, 0x46), true, uWrap - 900, vEvents) == 1, "a start without duration opens");
+	Check(objTracker.Update(MakeSegmentation(8, 0x3E), true, uWrap - 100, vEvents) == 1 && objTracker.Update(MakeSegmentation(8, 0x3F), true, uWrap - 100, vEvents) == 1, "an event closes before the wrap");
+	vEvents.clear();
+	Check(objTracker.Expire(uWrap - 1000, 1000, vEvents) == 0 && objTracker.GetOpenCount() == 2, "a time before the start expires nothing");
+	Check(objTracker.Update(MakeSegmentation(8, 0x3F), true, uWrap - 100, vEvents) == 0, "the closed event is remembered within its grace");
+	Check(objTracker.Expire(1000, 1000, vEvents) == 0 && objTracker.GetOpenCount() == 2, "a duration within its grace after the wrap is kept");
+	Check(objTracker.Expire(1001, 1000, vEvents) == 1 && vEvents.back().eKind == E::orphaned && vEvents.back().segmentation_event_id == 6 && vEvents.back().uEndPts == 1001, "an elapsed duration after the wrap orphans the start");
+	Check(objTracker.GetOpenCount() == 1 && objTracker.FindOpen(6) == nullptr && objTracker.FindOpen(7) != nullptr, "an open event without duration is kept");
+	Check(objTracker.Update(MakeSegmentation(8, 0x3F), true, 1001, vEvents) == 1 && vEvents.back().eKind == E::orphaned, "a closed event is forgotten after its grace");
+	std::vector<scte35::SSegmentationEvent> vOpen;
+	objTracker.GetOpenEvents(vOpen);
+	Check(vOpen.size() == 1 && vOpen[0].segmentation_event_id == 7, "GetOpenEvents lists the open events");
+}
+
+/*! \brief Function to get the CSpliceCache shard of a hexa-decimal input : FNV-1a over encoding, length and the last 64 characters,
+*	high half of the key modulo the shard count (recomputed here so the eviction checks know which cues share a shard).
+*/
+std::size_t GetCacheShard(const std::string& sInput, const std::size_t& iShardCount) {
+	uint64_t uHash = 0xcbf29ce484222325ULL;
+	const uint64_t uHeader = ((uint64_t)scte35::scte35Input::hexa << 56) ^ (uint64_t)sInput.length();
+	for (int i = 0;i < 8;i++) {
+		uHash = (uHash ^ ((uHeader >> (i * 8)) & 0xff)) * 0x100000001b3ULL;
+	}
+	for (std::size_t i = sInput.length() > 64 ? sInput.length() - 64 : 0;i < sInput.length();i++) {
+		uHash = (uHash ^ (unsigned char)sInput[i]) * 0x100000001b3ULL;
+	}
+	return (std::size_t)((uHash >> 32) % iShardCount);
+}
+
+/*! \brief Checks of CSpliceCache hits, failed parses, LRU eviction per shard and the disabled cache.
+*/
+void CheckCache() {
+	//A hit returns the very same parsed cue, other encodings and other inputs are separate entries
+	{
+		scte35::CSpliceCache objCache(64);
+		const std::string sHexa = scte35::g_SpliceCorpus[0].sHexa;
+		scte35::CSpliceCache::ResultPtr pFirst = objCache.ParseHexa(sHexa);
+		scte35::CSpliceCache::ResultPtr pSecond = objCache.ParseHexa(sHexa);
+		Check(pFirst != nullptr && pFirst.get() == pSecond.get(), "a cache hit returns the same shared cue");
+		Check(objCache.GetHits() == 1 && objCache.GetMisses() == 1 && objCache.GetSize() == 1, "one miss then one hit");
+
+		std::string sBits;
+		for (const uint8_t& uByte : GetBytes(scte35::g_SpliceCorpus[0])) {
+			for (int b = 7;b >= 0;b--) {
+				sBits += ((uByte >> b) & 1) ? '1' : '0';
+			}
+		}
+		scte35::CSpliceCache::ResultPtr pBinary = objCache.ParseBinary(sBits);
+		Check(pBinary != nullptr && pBinary.get() != pFirst.get() && pBinary->GetText(true) == pFirst->GetText(true), "the same cue in another encoding is another entry");
+		std::string sLower = sHexa;
+		std::transform(sLower.begin(), sLower.end(), sLower.begin(), [](const char& c) { return (char)std::tolower((unsigned char)c); });
+		Check(objCache.ParseHexa(sLower).get() != pFirst.get() && objCache.GetSize() == 3, "lower case hexa is another entry");
+
+		//Failed parses are not cached, every call parses again
+		const std::string sTruncated = sHexa.substr(0, 20);
+		Check(objCache.ParseHexa(sTruncated) == nullptr && objCache.ParseHexa(sTruncated) == nullptr, "a failed parse returns nullptr");
+		Check(objCache.GetSize() == 3 && objCache.GetMisses() == 5 && objCache.GetHits() == 1, "a failed parse is not cached");
+
+		objCache.ResetValue();
+		Check(objCache.GetSize() == 0 && objCache.GetHits() == 0 && objCache.GetMisses() == 0 && pFirst->GetSInfoData().splice_command_type == scte35::scte35Cmd::time_signal, "ResetValue drops the entries, returned cues stay valid");
+		Check(objCache.ParseHexa(sHexa).get() != pFirst.get(), "a dropped cue parses again");
+	}
+
+	//Least recently used first, a hit refreshes the entry (8 cues per shard, one shard)
+	{
+		scte35::CSpliceCache objCache(8);
+		std::vector<std::string> vCues;
+		std::vector<scte35::CSpliceCache::ResultPtr> vResults;
+		for (uint64_t i = 0;i < 9;i++) {
+			vCues.push_back(MakeTimeSignal(1000 + i));
+		}
+		for (std::size_t i = 0;i < 8;i++) {
+			vResults.push_back(objCache.ParseHexa(vCues[i]));
+		}
+		Check(objCache.ParseHexa(vCues[0]).get() == vResults[0].get(), "the oldest cue is a hit before eviction");
+		objCache.ParseHexa(vCues[8]);
+		Check(objCache.GetSize() == 8, "the cache keeps its capacity");
+		const uint64_t uHits = objCache.GetHits();
+		Check(objCache.ParseHexa(vCues[0]).get() == vResults[0].get(), "a refreshed cue is kept");
+		for (std::size_t i = 2;i <= 8;i++) {
+			objCache.ParseHexa(vCues[i]);
+		}
+		Check(objCache.GetHits() == uHits + 8, "the 8 most recently used cues are hits");
+		Check(objCache.ParseHexa(vCues[1]).get() != vResults[1].get() && objCache.GetHits() == uHits + 8, "the least recently used cue was evicted");
+	}
+
+	//Capacity is per shard : each shard keeps its own 8 most recent cues whatever the other shard holds
+	{
+		const std::size_t iShards = 2;
+		scte35::CSpliceCache objCache(16, iShards);
+		std::vector<std::string> vCues;
+		for (uint64_t i = 0;i < 48;i++) {
+			vCues.push_back(MakeTimeSignal(50000 + i * 7));
+			objCache.ParseHexa(vCues.back());
+		}
+		std::vector<std::size_t> vKept(iShards, 0);
+		std::vector<std::string> vEvicted;
+		std::vector<std::string> vPresent;
+		for (std::size_t i = vCues.size();i-- > 0;) {
+			std::size_t& iKept = vKept[GetCacheShard(vCues[i], iShards)];
+			(iKept < 8 ? vPresent : vEvicted).push_back(vCues[i]);
+			iKept++;
+		}
+		Check(vKept[0] > 8 && vKept[1] > 8, "both shards overflowed");
+		Check(objCache.GetSize() == 16, "each shard holds its capacity");
+		const uint64_t uHits = objCache.GetHits();
+		for (const std::string& sCue : vPresent) {
+			objCache.ParseHexa(sCue);
+		}
+		Check(objCache.GetHits() == uHits + vPresent.size(), "the most recent cues of each shard are hits");
+		const uint64_t uMisses = objCache.GetMisses();
+		for (const std::string& sCue : vEvicted) {
+			objCache.ParseHexa(sCue);
+		}
+		Check(objCache.GetMisses() == uMisses + vEvicted.size() && objCache.GetSize() == 16, "the older cues of each shard were evicted");
+	}
+
+	//Capacity 0 disables the cache
+	{
+		scte35::CSpliceCache objCache(0);
+		const std::string sHexa = scte35::g_SpliceCorpus[1].sHexa;
+		scte35::CSpliceCache::ResultPtr pFirst = objCache.ParseHexa(sHexa);
+		scte35::CSpliceCache::ResultPtr pSecond = objCache.ParseHexa(sHexa);
+		Check(pFirst != nullptr && pSecond != nullptr && pFirst.get() != pSecond.get(), "a disabled cache parses every call");
+		Check(objCache.GetSize() == 0 && objCache.GetHits() == 0, "a disabled cache holds nothing");
+	}
+}
+
+/*! \brief Function to parse a time_signal cue with a pts_time and a pts_adjustment.
+*/
+std::shared_ptr<const scte35::CSpliceClass> MakeAdjustedCue(const uint64_t& uPts, const uint64_t& uAdjustment) {
+	std::vector<uint8_t> vBytes = MakeTimeSignalBytes(uPts);
+	vBytes[4] = (uint8_t)((vBytes[4] & 0xFE) | ((uAdjustment >> 32) & 0x01));
+	for (int i = 0;i < 4;i++) {
+		vBytes[5 + i] = (uint8_t)(uAdjustment >> (24 - 8 * i));
+	}
+	const uint32_t uCrc = scte35::CSpliceCRC::Compute(vBytes.data(), vBytes.size() - 4);
+	for (int i = 0;i < 4;i++) {
+		vBytes[vBytes.size() - 4 + i] = (uint8_t)(uCrc >> (24 - 8 * i));
+	}
+	std::string sHexa;
+	scte35::CSpliceProjection::BytesToHexa(vBytes.data(), vBytes.size(), sHexa);
+	std::shared_ptr<scte35::CSpliceClass> pCue = std::make_shared<scte35::CSpliceClass>();
+	Check(pCue->ParseHexa(sHexa), "adjusted time_signal parses");
+	return pCue;
+}
+
+/*! \brief Checks of the pts_adjustment addition, of CPtsUnwrapper across the 33-bit wrap and of the per-channel range index of CSpliceTimeline.
+*/
+void CheckTimeline() {
+	typedef scte35::CSpliceTimeline CTimeline;
+	const uint64_t uWrap = CTimeline::uPtsMask + 1;
+
+	//pts_time plus pts_adjustment modulo 2^33
+	Check(CTimeline::AddPts(uWrap - 10, 20) == 10 && CTimeline::AddPts(CTimeline::uPtsMask, 1) == 0 && CTimeline::AddPts(5, CTimeline::uPtsMask) == 4 && CTimeline::AddPts(100, 0) == 100, "AddPts wraps modulo 2^33");
+	const uint64_t uCases[][2] = { { 1000, 0 }, { uWrap - 100, 300 }, { 300, uWrap - 100 }, { CTimeline::uPtsMask, CTimeline::uPtsMask }, { 0x123456789ULL, 0x0ABCDEF01ULL } };
+	for (const auto& uCase : uCases) {
+		uint64_t uPts = 0;
+		std::shared_ptr<const scte35::CSpliceClass> pCue = MakeAdjustedCue(uCase[0], uCase[1]);
+		Check(pCue->GetSInfoData().pts_adjustment == uCase[1] && CTimeline::GetCuePts(*pCue, uPts) && uPts == ((uCase[0] + uCase[1]) % uWrap), "GetCuePts adds pts_adjustment modulo 2^33");
+	}
+	{
+		scte35::CSpliceClass objCue;
+		uint64_t uPts = 0;
+		Check(objCue.ParseHexa(scte35::g_SpliceCorpus[10].sHexa) && !CTimeline::GetCuePts(objCue, uPts), "a private_command carries no splice time");
+	}
+
+	//Unwrapping : forward wraps add 2^33, late values stay before the last one
+	{
+		scte35::CPtsUnwrapper objUnwrapper;
+		Check(!objUnwrapper.HasValue() && objUnwrapper.GetNearest(77) == 77, "GetNearest without value is the value itself");
+		Check(objUnwrapper.Unwrap(uWrap - 1000) == (int64_t)(uWrap - 1000) && objUnwrapper.HasValue(), "the first value is placed at itself");
+		Check(objUnwrapper.Unwrap(500) == (int64_t)(uWrap + 500), "a value after the wrap is placed after it");
+		Check(objUnwrapper.Unwrap(uWrap - 2000) == (int64_t)(uWrap - 2000), "a late value before the wrap stays before it");
+		Check(objUnwrapper.Unwrap(1000) == (int64_t)(uWrap + 1000), "the clock goes on after a late value");
+		Check(objUnwrapper.GetNearest(uWrap - 10) == (int64_t)(uWrap - 10) && objUnwrapper.GetLast() == (int64_t)(uWrap + 1000), "GetNearest does not place the value");
+		Check(objUnwrapper.Unwrap(uWrap + 1234) == (int64_t)(uWrap + 1234), "upper bits are ignored");
+
+		//Several wraps in steps below 2^32
+		int64_t iExpected = (int64_t)(uWrap + 1234);
+		uint64_t uPts = 1234;
+		bool bPlaced = true;
+		for (int i = 0;i < 12;i++) {
+			uPts = (uPts + 0xC0000000ULL) & CTimeline::uPtsMask;
+			iExpected += 0xC0000000LL;
+			bPlaced = bPlaced && objUnwrapper.Unwrap(uPts) == iExpected;
+		}
+		Check(bPlaced && iExpected > (int64_t)(4 * uWrap), "every step of several wraps is placed forward");
+		bPlaced = true;
+		for (int i = 0;i < 12;i++) {
+			uPts = (uPts - 0xC0000000ULL) & CTimeline::uPtsMask;
+			iExpected -= 0xC0000000LL;
+			bPlaced = bPlaced && objUnwrapper.Unwrap(uPts) == iExpected;
+		}
+		Check(bPlaced, "every step back across the wraps is placed backward");
+
+		objUnwrapper.ResetValue();
+		Check(!objUnwrapper.HasValue() && objUnwrapper.Unwrap(42) == 42, "ResetValue forgets the clock");
+	}
+
+	//Per-channel range index : channel 1 crosses the wrap, channel 2 has an unrelated clock, late cues are merged by the next query
+	{
+		CTimeline objTimeline(2);
+		std::vector<int64_t> vTimes1;
+		for (uint64_t i = 0;i < 20;i++) {
+			vTimes1.push_back(objTimeline.Add(1, (uWrap - 45000 + i * 4500) & CTimeline::uPtsMask, nullptr));
+			objTimeline.Add(2, 1000 + i * 10, nullptr);
+		}
+		for (std::size_t i = 1;i < vTimes1.size();i++) {
+			Check(vTimes1[i] == vTimes1[i - 1] + 4500, "channel 1 times keep increasing across the wrap");
+		}
+		std::shared_ptr<const scte35::CSpliceClass> pLate = MakeAdjustedCue(uWrap - 40000, 0);
+		std::shared_ptr<const scte35::CSpliceClass> pSame = MakeAdjustedCue(uWrap - 40000, 0);
+		int64_t iLate = 0;
+		int64_t iSame = 0;
+		Check(objTimeline.Add(1, pLate, iLate) && iLate == (int64_t)(uWrap - 40000) && objTimeline.Add(1, pSame, iSame) && iSame == iLate, "late cues are placed before the wrap");
+		Check(objTimeline.GetChannelCount() == 2, "two channels");
+
+		std::vector<scte35::STimelineEntry> vEntries;
+		Check(objTimeline.Query(1, (int64_t)(uWrap - 45000), (int64_t)(uWrap - 36000), vEntries) == 5, "channel 1 range holds its entries only");
+		Check(vEntries.size() == 5 && vEntries[0].iTime == (int64_t)(uWrap - 45000) && vEntries[1].iTime == (int64_t)(uWrap - 40500) && vEntries[2].pCue == pLate && vEntries[3].pCue == pSame && vEntries[4].iTime == (int64_t)(uWrap - 36000), "range in time order, same time in arrival order");
+		vEntries.clear();
+		Check(objTimeline.Query(1, (int64_t)uWrap, (int64_t)uWrap + 4500, vEntries) == 2 && vEntries[0].iTime == (int64_t)uWrap, "range after the wrap");
+		vEntries.clear();
+		Check(objTimeline.Query(2, 1000, 1050, vEntries) == 6 && vEntries.back().iTime == 1050, "channel 2 range holds its own entries");
+		vEntries.clear();
+		Check(objTimeline.Query(3, 0, (int64_t)(4 * uWrap), vEntries) == 0, "an unknown channel has no entry");
+
+		//Retention relative to the last value of each channel, the late cues moved it back so the stream time is placed again
+		Check(objTimeline.Unwrap(1, vTimes1.back() & CTimeline::uPtsMask) == vTimes1.back(), "the stream time is placed after the late cues");
+		Check(objTimeline.EraseOlderThan(9000) == 19, "EraseOlderThan keeps the last 9000 ticks of each channel");
+		vEntries.clear();
+		Check(objTimeline.Query(1, INT64_MIN, INT64_MAX, vEntries) == 3 && vEntries[0].iTime == vTimes1.back() - 9000, "channel 1 keeps its recent entries");
+		vEntries.clear();
+		Check(objTimeline.Query(2, INT64_MIN, INT64_MAX, vEntries) == 20, "channel 2 keeps its recent entries");
+	}
+
+	//Index alone : out of order adds, counts and erasure
+	{
+		scte35::CSpliceTimeIndex objIndex;
+		const int64_t iTimes[] = { 50, 10, 40, 10, 30, 20, 60 };
+		for (const int64_t& iTime : iTimes) {
+			objIndex.Add(iTime, nullptr);
+		}
+		std::vector<scte35::STimelineEntry> vEntries;
+		Check(objIndex.Query(0, 100, vEntries) == 7 && std::is_sorted(vEntries.begin(), vEntries.end(), [](const scte35::STimelineEntry& objA, const scte35::STimelineEntry& objB) { return objA.iTime < objB.iTime; }), "the index returns sorted entries");
+		Check(vEntries[0].uSequence < vEntries[1].uSequence, "same time keeps the insertion order");
+		Check(objIndex.Count(10, 30) == 4 && objIndex.Count(31, 39) == 0 && objIndex.Count(60, 60) == 1, "Count over inclusive ranges");
+		Check(objIndex.EraseBefore(30) == 3 && objIndex.GetSize() == 4 && objIndex.Count(0, 100) == 4, "EraseBefore drops the older entries");
+	}
+}
+
+/*! \brief Function to get the projection of every field of a cue from its full CSpliceClass parse.
+*/
+scte35::SSpliceProjection GetFullProjection(const scte35::CSpliceClass& objCue, std::vector<uint8_t>& vUpid) {
+	typedef scte35::scte35Projected P;
+	scte35::SSpliceProjection objFull;
+	const scte35::SInfoData& objInfo = objCue.GetSInfoData();
+	objFull.uFound = P::splice_command_type | P::pts_adjustment | P::tier | P::segmentation_count;
+	objFull.splice_command_type = objInfo.splice_command_type;
+	objFull.pts_adjustment = objInfo.pts_adjustment;
+	objFull.tier = objInfo.tier;
+
+	if (objInfo.splice_command_type == scte35::scte35Cmd::time_signal && objCue.GetTimeSignal().time_specified_flag == 1) {
+		objFull.uFound |= P::pts_time;
+		objFull.pts_time = objCue.GetTimeSignal().pts_time;
+	}
+	else if (objInfo.splice_command_type == scte35::scte35Cmd::splice_insert) {
+		const scte35::SpliceInsertData& objInsert = objCue.GetSpliceInsert();
+		objFull.uFound |= P::splice_event_id;
+		objFull.splice_event_id = objInsert.splice_event_id;
+		objFull.splice_event_cancel_indicator = objInsert.splice_event_cancel_indicator;
+		if (objInsert.splice_event_cancel_indicator == 0) {
+			objFull.uFound |= P::out_of_network_indicator;
+			objFull.out_of_network_indicator = objInsert.out_of_network_indicator;
+			objFull.splice_immediate_flag = objInsert.splice_immediate_flag;
+			if (objInsert.program_splice_flag == 1 && objInsert.splice_immediate_flag == 0 && objInsert.m_spliceT.time_specified_flag == 1) {
+				objFull.uFound |= P::pts_time;
+				objFull.pts_time = objInsert.m_spliceT.pts_time;
+			}
+			if (objInsert.duration_flag == 1) {
+				objFull.uFound |= P::break_duration;
+				objFull.auto_return = objInsert.m_breakD.auto_return;
+				objFull.duration = objInsert.m_breakD.duration;
+			}
+		}
+	}
+
+	for (const scte35::SDBase* pDescriptor : objCue.GetDescriptors()) {
+		if (pDescriptor->splice_descriptor_tag != scte35::scte35Desc::segmentation_descriptor || !scte35::CSpliceClass::IsBuiltInDescriptor(*pDescriptor)) {
+			continue;
+		}
+		if (objFull.segmentation_count++ != 0) {
+			continue;
+		}
+		const scte35::SegmentationDescriptor& objSegmentation = *static_cast<const scte35::SegmentationDescriptor*>(pDescriptor);
+		objFull.uFound |= P::segmentation_event_id;
+		objFull.segmentation_event_id = objSegmentation.segmentation_event_id;
+		objFull.segmentation_event_cancel_indicator = objSegmentation.segmentation_event_cancel_indicator;
+		if (objSegmentation.segmentation_event_cancel_indicator == 0) {
+			objFull.uFound |= P::segmentation_type_id | P::segmentation_upid | P::segment_num;
+			objFull.segmentation_type_id = objSegmentation.segmentation_type_id;
+			objFull.segmentation_upid_type = objSegmentation.segmentation_upid_type;
+			objFull.segmentation_upid_length = objSegmentation.segmentation_upid_length;
+			objFull.segment_num = objSegmentation.segment_num;
+			objFull.segments_expected = objSegmentation.segments_expected;
+			vUpid.assign(objSegmentation.v_upid_list.begin(), objSegmentation.v_upid_list.end());
+		}
+	}
+	return objFull;
+}
+
+/*! \brief Function to compare the fields a projection found with the full projection.
+*/
+bool IsSameProjection(const scte35::SSpliceProjection& objResult, const scte35::SSpliceProjection& objFull, const std::vector<uint8_t>& vUpid) {
+	typedef scte35::scte35Projected P;
+	bool bSame = true;
+	bSame = bSame && (!objResult.Has(P::splice_command_type) || objResult.splice_command_type == objFull.splice_command_type);
+	bSame = bSame && (!objResult.Has(P::pts_adjustment) || objResult.pts_adjustment == objFull.pts_adjustment);
+	bSame = bSame && (!objResult.Has(P::tier) || objResult.tier == objFull.tier);
+	bSame = bSame && (!objResult.Has(P::pts_time) || objResult.pts_time == objFull.pts_time);
+	bSame = bSame && (!objResult.Has(P::splice_event_id) || (objResult.splice_event_id == objFull.splice_event_id && objResult.splice_event_cancel_indicator == objFull.splice_event_cancel_indicator));
+	bSame = bSame && (!objResult.Has(P::out_of_network_indicator) || (objResult.out_of_network_indicator == objFull.out_of_network_indicator && objResult.splice_immediate_flag == objFull.splice_immediate_flag));
+	bSame = bSame && (!objResult.Has(P::break_duration) || (objResult.auto_return == objFull.auto_return && objResult.duration == objFull.duration));
+	bSame = bSame && (!objResult.Has(P::segmentation_event_id) || (objResult.segmentation_event_id == objFull.segmentation_event_id && objResult.segmentation_event_cancel_indicator == objFull.segmentation_event_cancel_indicator));
+	bSame = bSame && (!objResult.Has(P::segmentation_type_id) || objResult.segmentation_type_id == objFull.segmentation_type_id);
+	bSame = bSame && (!objResult.Has(P::segmentation_upid) || (objResult.segmentation_upid_type == objFull.segmentation_upid_type && objResult.segmentation_upid_length == objFull.segmentation_upid_length
+		&& objResult.segmentation_upid_length == vUpid.size() && std::equal(vUpid.begin(), vUpid.end(), objResult.pSegmentationUpid)));
+	bSame = bSame && (!objResult.Has(P::segment_num) || (objResult.segment_num == objFull.segment_num && objResult.segments_expected == objFull.segments_expected));
+	bSame = bSame && (!objResult.Has(P::segmentation_count) || objResult.segmentation_count == objFull.segmentation_count);
+	return bSame;
+}
+
+/*! \brief Checks of CSpliceProjection under every field mask against the full CSpliceClass parse of the corpus.
+*/
+void CheckProjection() {
+	scte35::CSpliceClass objCue;
+	scte35::CSpliceProjection objProjection;
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		const char* sName = scte35::g_SpliceCorpus[k].sName;
+		const std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+		if (!objCue.ParseHexa(scte35::g_SpliceCorpus[k].sHexa)) {
+			Check(false, "corpus cue parses", sName);
+			continue;
+		}
+		std::vector<uint8_t> vUpid;
+		const scte35::SSpliceProjection objFull = GetFullProjection(objCue, vUpid);
+
+		//Every mask : exactly the requested fields the cue holds, each equal to the full parse
+		bool bParsed = true;
+		bool bFound = true;
+		bool bSame = true;
+		for (uint32_t uMask = 1;uMask <= scte35::scte35Projected::all;uMask++) {
+			scte35::SSpliceProjection objResult;
+			objProjection.SetFields(uMask);
+			bParsed = bParsed && objProjection.Parse(vBytes.data(), vBytes.size(), objResult);
+			bFound = bFound && objResult.uFound == (objFull.uFound & uMask);
+			bSame = bSame && IsSameProjection(objResult, objFull, vUpid);
+		}
+		Check(bParsed, "the projection parses under every mask", sName);
+		Check(bFound, "the projection finds the requested fields the cue holds", sName);
+		Check(bSame, "the projected fields equal the full parse", sName);
+
+		//Hexa-decimal entry point, every field
+		scte35::SSpliceProjection objResult;
+		objProjection.SetFields(scte35::scte35Projected::all);
+		Check(objProjection.ParseHexa(scte35::g_SpliceCorpus[k].sHexa, objResult) && objResult.uFound == objFull.uFound && IsSameProjection(objResult, objFull, vUpid), "ParseHexa projects every field", sName);
+
+		//Truncated sections are refused
+		Check(!objProjection.Parse(vBytes.data(), vBytes.size() - 1, objResult), "a section longer than its bytes is refused", sName);
+	}
+}
+
+/*! \brief One CSpliceVisitor event recorded by CWalkRecorder.
+*/
+struct SWalkEvent {
+	char cKind;					/*!<'S' section, 'F' field, 'B' bytes, 'C' command, 'c' command end, 'L' loop, 'D' descriptor, 'd' descriptor end.*/
+	std::string sName;			/*!<Field, bytes or loop name.*/
+	uint64_t uValue;			/*!<Field value, command type, descriptor tag or loop index.*/
+	uint32_t uIdentifier;		/*!<Descriptor identifier.*/
+	std::size_t iOffset;		/*!<Bit offset of a field, byte offset of the other events.*/
+	std::size_t iLength;		/*!<Bits of a field, bytes of the other events.*/
+
+	bool operator==(const SWalkEvent& objOther) const {
+		return cKind == objOther.cKind && sName == objOther.sName && uValue == objOther.uValue && uIdentifier == objOther.uIdentifier && iOffset == objOther.iOffset && iLength == objOther.iLength;
+	}
+};
+
+/*! \brief CSpliceVisitor recording every event, skipping the command or the descriptors of a tag and stopping at an event when asked.
+*/
+class CWalkRecorder : public scte35::CSpliceVisitor {
+public:
+	scte35::scte35Visit::type OnSection(const uint8_t* pData, const std::size_t& iLength) override { (void)pData; return Record({ 'S', "", 0, 0, 0, iLength }); }
+	scte35::scte35Visit::type OnField(const char* sName, const uint64_t& uValue, const std::size_t& iBitOffset, const int& iBits) override { return Record({ 'F', sName, uValue, 0, iBitOffset, (std::size_t)iBits }); }
+	scte35::scte35Visit::type OnBytes(const char* sName, const uint8_t* pData, const std::size_t& iLength, const std::size_t& iOffset) override { (void)pData; return Record({ 'B', sName, 0, 0, iOffset, iLength }); }
+	scte35::scte35Visit::type OnCommandEnd(const uint32_t& uType) override { return Record({ 'c', "", uType, 0, 0, 0 }); }
+	scte35::scte35Visit::type OnLoop(const char* sName, const uint32_t& uIndex, const std::size_t& iOffset) override { return Record({ 'L', sName, uIndex, 0, iOffset, 0 }); }
+	scte35::scte35Visit::type OnDescriptorEnd(const uint32_t& uTag) override { return Record({ 'd', "", uTag, 0, 0, 0 }); }
+	void OnEnd(const scte35::scte35Error::type& eError) override { m_eEnd = eError; m_iEnds++; }
+
+	scte35::scte35Visit::type OnCommand(const uint32_t& uType, const std::size_t& iOffset, const std::size_t& iLength) override {
+		scte35::scte35Visit::type eVisit = Record({ 'C', "", uType, 0, iOffset, iLength });
+		return (eVisit == scte35::scte35Visit::next && m_bSkipCommand) ? scte35::scte35Visit::skip : eVisit;
+	}
+	scte35::scte35Visit::type OnDescriptor(const uint32_t& uTag, const uint32_t& uIdentifier, const std::size_t& iOffset, const std::size_t& iLength) override {
+		scte35::scte35Visit::type eVisit = Record({ 'D', "", uTag, uIdentifier, iOffset, iLength });
+		return (eVisit == scte35::scte35Visit::next && uTag == m_uSkipTag) ? scte35::scte35Visit::skip : eVisit;
+	}
+
+	std::vector<SWalkEvent> m_vEvents;								/*!<Events before OnEnd, in order.*/
+	scte35::scte35Error::type m_eEnd = scte35::scte35Error::count;	/*!<Error of the OnEnd event.*/
+	int m_iEnds = 0;												/*!<Number of OnEnd events.*/
+	bool m_bSkipCommand = false;									/*!<Whether OnCommand returns skip.*/
+	uint32_t m_uSkipTag = 0x100;									/*!<Tag of the descriptors OnDescriptor skips, none by default.*/
+	std::size_t m_iStopAt = SIZE_MAX;								/*!<Index of the event returning stop.*/
+
+private:
+	scte35::scte35Visit::type Record(const SWalkEvent& objEvent) {
+		m_vEvents.push_back(objEvent);
+		return m_vEvents.size() - 1 == m_iStopAt ? scte35::scte35Visit::stop : scte35::scte35Visit::next;
+	}
+};
+
+/*! \brief Function to read a big-endian bit field of a section.
+*/
+uint64_t GetBitsAt(const std::vector<uint8_t>& vBytes, const std::size_t& iOffset, const std::size_t& iBits) {
+	uint64_t uValue = 0;
+	for (std::size_t i = iOffset;i < iOffset + iBits;i++) {
+		uValue = (uValue << 1) | ((vBytes[i / 8] >> (7 - i % 8)) & 1);
+	}
+	return uValue;
+}
+
+/*! \brief Function to write a big-endian bit field of a section.
+*/
+void SetBitsAt(std::vector<uint8_t>& vBytes, const std::size_t& iOffset, const std::size_t& iBits, const uint64_t& uValue) {
+	for (std::size_t i = 0;i < iBits;i++) {
+		const std::size_t iBit = iOffset + i;
+		const uint8_t uMask = (uint8_t)(1 << (7 - iBit % 8));
+		vBytes[iBit / 8] = ((uValue >> (iBits - 1 - i)) & 1) ? (uint8_t)(vBytes[iBit / 8] | uMask) : (uint8_t)(vBytes[iBit / 8] & ~uMask);
+	}
+}
+
+/*! \brief Function to get the first recorded event of a kind and name.
+*	\returns the event index, the number of events if none.
+*/
+std::size_t FindEvent(const std::vector<SWalkEvent>& vEvents, const char& cKind, const char* sName = "") {
+	std::size_t i = 0;
+	while (i < vEvents.size() && (vEvents[i].cKind != cKind || vEvents[i].sName != sName)) {
+		i++;
+	}
+	return i;
+}
+
+/*! \brief Function to check the fields of a table up to its first conditional field against its names, offsets and widths.
+*	\param iFirst index of the event of the first field.
+*	\param iBase bit offset of the structure in the section.
+*/
+template <typename TLayout, std::size_t... Is>
+bool IsLayoutWalked(const std::vector<SWalkEvent>& vEvents, const std::size_t& iFirst, const std::size_t& iBase, std::index_sequence<Is...>) {
+	typedef scte35::CSpliceLayout<TLayout> CLayout;
+	if (iFirst + sizeof...(Is) > vEvents.size()) {
+		return false;
+	}
+	return ((vEvents[iFirst + Is].cKind == 'F' && vEvents[iFirst + Is].sName == CLayout::template GetName<Is>() && vEvents[iFirst + Is].iOffset == iBase + CLayout::template GetOffset<Is>() && vEvents[iFirst + Is].iLength == (std::size_t)CLayout::template GetBits<Is>()) && ...);
+}
+
+/*! \brief Function to remove the events a skip of the command or of the descriptors of a tag passes over.
+*/
+std::vector<SWalkEvent> GetSkippedEvents(const std::vector<SWalkEvent>& vEvents, const char& cStart, const char& cEnd, const uint32_t& uTag) {
+	std::vector<SWalkEvent> vSkipped;
+	bool bSkipping = false;
+	for (const SWalkEvent& objEvent : vEvents) {
+		if (objEvent.cKind == cEnd) {
+			bSkipping = false;
+		}
+		if (!bSkipping) {
+			vSkipped.push_back(objEvent);
+		}
+		if (objEvent.cKind == cStart && (cStart == 'C' || objEvent.uValue == uTag)) {
+			bSkipping = true;
+		}
+	}
+	return vSkipped;
+}
+
+/*! \brief Function to walk a section, the error and the recorded events.
+*/
+scte35::scte35Error::type GetWalkError(const std::vector<uint8_t>& vBytes, const std::size_t& iLength, CWalkRecorder& objRecorder) {
+	scte35::scte35Error::type eError = scte35::CSpliceWalker::Walk(vBytes.data(), iLength, objRecorder);
+	return (objRecorder.m_iEnds == 1 && objRecorder.m_eEnd == eError) ? eError : scte35::scte35Error::count;
+}
+
+/*! \brief Checks of CSpliceWalker: field names, offsets and widths against the layout tables, values against the bytes, skip, stop and failures.
+*/
+void CheckWalker() {
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		const char* sName = scte35::g_SpliceCorpus[k].sName;
+		std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[k]);
+		CWalkRecorder objFull;
+		Check(GetWalkError(vBytes, vBytes.size(), objFull) == scte35::scte35Error::none, "walk of a corpus cue", sName);
+		const std::vector<SWalkEvent>& vEvents = objFull.m_vEvents;
+
+		//The header fields follow SInfoHeaderLayout from table_id
+		Check(!vEvents.empty() && vEvents[0].cKind == 'S' && vEvents[0].iLength == vBytes.size(), "OnSection first with the section length", sName);
+		Check(IsLayoutWalked<scte35::SInfoHeaderLayout>(vEvents, 1, 0, std::make_index_sequence<scte35::CSpliceLayout<scte35::SInfoHeaderLayout>::iFirstConditional>()), "header fields against SInfoHeaderLayout", sName);
+
+		//Every field holds the bits at its offset and the events tile the section up to CRC_32
+		std::size_t iPos = 0;
+		std::size_t iCommandEnd = 0;
+		std::size_t iDescriptorEnd = 0;
+		bool bTiled = true;
+		bool bValues = true;
+		for (const SWalkEvent& objEvent : vEvents) {
+			switch (objEvent.cKind)
+			{
+				case 'F': {
+					bValues = bValues && objEvent.iOffset + objEvent.iLength <= vBytes.size() * 8 && GetBitsAt(vBytes, objEvent.iOffset, objEvent.iLength) == objEvent.uValue;
+					bTiled = bTiled && objEvent.iOffset == iPos;
+					iPos = objEvent.iOffset + objEvent.iLength;
+				}
+				break;
+				case 'B': {
+					bTiled = bTiled && objEvent.iOffset * 8 == iPos;
+					iPos = (objEvent.iOffset + objEvent.iLength) * 8;
+				}
+				break;
+				case 'C': {
+					bTiled = bTiled && objEvent.iOffset * 8 == iPos;
+					iCommandEnd = objEvent.iLength != 0xFFF ? (objEvent.iOffset + objEvent.iLength) * 8 : 0;
+				}
+				break;
+				case 'c': {
+					iPos = iCommandEnd != 0 ? iCommandEnd : iPos;
+				}
+				break;
+				case 'L': {
+					bTiled = bTiled && objEvent.iOffset * 8 == iPos;
+				}
+				break;
+				case 'D': {
+					bTiled = bTiled && objEvent.iOffset * 8 == iPos;
+					iDescriptorEnd = (objEvent.iOffset + objEvent.iLength) * 8;
+				}
+				break;
+				case 'd': {
+					iPos = iDescriptorEnd;
+				}
+				break;
+				default: {
+				}
+				break;
+			}
+		}
+		Check(bValues, "field values against the section bits", sName);
+		Check(bTiled && iPos == vBytes.size() * 8, "field offsets contiguous up to the end of CRC_32", sName);
+
+		//The command and the CUEI segmentation descriptors start with the fixed fields of their tables
+		const std::size_t iCommand = FindEvent(vEvents, 'C');
+		if (iCommand < vEvents.size() && vEvents[iCommand].uValue == scte35::scte35Cmd::splice_insert) {
+			Check(vEvents[iCommand].iOffset == 14 && IsLayoutWalked<scte35::SpliceInsertLayout>(vEvents, iCommand + 1, 14 * 8, std::make_index_sequence<scte35::CSpliceLayout<scte35::SpliceInsertLayout>::iFirstConditional>()), "splice_insert fields against SpliceInsertLayout", sName);
+		}
+		for (std::size_t i = 0;i < vEvents.size();i++) {
+			if (vEvents[i].cKind == 'D' && vEvents[i].uValue == scte35::scte35Desc::segmentation_descriptor && vEvents[i].uIdentifier == 0x43554549) {
+				Check(IsLayoutWalked<scte35::SegmentationDescriptorLayout>(vEvents, i + 1, vEvents[i].iOffset * 8, std::make_index_sequence<scte35::CSpliceLayout<scte35::SegmentationDescriptorLayout>::iFirstConditional>()), "segmentation_descriptor fields against SegmentationDescriptorLayout", sName);
+			}
+		}
+
+		//WalkHexa reports the same events
+		scte35::CSpliceWalker objWalker;
+		CWalkRecorder objHexa;
+		Check(objWalker.WalkHexa(scte35::g_SpliceCorpus[k].sHexa, objHexa) == scte35::scte35Error::none && objHexa.m_vEvents == vEvents, "WalkHexa events equal Walk events", sName);
+
+		//Skip on OnCommand passes over the command fields only
+		if (iCommand < vEvents.size()) {
+			CWalkRecorder objSkip;
+			objSkip.m_bSkipCommand = true;
+			Check(GetWalkError(vBytes, vBytes.size(), objSkip) == scte35::scte35Error::none && objSkip.m_vEvents == GetSkippedEvents(vEvents, 'C', 'c', 0), "skip on OnCommand", sName);
+		}
+
+		//Skip on OnDescriptor passes over the fields of the descriptors of that tag only
+		const std::size_t iDescriptor = FindEvent(vEvents, 'D');
+		if (iDescriptor < vEvents.size()) {
+			CWalkRecorder objSkip;
+			objSkip.m_uSkipTag = (uint32_t)vEvents[iDescriptor].uValue;
+			Check(GetWalkError(vBytes, vBytes.size(), objSkip) == scte35::scte35Error::none && objSkip.m_vEvents == GetSkippedEvents(vEvents, 'D', 'd', objSkip.m_uSkipTag), "skip on OnDescriptor", sName);
+		}
+
+		//Stop at any event ends the walk there without an error
+		bool bStopped = true;
+		for (std::size_t i = 0;i < vEvents.size();i++) {
+			CWalkRecorder objStop;
+			objStop.m_iStopAt = i;
+			bStopped = bStopped && GetWalkError(vBytes, vBytes.size(), objStop) == scte35::scte35Error::none && objStop.m_vEvents.size() == i + 1 && std::equal(objStop.m_vEvents.begin(), objStop.m_vEvents.end(), vEvents.begin());
+		}
+		Check(bStopped, "stop ends the walk at the stopping event", sName);
+
+		//A section longer than the bytes is truncated
+		CWalkRecorder objShort;
+		Check(GetWalkError(vBytes, vBytes.size() - 1, objShort) == scte35::scte35Error::truncated, "section cut by one byte truncated", sName);
+	}
+
+	//Input failures
+	std::vector<uint8_t> vBytes = GetBytes(scte35::g_SpliceCorpus[0]);
+	CWalkRecorder objEmpty;
+	Check(scte35::CSpliceWalker::Walk(nullptr, 0, objEmpty) == scte35::scte35Error::empty_input && objEmpty.m_eEnd == scte35::scte35Error::empty_input && objEmpty.m_vEvents.empty(), "walk of no bytes empty_input");
+	CWalkRecorder objHeader;
+	Check(GetWalkError(vBytes, 13, objHeader) == scte35::scte35Error::truncated && objHeader.m_vEvents.empty(), "walk of a cut header truncated");
+
+	const std::string sHexa = scte35::g_SpliceCorpus[0].sHexa;
+	scte35::CSpliceWalker objWalker;
+	CWalkRecorder objOdd;
+	CWalkRecorder objSpace;
+	CWalkRecorder objText;
+	Check(objWalker.WalkHexa(sHexa.substr(1), objOdd) == scte35::scte35Error::odd_length && objOdd.m_eEnd == scte35::scte35Error::odd_length, "WalkHexa of an odd length odd_length");
+	Check(objWalker.WalkHexa(sHexa.substr(0, 2) + "  " + sHexa.substr(2), objSpace) == scte35::scte35Error::white_space && objSpace.m_eEnd == scte35::scte35Error::white_space, "WalkHexa with spaces white_space");
+	Check(objWalker.WalkHexa("ZZ" + sHexa.substr(2), objText) == scte35::scte35Error::rejected && objText.m_eEnd == scte35::scte35Error::rejected, "WalkHexa of a non hexa-decimal text rejected");
+
+	//Corrupted lengths, located with the offsets of a full walk of time_signal_po_start
+	CWalkRecorder objFull;
+	GetWalkError(vBytes, vBytes.size(), objFull);
+	const std::vector<SWalkEvent>& vEvents = objFull.m_vEvents;
+	const std::size_t iCommandLength = FindEvent(vEvents, 'F', "splice_command_length");
+	const std::size_t iCommandType = FindEvent(vEvents, 'F', "splice_command_type");
+	const std::size_t iLoopLength = FindEvent(vEvents, 'F', "descriptor_loop_length");
+	const std::size_t iDescriptor = FindEvent(vEvents, 'D');
+	Check(iCommandLength < vEvents.size() && iCommandType < vEvents.size() && iLoopLength < vEvents.size() && iDescriptor < vEvents.size() && vEvents[iDescriptor].uValue == scte35::scte35Desc::segmentation_descriptor, "time_signal_po_start events");
+	if (iCommandLength >= vEvents.size() || iCommandType >= vEvents.size() || iLoopLength >= vEvents.size() || iDescriptor >= vEvents.size()) {
+		return;
+	}
+
+	std::vector<uint8_t> vCorrupt = vBytes;
+	SetBitsAt(vCorrupt, vEvents[iCommandLength].iOffset, vEvents[iCommandLength].iLength, 0xFF0);
+	CWalkRecorder objCommand;
+	Check(GetWalkError(vCorrupt, vCorrupt.size(), objCommand) == scte35::scte35Error::truncated && FindEvent(objCommand.m_vEvents, 'C') == objCommand.m_vEvents.size(), "splice_command_length beyond the section truncated");
+
+	vCorrupt = vBytes;
+	SetBitsAt(vCorrupt, vEvents[iCommandType].iOffset, vEvents[iCommandType].iLength, 0x01);
+	CWalkRecorder objType;
+	Check(GetWalkError(vCorrupt, vCorrupt.size(), objType) == scte35::scte35Error::unknown_command, "reserved splice_command_type unknown_command");
+
+	vCorrupt = vBytes;
+	SetBitsAt(vCorrupt, vEvents[iLoopLength].iOffset, vEvents[iLoopLength].iLength, vEvents[iLoopLength].uValue + 1);
+	CWalkRecorder objLoop;
+	Check(GetWalkError(vCorrupt, vCorrupt.size(), objLoop) == scte35::scte35Error::descriptor_overrun && FindEvent(objLoop.m_vEvents, 'D') == objLoop.m_vEvents.size(), "descriptor_loop_length beyond CRC_32 descriptor_overrun");
+
+	vCorrupt = vBytes;
+	vCorrupt[vEvents[iDescriptor].iOffset + 1]++;
+	CWalkRecorder objDescriptor;
+	Check(GetWalkError(vCorrupt, vCorrupt.size(), objDescriptor) == scte35::scte35Error::descriptor_overrun, "descriptor_length beyond the loop descriptor_overrun");
+
+	//A descriptor_length shorter than the segmentation fields truncates the descriptor, not the loop
+	const std::size_t iCut = vEvents[iDescriptor].iLength - 2 - 9;
+	vCorrupt = vBytes;
+	vCorrupt[vEvents[iDescriptor].iOffset + 1] = 9;
+	SetBitsAt(vCorrupt, vEvents[iLoopLength].iOffset, vEvents[iLoopLength].iLength, vEvents[iLoopLength].uValue - iCut);
+	CWalkRecorder objCut;
+	Check(GetWalkError(vCorrupt, vCorrupt.size(), objCut) == scte35::scte35Error::truncated && FindEvent(objCut.m_vEvents, 'D') < objCut.m_vEvents.size() && FindEvent(objCut.m_vEvents, 'd') == objCut.m_vEvents.size(), "segmentation_descriptor cut by descriptor_length truncated");
+}
+
+/*! \brief Application descriptor of CAbcdDecoder: the 32-bit value following identifier.
+*/
+class CAbcdDescriptor : public scte35::PrivateDescriptor {
+public:
+	uint32_t uValue = 0;		/*!<Bytes 6 to 9 of the descriptor.*/
+};
+
+/*! \brief Descriptor decoder of the checks, decoding descriptors of exactly 10 bytes and counting its calls.
+*/
+class CAbcdDecoder : public scte35::CSpliceDescriptorDecoder {
+public:
+	scte35::PrivateDescriptor* Decode(const uint8_t* pData, const std::size_t& iLength) const override {
+		m_iCalls++;
+		if (iLength != 10) {
+			return nullptr;
+		}
+		CAbcdDescriptor* pDescriptor = new CAbcdDescriptor();
+		pDescriptor->uValue = ((uint32_t)pData[6] << 24) | ((uint32_t)pData[7] << 16) | ((uint32_t)pData[8] << 8) | (uint32_t)pData[9];
+		return pDescriptor;
+	}
+	void AppendText(const scte35::PrivateDescriptor& objDescriptor, std::ostream& sOut, const std::string& sSep) const override {
+		sOut << "abcd_value=" << static_cast<const CAbcdDescriptor&>(objDescriptor).uValue << sSep;
+	}
+
+	mutable int m_iCalls = 0;		/*!<Number of Decode calls.*/
+};
+
+/*! \brief Function to check that a parsed descriptor is kept raw with its bytes.
+*	\param iOffset offset of the descriptor in the section.
+*/
+bool IsRawDescriptor(const scte35::SDBase* pDescriptor, const std::vector<uint8_t>& vBytes, const std::size_t& iOffset) {
+	if (scte35::CSpliceClass::IsBuiltInDescriptor(*pDescriptor)) {
+		return false;
+	}
+	const scte35::PrivateDescriptor* pPrivate = static_cast<const scte35::PrivateDescriptor*>(pDescriptor);
+	if (typeid(*pPrivate) != typeid(scte35::PrivateDescriptor)) {
+		return false;
+	}
+	return pPrivate->pDecoder == nullptr && pPrivate->iRawLength == (std::size_t)pPrivate->descriptor_length + 2 && iOffset + pPrivate->iRawLength <= vBytes.size() && std::equal(pPrivate->pRaw, pPrivate->pRaw + pPrivate->iRawLength, vBytes.begin() + iOffset);
+}
+
+/*! \brief Checks of CSpliceDescriptorRegistry: refused pairs, dispatch of registered pairs to their decoder and raw unregistered descriptors.
+*/
+void CheckDescriptorRegistry() {
+	const uint32_t uCUEI = 0x43554549;
+	const uint32_t uABCD = 0x41424344;
+	CAbcdDecoder objDecoder;
+	scte35::CSpliceDescriptorRegistry objRegistry;
+
+	//The "CUEI" descriptors of the parser cannot be overridden
+	for (uint32_t uTag = scte35::scte35Desc::avail_descriptor;uTag <= scte35::scte35Desc::audio_descriptor;uTag++) {
+		Check(!objRegistry.Register(uTag, uCUEI, &objDecoder), "Register of a built-in CUEI tag refused");
+	}
+	Check(!objRegistry.Register(0x100, uABCD, &objDecoder), "Register of a tag above 0xFF refused");
+	Check(!objRegistry.Register(2, uABCD, nullptr), "Register of no decoder refused");
+	Check(objRegistry.GetSize() == 0 && objRegistry.Find(0, uCUEI) == nullptr, "refused pairs not registered");
+	Check(objRegistry.Register(0x05, uCUEI, &objDecoder) && objRegistry.Find(0x05, uCUEI) == &objDecoder, "Register of a reserved CUEI tag");
+	Check(objRegistry.Unregister(0x05, uCUEI) && !objRegistry.Unregister(0x05, uCUEI) && objRegistry.Find(0x05, uCUEI) == nullptr, "Unregister removes the pair once");
+
+	//time_signal_private_descriptors : CUEI segmentation_descriptor, 0xF0 "ABCD" of 12 bytes and 0x02 "ABCD" of 10 bytes
+	const scte35::SpliceCorpusEntry& objEntry = scte35::g_SpliceCorpus[12];
+	const std::vector<uint8_t> vBytes = GetBytes(objEntry);
+	const std::size_t iPrivateF0 = 14 + 5 + 2 + 2 + 0x1C;
+	const std::size_t iPrivate02 = iPrivateF0 + 12;
+	Check(vBytes[iPrivateF0] == 0xF0 && vBytes[iPrivate02] == 0x02, "time_signal_private_descriptors layout", objEntry.sName);
+
+	//Without a decoder of the pair every private descriptor stays raw
+	scte35::CSpliceClass objCue;
+	Check(objRegistry.Register(0x02, 0x57585960, &objDecoder), "Register of a private pair");
+	objCue.SetDescriptorRegistry(&objRegistry);
+	bool bParsed = objCue.ParseHexa(objEntry.sHexa) && objCue.GetDescriptors().size() == 3;
+	Check(bParsed, "parse with a registry", objEntry.sName);
+	if (bParsed) {
+		Check(scte35::CSpliceClass::IsBuiltInDescriptor(*objCue.GetDescriptors()[0]), "CUEI descriptor built in", objEntry.sName);
+		Check(IsRawDescriptor(objCue.GetDescriptors()[1], vBytes, iPrivateF0) && IsRawDescriptor(objCue.GetDescriptors()[2], vBytes, iPrivate02), "unregistered private descriptors raw", objEntry.sName);
+		Check(objDecoder.m_iCalls == 0, "decoder of another identifier not called", objEntry.sName);
+		const std::string sText = objCue.GetText(true);
+		Check(sText.find("private_byte[1]=17, ") != std::string::npos && sText.find("abcd_value=") == std::string::npos, "raw descriptor text", objEntry.sName);
+	}
+
+	//A registered pair is decoded by its decoder and its text comes from AppendText
+	Check(objRegistry.Register(0x02, uABCD, &objDecoder) && objRegistry.GetSize() == 2, "Register of the 0x02 ABCD pair");
+	bParsed = objCue.ParseHexa(objEntry.sHexa) && objCue.GetDescriptors().size() == 3;
+	Check(bParsed, "parse with a registered pair", objEntry.sName);
+	if (bParsed) {
+		const CAbcdDescriptor* pDecoded = dynamic_cast<const CAbcdDescriptor*>(static_cast<const scte35::PrivateDescriptor*>(objCue.GetDescriptors()[2]));
+		Check(objDecoder.m_iCalls == 1, "decoder called once per descriptor", objEntry.sName);
+		Check(pDecoded != nullptr && pDecoded->pDecoder == &objDecoder && pDecoded->uValue == 0x11223344 && pDecoded->identifier == uABCD && pDecoded->pRaw != nullptr && pDecoded->iRawLength == 10, "registered descriptor decoded", objEntry.sName);
+		Check(IsRawDescriptor(objCue.GetDescriptors()[1], vBytes, iPrivateF0), "private descriptor of another tag raw", objEntry.sName);
+		const std::string sText = objCue.GetText(true);
+		Check(sText.find("identifier=1094861636, abcd_value=287454020, ") != std::string::npos && sText.find("private_byte[1]=17, ") == std::string::npos, "decoder text in GetText", objEntry.sName);
+	}
+
+	//A pair whose decoder rejects the bytes is kept raw
+	Check(objRegistry.Register(0xF0, uABCD, &objDecoder), "Register of the 0xF0 ABCD pair");
+	objDecoder.m_iCalls = 0;
+	bParsed = objCue.ParseHexa(objEntry.sHexa) && objCue.GetDescriptors().size() == 3;
+	Check(bParsed && objDecoder.m_iCalls == 2 && IsRawDescriptor(objCue.GetDescriptors()[1], vBytes, iPrivateF0) && dynamic_cast<const CAbcdDescriptor*>(static_cast<const scte35::PrivateDescriptor*>(objCue.GetDescriptors()[2])) != nullptr, "descriptor rejected by its decoder raw", objEntry.sName);
+
+	//Detached, the registered pair is raw again
+	objCue.SetDescriptorRegistry(nullptr);
+	bParsed = objCue.ParseHexa(objEntry.sHexa) && objCue.GetDescriptors().size() == 3;
+	Check(bParsed && IsRawDescriptor(objCue.GetDescriptors()[2], vBytes, iPrivate02), "descriptor raw after the registry is detached", objEntry.sName);
+}
+
+/*! \brief Function to run an archive query, the results as a vector.
+*/
+std::vector<uint64_t> GetQuery(const scte35::CSpliceArchive& objArchive, const scte35::SArchiveQuery& objQuery) {
+	std::vector<uint64_t> vSequences;
+	objArchive.Query(objQuery, vSequences);
+	return vSequences;
+}
+
+/*! \brief Checks of CSpliceArchive over rotated journals: indexing by walk against CSpliceArchive::Add, refused journals and segmentation type unions.
+*/
+void CheckArchive() {
+	const char* sPaths[] = { "SCTE35Test_archive_0.bin", "SCTE35Test_archive_1.bin", "SCTE35Test_archive_2.bin" };
+	const std::size_t iRecords = 8 * scte35::g_SpliceCorpusCount;
+	for (const char* sPath : sPaths) {
+		std::remove(sPath);
+	}
+
+	//The second journal continues the sequence numbers of the first one, the third numbers its records again
+	scte35::CSpliceArchive objAdded;
+	scte35::CSpliceJournalWriter objWriter;
+	scte35::CSpliceClass objCue;
+	Check(objWriter.Open(sPaths[0]), "archive journal created");
+	for (std::size_t i = 0;i < iRecords;i++) {
+		const scte35::SpliceCorpusEntry& objEntry = scte35::g_SpliceCorpus[i % scte35::g_SpliceCorpusCount];
+		const std::vector<uint8_t> vBytes = GetBytes(objEntry);
+		const bool bParsed = objCue.ParseHexa(objEntry.sHexa);
+		if (i == iRecords / 2) {
+			Check(objWriter.Close() && objWriter.Open(sPaths[1], objWriter.GetNextSequence()), "archive journal rotated");
+		}
+		Check(objWriter.Append(i % 5, 1000 + i, vBytes.data(), vBytes.size(), bParsed ? &objCue : nullptr), "archive journal Append");
+		Check(objAdded.Add(i, i % 5, 1000 + i, bParsed ? &objCue : nullptr), "archive Add");
+	}
+	Check(objWriter.Close() && objWriter.Open(sPaths[2]), "archive journal numbering again");
+	const std::vector<uint8_t> vFirst = GetBytes(scte35::g_SpliceCorpus[0]);
+	Check(objWriter.Append(0, 1000 + iRecords, vFirst.data(), vFirst.size(), nullptr) && objWriter.Close(), "archive journal numbering again Append");
+
+	scte35::CSpliceJournalReader objReaders[3];
+	for (std::size_t i = 0;i < 3;i++) {
+		Check(objReaders[i].Open(sPaths[i]), "archive journal opened", sPaths[i]);
+	}
+	Check(objReaders[1].GetFirstSequence() == iRecords / 2 && objReaders[2].GetFirstSequence() == 0, "archive journal first sequence numbers");
+	scte35::CSpliceArchive objIndexed;
+	std::size_t iIndexed = 0;
+	Check(objIndexed.IndexJournal(objReaders[0], iIndexed) && iIndexed == iRecords / 2, "archive first journal indexed");
+	Check(objIndexed.IndexJournal(objReaders[1], iIndexed) && iIndexed == iRecords - iRecords / 2, "archive rotated journal indexed");
+	Check(objIndexed.IndexJournal(objReaders[0], iIndexed) && iIndexed == 0, "archive journal indexed again adds nothing");
+	Check(!objIndexed.IndexJournal(objReaders[2], iIndexed) && iIndexed == 0 && objIndexed.GetRecordCount() == iRecords, "archive refuses a journal numbering its records again");
+	scte35::CSpliceArchive objGap;
+	Check(objGap.IndexJournal(objReaders[1], iIndexed) && !objGap.IndexJournal(objReaders[0], iIndexed) && !objGap.IndexJournal(objReaders[2], iIndexed), "archive refuses a journal before its records");
+	scte35::CSpliceArchive objAfterGap;
+	Check(objAfterGap.Add(0, 0, 0, nullptr) && !objAfterGap.IndexJournal(objReaders[1], iIndexed) && objAfterGap.GetRecordCount() == 1, "archive refuses a journal after a gap");
+	Check(objIndexed.GetPostingCount() == objAdded.GetPostingCount(), "archive walk posts what Add posts");
+
+	//Every single condition gives the same records whether indexed by walk or by Add
+	scte35::SArchiveQuery objQuery;
+	for (uint32_t uType = 0;uType < 256;uType++) {
+		objQuery.vSegmentationTypes.assign(1, uType);
+		Check(GetQuery(objIndexed, objQuery) == GetQuery(objAdded, objQuery), "archive segmentation type query");
+	}
+	objQuery = scte35::SArchiveQuery();
+	objQuery.bChannel = true;
+	for (objQuery.uChannel = 0;objQuery.uChannel < 5;objQuery.uChannel++) {
+		Check(GetQuery(objIndexed, objQuery) == GetQuery(objAdded, objQuery) && !GetQuery(objIndexed, objQuery).empty(), "archive channel query");
+	}
+
+	//Several segmentation types are any of them, with and without other conditions, a limit or a receive range
+	std::vector<uint32_t> vTypes;
+	for (uint32_t uType = 0;uType < 256;uType++) {
+		objQuery = scte35::SArchiveQuery();
+		objQuery.vSegmentationTypes.assign(1, uType);
+		if (!GetQuery(objIndexed, objQuery).empty()) {
+			vTypes.push_back(uType);
+		}
+	}
+	Check(vTypes.size() >= 3, "archive corpus holds several segmentation types");
+	for (std::size_t iChannel = 0;iChannel < 6;iChannel++) {
+		objQuery = scte35::SArchiveQuery();
+		objQuery.bChannel = iChannel < 5;
+		objQuery.uChannel = iChannel;
+		objQuery.bReceiveTime = iChannel == 2;
+		objQuery.uReceiveBegin = 1000 + iRecords / 4;
+		objQuery.uReceiveEnd = 1000 + iRecords / 2 + 7;
+		std::vector<uint64_t> vExpected;
+		for (uint32_t uType : vTypes) {
+			scte35::SArchiveQuery objSingle = objQuery;
+			objSingle.vSegmentationTypes.assign(1, uType);
+			const std::vector<uint64_t> vSingle = GetQuery(objIndexed, objSingle);
+			vExpected.insert(vExpected.end(), vSingle.begin(), vSingle.end());
+		}
+		std::sort(vExpected.begin(), vExpected.end());
+		vExpected.erase(std::unique(vExpected.begin(), vExpected.end()), vExpected.end());
+		objQuery.vSegmentationTypes = vTypes;
+		objQuery.vSegmentationTypes.push_back(vTypes[0]);
+		objQuery.vSegmentationTypes.push_back(0xFFFF);
+		Check(GetQuery(objIndexed, objQuery) == vExpected && GetQuery(objAdded, objQuery) == vExpected, "archive segmentation types are a union");
+		objQuery.iLimit = 3;
+		vExpected.resize(std::min(vExpected.size(), (std::size_t)3));
+		Check(GetQuery(objIndexed, objQuery) == vExpected, "archive segmentation types union with a limit");
+	}
+
+	for (std::size_t i = 0;i < 3;i++) {
+		objReaders[i].Close();
+		std::remove(sPaths[i]);
+	}
+}
+
+/*! \brief Function to check that the rows of a child table belonging to a parent row hold that parent row and the expected values of one column.
+*/
+void CheckChildRows(const scte35::CSpliceColumnarReader& objReader, const scte35::scte35ColumnTable::type& eTable, const char* sParentColumn, const char* sColumn,
+	const uint64_t& uParentRow, const std::vector<uint64_t>& vExpected, const char* sCue) {
+	std::vector<uint64_t> vParents;
+	std::vector<uint64_t> vValues;
+	uint64_t uFirst = 0;
+	uint64_t uCount = 0;
+	Check(objReader.GetChildRows(eTable, uParentRow, uFirst, uCount) && uCount == vExpected.size(), sColumn, sCue);
+	Check(objReader.Decode(sParentColumn, vParents) && objReader.Decode(sColumn, vValues), sColumn, sCue);
+	for (uint64_t i = 0;i < uCount && uFirst + i < vValues.size() && i < vExpected.size();i++) {
+		Check(vParents[(std::size_t)(uFirst + i)] == uParentRow && vValues[(std::size_t)(uFirst + i)] == vExpected[(std::size_t)i], sColumn, sCue);
+	}
+}
+
+/*! \brief Checks of the columnar child tables of descriptors and component loops, and of their 64-bit offsets, against the parsed corpus.
+*/
+void CheckColumnar() {
+	const char* sPath = "SCTE35Test_columnar.bin";
+	scte35::CSpliceColumnarWriter objWriter;
+	std::vector<std::size_t> vAdded;
+	for (std::size_t k = 0;k < scte35::g_SpliceCorpusCount;k++) {
+		scte35::CSpliceClass objCue;
+		objCue.ParseHexa(scte35::g_SpliceCorpus[k].sHexa);
+		if (objWriter.Add(objCue, k, k)) {
+			vAdded.push_back(k);
+		}
+	}
+	Check(objWriter.Write(sPath), "columnar Write");
+
+	scte35::CSpliceColumnarReader objReader;
+	Check(objReader.Open(sPath) && objReader.GetRows(scte35::scte35ColumnTable::cue) == vAdded.size(), "columnar file reads back every cue");
+	const char* sWide[] = { "schedule_offsets", "segmentation_offsets", "avail_offsets", "insert_component_offsets", "segmentation.component_offsets",
+		"audio.component_offsets", "upid.offsets", "schedule.cue_row", "segmentation.cue_row", "audio_component.audio_row" };
+	for (const char* sName : sWide) {
+		const scte35::SColumnInfo* pColumn = objReader.FindColumn(sName);
+		Check(pColumn != nullptr && pColumn->iWidth == 8, "columnar offsets and parent rows are 64-bit", sName);
+	}
+	uint64_t uFirst = 0;
+	uint64_t uCount = 0;
+	Check(!objReader.GetChildRows(scte35::scte35ColumnTable::cue, 0, uFirst, uCount) && !objReader.GetChildRows(scte35::scte35ColumnTable::avail, vAdded.size(), uFirst, uCount), "columnar GetChildRows rejects the cue table and rows past the end");
+
+	uint64_t uSegmentationRow = 0;
+	uint64_t uAudioRow = 0;
+	std::vector<std::vector<uint8_t>> vUpids;
+	for (std::size_t r = 0;r < vAdded.size();r++) {
+		const char* sCue = scte35::g_SpliceCorpus[vAdded[r]].sName;
+		scte35::CSpliceClass objCue;
+		objCue.ParseHexa(scte35::g_SpliceCorpus[vAdded[r]].sHexa);
+
+		std::vector<uint64_t> vAvails;
+		std::vector<uint64_t> vDtmfs;
+		std::vector<uint64_t> vTimes;
+		std::vector<uint64_t> vAudios;
+		std::vector<uint64_t> vSegmentations;
+		for (const scte35::SDBase* pDescriptor : objCue.GetDescriptors()) {
+			if (!scte35::CSpliceClass::IsBuiltInDescriptor(*pDescriptor)) {
+				continue;
+			}
+			if (pDescriptor->splice_descriptor_tag == scte35::scte35Desc::avail_descriptor) {
+				vAvails.push_back(static_cast<const scte35::AvailDescriptor*>(pDescriptor)->provider_avail_id);
+			}
+			else if (pDescriptor->splice_descriptor_tag == scte35::scte35Desc::dtmf_descriptor) {
+				uint64_t uChars = 0;
+				const std::vector<uint32_t>& vChars = static_cast<const scte35::DTMFDescriptor*>(pDescriptor)->v_DTMF_Char;
+				for (std::size_t i = vChars.size();i > 0;i--) {
+					uChars = (uChars << 8) | (uint8_t)vChars[i - 1];
+				}
+				vDtmfs.push_back(uChars);
+			}
+			else if (pDescriptor->splice_descriptor_tag == scte35::scte35Desc::time_descriptor) {
+				vTimes.push_back(static_cast<const scte35::TimeDescriptor*>(pDescriptor)->TAI_seconds);
+			}
+			else if (pDescriptor->splice_descriptor_tag == scte35::scte35Desc::audio_descriptor) {
+				const scte35::AudioDescriptor& objAudio = *static_cast<const scte35::AudioDescriptor*>(pDescriptor);
+				vAudios.push_back(objAudio.audio_count);
+				std::vector<uint64_t> vCodes;
+				for (const scte35::AudioDescComponent& objComponent : objAudio.v_audio_comp_list) {
+					vCodes.push_back(objComponent.ISO_code);
+				}
+				CheckChildRows(objReader, scte35::scte35ColumnTable::audio_component, "audio_component.audio_row", "audio_component.ISO_code", uAudioRow++, vCodes, sCue);
+			}
+			else if (pDescriptor->splice_descriptor_tag == scte35::scte35Desc::segmentation_descriptor) {
+				const scte35::SegmentationDescriptor& objSegmentation = *static_cast<const scte35::SegmentationDescriptor*>(pDescriptor);
+				vSegmentations.push_back(objSegmentation.segmentation_type_id);
+				vUpids.emplace_back(objSegmentation.v_upid_list.begin(), objSegmentation.v_upid_list.end());
+				std::vector<uint64_t> vOffsets;
+				for (const scte35::SegDescComponent& objComponent : objSegmentation.v_ChildComps) {
+					vOffsets.push_back(objComponent.pts_offset);
+				}
+				CheckChildRows(objReader, scte35::scte35ColumnTable::segmentation_component, "segmentation_component.segmentation_row", "segmentation_component.pts_offset", uSegmentationRow++, vOffsets, sCue);
+			}
+		}
+		CheckChildRows(objReader, scte35::scte35ColumnTable::avail, "avail.cue_row", "avail.provider_avail_id", r, vAvails, sCue);
+		CheckChildRows(objReader, scte35::scte35ColumnTable::dtmf, "dtmf.cue_row", "dtmf.DTMF_char", r, vDtmfs, sCue);
+		CheckChildRows(objReader, scte35::scte35ColumnTable::time, "time.cue_row", "time.TAI_seconds", r, vTimes, sCue);
+		CheckChildRows(objReader, scte35::scte35ColumnTable::audio, "audio.cue_row", "audio.audio_count", r, vAudios, sCue);
+		CheckChildRows(objReader, scte35::scte35ColumnTable::segmentation, "segmentation.cue_row", "segmentation.segmentation_type_id", r, vSegmentations, sCue);
+
+		const scte35::SpliceInsertData& objInsert = objCue.GetSpliceInsert();
+		std::vector<uint64_t> vTags;
+		if (objCue.GetSInfoData().splice_command_type == scte35::scte35Cmd::splice_insert && objInsert.program_splice_flag == 0) {
+			for (const scte35::SInComponent& objComponent : objInsert.v_ChildComps) {
+				vTags.push_back(objComponent.component_tag);
+			}
+		}
+		CheckChildRows(objReader, scte35::scte35ColumnTable::insert_component, "insert_component.cue_row", "insert_component.component_tag", r, vTags, sCue);
+	}
+
+	//Every segmentation row finds its UPID bytes in the dictionary, stored one byte per value
+	const scte35::SColumnInfo* pUpidBytes = objReader.FindColumn("upid.bytes");
+	Check(pUpidBytes != nullptr && pUpidBytes->iWidth == 1, "columnar UPID bytes are 8-bit");
+	std::vector<uint64_t> vUpidIndexes;
+	Check(objReader.Decode("segmentation.segmentation_upid", vUpidIndexes) && vUpidIndexes.size() == vUpids.size(), "columnar segmentation_upid rows");
+	for (std::size_t i = 0;i < vUpidIndexes.size() && i < vUpids.size();i++) {
+		const uint8_t* pUpid = nullptr;
+		std::size_t iUpidLength = 0;
+		Check(objReader.GetUpid((uint32_t)vUpidIndexes[i], pUpid, iUpidLength) && iUpidLength == vUpids[i].size() && std::equal(vUpids[i].begin(), vUpids[i].end(), pUpid), "columnar GetUpid returns the segmentation_upid bytes");
+	}
+	objReader.Close();
+	std::remove(sPath);
+}
+
+}
+
+/*!	\brief Function main of the check program, returns 0 if every check passed.
+*/
+int main() {
+	CheckCRC();
+	CheckLayouts();
+	CheckBitKernels();
+	CheckMetrics();
+#ifdef SCTE35_ENABLE_PROFILING
+	CheckProfiler();
+#endif
+	CheckScheduler();
+	CheckScheduleIndex();
+	CheckSegmentationTracker();
+	CheckCache();
+	CheckTimeline();
+	CheckProjection();
+	CheckWalker();
+	CheckDescriptorRegistry();
+	CheckHexaInputs();
+	CheckJournal();
+	CheckArchive();
+	CheckCApi();
+	CheckUpids();
+	CheckValidator();
+	CheckFingerprint();
+	CheckEngine();
+	CheckQueues();
+	CheckPipeline();
+	CheckColumnar();
+
+	if (g_iFailures != 0) {
+		std::printf("%d check(s) failed\n", g_iFailures);
+		return 1;
+	}
+	std::printf("All checks passed\n");
+	return 0;
+}